@@ -6,34 +6,43 @@ layout(location = 1) in vec3 l_color;
 layout(location = 2) in vec3 l_normal;
 layout(location = 3) in vec2 l_uv;
 
-uniform mat4 u_proj;
-uniform mat4 u_model;
-uniform mat4 u_shadow;
-uniform mat3 u_inv_model;
+layout(std140) uniform CameraBlock {
+    mat4 u_proj;
+    vec3 u_eye;
+    vec3 u_angle;
+};
+
+layout(std140) uniform ObjectBlock {
+    mat4 u_model;
+    mat3 u_inv_model;
+    vec3 m_ambient;
+    vec3 m_diffuse;
+    vec3 m_specular;
+};
+
+layout(std140) uniform LightBlock {
+    int  u_light_count;
+    vec3 u_light_position[50];
+    vec3 u_light_direction[50];
+    vec4 u_light_attenuation[50];
+    vec3 u_light_color[50];
+};
+
+layout(std140) uniform FogBlock {
+    int   u_fog_count;
+    vec3  u_fogStartColor[4];
+    vec3  u_fogEndColor[4];
+    float u_fogStart[4];
+    float u_fogEnd[4];
+    float u_fogDensity[4];
+    float u_fogCutoffHeight[4];
+};
 
-uniform vec3 u_eye;
-uniform vec3 u_angle;
+uniform mat4 u_shadow;
 
 varying vec2 v_coord;
 varying vec3 v_color;
 
-uniform vec3 m_ambient;
-uniform vec3 m_diffuse;
-uniform vec3 m_specular;
-
-uniform int u_light_count;
-uniform vec3 u_light_position[50];
-uniform vec3 u_light_direction[50];
-uniform vec4 u_light_attenuation[50];
-uniform vec3 u_light_color[50];
-
-uniform int u_fog_count;
-uniform vec3 u_fogStartColor[8];
-uniform vec3 u_fogEndColor[8];
-uniform float u_fogStart[8];
-uniform float u_fogEnd[8];
-uniform float u_fogDensity[8];
-uniform float u_fogCutoffHeight[8];
 varying float v_fogFactor[8];
 
 void main() {
@@ -89,9 +98,16 @@ varying vec2 v_coord;
 varying float v_fogFactor[8];
 
 uniform sampler2D u_sampler;
-uniform int u_fog_count;
-uniform vec3 u_fogStartColor[8];
-uniform vec3 u_fogEndColor[8];
+
+layout(std140) uniform FogBlock {
+    int   u_fog_count;
+    vec3  u_fogStartColor[4];
+    vec3  u_fogEndColor[4];
+    float u_fogStart[4];
+    float u_fogEnd[4];
+    float u_fogDensity[4];
+    float u_fogCutoffHeight[4];
+};
 
 out vec4 color;
 
@@ -0,0 +1,127 @@
+[begin] vertex
+#version 330 core
+
+layout(location = 0) in vec3 l_position;
+layout(location = 1) in vec3 l_color;
+layout(location = 2) in vec3 l_normal;
+layout(location = 3) in vec2 l_uv;
+
+// Per instance attributes
+layout(location = 4) in mat4 l_model;
+layout(location = 8) in vec4 l_diffuse;
+layout(location = 9) in vec4 l_ambient;
+
+layout(std140) uniform CameraBlock {
+    mat4 u_proj;
+    vec3 u_eye;
+    vec3 u_angle;
+};
+
+layout(std140) uniform LightBlock {
+    int  u_light_count;
+    vec3 u_light_position[50];
+    vec3 u_light_direction[50];
+    vec4 u_light_attenuation[50];
+    vec3 u_light_color[50];
+};
+
+layout(std140) uniform FogBlock {
+    int   u_fog_count;
+    vec3  u_fogStartColor[4];
+    vec3  u_fogEndColor[4];
+    float u_fogStart[4];
+    float u_fogEnd[4];
+    float u_fogDensity[4];
+    float u_fogCutoffHeight[4];
+};
+
+varying vec2 v_coord;
+varying vec3 v_color;
+
+uniform vec3 m_specular;
+
+varying float v_fogFactor[8];
+
+void main() {
+    vec4 vertPos = l_model * vec4(l_position, 1.0);
+    vec3 norm = normalize(transpose(inverse(mat3(l_model))) * l_normal);
+    vec3 lightColor = l_ambient.rgb;
+
+    for (int i = 0; i < u_light_count; i++) {
+        float intensity = u_light_attenuation[i].r;
+        float range = u_light_attenuation[i].g;
+        float attenuation = u_light_attenuation[i].b;
+        float type = u_light_attenuation[i].a;
+
+        if (type < 1.0) {
+            float dist = length(u_light_position[i] - vec3(vertPos));
+            if (dist > range) continue;
+
+            vec3 lightDir = normalize(u_light_position[i] - vec3(vertPos));
+            float diff = max(dot(norm, lightDir), 0.0);
+            vec3 viewDir = normalize(u_eye - vec3(vertPos));
+            vec3 reflectDir = reflect(-lightDir, norm);
+            float spec = pow(max(dot(viewDir, reflectDir), 0.0), 1.0);
+            vec3 specular = u_light_color[i] * (spec * m_specular);
+
+            lightColor += ((diff * u_light_color[i]) * intensity) / (1.0 + (dist * attenuation)) + specular;
+        } else if (type < 2.0) {
+            vec3 lightDir = normalize(-u_light_direction[i]);
+            float diff = max(dot(norm, lightDir), 0.0);
+            lightColor += (diff * u_light_color[i]) * intensity;
+        }
+    }
+
+    v_color = l_diffuse.rgb * l_color * lightColor;
+    v_coord = l_uv;
+
+    // Compute fog factors for each fog layer
+    for (int i = 0; i < u_fog_count; i++) {
+        float fogDistance = length(vertPos.xyz - u_eye);
+        float fogRange = u_fogEnd[i] - u_fogStart[i];
+        float fogFactor = clamp((fogDistance - u_fogStart[i]) / fogRange, 0.0, 1.0);
+        v_fogFactor[i] = vertPos.y < u_fogCutoffHeight[i] ? exp(-u_fogDensity[i] * fogFactor) : -1.0;
+    }
+
+    gl_Position = u_proj * vertPos;
+}
+[end]
+
+[begin] fragment
+#version 330 core
+
+varying vec3 v_color;
+varying vec2 v_coord;
+varying float v_fogFactor[8];
+
+uniform sampler2D u_sampler;
+
+layout(std140) uniform FogBlock {
+    int   u_fog_count;
+    vec3  u_fogStartColor[4];
+    vec3  u_fogEndColor[4];
+    float u_fogStart[4];
+    float u_fogEnd[4];
+    float u_fogDensity[4];
+    float u_fogCutoffHeight[4];
+};
+
+out vec4 color;
+
+void main() {
+    float Gamma = 2.2;
+
+    // Original color
+    vec3 originalColor = pow(v_color.rgb, vec3(1.0 / Gamma));
+
+    vec3 finalColor = originalColor;
+
+    // Compute final fog color for each fog layer
+    for (int i = 0; i < u_fog_count; i++) {
+        vec3 fogColor = mix(u_fogStartColor[i], u_fogEndColor[i], v_fogFactor[i]);
+        finalColor = (v_fogFactor[i] >= 0.0) ? mix(fogColor, finalColor, v_fogFactor[i]) : finalColor;
+    }
+
+    color = vec4(finalColor, 1.0);
+}
+[end]
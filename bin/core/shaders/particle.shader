@@ -0,0 +1,57 @@
+[begin] vertex
+
+#version 330 core
+
+layout(location = 0) in vec3 l_position;
+layout(location = 1) in vec3 l_color;
+layout(location = 2) in vec3 l_normal;
+layout(location = 3) in vec2 l_uv;
+
+// Per particle attributes
+layout(location = 4) in vec3 l_offset;
+layout(location = 5) in vec3 l_scale;
+layout(location = 6) in vec3 l_tint;
+
+layout(std140) uniform CameraBlock {
+    mat4 u_proj;
+    vec3 u_eye;
+    vec3 u_angle;
+};
+
+varying vec3 v_color;
+
+void main() {
+    
+    vec4 vertPos = vec4(l_position * l_scale + l_offset, 1);
+    
+    v_color = l_tint;
+    
+    gl_Position = u_proj * vertPos;
+    
+    return;
+};
+
+[end]
+
+
+
+[begin] fragment
+
+#version 330 core
+
+varying vec3 v_color;
+
+out vec4 color;
+
+void main() {
+    
+    float Gamma = 2.2;
+    
+    vec4 vColor = vec4(v_color, 1);
+    
+    color = vec4( pow(vColor.rgb, vec3(1.0/Gamma)), 1);
+    
+    return;
+}
+
+[end]
@@ -7,20 +7,30 @@ layout(location = 1) in vec3 l_color;
 layout(location = 2) in vec3 l_normal;
 layout(location = 3) in vec2 l_uv;
 
-uniform mat4 u_proj;
-uniform mat4 u_model;
-uniform vec3 u_eye;
+layout(std140) uniform CameraBlock {
+    mat4 u_proj;
+    vec3 u_eye;
+    vec3 u_angle;
+};
 
-varying vec2 v_coord;
-varying vec3 v_color;
+layout(std140) uniform ObjectBlock {
+    mat4 u_model;
+    mat3 u_inv_model;
+    vec3 m_ambient;
+    vec3 m_diffuse;
+    vec3 m_specular;
+};
 
-uniform vec3 m_ambient;
-uniform vec3 m_diffuse;
+layout(std140) uniform LightBlock {
+    int  u_light_count;
+    vec3 u_light_position[50];
+    vec3 u_light_direction[50];
+    vec4 u_light_attenuation[50];
+    vec3 u_light_color[50];
+};
 
-uniform int   u_light_count;
-uniform vec3  u_light_position[120];
-uniform vec3  u_light_attenuation[120];
-uniform vec3  u_light_color[120];
+varying vec2 v_coord;
+varying vec3 v_color;
 
 void main() 
 {
@@ -29,7 +39,7 @@ void main()
   float diff = 1.0;
         
   vec3 finalColor = m_ambient;
-  for (int i=0; i<=u_light_count; i++) {
+  for (int i=0; i<u_light_count; i++) {
     
     float intensity    = u_light_attenuation[i].r;
     float range        = u_light_attenuation[i].g;
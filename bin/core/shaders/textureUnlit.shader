@@ -7,27 +7,33 @@ layout(location = 1) in vec3 l_color;
 layout(location = 2) in vec3 l_normal;
 layout(location = 3) in vec2 l_uv;
 
-uniform mat4 u_proj;
-uniform mat4 u_model;
-uniform mat4 u_shadow;
-uniform mat3 u_inv_model;
+layout(std140) uniform CameraBlock {
+    mat4 u_proj;
+    vec3 u_eye;
+    vec3 u_angle;
+};
+
+layout(std140) uniform ObjectBlock {
+    mat4 u_model;
+    mat3 u_inv_model;
+    vec3 m_ambient;
+    vec3 m_diffuse;
+    vec3 m_specular;
+};
+
+layout(std140) uniform LightBlock {
+    int  u_light_count;
+    vec3 u_light_position[50];
+    vec3 u_light_direction[50];
+    vec4 u_light_attenuation[50];
+    vec3 u_light_color[50];
+};
 
-uniform vec3 u_eye;
-uniform vec3 u_angle;
+uniform mat4 u_shadow;
 
 varying vec2 v_coord;
 varying vec3 v_color;
 
-uniform vec3 m_ambient;
-uniform vec3 m_diffuse;
-uniform vec3 m_specular;
-
-uniform int   u_light_count;
-uniform vec3  u_light_position[100];
-uniform vec3  u_light_direction[100];
-uniform vec4  u_light_attenuation[100];
-uniform vec3  u_light_color[100];
-
 void main() {
     
     vec4 vertPos = u_model * vec4(l_position, 1);
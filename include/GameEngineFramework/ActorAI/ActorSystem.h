@@ -5,6 +5,7 @@
 
 #include <GameEngineFramework/ActorAI/ActorStates.h>
 #include <GameEngineFramework/ActorAI/GeneticPresets.h>
+#include <GameEngineFramework/ActorAI/SpatialGrid.h>
 
 #include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
 
@@ -12,8 +13,14 @@
 
 #include <GameEngineFramework/ActorAI/components/actor.h>
 
+#include <GameEngineFramework/Math/Random.h>
+
+#include <GameEngineFramework/Jobs/JobSystem.h>
+
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <chrono>
 
 
@@ -26,7 +33,7 @@ public:
     /// Create an actor and return its pointer.
     Actor* CreateActor(void);
     
-    /// Destroy an actor.
+    /// Destroy an actor. Actors destroyed while the AI thread is running are released at the next frame boundary.
     bool DestroyActor(Actor* actorPtr);
     
     
@@ -44,9 +51,25 @@ public:
     Actor* GetActor(unsigned int index);
     
     
-    /// Signal to the AI thread to update the simulation.
+    /// Append the active actors within a radius of a point. Grid positions are taken
+    /// at the last state exchange. Actors created, placed or activated since then are
+    /// checked at their current position. Actors moved by physics may lag by the
+    /// distance covered since the exchange, so callers needing exact positions should
+    /// check them again. Returns the number of actors found.
+    unsigned int GetActorsInRadius(glm::vec3 position, float radius, std::vector<Actor*>& results);
+    
+    /// Append the active actors inside a bounding box, following the same rules as GetActorsInRadius.
+    unsigned int GetActorsInBounds(glm::vec3 min, glm::vec3 max, std::vector<Actor*>& results);
+    
+    
+    /// Signal to the AI thread to update the simulation. Once the previous
+    /// update has finished the actor states are exchanged between the threads
+    /// and the next update is started, otherwise the call returns immediately.
     void UpdateSendSignal(void);
     
+    /// Check if the AI thread is still running an update.
+    bool IsUpdatePending(void);
+    
     
     /// Set the update distance from the camera position.
     void SetActorUpdateDistance(float distance);
@@ -59,6 +82,19 @@ public:
     float GetWaterLevel(void);
     
     
+    /// Set the number of threads running the actor simulation, including the
+    /// AI thread. Zero uses one thread per hardware thread.
+    void SetNumberOfThreads(unsigned int numberOfThreads);
+    
+    /// Get the number of threads running the actor simulation.
+    unsigned int GetNumberOfThreads(void);
+    
+    /// Seed the random streams used by the simulation. Initiate picks a seed from
+    /// the engine generator. Equal seeds give equal simulations regardless of
+    /// the number of threads.
+    void SetSeed(int seed);
+    
+    
     // Called internally
     
     /// Initiate the actor AI system.
@@ -67,7 +103,7 @@ public:
     /// Shutdown the actor AI system.
     void Shutdown(void);
     
-    /// Update the actors in the simulation.
+    /// Run one update cycle over the actors in the simulation.
     void Update();
     
     /// Genetic entity definitions.
@@ -75,16 +111,81 @@ public:
     
 private:
     
+    friend class Actor;
+    
+    // Actors waiting for the batched network pass
+    struct NeuralBatchEntry {
+        
+        uint64_t fingerprint;
+        
+        unsigned int numberOfInputs;
+        
+        Actor* actor;
+        
+        bool operator< (const NeuralBatchEntry& entry) const {
+            if (fingerprint != entry.fingerprint) 
+                return fingerprint < entry.fingerprint;
+            return numberOfInputs < entry.numberOfInputs;
+        }
+        
+    };
+    
+    // AI thread entry point
+    void ThreadMain(void);
+    
+    // Exchange the shared actor states while the AI thread is parked
+    void ExchangeActorStates(void);
+    void ExchangeActorState(Actor* actor);
+    
+    // Release an actor back to the pool
+    bool ReleaseActor(Actor* actor);
+    
+    // Track an actor placed or activated on the main thread until the next exchange
+    void MarkPending(Actor* actor);
+    
+    // Merge the pending actors into a query and drop the inactive results
+    template<typename Contains> unsigned int FinishQuery(std::vector<Actor*>& results, unsigned int begin, Contains contains);
+    
+    // Update a range of actors on a worker thread
+    void UpdateActorRange(unsigned int begin, unsigned int end, unsigned int cycleSeed);
+    
     // Behavioral state update
-    void UpdateActorState(Actor* actor);
+    void UpdateActorState(Actor* actor, RandomStream& random, std::vector<NeuralBatchEntry>& neuralBatch, std::vector<Actor*>& nearbyActors);
     
-    bool HandleWalkingChance(Actor* actor);
-    void HandleStopWalkingChance(Actor* actor);
-    void HandleMovementCooldown(Actor* actor, bool isAquatic);
+    bool HandleWalkingChance(Actor* actor, RandomStream& random);
+    void HandleStopWalkingChance(Actor* actor, RandomStream& random);
+    void HandleMovementCooldown(Actor* actor, RandomStream& random, bool isAquatic);
     void HandleObservationCooldown(Actor* actor);
-    void HandleFocusOnNearbyActor(Actor* actor);
+    void HandleFocusOnNearbyActor(Actor* actor, RandomStream& random, std::vector<Actor*>& nearbyActors);
     bool HandleBreedingState(Actor* actor);
-    void HandleNeuralNetwork(Actor* actor);
+    void HandleNearbyPrey(Actor* actor, std::vector<Actor*>& nearbyActors);
+    void HandleNearbyThreats(Actor* actor, std::vector<Actor*>& nearbyActors);
+    void HandleNeuralNetwork(Actor* actor, std::vector<NeuralBatchEntry>& neuralBatch);
+    
+    // Run the queued actor networks in batches of matching networks
+    void ProcessNeuralBatches(void);
+    void ProcessNeuralRun(unsigned int index);
+    
+    std::vector<NeuralBatchEntry> mNeuralBatch;
+    
+    // Actors queued by each range, merged in actor order after the update
+    std::vector< std::vector<NeuralBatchEntry> > mRangeBatches;
+    
+    // Slice of the sorted batch run through one network
+    struct NeuralBatchRun {
+        
+        unsigned int begin;
+        unsigned int end;
+        
+        unsigned int inputOffset;
+        unsigned int outputOffset;
+        
+    };
+    
+    std::vector<NeuralBatchRun> mNeuralRuns;
+    
+    std::vector<float> mNeuralBatchInputs;
+    std::vector<float> mNeuralBatchOutputs;
     
     // Current position of the player in the world
     glm::vec3 mPlayerPosition;
@@ -95,11 +196,45 @@ private:
     // Maximum world water level
     float mWorldWaterLevel;
     
+    // Copies of the system state as seen by the AI thread
+    glm::vec3 mSimulationPlayerPosition;
+    float mSimulationUpdateDistance;
+    float mSimulationWaterLevel;
+    
+    // Actors taking part in the current update cycle
+    std::vector<Actor*> mSimulationActors;
+    
+    // Actors destroyed while the AI thread was running
+    std::vector<Actor*> mDestroyQueue;
+    
+    // Active actor positions, only changed while the AI thread is parked
+    SpatialGrid mGrid;
+    
+    // Actors the grid does not hold at their current position
+    std::vector<Actor*> mPendingActors;
+    
+    // Random stream owned by the AI thread, seeds the per range streams
+    RandomStream mRandom;
+    
+    // Workers sharing the actor update with the AI thread
+    JobSystem mWorkers;
+    unsigned int mNumberOfThreads;
+    
     
     // Threading
     std::thread* mActorSystemThread;
     std::mutex   mux;
     
+    // AI thread wake up
+    std::mutex mSignalMux;
+    std::condition_variable mSignal;
+    bool mIsThreadActive;
+    bool mIsUpdatePending;
+    
+    // Number of update cycles finished by the AI thread and requested by the main thread
+    std::atomic<unsigned int> mEpoch;
+    unsigned int mRequestedEpoch;
+    
     // Object pools
     PoolAllocator<Actor> mActors;
     
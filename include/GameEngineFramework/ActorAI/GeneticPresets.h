@@ -3,6 +3,9 @@
 
 #include <GameEngineFramework/ActorAI/components/actor.h>
 
+/// Binary genome format version.
+#define GENOME_VERSION  1
+
 
 class ENGINE_API GeneticPresets {
     
@@ -11,8 +14,17 @@ public:
     /// Extract the genome from the entity and return it as a string.
     std::string ExtractGenome(Actor* actorSource);
     
-    /// Inject a genome string into an actor.
-    bool InjectGenome(Actor* actorSource, std::string genome);
+    /// Inject a genome into an actor. Accepts both the binary and the text format.
+    bool InjectGenome(Actor* actorSource, const std::string& genome);
+    
+    /// Encode the genome of an actor into the binary format.
+    void EncodeGenome(Actor* actorSource, std::string& genome);
+    
+    /// Decode a binary genome into an actor. Returns false if the data is malformed.
+    bool DecodeGenome(Actor* actorSource, const std::string& genome);
+    
+    /// Check if a genome is in the binary format.
+    bool IsBinaryGenome(const std::string& genome);
     
     
     /// Blend two genomes together creating a sub variant of the original pair.
@@ -6,6 +6,8 @@
 #include <cmath>
 #include <algorithm>
 #include <cstdlib>
+#include <cstdint>
+#include <new>
 
 
 #include <GameEngineFramework/configuration.h>
@@ -26,16 +28,65 @@ struct ENGINE_API DataSet {
 };
 
 
+/// Binary neural state format version.
+#define NEURAL_STATE_VERSION  1
+
+/// Number of floats neural buffers are padded and aligned to.
+#define NEURAL_LANE_WIDTH  8
+
+
+/// Allocate aligned storage for neural buffers. Every call is counted so
+/// tests can check that a code path runs without touching the heap.
+ENGINE_API void* NeuralAllocate(std::size_t size, std::size_t alignment);
+
+/// Release storage returned by NeuralAllocate.
+ENGINE_API void NeuralFree(void* block);
+
+/// Number of neural buffer allocations made since startup.
+ENGINE_API unsigned long long int NeuralGetAllocationCount(void);
+
+
+/// Allocator returning storage aligned for SIMD loads.
+template<typename T, std::size_t Alignment> struct AlignedAllocator {
+    
+    typedef T value_type;
+    
+    template<typename U> struct rebind {typedef AlignedAllocator<U, Alignment> other;};
+    
+    AlignedAllocator() {}
+    template<typename U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+    
+    T* allocate(std::size_t count) {
+        return (T*)NeuralAllocate(count * sizeof(T), Alignment);
+    }
+    
+    void deallocate(T* pointer, std::size_t) {
+        NeuralFree(pointer);
+    }
+    
+    template<typename U> bool operator== (const AlignedAllocator<U, Alignment>&) const {return true;}
+    template<typename U> bool operator!= (const AlignedAllocator<U, Alignment>&) const {return false;}
+    
+};
+
+typedef std::vector<float, AlignedAllocator<float, NEURAL_LANE_WIDTH * sizeof(float)>> NeuralBuffer;
+
+
 struct ENGINE_API NeuralLayer {
     
     unsigned int numberOfInputs;
     unsigned int numberOfNeurons;
     
-    std::vector<float> neurons;
+    /// Number of floats between the start of each weight row.
+    unsigned int weightStride;
     
-    std::vector<std::vector<float>> weights;
+    /// Neuron outputs padded with zeros to the network layer width.
+    NeuralBuffer neurons;
     
-    std::vector<float> biases;
+    /// Row major weight matrix with one row of inputs per neuron.
+    NeuralBuffer weights;
+    
+    NeuralBuffer biases;
     
 };
 
@@ -47,13 +98,32 @@ public:
     /// Feed a dataset through the network.
     void FeedForward(const std::vector<float>& input);
     
+    /// Feed a dataset through the network writing the results into the output buffer.
+    /// The output buffer should hold GetNumberOfOutputs() values or be null.
+    void FeedForward(const float* input, unsigned int numberOfInputs, float* output);
+    
+    /// Feed a batch of datasets through the network one layer at a time. The inputs hold one
+    /// row of numberOfInputs values per dataset and the outputs one row of GetNumberOfOutputs() values.
+    void FeedForwardBatch(const float* inputs, unsigned int numberOfInputs, float* outputs, unsigned int batchSize);
+    
     /// Get the output state of the network after a dataset
     /// has been fed through the network.
     std::vector<float> GetResults(void);
     
+    /// Get the number of values in the output layer.
+    unsigned int GetNumberOfOutputs(void);
+    
     /// Get the number of layers in the neural network.
     unsigned int GetNumberOfLayers(void);
     
+    /// Get a hash of the topology, weights and biases. Networks with
+    /// the same fingerprint give the same results.
+    uint64_t GetFingerprint(void);
+    
+    /// Get the number of elements reserved across the layers, batch buffers
+    /// and training scratch. This only changes when a buffer reallocates.
+    std::size_t GetBufferCapacity(void);
+    
     /// Add a neural layer to the network. The number of inputs should match
     /// the previous layer`s neuron count.
     void AddNeuralLayer(int numberOfNeurons, int numberOfInputs);
@@ -64,12 +134,24 @@ public:
     /// Modify the weights to fit a given training set of data.
     void Train(TrainingSet& trainingSet, float learningRate);
     
+    /// Modify the weights by the gradient averaged over a batch of training sets.
+    void TrainBatch(const TrainingSet* trainingSets, unsigned int numberOfSets, float learningRate);
+    
     /// Save the neural state of the network.
     std::vector<std::string> SaveState(void);
     
     /// Load a neural state into the network.
     void LoadState(std::vector<std::string>& state);
     
+    /// Save the neural state of the network in the binary format.
+    void SaveStateBinary(std::string& state);
+    
+    /// Load a binary neural state into the network. Returns false if the data is malformed.
+    bool LoadStateBinary(const std::string& state);
+    
+    /// Check if a neural state is in the binary format.
+    bool IsBinaryState(const std::string& state);
+    
     
     NeuralNetwork();
     
@@ -78,11 +160,40 @@ private:
     // Neural layers
     std::vector<NeuralLayer> mTopology;
     
-    // Calculate the error rate
-    std::vector<std::vector<float>> CalculateDeltas(const std::vector<float>& target);
+    // Padded width of the neuron buffers across all layers
+    unsigned int mLayerWidth;
+    
+    // Number of values last fed into the input layer
+    unsigned int mNumberOfInputs;
+    
+    // Batch neuron buffers holding one padded row per dataset
+    NeuralBuffer mBatchInput;
+    NeuralBuffer mBatchOutput;
+    
+    // Training scratch holding one padded row of deltas per layer, and
+    // gradients laid out the same as the layer biases and weights
+    NeuralBuffer mDeltas;
+    NeuralBuffer mBiasGradients;
+    NeuralBuffer mWeightGradients;
+    
+    // Cached parameter hash
+    uint64_t mFingerprint;
+    bool mIsFingerprintValid;
+    
+    // Number of active values in a layer
+    unsigned int GetLayerSize(unsigned int index);
+    
+    // Resize the neuron buffers to fit the widest layer
+    void UpdateLayerWidth(void);
+    
+    // Size the training scratch to the topology
+    void UpdateTrainingBuffers(void);
+    
+    // Calculate the error rate and add the resulting gradients to the scratch
+    void CalculateDeltas(const float* input, unsigned int numberOfInputs, const float* target, unsigned int numberOfTargets);
     
-    // Update the weights by a given rate of learning
-    void UpdateWeights(const std::vector<float>& input, const std::vector<std::vector<float>>& deltas, float learningRate);
+    // Apply the summed gradients scaled by a given rate of learning
+    void UpdateWeights(float learningRate);
     
     // Back propagation training activation function
     float ActivationFunctionDerivative(float value);
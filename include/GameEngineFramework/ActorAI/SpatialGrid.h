@@ -0,0 +1,122 @@
+#ifndef _ACTOR_SPATIAL_GRID__
+#define _ACTOR_SPATIAL_GRID__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <cstdint>
+
+class Actor;
+
+/// Returned for actors which are not in the grid.
+#define  SPATIAL_GRID_NONE  0xffffffff
+
+
+/// Uniform hash grid of actor positions on the xz plane. Cells are found
+/// through an open addressing hash table so the world has no fixed bounds.
+/// Actors keep a handle to their entry and only change cells when they
+/// cross a cell border.
+class ENGINE_API SpatialGrid {
+
+public:
+    
+    SpatialGrid();
+    
+    /// Set the width of a grid cell. Clears the grid.
+    void SetCellSize(float size);
+    
+    /// Get the width of a grid cell.
+    float GetCellSize(void);
+    
+    /// Add an actor at a position and return its handle.
+    unsigned int Insert(Actor* actor, const glm::vec3& position);
+    
+    /// Move an actor to a new position.
+    void Update(unsigned int handle, const glm::vec3& position);
+    
+    /// Remove an actor from the grid.
+    void Remove(unsigned int handle);
+    
+    /// Remove every actor from the grid.
+    void Clear(void);
+    
+    /// Get the number of actors in the grid.
+    unsigned int GetNumberOfActors(void);
+    
+    /// Append the actors within a radius of a point. Returns the number of actors found.
+    unsigned int QueryRadius(const glm::vec3& center, float radius, std::vector<Actor*>& results);
+    
+    /// Append the actors inside a bounding box. Returns the number of actors found.
+    unsigned int QueryBounds(const glm::vec3& min, const glm::vec3& max, std::vector<Actor*>& results);
+    
+private:
+    
+    struct Entry {
+        
+        Actor* actor;
+        
+        glm::vec3 position;
+        
+        // Cell holding the entry and the index within that cell,
+        // or the next free handle while unused
+        unsigned int cell;
+        unsigned int index;
+        
+    };
+    
+    struct Cell {
+        
+        int x;
+        int z;
+        
+        std::vector<unsigned int> handles;
+        
+    };
+    
+    struct Slot {
+        
+        int x;
+        int z;
+        
+        unsigned int cell;
+        
+    };
+    
+    int GetCellCoordinate(float value);
+    
+    unsigned int Hash(int x, int z);
+    
+    // Return the table slot holding the cell, or the empty slot where it belongs
+    unsigned int Probe(int x, int z);
+    
+    // Return the cell index at the coordinates, or SPATIAL_GRID_NONE
+    unsigned int FindCell(int x, int z);
+    
+    // Return the cell index at the coordinates, creating the cell if needed
+    unsigned int GetCell(int x, int z);
+    
+    void Grow(void);
+    
+    void AddToCell(unsigned int handle, unsigned int cell);
+    void RemoveFromCell(unsigned int handle);
+    
+    float mCellSize;
+    float mInverseCellSize;
+    
+    std::vector<Entry> mEntries;
+    
+    unsigned int mFreeHead;
+    unsigned int mCount;
+    
+    // Cells stay allocated once created so their handle lists are reused
+    std::vector<Cell> mCells;
+    
+    std::vector<Slot> mTable;
+    
+    unsigned int mMask;
+    
+};
+
+#endif
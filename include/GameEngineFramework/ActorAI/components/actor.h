@@ -16,6 +16,34 @@
 
 #include <string>
 
+class ActorSystem;
+
+
+/// Actor state shared by the AI thread and the main thread. The AI thread
+/// works on its own copy which is exchanged with the main thread copy at the
+/// frame boundary, so neither thread locks the other out while it runs.
+struct ENGINE_API ActorState {
+    
+    glm::vec3 position;
+    
+    glm::vec3 targetPoint;
+    
+    unsigned long int age;
+    
+    float distance;
+    
+    bool isActive;
+    
+    bool isWalking;
+    
+    bool isRunning;
+    
+    std::string name;
+    
+    ActorState();
+    
+};
+
 
 class ENGINE_API Actor {
     
@@ -210,6 +238,22 @@ public:
     /// Check if a memory exists in this actor.
     bool CheckMemoryExists(std::string memory);
     
+    // Prey
+    
+    /// Add the name of an actor this actor will hunt when nearby.
+    void AddAttackActor(std::string name);
+    
+    /// Clear the names of the actors this actor will hunt.
+    void ClearAttackActors(void);
+    
+    // Predators
+    
+    /// Add the name of an actor this actor will run from when nearby.
+    void AddFleeFromActor(std::string name);
+    
+    /// Clear the names of the actors this actor will run from.
+    void ClearFleeFromActors(void);
+    
     // Age scaling
     
     /// Set the initial scale for the actor.
@@ -234,7 +278,7 @@ public:
     
 private:
     
-    // Encode the actor state dataset and send it through the network.
+    // Encode the actor state dataset into the network input values.
     void EncodeInputLayer(void);
     
     // Decode the actor state dataset and apply the changes to the actor.
@@ -371,6 +415,10 @@ private:
     // Local actor neural network
     NeuralNetwork mNeuralNetwork;
     
+    // Network input and output values reused every tick
+    std::vector<float> mNeuralInputs;
+    std::vector<float> mNeuralOutputs;
+    
     // User bit mask byte
     uint8_t mBitmask;
     
@@ -399,6 +447,22 @@ private:
     // List of animation states for each genetic component
     std::vector<glm::vec4> mAnimationStates;
     
+    // Shared state as seen by the AI thread
+    ActorState mSimulation;
+    
+    // Shared state as of the last exchange
+    ActorState mExchanged;
+    
+    // Handle into the actor system proximity grid
+    unsigned int mGridHandle;
+    
+    // System owning this actor, told when the actor moves or wakes
+    // up between exchanges so its proximity queries stay current
+    ActorSystem* mSystem;
+    
+    // Is this actor on the system pending list
+    bool mIsPending;
+    
     std::mutex mux;
     
 };
@@ -33,6 +33,8 @@
 
 #include <GameEngineFramework/Networking/NetworkSystem.h>
 
+#include <GameEngineFramework/Jobs/JobSystem.h>
+
 #include <GameEngineFramework/Engine/EngineSystems.h>
 
 #define  CONSOLE_NUMBER_OF_ELEMENTS   32
@@ -47,9 +49,6 @@
 typedef void(*ButtonCallBack)(Button*);
 
 
-#define COMPONENT_STREAM_BUFFER_SIZE   1024 * 64
-
-
 class ENGINE_API EngineSystemManager {
     
 public:
@@ -222,6 +221,18 @@ public:
     /// reduce the mesh by one half of the original size.
     void AddHeightFieldToMeshHalfSize(Mesh* mesh, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height, float offsetX, float offsetZ);
     
+    /// Append the height field quads to a vertex and index buffer. The buffers are sized once up front 
+    /// and no engine state is touched, so this is safe on worker threads.
+    void AddHeightFieldToBuffer(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height, float offsetX, float offsetZ, unsigned int subTessX=1, unsigned int subTessZ=1);
+    
+    /// Append the half size height field quads to a vertex and index buffer.
+    void AddHeightFieldToBufferHalfSize(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height, float offsetX, float offsetZ);
+    
+    /// Append the height field as an indexed grid sharing one vertex per height field point. Uses 
+    /// about a quarter of the vertices of the quad layout with smooth normals and per point colors.
+    /// Fields smaller than two by two points are ignored.
+    void AddHeightFieldToBufferShared(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height, float offsetX, float offsetZ);
+    
     /// Apply the height field values to the mesh using a quality resolution value.
     void AddHeightFieldToMeshReduced(Mesh* mesh, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height, float offsetX, float offsetZ, unsigned int resolution);
     
@@ -334,6 +345,19 @@ public:
     void UpdatePhysicsDebugRenderer(void);
     
     
+    /// Number of entries and time spent in a component system during the last update.
+    struct ComponentStreamProfile {
+        
+        unsigned int count;
+        
+        double milliseconds;
+        
+    };
+    
+    /// Return the stream profile of a component system from the last update.
+    ComponentStreamProfile GetComponentStreamProfile(ComponentType type);
+    
+    
 private:
     
     // Create a component object with initial type information and return its pointer.
@@ -394,6 +418,9 @@ private:
     
     // Batch update engine components
     void UpdateTransformationChains(void);
+    
+    // Transform cache update pass counter
+    unsigned int mTransformPass;
     void UpdateUI(void);
     
     // Console
@@ -413,6 +440,7 @@ private:
     void UpdateActorGenetics(unsigned int index);
     void UpdateActorAnimation(unsigned int index);
     void UpdateActorPhysics(unsigned int index);
+    void QueryActorGround(void);
     
     // Actor genetics update
     void ClearOldGeneticRenderers(unsigned int index);
@@ -452,6 +480,8 @@ private:
         Shader*  textureUnlit = nullptr;
         Shader*  color = nullptr;
         Shader*  colorUnlit = nullptr;
+        Shader*  colorInstanced = nullptr;
+        Shader*  particle = nullptr;
         Shader*  UI = nullptr;
         Shader*  shadowCaster = nullptr;
         Shader*  sky = nullptr;
@@ -490,27 +520,94 @@ private:
     
     void UpdateComponentStream(void);
     
-    unsigned int mDataStreamIndex;
     unsigned int mObjectIndex;
-    unsigned int mStreamSize;
     
-    struct ComponentDataStreamBuffer {
-        // Base object
+    // Dense list of one component type. Entries are written in object order
+    // and the list size is closed off each time the object index wraps.
+    template<typename T> struct ComponentStream {
+        
+        std::vector<T> buffer;
+        
+        unsigned int size;
+        unsigned int index;
+        
+        double milliseconds;
+        
+        ComponentStream() : size(0), index(0), milliseconds(0) {}
+        
+        T& operator[] (unsigned int const i) {return buffer[i];}
+        
+        void Push(const T& entry) {
+            if (index < buffer.size()) {buffer[index] = entry;} else {buffer.push_back(entry);}
+            index++;
+            if (size < index) size = index;
+        }
+        
+        void Close(void) {
+            size  = index;
+            index = 0;
+        }
+        
+    };
+    
+    // Stream entries hold only the components read by each system
+    struct RigidBodyStream {
+        Transform*     transform;
+        RigidBody*     rigidBody;
+    };
+    
+    struct MeshRendererStream {
+        Transform*     transform;
+        MeshRenderer*  meshRenderer;
+    };
+    
+    struct CameraStream {
+        Transform*     transform;
+        Camera*        camera;
+        Panel*         panel;
+    };
+    
+    struct ActorStream {
         GameObject*    gameObject;
-        // Components
         Transform*     transform;
-        // Rendering
-        Light*         light;
         Actor*         actor;
-        Camera*        camera;
         RigidBody*     rigidBody;
+    };
+    
+    struct LightStream {
+        Transform*     transform;
+        Light*         light;
+    };
+    
+    struct TextStream {
+        GameObject*    gameObject;
+        Transform*     transform;
         MeshRenderer*  meshRenderer;
-        // UI
         Text*          text;
+    };
+    
+    struct PanelStream {
+        Transform*     transform;
         Panel*         panel;
     };
     
-    ComponentDataStreamBuffer mStreamBuffer[ COMPONENT_STREAM_BUFFER_SIZE ];
+    ComponentStream<Transform*>          mTransformStream;
+    ComponentStream<RigidBodyStream>     mRigidBodyStream;
+    ComponentStream<MeshRendererStream>  mMeshRendererStream;
+    ComponentStream<CameraStream>        mCameraStream;
+    ComponentStream<ActorStream>         mActorStream;
+    ComponentStream<LightStream>         mLightStream;
+    ComponentStream<TextStream>          mTextStream;
+    ComponentStream<PanelStream>         mPanelStream;
+    
+    // Ground below each actor and below its target point, queried as one batch per frame
+    std::vector<glm::vec3> mActorGroundQueries;
+    std::vector<Hit>       mActorGroundHits;
+    std::vector<uint8_t>   mActorGroundIsHit;
+    
+    // Actor body parts drawn as one instanced batch
+    InstanceBatch* mActorBatch;
+    Material*      mActorBatchMaterial;
     
     // Debug rendering
     bool usePhysicsDebugRenderer;
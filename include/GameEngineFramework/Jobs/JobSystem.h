@@ -0,0 +1,125 @@
+#ifndef _JOB_SYSTEM__
+#define _JOB_SYSTEM__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <functional>
+#include <vector>
+#include <deque>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+/// Counts the jobs that are still running. Jobs submitted against a
+/// counter release it when they finish.
+class ENGINE_API JobCounter {
+
+public:
+    
+    JobCounter();
+    
+    /// Check if every job attached to this counter has finished.
+    bool IsComplete(void);
+    
+    /// Get the number of jobs that have not finished.
+    unsigned int GetCount(void);
+    
+private:
+    
+    friend class JobSystem;
+    
+    std::atomic<unsigned int> mCount;
+    
+};
+
+
+class ENGINE_API JobSystem {
+
+public:
+    
+    JobSystem();
+    
+    /// Submit a job to the worker pool. The counter is optional and will be
+    /// released when the job has finished.
+    void Submit(std::function<void()> job, JobCounter* counter = nullptr);
+    
+    /// Submit a job that will not start until the dependency counter is complete.
+    void Submit(std::function<void()> job, JobCounter* counter, JobCounter* dependency);
+    
+    /// Block until the counter is complete. The calling thread will run
+    /// queued jobs while it waits.
+    void Wait(JobCounter* counter);
+    
+    /// Split the range zero to count into batches and run the function over each
+    /// batch as a job. Returns after every batch has finished.
+    void ParallelFor(unsigned int count, unsigned int batchSize, std::function<void(unsigned int begin, unsigned int end)> function);
+    
+    /// Get the number of worker threads in the pool.
+    unsigned int GetNumberOfWorkers(void);
+    
+    
+    // Called internally
+    
+    /// Start the worker pool. Zero workers will use one worker per hardware
+    /// thread, less one for the main thread.
+    void Initiate(unsigned int numberOfWorkers = JOB_SYSTEM_NUMBER_OF_WORKERS);
+    
+    /// Finish any queued jobs and stop the worker pool.
+    void Shutdown(void);
+    
+private:
+    
+    struct JobEntry {
+        
+        std::function<void()> function;
+        
+        JobCounter* counter;
+        JobCounter* dependency;
+        
+    };
+    
+    // Each thread pushes and pops from the back of its own queue.
+    // Idle threads steal from the front of the other queues.
+    struct JobQueue {
+        
+        std::mutex mux;
+        
+        std::deque<JobEntry> jobs;
+        
+    };
+    
+    void WorkerMain(unsigned int queueIndex);
+    
+    void PushJob(JobEntry& entry);
+    bool PopJob(JobEntry& entry);
+    
+    void RunJob(JobEntry& entry);
+    
+    // Move jobs whose dependencies have completed onto the queues
+    void ReleaseDeferred(void);
+    
+    // Queue index of the calling thread in this pool
+    unsigned int GetQueueIndex(void);
+    
+    // Queue zero is shared by threads outside the pool
+    std::vector<JobQueue*> mQueues;
+    
+    // Jobs waiting on a dependency. These are not counted as queued.
+    std::mutex mDeferredMux;
+    std::vector<JobEntry> mDeferredJobs;
+    
+    std::vector<std::thread*> mWorkers;
+    
+    std::atomic<unsigned int> mNumberOfQueuedJobs;
+    std::atomic<bool> mIsActive;
+    
+    // Idle worker wake up
+    std::mutex mWakeMux;
+    std::condition_variable mWakeCondition;
+    
+};
+
+#endif
@@ -3,6 +3,59 @@
 
 #include <GameEngineFramework/configuration.h>
 
+#include <cstdint>
+
+/// Evaluate perlin noise for a batch of coordinates. Safe to call from any thread.
+ENGINE_API void PerlinNoiseBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count, int seed);
+
+
+/// Seedable random number stream. Each stream holds its own state, so 
+/// streams can be created per chunk or per thread.
+class ENGINE_API RandomStream {
+
+public:
+    
+    RandomStream();
+    RandomStream(int seed);
+    
+    /// Reset the stream from a seed value.
+    void SetSeed(int value);
+    
+    /// Get the seed the stream was started from.
+    int GetSeed(void);
+    
+    /// Return the next raw 32 bit value.
+    uint32_t Next(void);
+    
+    /// Return a float between the min and max values.
+    float Range(float min, float max);
+    
+    /// Return a double between the min and max values.
+    double Range(double min, double max);
+    
+    /// Return an integer between the min and max values.
+    int Range(int min, int max);
+    
+    /// Return a perlin noise value seeded from the stream seed.
+    float Perlin(float xcoord, float ycoord, float zcoord);
+    
+    /// Fill the output with perlin noise values for each set of input coordinates.
+    void PerlinBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count);
+    
+    /// Fill a buffer with raw 32 bit values.
+    void Fill(uint32_t* buffer, unsigned int count);
+    
+    /// Fill a buffer with floats uniformly distributed from min up to max.
+    void Fill(float* buffer, unsigned int count, float min, float max);
+    
+private:
+    
+    int mSeed;
+    
+    uint32_t mState[4];
+};
+
+
 class ENGINE_API NumberGeneration {
     
 public:
@@ -27,9 +80,15 @@ public:
     /// Return a perlin noise value based on the input coordinates.
     float Perlin(float xcoord, float ycoord, float zcoord, int seed);
     
+    /// Fill the output with perlin noise values for each set of input coordinates. Matches 
+    /// Perlin() exactly and uses SSE2 lanes when available.
+    void PerlinBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count, int seed);
+    
 private:
     
     int mSeed;
+    
+    RandomStream mStream;
 };
 
 #endif
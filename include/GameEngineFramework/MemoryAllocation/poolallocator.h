@@ -9,7 +9,11 @@
 #include <GameEngineFramework/configuration.h>
 
 #include <cstdlib>
+#include <cstdint>
+#include <new>
 #include <vector>
+#include <algorithm>
+#include <type_traits>
 
 //
 // Configuration
@@ -34,6 +38,15 @@
  #include <string>
 #endif
 
+// Handle layout - lower bits address the slot, upper bits hold the slot generation
+#define  POOL_HANDLE_INDEX_BITS       24
+#define  POOL_HANDLE_INDEX_MASK       0x00ffffff
+#define  POOL_HANDLE_GENERATION_MASK  0xff
+
+// Marks the end of the free list and slots which are not in the active list
+#define  POOL_SLOT_NONE               0xffffffff
+
+
 struct ENGINE_API CustomAllocator {
     
     /** Initial number of pools.*/
@@ -44,11 +57,61 @@ struct ENGINE_API CustomAllocator {
     
 };
 
+
+/** Compact 32 bit reference to a pool object. The handle stores the slot index
+ * and the generation of the slot at the time the handle was taken. Resolving a
+ * handle after its object was destroyed will return a null pointer.*/
+struct ENGINE_API PoolHandle {
+    
+    unsigned int value;
+    
+    PoolHandle() : value(POOL_SLOT_NONE) {}
+    
+    unsigned int GetIndex(void)      const {return value & POOL_HANDLE_INDEX_MASK;}
+    unsigned int GetGeneration(void) const {return (value >> POOL_HANDLE_INDEX_BITS) & POOL_HANDLE_GENERATION_MASK;}
+    
+    bool IsNull(void) const {return value == POOL_SLOT_NONE;}
+    
+    bool operator== (const PoolHandle& rhs) const {return value == rhs.value;}
+    bool operator!= (const PoolHandle& rhs) const {return value != rhs.value;}
+    
+};
+
+
 template<typename T> class ENGINE_API PoolAllocator {
     
-    std::vector< std::pair<T*, std::vector<bool>> > m_pool;
+    // Object storage followed by the fixed slot index of the object. While a
+    // slot is free its storage holds the index of the next free slot.
+    struct Node {
+        
+        typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+        
+        unsigned int slot;
+        
+    };
+    
+    // Pool base addresses kept sorted by address, paired with the pool index
+    struct PoolBase {
+        
+        uintptr_t address;
+        
+        unsigned int index;
+        
+        bool operator< (const PoolBase& rhs) const {return address < rhs.address;}
+        
+    };
+    
+    std::vector< Node* > m_pool;
+    std::vector< PoolBase > m_poolBase;
     std::vector< T* > m_activeList;
     
+    // Per slot state
+    std::vector< unsigned int >  m_activeIndex;
+    std::vector< unsigned char > m_generation;
+    
+    unsigned int m_freeHead;
+    unsigned int m_freeCount;
+    
     int m_poolSz;
     int m_poolCount;
     
@@ -59,70 +122,126 @@ template<typename T> class ENGINE_API PoolAllocator {
         
     }
     
-    std::pair<T*, std::vector<bool>> allocate(void) {
+    Node& node(unsigned int slot) {return m_pool[slot / m_poolSz][slot % m_poolSz];}
+    
+    unsigned int& nextFree(Node& nodeRef) {return *reinterpret_cast<unsigned int*>(&nodeRef.storage);}
+    
+    Node* allocate(void) {
         
-        // Allocate a pool and a state list pair
-        T*    poolPtr = (T*)   malloc(m_poolSz * sizeof(T));
-        std::vector<bool> boolList;
+        // Allocate a pool of nodes
+        Node* poolPtr = (Node*) malloc(m_poolSz * sizeof(Node));
         
         // Check the pool allocation
-        if (poolPtr == nullptr) return std::make_pair(nullptr, boolList);
+        if (poolPtr == nullptr) return nullptr;
+        
+        unsigned int slotBegin = m_pool.size() * m_poolSz;
+        
+        m_pool.push_back( poolPtr );
+        
+        PoolBase base;
+        base.address = reinterpret_cast<uintptr_t>(poolPtr);
+        base.index   = m_pool.size() - 1;
         
-        // Initiate all objects as inactive
-        boolList.resize(m_poolSz);
-        for (int i=0; i < m_poolSz; i++) boolList.push_back(false);
+        m_poolBase.insert( std::upper_bound(m_poolBase.begin(), m_poolBase.end(), base), base );
         
-        // Add the pair to the list
-        std::pair<T*, std::vector<bool>> poolPair = std::make_pair(poolPtr, boolList);
-        m_pool.push_back( poolPair );
+        m_activeIndex.resize(slotBegin + m_poolSz, POOL_SLOT_NONE);
+        m_generation.resize(slotBegin + m_poolSz, 0);
         
-        m_poolCount++;
+        // Link the new slots in front of the free list in ascending order
+        for (int i=0; i < m_poolSz; i++) {
+            
+            poolPtr[i].slot = slotBegin + i;
+            
+            nextFree(poolPtr[i]) = (i < m_poolSz - 1) ? (slotBegin + i + 1) : m_freeHead;
+            
+        }
+        
+        m_freeHead = slotBegin;
+        m_freeCount += m_poolSz;
         
-        return poolPair;
+        return poolPtr;
     }
     
-    void deallocate(void) {
+    // Returns the slot of an object pointer or POOL_SLOT_NONE if the pointer
+    // does not reference an active object in this allocator. The owning pool
+    // is found by a binary search over the sorted pool addresses, so no memory
+    // behind the pointer is read before it is known to belong to a pool.
+    unsigned int findSlot(T* objectPtr) {
+        
+        if (objectPtr == nullptr)
+            return POOL_SLOT_NONE;
         
-        // Deallocate the last pool pair
-        std::pair<T*, std::vector<bool>>& lastPoolPair = *m_pool.end();
-        std::free(lastPoolPair.first);
+        PoolBase key;
+        key.address = reinterpret_cast<uintptr_t>(objectPtr);
+        key.index   = 0;
         
-        // Remove the pair from the list
-        m_pool.erase( m_pool.end() );
+        // Last pool starting at or before the address
+        typename std::vector< PoolBase >::iterator it = std::upper_bound(m_poolBase.begin(), m_poolBase.end(), key);
         
-        m_poolCount--;
+        if (it == m_poolBase.begin())
+            return POOL_SLOT_NONE;
+        
+        --it;
+        
+        uintptr_t offset = key.address - it->address;
+        
+        if (offset >= m_poolSz * sizeof(Node))
+            return POOL_SLOT_NONE;
+        
+        // Must point at the start of a node
+        if (offset % sizeof(Node) != 0)
+            return POOL_SLOT_NONE;
+        
+        unsigned int slot = it->index * m_poolSz + offset / sizeof(Node);
+        
+        if (m_activeIndex[slot] == POOL_SLOT_NONE)
+            return POOL_SLOT_NONE;
+        
+        return slot;
     }
     
+    void initiate(int poolSize) {
+        
+        m_poolSz     = (poolSize < 1) ? 1 : poolSize;
+        m_poolCount  = 0;
+        m_freeHead   = POOL_SLOT_NONE;
+        m_freeCount  = 0;
+        
+        return;
+    }
+
 public:
     
     T* operator[] (unsigned int const i) {return m_activeList[i];}
     
     PoolAllocator() {
         
-        m_poolSz           = 1024;
-        m_poolCount        = 1;
+        initiate(1024);
         
         this ->allocate();
+        m_poolCount = 1;
         return;
     }
     PoolAllocator(CustomAllocator customAllocator) {
         
-        m_poolSz           = customAllocator.poolSize;
-        m_poolCount        = 0;
+        initiate(customAllocator.poolSize);
         
         if (customAllocator.poolCount < 1) {customAllocator.poolCount=1;}
         
-        for (int i=0; i < customAllocator.poolCount; i++) 
+        for (int i=0; i < customAllocator.poolCount; i++)
             this ->allocate();
+        
+        m_poolCount = customAllocator.poolCount;
         return;
     }
     PoolAllocator(unsigned int poolSize, unsigned int poolCount) {
         
-        m_poolSz           = poolSize;
-        m_poolCount        = poolCount;
+        initiate(poolSize);
         
-        for (int i=0; i < poolCount; i++) 
+        for (unsigned int i=0; i < poolCount; i++)
             this ->allocate();
+        
+        m_poolCount = poolCount;
         return;
     }
     ~PoolAllocator() {
@@ -135,75 +254,38 @@ public:
     /** Reserves an object and returns its pointer.*/
     T* Create(void) {
         
-        T* objectPtr = nullptr;
-        
-        // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
+        // All pools are full, allocate a new pool
+        if (m_freeHead == POOL_SLOT_NONE) {
             
-            // Get the next pool and free list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool>& boolPtr = m_pool[i].second;
-            
-            // Iterate the pool objects
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                // Check if the object is available
-                if (!boolPtr[f]) {
-                    
-#ifdef ENABLE_CONSOLE_DEBUG__
-    #ifdef ENABLE_DEBUG_ON_CONSTRUCT__
-                    
-                    std::cout << "  Constructed :: " << &poolPtr[f] << "   Pool * " << &poolPtr[0] << "\n";
-                    
-    #endif
-#endif
-                    
-                    // Call the constructor
-                    T& objectRef = poolPtr[f];
-                    construct(objectRef);
-                    
-                    // Mark the object as active
-                    boolPtr[f] = true;
-                    
-                    m_activeList.push_back(&poolPtr[f]);
-                    
-                    return &poolPtr[f];
-                }
-                
-            }
+            if (this ->allocate() == nullptr)
+                return nullptr;
             
+            m_poolCount++;
         }
         
-        // All pools are full, allocate a new pool
-        if (objectPtr == nullptr) {
-            
-            this ->allocate();
-            
-            std::pair<T*, std::vector<bool>>& poolPair = m_pool[m_pool.size()-1];
-            
-            T& poolPtr = *poolPair.first;
-            std::vector<bool>& boolPtr = poolPair.second;
-            
+        // Pop the next free slot
+        unsigned int slot = m_freeHead;
+        Node& nodeRef = node(slot);
+        
+        m_freeHead = nextFree(nodeRef);
+        m_freeCount--;
+        
+        T* objectPtr = reinterpret_cast<T*>(&nodeRef.storage);
+
 #ifdef ENABLE_CONSOLE_DEBUG__
     #ifdef ENABLE_DEBUG_ON_CONSTRUCT__
-            
-            std::cout << "  Constructed :: " << &poolPtr << "   Pool * " << &poolPtr << "\n";
-            
+        
+        std::cout << "  Constructed :: " << objectPtr << "   Pool * " << m_pool[slot / m_poolSz] << "\n";
+    
     #endif
 #endif
-            
-            // Call the constructor
-            new (&poolPtr) T();
-            
-            // Mark the first object as active
-            boolPtr[0] = true;
-            
-            m_activeList.push_back(&poolPtr);
-            
-            objectPtr = &poolPtr;
-        }
+        
+        // Call the constructor
+        construct(*objectPtr);
+        
+        // Mark the object as active
+        m_activeIndex[slot] = m_activeList.size();
+        m_activeList.push_back(objectPtr);
         
         return objectPtr;
     }
@@ -211,96 +293,72 @@ public:
     /** Frees an object.*/
     bool Destroy(T* objectPtr) {
         
-        // Iterate the list of pools
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
-            
-            // Get the next pool and state list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool>& boolPtr = m_pool[i].second;
-            
-            // Iterate the pool its self
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                // Check matching pointers
-                if (objectPtr == &poolPtr[f]) {
-                    
-                    // Check if the object is active
-                    if (boolPtr[f]) {
-                        
+        unsigned int slot = findSlot(objectPtr);
+        
+        if (slot == POOL_SLOT_NONE)
+            return false;
+
 #ifdef ENABLE_CONSOLE_DEBUG__
     #ifdef ENABLE_DEBUG_ON_DESTRUCT__
-                        T& poolRef = *poolPtr;
-                        
-                        std::cout << "  Destructed :: " << &poolPtr[f] << "   Pool * " << &poolRef << "\n";
-                        
+        
+        std::cout << "  Destructed :: " << objectPtr << "   Pool * " << m_pool[slot / m_poolSz] << "\n";
+    
     #endif
 #endif
-                        
-                        // Explicitly call the destructor
-                        destruct(poolPtr[f]);
-                        
-                        // Mark the object as inactive
-                        boolPtr[f] = false;
-                        
-                        // Object is active, add to list
-                        int ListSize = m_activeList.size();
-                        for (int a=0; a < ListSize; a++) {
-                            
-                            if (m_activeList[a] == objectPtr) {m_activeList.erase( m_activeList.begin() + a ); break;}
-                            
-                        }
-                        
-                        return true;
-                    } else return false;
-                    
-                }
-                
-            }
-            
-        }
         
-        return false;
+        // Explicitly call the destructor
+        destruct(*objectPtr);
+        
+        // Swap the last active object into the vacated position
+        unsigned int activeIndex = m_activeIndex[slot];
+        T* lastPtr = m_activeList.back();
+        
+        m_activeList[activeIndex] = lastPtr;
+        m_activeIndex[ reinterpret_cast<Node*>(lastPtr)->slot ] = activeIndex;
+        m_activeList.pop_back();
+        
+        // Mark the object as inactive and invalidate any outstanding handles
+        m_activeIndex[slot] = POOL_SLOT_NONE;
+        m_generation[slot] = (m_generation[slot] + 1) & POOL_HANDLE_GENERATION_MASK;
+        
+        // Push the slot onto the free list
+        nextFree(node(slot)) = m_freeHead;
+        m_freeHead = slot;
+        m_freeCount++;
+        
+        return true;
     }
     
     /** Clears the entire pool of all its objects.*/
     void Clear(void) {
-        
-        // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
-            
-            // Get the next pair
-            std::pair<T*, std::vector<bool>>* poolPair = &m_pool[i];
-            T*    poolPtr = poolPair ->first;
-            std::vector<bool> boolPtr = poolPair ->second;
-            
+
 #ifdef ENABLE_LEAK_DETECTION__
     #ifdef ENABLE_CONSOLE_DEBUG__
+        
+        for (unsigned int i=0; i < m_activeList.size(); i++) {
             
-            // Iterate the pool
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                if (boolPtr[f]) {
-                    T& poolRef = *poolPair ->first;
-                    
-                    std::cout << " [Leak detected]  < " << &poolPtr[f] << " >  pool #" << i << "  pool *";
-                    std::cout << &poolRef << "\n";
-                }
-                
-            }
+            unsigned int slot = reinterpret_cast<Node*>(m_activeList[i])->slot;
             
+            std::cout << " [Leak detected]  < " << m_activeList[i] << " >  pool #" << (slot / m_poolSz) << "  pool *";
+            std::cout << m_pool[slot / m_poolSz] << "\n";
+        }
+    
     #endif
 #endif
-            
-            // Deallocate the pool pair
-            std::free(poolPtr);
-            
-        }
+        
+        // Deallocate the pools
+        for (unsigned int i=0; i < m_pool.size(); i++)
+            std::free(m_pool[i]);
         
         m_pool.clear();
+        m_poolBase.clear();
+        m_activeList.clear();
+        m_activeIndex.clear();
+        m_generation.clear();
+        
+        m_freeHead  = POOL_SLOT_NONE;
+        m_freeCount = 0;
+        m_poolCount = 0;
         
         return;
     }
@@ -313,87 +371,78 @@ public:
     
     /** Returns the number of used memory locations.*/
     unsigned int GetObjectCount(void) {
+        return m_activeList.size();
+    }
+    /** Returns the number of unused memory locations.*/
+    unsigned int GetFreeCount(void) {
+        return m_freeCount;
+    }
+    
+    
+    // Handles
+    
+    /** Returns a generation checked handle to an active object. A null handle
+     * is returned if the object does not belong to this allocator.*/
+    PoolHandle GetHandle(T* objectPtr) {
         
-        int ObjectCount = 0;
+        PoolHandle handle;
         
-        // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
-            
-            // Get the next pool and free list pair
-            //T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
-            
-            // Iterate the pool its self
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                // Check if the object is active
-                if (boolPtr[f]) ObjectCount++;
-                
-            }
-            
-        }
+        unsigned int slot = findSlot(objectPtr);
         
-        return ObjectCount;
+        if ((slot == POOL_SLOT_NONE) | (slot > POOL_HANDLE_INDEX_MASK))
+            return handle;
+        
+        handle.value = slot | ((unsigned int)m_generation[slot] << POOL_HANDLE_INDEX_BITS);
+        
+        return handle;
     }
-    /** Returns the number of unused memory locations.*/
-    unsigned int GetFreeCount(void) {
+    
+    /** Returns the object referenced by the handle or a null pointer if the
+     * object has since been destroyed.*/
+    T* Resolve(PoolHandle handle) {
         
-        unsigned int FreeCount = 0;
+        if (!IsValid(handle))
+            return nullptr;
         
-        // Iterate the pool list
-        unsigned int poolListSz = m_pool.size();
-        for (unsigned int i=0; i < poolListSz; i++) {
-            
-            // Get the next pool and free list pair
-            //T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
-            
-            // Iterate the pool its self
-            unsigned int poolSz = this ->m_poolSz;
-            for (unsigned int a=0; a < poolSz; a++) {
-                
-                // Check if the object is inactive
-                if (!boolPtr[a]) FreeCount++;
-                
-            }
-            
-        }
+        return reinterpret_cast<T*>(&node(handle.GetIndex()).storage);
+    }
+    
+    /** Check if the object referenced by the handle is still alive.*/
+    bool IsValid(PoolHandle handle) {
         
-        return FreeCount;
+        if (handle.IsNull())
+            return false;
+        
+        unsigned int slot = handle.GetIndex();
+        
+        if (slot >= m_activeIndex.size())
+            return false;
+        
+        if (m_activeIndex[slot] == POOL_SLOT_NONE)
+            return false;
+        
+        return m_generation[slot] == handle.GetGeneration();
     }
     
     /** Debug output to console. Must #define ENABLE_CONSOLE_DEBUG__ */
     void Debug(void) {
-        
+
 #ifdef  ENABLE_CONSOLE_DEBUG__
-        
+    
     #ifdef  ENABLE_DEBUG_DETAILS__
         
         std::cout << "\n\n\n";
         
         std::cout << "  Memory offset    State\n\n";
         
-        // Iterate the pool list
-        unsigned int poolListSz = m_pool.size();
-        for (unsigned int i=0; i < poolListSz; i++) {
+        // Iterate the slot list
+        for (unsigned int i=0; i < m_activeIndex.size(); i++) {
             
-            // Get the next pool and free list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
+            std::cout << "  " << &node(i).storage;
             
-            // Iterate the pool objects
-            unsigned int poolSz = this ->m_poolSz;
-            for (unsigned int f=0; f < poolSz; f++) {
-                
-                std::cout << "  " << &poolPtr[f];
-                
-                if (boolPtr[f]) std::cout << "         " << "Reserved";
-                
-                std::cout << "\n";
-                
-            }
+            if (m_activeIndex[i] != POOL_SLOT_NONE) std::cout << "         " << "Reserved";
+            
+            std::cout << "\n";
             
         }
     #endif
@@ -402,8 +451,8 @@ public:
         
         std::string spcStr = "  ";
         
-        std::cout << spcStr << this ->getObjectCount() << " - Used memory locations\n";
-        std::cout << spcStr << this ->getFreeCount() << " - Unused memory locations\n";
+        std::cout << spcStr << this ->GetObjectCount() << " - Used memory locations\n";
+        std::cout << spcStr << this ->GetFreeCount() << " - Unused memory locations\n";
         
         std::cout << "\n";
         
@@ -412,11 +461,11 @@ public:
         
         std::cout << "\n";
         
-        std::cout << spcStr << spcStr << m_poolSz * sizeof(T) <<      " - Size of a pool in bytes\n";
-        std::cout << spcStr << spcStr << m_poolSz * sizeof(T) * m_poolCount << " - Total size of all pools in bytes\n";
+        std::cout << spcStr << spcStr << m_poolSz * sizeof(Node) <<      " - Size of a pool in bytes\n";
+        std::cout << spcStr << spcStr << m_poolSz * sizeof(Node) * m_poolCount << " - Total size of all pools in bytes\n";
         
         std::cout << "\n\n";
-        
+
 #endif
         
         return;
@@ -434,35 +483,28 @@ public:
         fDump << "  Allocation crash report\n";
         
         // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (unsigned int i=0; i < poolListSz; i++) {
-            
-            // Get the next pair
-            std::pair<T*, std::vector<bool>>* poolPair = &m_pool[i];
-            T*    poolPtr = poolPair ->first;
-            std::vector<bool> boolPtr = poolPair ->second;
+        for (unsigned int i=0; i < m_pool.size(); i++) {
             
             // Log the pool pointer
-            T& poolRef = *poolPair ->first;
-            fDump << "pool[" << i << "] " << poolPair ->first << "\n";
+            fDump << "pool[" << i << "] " << m_pool[i] << "\n";
             
             // Iterate the pool
-            int poolSz = this ->m_poolSz;
-            for (unsigned int f=0; f < poolSz; f++) {
+            for (int f=0; f < m_poolSz; f++) {
                 
-                if (boolPtr[f]) {
-                    
-                    // Log the object pointer
-                    T* poolRef = &poolPtr[f];
-                    fDump << " " << f << " " << poolRef << "\n";
-                    
-                    char* charPtr = (char*)poolPtr;
-                    
-                    for (unsigned int z=0; z < sizeof(T); z++) 
-                        fDump << &charPtr[z];
-                    
-                }
+                unsigned int slot = i * m_poolSz + f;
                 
+                if (m_activeIndex[slot] == POOL_SLOT_NONE)
+                    continue;
+                
+                // Log the object pointer
+                T* objectPtr = reinterpret_cast<T*>(&m_pool[i][f].storage);
+                fDump << " " << f << " " << objectPtr << "\n";
+                
+                char* charPtr = (char*)objectPtr;
+                
+                for (unsigned int z=0; z < sizeof(T); z++)
+                    fDump << charPtr[z];
+                    
             }
             
         }
@@ -475,4 +517,3 @@ public:
 };
 
 #endif
-
@@ -0,0 +1,93 @@
+#ifndef _PHYSICS_HEIGHT_FIELD_QUERY_
+#define _PHYSICS_HEIGHT_FIELD_QUERY_
+
+#include <GameEngineFramework/configuration.h>
+#include <GameEngineFramework/Physics/Raycast.h>
+
+#include <glm/glm.hpp>
+
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+/// Outcome of sampling the ground below a point.
+enum class HeightFieldResult {
+    Hit,
+    Miss,
+    Uncovered
+};
+
+
+/// Samples terrain height fields directly instead of casting rays against
+/// them. Heights are interpolated over the same two triangles per grid cell
+/// that the physics height field shape uses, so the results agree with a
+/// downward ray cast. All height fields must share one tile size and lie on
+/// one grid, as the chunks do.
+class ENGINE_API HeightFieldQuery {
+
+public:
+    
+    HeightFieldQuery();
+    
+    /// Add a height field laid out as the physics height field shape and centered
+    /// on a world position. Returns false if the tile does not fit the tile grid.
+    bool AddHeightField(const float* heights, unsigned int width, unsigned int length, glm::vec3 position, glm::vec3 scale, void* userData);
+    
+    /// Remove a height field by its height buffer.
+    bool RemoveHeightField(const float* heights);
+    
+    /// Remove every height field.
+    void Clear(void);
+    
+    /// Get the number of height fields.
+    unsigned int GetNumberOfHeightFields(void);
+    
+    /// Find the terrain below a point within a distance.
+    HeightFieldResult Query(glm::vec3 from, float distance, Hit& hit);
+    
+    /// Find the terrain below a batch of points.
+    void QueryBatch(const glm::vec3* from, unsigned int count, float distance, Hit* hits, HeightFieldResult* results);
+    
+private:
+    
+    struct Tile {
+        
+        const float* heights;
+        
+        unsigned int width;
+        unsigned int length;
+        
+        // World position of the first height sample
+        float originX;
+        float originY;
+        float originZ;
+        
+        glm::vec3 scale;
+        
+        void* userData;
+        
+        int cellX;
+        int cellZ;
+        
+    };
+    
+    uint64_t GetKey(int cellX, int cellZ);
+    
+    // Find the tile covering a point, checking the last tile first
+    const Tile* FindTile(float x, float z, unsigned int& lastTile);
+    
+    HeightFieldResult Sample(const Tile& tile, glm::vec3 from, float distance, Hit& hit);
+    
+    std::vector<Tile> mTiles;
+    
+    std::unordered_map<uint64_t, unsigned int> mTileIndex;
+    
+    // Tile grid set by the first height field
+    float mTileSizeX;
+    float mTileSizeZ;
+    float mGridOriginX;
+    float mGridOriginZ;
+    
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include <GameEngineFramework/Physics/components/meshcollider.h>
 
 #include <GameEngineFramework/Physics/Raycast.h>
+#include <GameEngineFramework/Physics/HeightFieldQuery.h>
 #include <GameEngineFramework/Physics/Masks.h>
 
 #include <cstdlib>
@@ -69,8 +70,24 @@ public:
     bool DestroyTriangleMesh(MeshCollider* collider);
     
     /// Cast a ray and return the hit data of any objects that intersected the ray.
+    /// Rays may be cast from several threads at once but not while the world is updating.
     bool Raycast(glm::vec3 from, glm::vec3 direction, float distance, Hit& hit, LayerMask layer=LayerMask::Default);
     
+    /// Cast a batch of rays across the job system. Returns the number of rays that hit.
+    unsigned int RaycastBatch(const RaycastQuery* queries, unsigned int count, Hit* hits, uint8_t* isHit);
+    
+    /// Register a height field collider placed at a world position with the ground query.
+    bool AddTerrainHeightField(MeshCollider* collider, glm::vec3 position, void* userData);
+    /// Remove a height field collider from the ground query.
+    bool RemoveTerrainHeightField(MeshCollider* collider);
+    
+    /// Find the ground straight below a point. Registered terrain is sampled directly
+    /// and anything else falls back to a ray cast, as do points above or below any
+    /// other collider on the layer. Terrain hits do not set the collider.
+    bool QueryGround(glm::vec3 from, float distance, Hit& hit, LayerMask layer=LayerMask::Ground);
+    /// Find the ground below a batch of points. Returns the number of points that found ground.
+    unsigned int QueryGroundBatch(const glm::vec3* from, unsigned int count, float distance, Hit* hits, uint8_t* isHit, LayerMask layer=LayerMask::Ground);
+    
     
 private:
     
@@ -79,15 +96,20 @@ private:
     // Remove a rigid body from the free list
     rp3d::RigidBody* RemoveRigidBodyFromFreeList(void);
     
+    // Gather the bounds of the colliders on a layer other than height fields
+    void GetGroundObstacles(LayerMask layer, std::vector<rp3d::AABB>& obstacles);
+    // Check if a downward query passes through any of the bounds
+    bool IsColumnBlocked(const std::vector<rp3d::AABB>& obstacles, glm::vec3 from, float distance);
+    
     // Free list of rigid bodies
     std::vector<rp3d::RigidBody*> mRigidBodyFreeList;
     
-    // Callback function for physics ray casting
-    RaybackCastCaller mRaybackCastCaller;
-    
     // Allocator of mesh colliders
     PoolAllocator<MeshCollider> mMeshColliders;
     
+    // Terrain height fields sampled by the ground queries
+    HeightFieldQuery mTerrain;
+    
 };
 
 
@@ -2,6 +2,7 @@
 #define _PHYSICS_RAYCAST_
 
 #include "../../../vendor/ReactPhysics3d/ReactPhysics3d.h"
+#include <GameEngineFramework/Physics/Masks.h>
 
 #include <cstdlib>
 
@@ -62,4 +63,22 @@ public:
     
 };
 
+
+/// Single ray in a ray cast batch.
+class ENGINE_API RaycastQuery {
+    
+public:
+    
+    glm::vec3 from;
+    
+    glm::vec3 direction;
+    
+    float distance;
+    
+    LayerMask layer;
+    
+    RaycastQuery();
+    
+};
+
 #endif
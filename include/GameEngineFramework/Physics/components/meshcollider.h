@@ -4,6 +4,7 @@
 #include <GameEngineFramework/configuration.h>
 
 #include <ReactPhysics3d/ReactPhysics3d.h>
+#include <glm/glm.hpp>
 #include <vector>
 
 
@@ -15,6 +16,11 @@ public:
     rp3d::HeightFieldShape* heightFieldShape;
     float* heightMapBuffer;
     
+    /// Height field dimensions and scale.
+    unsigned int heightMapWidth;
+    unsigned int heightMapLength;
+    glm::vec3 heightMapScale;
+    
     /// Triangle collider.
     rp3d::TriangleMesh* triangleMesh;
     float* vertexBuffer;
@@ -0,0 +1,72 @@
+#ifndef _CHUNK_GENERATOR__
+#define _CHUNK_GENERATOR__
+
+#include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/Perlin.h>
+
+#include <vector>
+
+
+/// CPU side chunk data produced by the generator before anything
+/// is uploaded to the GPU or added to the physics world.
+class ENGINE_API ChunkBuildData {
+
+public:
+    
+    /// Chunk world position
+    float x;
+    float y;
+    
+    /// Seed derived from the world seed and the chunk position
+    int seed;
+    
+    /// Number of points along each side of the fields
+    unsigned int fieldSize;
+    
+    std::vector<float>     heightField;
+    std::vector<glm::vec3> colorField;
+    
+    /// Terrain mesh buffers
+    std::vector<Vertex> meshVertices;
+    std::vector<Index>  meshIndices;
+    
+    /// Half size terrain mesh buffers
+    std::vector<Vertex> lodVertices;
+    std::vector<Index>  lodIndices;
+    
+    ChunkBuildData();
+    
+};
+
+
+/// Snapshot of the world settings needed to generate chunk terrain. Building
+/// reads only this snapshot, so chunks can be built on any thread.
+class ENGINE_API ChunkGenerator {
+
+public:
+    
+    int chunkSize;
+    
+    int worldSeed;
+    
+    /// Terrain color range from low to high ground
+    glm::vec3 colorLow;
+    glm::vec3 colorHigh;
+    
+    /// Snow cap color and starting height
+    glm::vec3 snowCapColor;
+    float snowCapHeight;
+    
+    /// Build the terrain mesh as a shared vertex grid rather than separate quads.
+    bool doSharedVertices;
+    
+    std::vector<Perlin> perlin;
+    
+    ChunkGenerator();
+    
+    /// Generate the height field, color field and mesh buffers for the chunk at the given position.
+    void Build(ChunkBuildData& data, float x, float y);
+    
+};
+
+#endif
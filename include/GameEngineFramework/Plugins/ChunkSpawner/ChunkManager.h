@@ -4,6 +4,9 @@
 #include <GameEngineFramework/Engine/Engine.h>
 
 #include <GameEngineFramework/Plugins/ChunkSpawner/Chunk.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkMap.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkGenerator.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/RegionFile.h>
 #include <GameEngineFramework/Plugins/ChunkSpawner/Perlin.h>
 #include <GameEngineFramework/Plugins/ChunkSpawner/Decor.h>
 #include <GameEngineFramework/Plugins/ChunkSpawner/Structure.h>
@@ -125,6 +128,21 @@ public:
     
     int worldSeed;
     
+    /// Generate chunk terrain on the job workers.
+    bool doAsyncGeneration;
+    
+    /// Main thread time per frame spent finishing generated chunks. (In milliseconds)
+    float generationBudget;
+    
+    /// Maximum number of chunks being generated on the job workers at once.
+    unsigned int generationJobLimit;
+    
+    /// Build chunk terrain as a shared vertex grid.
+    bool doSharedVertexTerrain;
+    
+    /// Compress chunk records saved to the world region files.
+    bool doCompressRegions;
+    
     ChunkManager();
     
     Chunk* FindChunk(int x, int z);
@@ -141,6 +159,9 @@ public:
     
     bool LoadWorld(void);
     
+    /// Move a world saved as one file per chunk into region files.
+    bool ConvertWorldToRegions(std::string worldname);
+    
     // Purge
     
     void ClearWorld(void);
@@ -151,6 +172,12 @@ public:
     
     Chunk CreateChunk(float x, float y);
     
+    /// Create the chunk objects, meshes and collider from generated data.
+    Chunk CreateChunk(ChunkBuildData& data);
+    
+    /// Get a generator holding the current world generation settings.
+    ChunkGenerator GetGenerator(void);
+    
     bool DestroyChunk(Chunk& chunk);
     
     // Actors
@@ -179,11 +206,11 @@ public:
     
     void AddDecorGrass(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz);
     void AddDecorGrassThin(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz);
-    void AddDecorGrassThick(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz);
+    void AddDecorGrassThick(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, RandomStream& random);
     
     void AddDecorTreeLogs(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz);
     void AddDecorTreeLeaves(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz);
-    void AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, Decoration treeType);
+    void AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, Decoration treeType, RandomStream& random);
     
     void Decorate(Chunk& chunk);
     
@@ -193,7 +220,7 @@ public:
     std::vector<Decoration> decoration;
     std::vector<Perlin> perlin;
     
-    std::vector<Chunk> chunks;
+    ChunkMap chunks;
     
     std::vector<GameObject*> actors;
     
@@ -210,8 +237,15 @@ private:
     void GenerateChunks(const glm::vec3 &playerPosition);
     
     bool IsChunkFound(const glm::vec2 &chunkPosition);
+    bool IsChunkSaved(const glm::vec2 &chunkPosition);
     
     void GenerateChunk(const glm::vec2 &chunkPosition);
+    void GenerateChunk(ChunkBuildData& data);
+    
+    void QueueChunkBuild(const glm::vec2 &chunkPosition);
+    bool IsChunkBuildQueued(const glm::vec2 &chunkPosition);
+    void FinalizeChunkBuilds(const glm::vec3 &playerPosition);
+    void CancelChunkBuilds(void);
     
     void DestroyChunks(const glm::vec3 &playerPosition);
     void UpdateActors(const glm::vec3 &playerPosition);
@@ -234,11 +268,44 @@ private:
     // Update index counters
     
     unsigned int mActorIndex;
-    unsigned int mChunkIndex;
+    
+    // Results of the actor proximity queries
+    
+    std::vector<Actor*> mNearbyActors;
     
     int mChunkCounterX;
     int mChunkCounterZ;
     
+    // Chunks being generated on the job workers
+    
+    struct ChunkBuildJob {
+        
+        ChunkBuildData data;
+        
+        JobCounter counter;
+        
+    };
+    
+    std::vector<ChunkBuildJob*> mChunkBuilds;
+    std::vector<glm::vec2> mChunkBuildCandidates;
+    
+    // Region files open for the current world
+    
+    struct OpenRegion {
+        
+        int x;
+        int z;
+        
+        RegionFile* file;
+        
+    };
+    
+    std::vector<OpenRegion> mRegions;
+    
+    void GetChunkCell(float x, float z, int& cellX, int& cellZ);
+    RegionFile* GetRegion(int cellX, int cellZ, bool doCreate);
+    void CloseRegions(void);
+    
     // Cool down counters
     
     unsigned int mBreedingCoolDown;
@@ -0,0 +1,70 @@
+#ifndef _CHUNK_MAP__
+#define _CHUNK_MAP__
+
+#include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/Chunk.h>
+
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+
+#include <vector>
+#include <cstdint>
+
+
+/// Chunk storage indexed by integer chunk coordinates. Chunks live in pool
+/// slots that do not move while the chunk exists. Lookups go through an open
+/// addressing hash table with linear probing.
+class ENGINE_API ChunkMap {
+
+public:
+    
+    ChunkMap();
+    
+    /// Create a chunk at the given coordinates and return its pointer.
+    /// Returns the existing chunk if one is already at these coordinates.
+    /// The chunk position is used as its key and should not be changed.
+    Chunk* Create(int x, int z);
+    
+    /// Find the chunk at the given coordinates. Returns null if not found.
+    Chunk* Find(int x, int z);
+    
+    /// Remove a chunk from the map and free its slot.
+    bool Destroy(Chunk* chunk);
+    
+    /// Remove every chunk from the map.
+    void Clear(void);
+    
+    /// Get the number of chunks in the map.
+    unsigned int Size(void);
+    
+    /// Get a chunk by its index in the active list. Destroying a chunk
+    /// moves the last chunk into its index.
+    Chunk* operator[] (unsigned int const index);
+    
+private:
+    
+    struct Entry {
+        
+        int x;
+        int z;
+        
+        Chunk* chunk;
+        
+    };
+    
+    unsigned int Hash(int x, int z);
+    
+    // Return the table slot holding the coordinates, or the empty slot where they belong
+    unsigned int Probe(int x, int z);
+    
+    void Grow(void);
+    
+    PoolAllocator<Chunk> mChunks;
+    
+    std::vector<Entry> mTable;
+    
+    unsigned int mMask;
+    unsigned int mCount;
+    
+};
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef _CHUNK_REGION_FILE__
+#define _CHUNK_REGION_FILE__
+
+#include <GameEngineFramework/Engine/Engine.h>
+
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/// Number of chunks along each side of a region.
+#define REGION_GRID_SIZE  16
+
+/// Region file format version.
+#define REGION_VERSION  1
+
+/// Record stored compressed.
+#define REGION_FLAG_COMPRESSED  0x01
+
+
+/// Actor entry within a chunk record.
+class ENGINE_API ChunkActorRecord {
+
+public:
+    
+    glm::vec3 position;
+    
+    unsigned long long int age;
+    
+    std::string genome;
+    
+    ChunkActorRecord();
+    
+};
+
+
+/// Static object entry within a chunk record.
+class ENGINE_API ChunkStaticRecord {
+
+public:
+    
+    glm::vec3 position;
+    
+    glm::vec3 color;
+    
+    uint8_t type;
+    
+    ChunkStaticRecord();
+    
+};
+
+
+/// Actors and static objects saved for a single chunk.
+class ENGINE_API ChunkRecord {
+
+public:
+    
+    std::vector<ChunkActorRecord>  actors;
+    std::vector<ChunkStaticRecord> statics;
+    
+    /// Write the record into a byte buffer.
+    void Encode(std::vector<uint8_t>& buffer);
+    
+    /// Read the record from a byte buffer. Returns false if the buffer is malformed.
+    bool Decode(const uint8_t* buffer, unsigned int size);
+    
+};
+
+
+/// Single file holding the records for a grid of chunks. A table in the
+/// header maps each chunk cell to its record so one chunk can be read or
+/// rewritten without touching the rest of the region.
+class ENGINE_API RegionFile {
+
+public:
+    
+    RegionFile();
+    ~RegionFile();
+    
+    /// Open a region file, creating it if it does not exist.
+    bool Open(std::string filename);
+    
+    /// Flush and close the region file.
+    void Close(void);
+    
+    /// Check if the region file is open.
+    bool IsOpen(void);
+    
+    /// Write the record for a chunk cell. Records that outgrow their space are moved to the end of the file.
+    bool Write(int cellX, int cellZ, const std::vector<uint8_t>& data, bool doCompress);
+    
+    /// Read the record for a chunk cell. Returns false if the cell has no record.
+    bool Read(int cellX, int cellZ, std::vector<uint8_t>& data);
+    
+    /// Check if the region holds a record for a chunk cell.
+    bool Contains(int cellX, int cellZ);
+    
+    /// Number of bytes written to the file since it was opened.
+    unsigned int GetBytesWritten(void);
+    
+    /// Get the region coordinates holding a chunk cell.
+    static void GetRegionCoordinates(int cellX, int cellZ, int& regionX, int& regionZ);
+    
+private:
+    
+    struct RegionHeader {
+        
+        char     magic[4];
+        uint32_t version;
+        uint32_t gridSize;
+        uint32_t reserved;
+        
+    };
+    
+    struct RegionEntry {
+        
+        int32_t  cellX;
+        int32_t  cellZ;
+        uint32_t offset;
+        uint32_t capacity;
+        uint32_t size;
+        uint32_t rawSize;
+        uint32_t flags;
+        
+    };
+    
+    std::fstream mFile;
+    
+    std::string mFilename;
+    
+    RegionEntry mTable[REGION_GRID_SIZE * REGION_GRID_SIZE];
+    
+    uint32_t mEndOfFile;
+    
+    unsigned int mBytesWritten;
+    
+    std::vector<uint8_t> mCompressBuffer;
+    
+    unsigned int GetSlot(int cellX, int cellZ);
+    
+    bool WriteEntry(unsigned int slot);
+    
+};
+
+
+/// Compress a buffer using LZ4 style block sequences. Returns the compressed size.
+ENGINE_API unsigned int RegionCompress(const uint8_t* source, unsigned int size, std::vector<uint8_t>& destination);
+
+/// Decompress a buffer produced by RegionCompress. Returns false if the data is malformed.
+ENGINE_API bool RegionDecompress(const uint8_t* source, unsigned int size, uint8_t* destination, unsigned int rawSize);
+
+#endif
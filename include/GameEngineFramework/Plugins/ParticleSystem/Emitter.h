@@ -66,6 +66,9 @@ public:
     /// Maximum number of particles allowed to be spawned be this emitter.
     unsigned int maxParticles;
     
+    /// Number of updates a particle lives before it is reset. Zero keeps particles until they leave the emitter area.
+    float lifetime;
+    
     Emitter();
     
     /// Add a particle to this emitter.
@@ -83,6 +86,15 @@ public:
     /// Get the current material used by this emitter.
     Material* GetMaterial(void);
     
+    /// Get the number of particles spawned by this emitter.
+    unsigned int GetNumberOfParticles(void);
+    
+    /// Get the position of a particle by its index.
+    glm::vec3 GetParticlePosition(unsigned int index);
+    
+    /// Get the number of updates a particle has lived since it was last reset.
+    float GetParticleLife(unsigned int index);
+    
 private:
     
     // Is this emitter currently active
@@ -94,13 +106,14 @@ private:
     //  Current number of particles in the particle emitter
     unsigned int mNumberOfParticles;
     
+    // Particle state kept in separate arrays so each can be streamed to the GPU as is
     std::vector<glm::vec3> mParticlePositions;
     std::vector<glm::vec3> mParticleVelocities;
+    std::vector<glm::vec3> mParticleScales;
     std::vector<glm::vec3> mParticleColors;
+    std::vector<float>     mParticleLife;
     
-    GameObject* mParticleObject;
-    
-    Mesh* mMesh;
+    ParticleBatch* mBatch;
     Material* mMaterial;
     
 public:
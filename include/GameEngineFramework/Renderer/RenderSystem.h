@@ -11,6 +11,8 @@
 #include <GameEngineFramework/Renderer/components/mesh.h>
 #include <GameEngineFramework/Renderer/components/submesh.h>
 #include <GameEngineFramework/Renderer/components/meshrenderer.h>
+#include <GameEngineFramework/Renderer/components/instancebatch.h>
+#include <GameEngineFramework/Renderer/components/particlebatch.h>
 #include <GameEngineFramework/Renderer/components/scene.h>
 #include <GameEngineFramework/Renderer/components/shader.h>
 #include <GameEngineFramework/Renderer/components/framebuffer.h>
@@ -21,12 +23,15 @@
 
 #include <GameEngineFramework/Logging/Logging.h>
 
+#include <GameEngineFramework/Jobs/JobSystem.h>
+
 #include <GameEngineFramework/configuration.h>
 
 #include <thread>
 #include <mutex>
 #include <chrono>
 #include <algorithm>
+#include <cstdint>
 
 #define GLEW_STATIC
 #include "../../../vendor/gl/glew.h"
@@ -40,6 +45,175 @@ struct Frustum {
 };
 
 
+/// Render queue entry drawn in the order of its sort key.
+struct RenderQueueItem {
+    
+    // Queue, render state and depth packed from the most to the least significant bits
+    uint64_t key;
+    
+    MeshRenderer* renderer;
+    
+};
+
+/// Sort render queue items by key with a least significant digit radix sort. The buffer is used as scratch space.
+ENGINE_API void RenderQueueSort(std::vector<RenderQueueItem>& items, std::vector<RenderQueueItem>& buffer);
+
+
+// Uniform blocks mirror the std140 layout of the shader blocks.
+// Vectors and array elements are padded out to a vec4.
+
+struct UniformBlockCamera {
+    
+    glm::mat4 viewProjection;
+    glm::vec4 eye;
+    glm::vec4 angle;
+    
+};
+
+struct UniformBlockLights {
+    
+    glm::ivec4 count;
+    glm::vec4  position    [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec4  direction   [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec4  attenuation [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec4  color       [RENDER_NUMBER_OF_LIGHTS];
+    
+};
+
+struct UniformBlockFog {
+    
+    glm::ivec4 count;
+    glm::vec4  colorBegin   [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec4  colorEnd     [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec4  begin        [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec4  end          [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec4  density      [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec4  heightCutoff [RENDER_NUMBER_OF_FOG_LAYERS];
+    
+};
+
+struct UniformBlockObject {
+    
+    glm::mat4 model;
+    glm::vec4 inverseModel[3];
+    glm::vec4 ambient;
+    glm::vec4 diffuse;
+    glm::vec4 specular;
+    
+};
+
+
+/// Kind of draw held by a render command.
+enum class RenderCommandType : uint8_t {
+    
+    DrawMesh,
+    DrawInstances,
+    DrawParticles,
+    DrawShadow
+    
+};
+
+/// Draw packet recorded without a GL context and replayed by the thread owning it.
+struct RenderCommand {
+    
+    RenderCommandType type;
+    
+    // Level of detail mesh and the material to draw it with
+    Mesh*     mesh;
+    Material* material;
+    
+    // Source of the draw
+    MeshRenderer*  renderer;
+    InstanceBatch* instanceBatch;
+    ParticleBatch* particleBatch;
+    
+    // Object block within the segment for mesh draws
+    unsigned int objectIndex;
+    
+};
+
+/// Camera, lights, fog and shadows recorded for one scene.
+struct RenderScenePacket {
+    
+    Scene* scene;
+    
+    Viewport viewport;
+    Frustum  frustum;
+    
+    UniformBlockCamera camera;
+    UniformBlockLights lights;
+    UniformBlockFog    fog;
+    
+    unsigned int numberOfShadows;
+    glm::vec3    shadowPosition  [RENDER_NUMBER_OF_SHADOWS];
+    glm::vec3    shadowDirection [RENDER_NUMBER_OF_SHADOWS];
+    
+};
+
+/// Draw packets recorded for one render queue group of a scene.
+struct RenderCommandSegment {
+    
+    /// Index of the scene packet this segment draws with.
+    unsigned int scene;
+    
+    /// Render queue group the packets were recorded from.
+    unsigned int queueGroup;
+    
+    /// Draw packets in submission order.
+    std::vector<RenderCommand> commands;
+    
+    /// Per draw uniform blocks spaced by the object block stride.
+    std::vector<uint8_t> objectBlocks;
+    
+    /// Released once the segment has been recorded.
+    JobCounter counter;
+    
+    // Sorting scratch space
+    std::vector<RenderQueueItem> sorted;
+    std::vector<RenderQueueItem> buffer;
+    
+};
+
+
+/// Frame of draw packets. Each segment is recorded by a worker and can be
+/// replayed while the segments after it are still being recorded.
+class ENGINE_API RenderCommandList {
+
+public:
+    
+    RenderCommandList();
+    ~RenderCommandList();
+    
+    /// Get the number of segments recorded for the frame.
+    unsigned int GetNumberOfSegments(void);
+    
+    /// Get a recorded segment by its index.
+    RenderCommandSegment* GetSegment(unsigned int index);
+    
+    /// Get the number of scenes recorded for the frame.
+    unsigned int GetNumberOfScenes(void);
+    
+    /// Get the number of draw packets across every segment.
+    unsigned int GetNumberOfCommands(void);
+    
+    /// Forget the recorded frame. The storage is kept for the next one.
+    void Clear(void);
+    
+    friend class RenderSystem;
+    
+private:
+    
+    std::vector<RenderScenePacket> mScenes;
+    
+    // Segments are reused from frame to frame
+    std::vector<RenderCommandSegment*> mSegments;
+    unsigned int mNumberOfSegments;
+    
+    RenderCommandSegment* AddSegment(void);
+    
+};
+
+
 
 class ENGINE_API RenderSystem {
     
@@ -59,6 +233,7 @@ public:
     
     
     RenderSystem();
+    ~RenderSystem();
     
     Scene* operator[] (unsigned int const i) {return mActiveScenes[i];}
     
@@ -164,6 +339,26 @@ public:
     unsigned int GetNumberOfFogLayers(void);
     
     
+    /// Create an instance batch and return its pointer.
+    InstanceBatch* CreateInstanceBatch(void);
+    
+    /// Destroy an instance batch and return true on success.
+    bool DestroyInstanceBatch(InstanceBatch* batchPtr);
+    
+    /// Return the number of instance batch objects.
+    unsigned int GetNumberOfInstanceBatches(void);
+    
+    
+    /// Create a particle batch and return its pointer.
+    ParticleBatch* CreateParticleBatch(void);
+    
+    /// Destroy a particle batch and return true on success.
+    bool DestroyParticleBatch(ParticleBatch* batchPtr);
+    
+    /// Return the number of particle batch objects.
+    unsigned int GetNumberOfParticleBatches(void);
+    
+    
     // Render queue
     
     /// Add a scene to the render queue for rendering.
@@ -176,6 +371,16 @@ public:
     unsigned int GetRenderQueueSize(void);
     
     
+    // Recording
+    
+    /// Set the number of worker threads recording render commands. Zero uses
+    /// one per hardware thread, less the main thread.
+    void SetNumberOfRecordingWorkers(unsigned int numberOfWorkers);
+    
+    /// Get the number of worker threads recording render commands.
+    unsigned int GetNumberOfRecordingWorkers(void);
+    
+    
     // Internal
     
     /// Prepare the render system.
@@ -187,15 +392,36 @@ public:
     /// Set the render area within the display.
     void SetViewport(unsigned int x, unsigned int y, unsigned int w, unsigned int h);
     
-    /// Draw the current frame as it stands.
+    /// Draw the current frame as it stands. The frame is recorded and replayed
+    /// within the call, the next frame is not prepared while this one submits.
     void RenderFrame(void);
     
+    /// Record the current frame into a command list without touching the GL context.
+    /// Culling, level of detail selection and sorting are run by the recording workers.
+    /// Meshes still create their GL buffers, so building the scene needs a context.
+    void RecordFrame(RenderCommandList& commandList);
+    
+    /// Replay a recorded command list. Must be called from the thread owning the GL context.
+    void SubmitFrame(RenderCommandList& commandList);
+    
     /// Return a list of any and all openGL error codes.
     std::vector<std::string> GetGLErrorCodes(std::string errorLocationString);
     
     /// Get number of draw calls made in the last frame.
     unsigned int GetNumberOfDrawCalls(void);
     
+    /// Get number of shader binds made in the last frame.
+    unsigned int GetNumberOfShaderBinds(void);
+    
+    /// Get number of material binds made in the last frame.
+    unsigned int GetNumberOfMaterialBinds(void);
+    
+    /// Get number of mesh binds made in the last frame.
+    unsigned int GetNumberOfMeshBinds(void);
+    
+    /// Get number of individual shader uniform updates made in the last frame.
+    unsigned int GetNumberOfUniformUpdates(void);
+    
     friend class EngineSystemManager;
     
     
@@ -204,6 +430,11 @@ private:
     // Draw call counter
     unsigned int mNumberOfDrawCalls;
     
+    // Bind counters
+    unsigned int mNumberOfShaderBinds;
+    unsigned int mNumberOfMaterialBinds;
+    unsigned int mNumberOfMeshBinds;
+    
     // Frame counter
     unsigned long long int mNumberOfFrames;
     
@@ -215,8 +446,41 @@ private:
     Material*  mCurrentMaterial;
     Shader*    mCurrentShader;
     
-    // Sorting
-    std::vector<std::pair<float, MeshRenderer*>> mRenderQueueSorter[5];
+    // OpenGL state last set by a material, -1 when unknown
+    struct MaterialState {
+        int doDepthTest;
+        int depthFunc;
+        int doFaceCulling;
+        int faceCullSide;
+        int faceWinding;
+        int doBlending;
+        int blendSource;
+        int blendDestination;
+        int blendAlphaSource;
+        int blendAlphaDestination;
+        long long int texture;
+    };
+    
+    MaterialState mCurrentState;
+    
+    // Next sort identifier handed to a material
+    unsigned int mMaterialSortId;
+    
+    // Frame recorded by the workers and replayed by RenderFrame
+    RenderCommandList mCommandList;
+    
+    // Recording runs on its own pool so segments never queue behind other jobs
+    // and waiting on them never runs unrelated work on the GL thread
+    JobSystem mRecorders;
+    
+    // Uniform buffers
+    unsigned int mUniformBufferCamera;
+    unsigned int mUniformBufferLights;
+    unsigned int mUniformBufferFog;
+    unsigned int mUniformBufferObject;
+    
+    // Per draw blocks are spaced by the buffer offset alignment
+    unsigned int mObjectBlockStride;
     
     // Light list
     unsigned int mNumberOfLights=0;
@@ -256,11 +520,8 @@ private:
     PoolAllocator<FrameBuffer>     mFrameBuffer;
     PoolAllocator<Texture>         mTexture;
     PoolAllocator<Fog>             mFog;
-    
-    // TODO: Sorting and other non openGL related render functions could be threaded out here
-    
-    // Render support thread
-    std::thread* renderThreadMain;
+    PoolAllocator<InstanceBatch>   mInstanceBatch;
+    PoolAllocator<ParticleBatch>   mParticleBatch;
     
     
     //
@@ -276,6 +537,35 @@ private:
     // Gather the fog layers for rendering
     void accumulateSceneFogLayers(Scene* currentScene);
     
+    // Uniform buffers
+    
+    void CreateUniformBlocks(void);
+    
+    void DestroyUniformBlocks(void);
+    
+    // Fill the camera, light and fog blocks of a scene packet
+    void RecordUniformBlocks(RenderScenePacket& scene, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection);
+    
+    // Fill the per draw block of a renderer
+    void RecordObjectBlock(uint8_t* destination, MeshRenderer* renderer);
+    
+    // Upload the camera, light and fog blocks for a scene
+    void UpdateUniformBlocks(RenderScenePacket& scene);
+    
+    // Upload the per draw blocks of a segment
+    void UpdateObjectBlocks(RenderCommandSegment* segment);
+    
+    // Command recording
+    
+    // Record the scene packets then start a job recording each render queue group
+    void BeginRecording(RenderCommandList& commandList);
+    
+    // Record the draw packets for one render queue group
+    void RecordSegment(RenderCommandList& commandList, RenderCommandSegment* segment, std::vector<MeshRenderer*>* renderQueueGroup);
+    
+    // Replay the draw packets of one segment
+    void SubmitSegment(RenderCommandList& commandList, RenderCommandSegment* segment);
+    
     // Asset binding
     
     bool BindMesh(Mesh* meshPtr);
@@ -284,17 +574,26 @@ private:
     
     bool BindShader(Shader* shaderPtr);
     
+    // Forget the current bindings so the next draw sets its state in full
+    void ResetBindings(void);
+    
     // Passes
     
-    bool GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection);
+    bool GeometryPass(RenderCommand& command);
+    
+    unsigned int PackInstances(InstanceBatch* batch, Frustum& frustum);
+    
+    bool InstancingPass(InstanceBatch* batch);
+    
+    bool ParticlePass(ParticleBatch* batch);
     
-    bool ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection);
+    bool ShadowVolumePass(RenderCommand& command, RenderScenePacket& scene);
     
-    bool SortingPass(glm::vec3& eye, std::vector<MeshRenderer*>* renderQueueGroup);
+    unsigned int SortingPass(RenderCommandSegment* segment, glm::vec3& eye, Frustum& frustum, std::vector<MeshRenderer*>* renderQueueGroup);
     
     Mesh* LevelOfDetailPass(MeshRenderer* currentEntity, glm::vec3& eye);
     
-    bool CullingPass(MeshRenderer* currentEntity, Camera* currentCamera, glm::mat4& viewProjection, Frustum& frustum);
+    bool CullingPass(MeshRenderer* currentEntity, Frustum& frustum);
     
     
     // Get the edge planes from the projection matrix
@@ -314,6 +613,8 @@ private:
         Shader*  textureUnlit = nullptr;
         Shader*  color = nullptr;
         Shader*  colorUnlit = nullptr;
+        Shader*  colorInstanced = nullptr;
+        Shader*  particle = nullptr;
         Shader*  UI = nullptr;
         Shader*  shadowCaster = nullptr;
         Shader*  sky = nullptr;
@@ -0,0 +1,75 @@
+#ifndef __COMPONENT_INSTANCE_BATCH
+#define __COMPONENT_INSTANCE_BATCH
+
+#include <GameEngineFramework/Renderer/components/meshrenderer.h>
+
+#include <unordered_map>
+#include <vector>
+
+
+/// Per instance data uploaded for each mesh renderer in a batch.
+struct ENGINE_API RenderInstance {
+    
+    glm::mat4 model;
+    
+    glm::vec4 diffuse;
+    
+    glm::vec4 ambient;
+    
+};
+
+
+/// Group of mesh renderers sharing one mesh and one material which are
+/// drawn together with a single instanced draw call. Each mesh renderer
+/// supplies its own transform and its material colors, the batch material
+/// supplies the render state and the shader.
+class ENGINE_API InstanceBatch {
+
+public:
+    
+    /// Should this batch be drawn.
+    bool isActive;
+    
+    /// Mesh drawn for every instance.
+    Mesh* mesh;
+    
+    /// Render state and instancing shader for the batch.
+    Material* material;
+    
+    /// Add a mesh renderer as an instance of this batch.
+    void AddMeshRenderer(MeshRenderer* meshRenderer);
+    
+    /// Remove a mesh renderer from this batch.
+    bool RemoveMeshRenderer(MeshRenderer* meshRenderer);
+    
+    /// Get the number of mesh renderers in this batch.
+    unsigned int GetNumberOfMeshRenderers(void);
+    
+    /// Get the number of instances drawn in the last frame.
+    unsigned int GetNumberOfInstances(void);
+    
+    friend class RenderSystem;
+    
+    InstanceBatch();
+    ~InstanceBatch();
+    
+private:
+    
+    // Mesh renderers and their index in the list
+    std::vector<MeshRenderer*> mMeshRenderers;
+    std::unordered_map<MeshRenderer*, unsigned int> mRendererIndex;
+    
+    // Instances packed for the current frame
+    std::vector<RenderInstance> mInstances;
+    
+    // OpenGL buffers
+    unsigned int mVertexArray;
+    unsigned int mBufferInstance;
+    
+    // Mesh buffers currently attached to the vertex array
+    unsigned int mAttachedVertexBuffer;
+    unsigned int mAttachedIndexBuffer;
+    
+};
+
+#endif
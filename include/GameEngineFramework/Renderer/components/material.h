@@ -160,6 +160,9 @@ private:
     // The function used to blend colors.
     int mBlendFunction;
     
+    // Identifier grouping draws with this material in the render queue.
+    unsigned int mSortId;
+    
 };
 
 
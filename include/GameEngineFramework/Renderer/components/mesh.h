@@ -16,6 +16,42 @@
 extern NumberGeneration Random;
 
 
+/// Record of the buffer uploads made by meshes.
+class ENGINE_API MeshUploadTrace {
+
+public:
+    
+    /// Number of upload calls made.
+    unsigned int numberOfUploads;
+    
+    /// Total number of bytes uploaded.
+    unsigned int numberOfBytes;
+    
+    /// Number of buffers allocated or resized.
+    unsigned int numberOfAllocations;
+    
+    /// Number of stream writes made through the persistent mapping.
+    unsigned int numberOfMappedWrites;
+    
+    /// Number of stream writes that fell back to sub data uploads.
+    unsigned int numberOfSubDataWrites;
+    
+    /// Number of fences waited on before a copy in the ring was rewritten.
+    unsigned int numberOfFenceWaits;
+    
+    /// Number of fence waits that blocked while the GPU was still drawing from the copy.
+    unsigned int numberOfFenceStalls;
+    
+    /// Size in bytes of each upload in the order they were made.
+    std::vector<unsigned int> uploadSizes;
+    
+    /// Reset the counters and the upload list.
+    void Clear(void);
+    
+    MeshUploadTrace();
+    
+};
+
 
 class ENGINE_API Mesh {
     
@@ -87,6 +123,15 @@ public:
     /// Purge the vertex buffer from the GPU.
     void Unload(void);
     
+    /// Stream changes through a ring of buffers. Only the ranges modified since the last load are uploaded.
+    void SetDynamic(bool isDynamic);
+    
+    /// Return whether the mesh streams its changes.
+    bool IsDynamic(void);
+    
+    /// Record the uploads made by every mesh into a trace. Pass nullptr to stop tracing.
+    static void SetUploadTrace(MeshUploadTrace* trace);
+    
     /// Return whether the buffers are allocated on the GPU.
     bool CheckIsAllocatedOnGPU(void);
     
@@ -120,10 +165,10 @@ public:
     void DisableAttribute(int index);
     
     
-    /// Load vertex buffer data onto the GPU.
+    /// Load vertex buffer data onto the GPU. Dynamic meshes take the data into their vertex array and stream it.
     void LoadVertexBuffer(Vertex* bufferData, int vertexCount);
     
-    /// Load index buffer data onto the GPU.
+    /// Load index buffer data onto the GPU. Dynamic meshes take the data into their index array and stream it.
     void LoadIndexBuffer(Index* bufferData, int indexCount);
     
     
@@ -172,6 +217,30 @@ private:
     
     bool mAreBuffersAllocated;
     
+    // Streaming state for dynamic meshes
+    bool mIsDynamic;
+    
+    unsigned int mVertexCapacity;
+    unsigned int mIndexCapacity;
+    
+    unsigned int mNumberOfStreamSlots;
+    unsigned int mStreamSlot;
+    
+    // Persistently mapped buffer memory, null when falling back to sub data uploads
+    void* mStreamVertex;
+    void* mStreamIndex;
+    
+    // Fences guarding each copy against writes while a draw is in flight
+    void* mStreamFence[RENDER_NUMBER_OF_STREAM_BUFFERS];
+    
+    // Ranges modified since each copy was last written
+    unsigned int mDirtyVertexBegin [RENDER_NUMBER_OF_STREAM_BUFFERS];
+    unsigned int mDirtyVertexEnd   [RENDER_NUMBER_OF_STREAM_BUFFERS];
+    unsigned int mDirtyIndexBegin  [RENDER_NUMBER_OF_STREAM_BUFFERS];
+    unsigned int mDirtyIndexEnd    [RENDER_NUMBER_OF_STREAM_BUFFERS];
+    
+    static MeshUploadTrace* mUploadTrace;
+    
     // Vertex buffer array
     std::vector<Vertex>   mVertexBuffer;
     // Index buffer array
@@ -189,6 +258,26 @@ private:
     void AllocateBuffers(void);
     void FreeBuffers(void);
     
+    // Mark a range of vertices and indices to be streamed on the next load
+    void MarkDirty(unsigned int vertexBegin, unsigned int vertexEnd, unsigned int indexBegin, unsigned int indexEnd);
+    
+    // Replace the buffers with a ring large enough for the current data
+    void ReserveStreamBuffers(void);
+    
+    // Release the fences and mapped memory of the ring
+    void ReleaseStreamBuffers(void);
+    
+    // Write the dirty ranges into the next copy in the ring
+    void StreamBuffers(void);
+    
+    // Write the dirty ranges of a copy and mark it clean
+    void WriteStreamSlot(unsigned int slot);
+    
+    static void TraceUpload(unsigned int size);
+    static void TraceStreamWrite(unsigned int size, bool isMapped);
+    static void TraceFenceWait(bool isStalled);
+    static void TraceAllocation(void);
+    
 };
 
 
@@ -0,0 +1,58 @@
+#ifndef __COMPONENT_PARTICLE_BATCH
+#define __COMPONENT_PARTICLE_BATCH
+
+#include <GameEngineFramework/Renderer/components/mesh.h>
+#include <GameEngineFramework/Renderer/components/material.h>
+
+
+/// Particles drawn as instances of one shared mesh. The owner keeps the
+/// particle positions, scales and colors in separate arrays and hands them
+/// to the batch every frame. Each array is copied into its own section of
+/// one instance buffer without being repacked.
+class ENGINE_API ParticleBatch {
+
+public:
+    
+    /// Should this batch be drawn.
+    bool isActive;
+    
+    /// Mesh drawn for every particle.
+    Mesh* mesh;
+    
+    /// Render state and particle shader for the batch.
+    Material* material;
+    
+    /// Set the particle arrays to draw. The arrays must stay valid until the batch is drawn.
+    void SetParticles(const glm::vec3* positions, const glm::vec3* scales, const glm::vec3* colors, unsigned int count);
+    
+    /// Get the number of particles drawn by this batch.
+    unsigned int GetNumberOfParticles(void);
+    
+    friend class RenderSystem;
+    
+    ParticleBatch();
+    ~ParticleBatch();
+    
+private:
+    
+    // Particle arrays owned by the caller
+    const glm::vec3* mPositions;
+    const glm::vec3* mScales;
+    const glm::vec3* mColors;
+    
+    unsigned int mNumberOfParticles;
+    
+    // OpenGL buffers
+    unsigned int mVertexArray;
+    unsigned int mBufferInstance;
+    
+    // Number of particles the instance buffer sections can hold
+    unsigned int mCapacity;
+    
+    // Mesh buffers currently attached to the vertex array
+    unsigned int mAttachedVertexBuffer;
+    unsigned int mAttachedIndexBuffer;
+    
+};
+
+#endif
@@ -2,6 +2,8 @@
 #define __COMPONENT_SCENE
 
 #include <GameEngineFramework/Renderer/components/meshrenderer.h>
+#include <GameEngineFramework/Renderer/components/instancebatch.h>
+#include <GameEngineFramework/Renderer/components/particlebatch.h>
 #include <GameEngineFramework/Renderer/components/camera.h>
 #include <GameEngineFramework/Renderer/components/light.h>
 #include <GameEngineFramework/Renderer/components/fog.h>
@@ -26,6 +28,18 @@ public:
     /// Remove a mesh renderer from this scene.
     bool RemoveMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup);
     
+    /// Add an instance batch to this scene. Batches are drawn after the geometry queue.
+    void AddInstanceBatchToScene(InstanceBatch* batch);
+    
+    /// Remove an instance batch from this scene.
+    bool RemoveInstanceBatchFromScene(InstanceBatch* batch);
+    
+    /// Add a particle batch to this scene. Particles are drawn after the instance batches.
+    void AddParticleBatchToScene(ParticleBatch* batch);
+    
+    /// Remove a particle batch from this scene.
+    bool RemoveParticleBatchFromScene(ParticleBatch* batch);
+    
     /// Add a light to this scene.
     void AddLightToSceneRoot(Light* light);
     
@@ -55,6 +69,12 @@ private:
     std::vector<MeshRenderer*>  mRenderQueueBackground;
     std::vector<MeshRenderer*>  mRenderQueueSky;
     
+    // List of instance batches in this scene
+    std::vector<InstanceBatch*>  mInstanceBatches;
+    
+    // List of particle batches in this scene
+    std::vector<ParticleBatch*>  mParticleBatches;
+    
     // List of lights in this scene
     std::vector<Light*>  mLightList;
     
@@ -82,7 +82,7 @@ public:
     void SetLightColors(unsigned int numberOfLights, glm::vec3* lightColors);
     
     
-    /// Set default uniform locations.
+    /// Set default uniform locations and attach the shared uniform blocks.
     void SetUniformLocations(void);
     
     /// Compile a vertex and fragment script into a shader program.
@@ -137,8 +137,14 @@ private:
     
     bool  mIsShaderLoaded;
     
+    // Uniform updates sent by every shader, counted per frame by the renderer
+    static unsigned int mNumberOfUniformUpdates;
+    
     unsigned int CompileSource(unsigned int Type, std::string Script);
     
+    // Attach a named uniform block to its binding point if the program uses it
+    void BindUniformBlock(std::string blockName, unsigned int bindingPoint);
+    
 };
 
 
@@ -18,6 +18,18 @@
 #define RENDER_FOG_LAYER_2        2
 #define RENDER_FOG_LAYER_3        3
 
+// Vertex attribute location of the first per instance attribute
+
+#define RENDER_INSTANCE_ATTRIBUTE 4
+
+// Uniform buffer binding points
+// Array sizes in the shader blocks must match the light and fog layer limits
+
+#define RENDER_UNIFORM_BLOCK_CAMERA  0
+#define RENDER_UNIFORM_BLOCK_LIGHTS  1
+#define RENDER_UNIFORM_BLOCK_FOG     2
+#define RENDER_UNIFORM_BLOCK_OBJECT  3
+
 // Mesh primitive drawing types
 
 #define  MESH_POINTS          GL_POINTS
@@ -31,9 +31,12 @@ public:
     /// Local scale relative to the parent scale.
     glm::vec3 localScale;
     
-    /// Transform matrix
+    /// Transform matrix in world space.
     glm::mat4 matrix;
     
+    /// Cached matrix built from the position, rotation and scale.
+    glm::mat4 localMatrix;
+    
     /// Pointer to a parent transform.
     Transform* parent;
     
@@ -43,6 +46,9 @@ public:
     /// Should the scale inherit from the parent transform
     bool inheritParentScale;
     
+    /// Should the cached matrices be rebuilt on the next update pass.
+    bool isDirty;
+    
     Transform();
     Transform(glm::vec3 init_position);
     
@@ -104,6 +110,29 @@ public:
     /// Update the model matrix from the current position, rotation and scale.
     void UpdateMatrix(void);
     
+    /// Flag the cached matrices to be rebuilt on the next update pass.
+    void MarkDirty(void);
+    
+    /// Rebuild the cached local and world matrices if this transform or any of its 
+    /// parents have changed. Parents are updated before their children and each 
+    /// transform is processed once per pass. Returns true if the world matrix was rebuilt.
+    bool UpdateCachedMatrix(unsigned int pass);
+    
+private:
+    
+    // Local state the cached matrices were last built from
+    glm::vec3  mCachedPosition;
+    glm::quat  mCachedRotation;
+    glm::vec3  mCachedScale;
+    Transform* mCachedParent;
+    
+    bool mCachedInheritRotation;
+    bool mCachedInheritScale;
+    
+    // Update pass bookkeeping
+    unsigned int mUpdatePass;
+    bool mWasUpdated;
+    
 };
 
 
@@ -61,6 +61,13 @@
 
 #define  RENDER_NUMBER_OF_QUEUE_GROUPS   7
 
+// Copies of the vertex data kept in flight for dynamic meshes
+#define  RENDER_NUMBER_OF_STREAM_BUFFERS  3
+
+// Threads recording render commands, kept apart from the job system workers
+// (Kept small as the job system already runs one per hardware thread)
+#define  RENDER_NUMBER_OF_RECORDING_WORKERS  2
+
 
 
 //
@@ -69,14 +76,31 @@
 
 #define PHYSICS_UPDATES_PER_SECOND         60
 
+// Rays cast per job in a ray cast batch
+#define PHYSICS_RAYCAST_BATCH_SIZE         64
+
 
 
 //
-// Unit testing
+// Unit testing / benchmarks
 //
 
 //#define RUN_UNIT_TESTS
 
+//#define RUN_BENCHMARKS
+
+
+
+//
+// Job system
+//
+
+// Number of worker threads (Zero uses one per hardware thread, less the main thread)
+#define  JOB_SYSTEM_NUMBER_OF_WORKERS      0
+
+// Components processed per job in the parallel component updates
+#define  JOB_SYSTEM_COMPONENT_BATCH_SIZE   512
+
 
 
 //
@@ -92,6 +116,15 @@
 
 #define NEURAL_LAYER_WIDTH  5
 
+// Threads running the actor simulation including the AI thread (Zero uses one per hardware thread)
+#define  ACTOR_SYSTEM_NUMBER_OF_THREADS    0
+
+// Actors processed per job in the parallel actor update
+#define  ACTOR_SYSTEM_BATCH_SIZE           128
+
+// Width of a cell in the actor proximity grid
+#define  ACTOR_SYSTEM_GRID_CELL_SIZE       32.0f
+
 
 
 
@@ -2,30 +2,39 @@
 #include <GameEngineFramework/Logging/Logging.h>
 #include <GameEngineFramework/Math/Random.h>
 
+#include <algorithm>
+
 extern Logger Log;
-extern ActorSystem AI;
 extern NumberGeneration Random;
 extern MathCore Math;
 
-// Actor system thread
-bool isActorThreadActive = true;
-bool doUpdate = false;
-void actorThreadMain(void);
-
-int actorCounter=0;
-int tickCounter=0;
 
-
-ActorSystem::ActorSystem() : 
+ActorSystem::ActorSystem() :
     mPlayerPosition(0),
     mActorUpdateDistance(300),
-    mWorldWaterLevel(0.0f)
+    mWorldWaterLevel(0.0f),
+    mSimulationPlayerPosition(0),
+    mSimulationUpdateDistance(300),
+    mSimulationWaterLevel(0.0f),
+    mNumberOfThreads(0),
+    mActorSystemThread(nullptr),
+    mIsThreadActive(false),
+    mIsUpdatePending(false),
+    mEpoch(0),
+    mRequestedEpoch(0)
 {
 }
 
 void ActorSystem::Initiate(void) {
     
-    mActorSystemThread = new std::thread( actorThreadMain );
+    mRandom.SetSeed( Random.Range(0, 2147483647) );
+    
+    if (mNumberOfThreads == 0) 
+        SetNumberOfThreads( ACTOR_SYSTEM_NUMBER_OF_THREADS );
+    
+    mIsThreadActive = true;
+    
+    mActorSystemThread = new std::thread( &ActorSystem::ThreadMain, this );
     
     Log.Write( " >> Starting thread AI" );
     
@@ -34,47 +43,113 @@ void ActorSystem::Initiate(void) {
 
 void ActorSystem::Shutdown(void) {
     
+    if (mActorSystemThread != nullptr) {
+        
+        {
+            std::lock_guard<std::mutex> lock(mSignalMux);
+            mIsThreadActive = false;
+        }
+        
+        mSignal.notify_one();
+        
+        mActorSystemThread->join();
+        
+        delete mActorSystemThread;
+        mActorSystemThread = nullptr;
+    }
+    
+    mWorkers.Shutdown();
+    mNumberOfThreads = 0;
+    
+    // The AI thread is gone, release anything still queued
+    mRequestedEpoch = mEpoch.load(std::memory_order_acquire);
+    
     mux.lock();
-    isActorThreadActive = false;
+    for (unsigned int i=0; i < mDestroyQueue.size(); i++)
+        ReleaseActor( mDestroyQueue[i] );
+    mDestroyQueue.clear();
     mux.unlock();
     
-    mActorSystemThread->join();
-    
     return;
 }
 
 void ActorSystem::SetWaterLevel(float waterLevel) {
-    mux.lock();
     mWorldWaterLevel = waterLevel;
-    mux.unlock();
     return;
 }
 
 float ActorSystem::GetWaterLevel(void) {
-    mux.lock();
-    float waterLevel = mWorldWaterLevel;
-    mux.unlock();
-    return waterLevel;
+    return mWorldWaterLevel;
 }
 
 void ActorSystem::SetPlayerWorldPosition(glm::vec3 position) {
-    mux.lock();
     mPlayerPosition = position;
-    mux.unlock();
     return;
 }
 
 glm::vec3 ActorSystem::GetPlayerWorldPosition(void) {
-    mux.lock();
-    glm::vec3 position(mPlayerPosition);
-    mux.unlock();
-    return position;
+    return mPlayerPosition;
+}
+
+void ActorSystem::SetNumberOfThreads(unsigned int numberOfThreads) {
+    
+    if (numberOfThreads == 0) {
+        
+        numberOfThreads = std::thread::hardware_concurrency();
+        
+        if (numberOfThreads == 0) 
+            numberOfThreads = 1;
+    }
+    
+    // Let the current cycle finish before replacing the workers
+    while (IsUpdatePending()) 
+        std::this_thread::yield();
+    
+    mWorkers.Shutdown();
+    
+    // The AI thread works alongside the pool
+    if (numberOfThreads > 1) 
+        mWorkers.Initiate(numberOfThreads - 1);
+    
+    mNumberOfThreads = numberOfThreads;
+    
+    return;
+}
+
+unsigned int ActorSystem::GetNumberOfThreads(void) {
+    return mNumberOfThreads;
+}
+
+void ActorSystem::SetSeed(int seed) {
+    mRandom.SetSeed(seed);
+    return;
+}
+
+bool ActorSystem::IsUpdatePending(void) {
+    return mEpoch.load(std::memory_order_acquire) != mRequestedEpoch;
 }
 
 void ActorSystem::UpdateSendSignal(void) {
-    mux.lock();
-    doUpdate = true;
-    mux.unlock();
+    
+    // Let the AI thread finish its current cycle
+    if (IsUpdatePending())
+        return;
+    
+    // The AI thread is parked, hand over the states
+    ExchangeActorStates();
+    
+    if (mActorSystemThread == nullptr)
+        return;
+    
+    mRequestedEpoch++;
+    
+    {
+        std::lock_guard<std::mutex> lock(mSignalMux);
+        mIsUpdatePending = true;
+    }
+    
+    mSignal.notify_one();
+    
     return;
 }
 
@@ -82,12 +157,30 @@ Actor* ActorSystem::CreateActor(void) {
     mux.lock();
     Actor* newActor = mActors.Create();
     mux.unlock();
+    
+    newActor->mSystem = this;
+    
+    MarkPending(newActor);
+    
     return newActor;
 }
 
 bool ActorSystem::DestroyActor(Actor* actorPtr) {
+    
+    // The AI thread may still hold this actor
+    if (IsUpdatePending()) {
+        
+        actorPtr->mIsActive = false;
+        
+        mux.lock();
+        mDestroyQueue.push_back(actorPtr);
+        mux.unlock();
+        
+        return true;
+    }
+    
     mux.lock();
-    bool state = mActors.Destroy(actorPtr);
+    bool state = ReleaseActor(actorPtr);
     mux.unlock();
     return state;
 }
@@ -107,38 +200,247 @@ Actor* ActorSystem::GetActor(unsigned int index) {
     return actorPtr;
 }
 
+template<typename Contains> unsigned int ActorSystem::FinishQuery(std::vector<Actor*>& results, unsigned int begin, Contains contains) {
+    
+    // Inactive actors and actors waiting to be destroyed stay in the grid
+    // until the next exchange. Placed actors are judged where they are now.
+    unsigned int end = begin;
+    
+    for (unsigned int i=begin; i < results.size(); i++) {
+        
+        if (!results[i]->mIsActive) 
+            continue;
+        
+        if ((results[i]->mIsPending) && (!contains(results[i]->mPosition))) 
+            continue;
+        
+        results[end++] = results[i];
+    }
+    
+    results.resize(end);
+    
+    // Actors placed since the exchange that the grid has elsewhere, or not at all
+    for (unsigned int i=0; i < mPendingActors.size(); i++) {
+        
+        Actor* actor = mPendingActors[i];
+        
+        if (!actor->mIsActive) 
+            continue;
+        
+        if (!contains(actor->mPosition)) 
+            continue;
+        
+        if (std::find(results.begin() + begin, results.begin() + end, actor) != results.begin() + end) 
+            continue;
+        
+        results.push_back(actor);
+    }
+    
+    return results.size() - begin;
+}
+
+unsigned int ActorSystem::GetActorsInRadius(glm::vec3 position, float radius, std::vector<Actor*>& results) {
+    
+    float radiusSquared = radius * radius;
+    
+    mux.lock();
+    
+    unsigned int begin = results.size();
+    
+    mGrid.QueryRadius(position, radius, results);
+    
+    unsigned int count = FinishQuery(results, begin, [&](const glm::vec3& point) {
+        glm::vec3 offset = point - position;
+        return glm::dot(offset, offset) <= radiusSquared;
+    });
+    
+    mux.unlock();
+    return count;
+}
 
-void ActorSystem::SetActorUpdateDistance(float distance) {
+unsigned int ActorSystem::GetActorsInBounds(glm::vec3 min, glm::vec3 max, std::vector<Actor*>& results) {
+    
     mux.lock();
+    
+    unsigned int begin = results.size();
+    
+    mGrid.QueryBounds(min, max, results);
+    
+    unsigned int count = FinishQuery(results, begin, [&](const glm::vec3& point) {
+        return !((point.x < min.x) | (point.x > max.x) | 
+                 (point.y < min.y) | (point.y > max.y) | 
+                 (point.z < min.z) | (point.z > max.z));
+    });
+    
+    mux.unlock();
+    return count;
+}
+
+
+void ActorSystem::SetActorUpdateDistance(float distance) {
     mActorUpdateDistance = distance;
+    return;
+}
+
+
+//
+// State exchange
+//
+
+void ActorSystem::ExchangeActorStates(void) {
+    
+    mux.lock();
+    
+    for (unsigned int i=0; i < mDestroyQueue.size(); i++)
+        ReleaseActor( mDestroyQueue[i] );
+    mDestroyQueue.clear();
+    
+    mSimulationPlayerPosition = mPlayerPosition;
+    mSimulationUpdateDistance = mActorUpdateDistance;
+    mSimulationWaterLevel     = mWorldWaterLevel;
+    
+    unsigned int numberOfActors = mActors.Size();
+    
+    mSimulationActors.resize(numberOfActors);
+    
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        
+        Actor* actor = mActors[i];
+        
+        ExchangeActorState(actor);
+        
+        mSimulationActors[i] = actor;
+    }
+    
+    // The grid now holds every active actor where it stands
+    for (unsigned int i=0; i < mPendingActors.size(); i++) 
+        mPendingActors[i]->mIsPending = false;
+    mPendingActors.clear();
+    
     mux.unlock();
+    
     return;
 }
 
+void ActorSystem::ExchangeActorState(Actor* actor) {
+    
+    ActorState& simulation = actor->mSimulation;
+    ActorState& exchanged  = actor->mExchanged;
+    
+    // Publish the decisions made on the AI thread since the last exchange
+    if (simulation.isActive != exchanged.isActive)
+        actor->mIsActive = simulation.isActive;
+    
+    if (simulation.isWalking != exchanged.isWalking)
+        actor->mIsWalking = simulation.isWalking;
+    
+    if (simulation.isRunning != exchanged.isRunning)
+        actor->mIsRunning = simulation.isRunning;
+    
+    if (simulation.targetPoint != exchanged.targetPoint)
+        actor->mTargetPoint = simulation.targetPoint;
+    
+    actor->mAge      += simulation.age - exchanged.age;
+    actor->mDistance  = simulation.distance;
+    
+    // Hand the main thread state to the AI thread
+    simulation.position    = actor->mPosition;
+    simulation.targetPoint = actor->mTargetPoint;
+    simulation.age         = actor->mAge;
+    simulation.isActive    = actor->mIsActive;
+    simulation.isWalking   = actor->mIsWalking;
+    simulation.isRunning   = actor->mIsRunning;
+    
+    if (simulation.name != actor->mName)
+        simulation.name = actor->mName;
+    
+    exchanged = simulation;
+    
+    // Move the actor within the grid only when it leaves its cell
+    if (simulation.isActive) {
+        
+        if (actor->mGridHandle == SPATIAL_GRID_NONE) {
+            actor->mGridHandle = mGrid.Insert(actor, simulation.position);
+        } else {
+            mGrid.Update(actor->mGridHandle, simulation.position);
+        }
+        
+    } else if (actor->mGridHandle != SPATIAL_GRID_NONE) {
+        
+        mGrid.Remove(actor->mGridHandle);
+        actor->mGridHandle = SPATIAL_GRID_NONE;
+    }
+    
+    return;
+}
+
+bool ActorSystem::ReleaseActor(Actor* actor) {
+    
+    if (actor->mGridHandle != SPATIAL_GRID_NONE) {
+        mGrid.Remove(actor->mGridHandle);
+        actor->mGridHandle = SPATIAL_GRID_NONE;
+    }
+    
+    if (actor->mIsPending) {
+        
+        for (unsigned int i=0; i < mPendingActors.size(); i++) {
+            
+            if (mPendingActors[i] != actor) 
+                continue;
+            
+            mPendingActors[i] = mPendingActors.back();
+            mPendingActors.pop_back();
+            break;
+        }
+        
+        actor->mIsPending = false;
+    }
+    
+    return mActors.Destroy(actor);
+}
+
+void ActorSystem::MarkPending(Actor* actor) {
+    
+    if (actor->mIsPending) 
+        return;
+    
+    mux.lock();
+    actor->mIsPending = true;
+    mPendingActors.push_back(actor);
+    mux.unlock();
+    
+    return;
+}
 
 
 //
 // Actor system thread
 //
 
-void actorThreadMain() {
+void ActorSystem::ThreadMain(void) {
     
-    while (isActorThreadActive) {
+    while (true) {
         
-        if (!doUpdate) {
-            std::this_thread::sleep_for( std::chrono::duration<float, std::micro>(1) );
-            continue;
+        {
+            std::unique_lock<std::mutex> lock(mSignalMux);
+            
+            mSignal.wait(lock, [this]() {return mIsUpdatePending | !mIsThreadActive;});
+            
+            if (!mIsThreadActive)
+                break;
+            
+            mIsUpdatePending = false;
         }
         
-        AI.Update();
+        Update();
+        
+        // Release the actor states back to the main thread
+        mEpoch.fetch_add(1, std::memory_order_release);
         
         continue;
     }
     
-    std::this_thread::sleep_for( std::chrono::duration<float, std::micro>(100) );
-    
     Log.Write( " >> Shutting down on thread AI" );
     
     return;
 }
-
@@ -2,19 +2,11 @@
 #include <GameEngineFramework/Logging/Logging.h>
 #include <GameEngineFramework/Math/Random.h>
 
+#include <algorithm>
+
 extern Logger Log;
-extern ActorSystem AI;
-extern NumberGeneration Random;
 extern MathCore Math;
 
-extern bool isActorThreadActive;
-extern bool doUpdate;
-
-extern int actorCounter;
-extern int tickCounter;
-
-#define NUMBER_OF_TICKS  10000000
-
 #define DECISION_CHANCE_TO_WALK                  1000
 #define DECISION_CHANCE_TO_CHANGE_DIRECTION      1000
 #define DECISION_CHANCE_TO_FOCUS_NEARBY          10000
@@ -26,66 +18,212 @@ extern int tickCounter;
 #define DISTANCE_MINIMUM_TARGET_BREEDING         1.0f
 
 void ActorSystem::Update(void) {
-    // Tick counter
-    tickCounter++;
-    if (tickCounter < NUMBER_OF_TICKS) 
-        return;
     
-    tickCounter = 0;
-    int numberOfActors = mActors.Size();
-    int numberOfActorsPerCycle = (numberOfActors > 10) ? (numberOfActors / 10) : 1;
+    // Runs on the AI thread against the states handed over at the last exchange
+    unsigned int numberOfActors  = mSimulationActors.size();
+    unsigned int numberOfRanges  = (numberOfActors + ACTOR_SYSTEM_BATCH_SIZE - 1) / ACTOR_SYSTEM_BATCH_SIZE;
     
-    mux.lock();
-    for (int i = 0; i < numberOfActorsPerCycle; i++) {
+    if (mRangeBatches.size() < numberOfRanges)
+        mRangeBatches.resize(numberOfRanges);
+    
+    // Each range draws from its own stream so the result does not depend on
+    // which thread runs it
+    unsigned int cycleSeed = (unsigned int)mRandom.Range(0, 2147483647);
+    
+    mWorkers.ParallelFor(numberOfActors, ACTOR_SYSTEM_BATCH_SIZE, [this, cycleSeed](unsigned int begin, unsigned int end) {
+        UpdateActorRange(begin, end, cycleSeed);
+    });
+    
+    // Merge the ranges in actor order
+    for (unsigned int r=0; r < numberOfRanges; r++) {
         
-        if (actorCounter >= numberOfActors) {
-            actorCounter = 0;
-            doUpdate = false;
-            break;
-        }
+        mNeuralBatch.insert(mNeuralBatch.end(), mRangeBatches[r].begin(), mRangeBatches[r].end());
         
-        Actor* actor = mActors[actorCounter++];
-        if (!actor->mIsActive) 
-            continue;
+        mRangeBatches[r].clear();
+    }
+    
+    ProcessNeuralBatches();
+    
+    return;
+}
+
+void ActorSystem::UpdateActorRange(unsigned int begin, unsigned int end, unsigned int cycleSeed) {
+    
+    // Small pools are handed over as one range, split them the same way
+    // the workers would
+    for (unsigned int rangeBegin = begin; rangeBegin < end; rangeBegin += ACTOR_SYSTEM_BATCH_SIZE) {
         
-        actor->mux.lock();
+        unsigned int rangeIndex = rangeBegin / ACTOR_SYSTEM_BATCH_SIZE;
+        unsigned int rangeEnd   = std::min(rangeBegin + ACTOR_SYSTEM_BATCH_SIZE, end);
+        
+        RandomStream random( (int)((cycleSeed + rangeIndex) & 0x7fffffff) );
+        
+        std::vector<NeuralBatchEntry>& neuralBatch = mRangeBatches[rangeIndex];
         
-        actor->mDistance = glm::distance(mPlayerPosition, actor->mPosition);
+        std::vector<Actor*> nearbyActors;
         
-        if (actor->mDistance > mActorUpdateDistance) {
+        for (unsigned int i = rangeBegin; i < rangeEnd; i++) {
+            
+            Actor* actor = mSimulationActors[i];
+            if (!actor->mSimulation.isActive)
+                continue;
+            
+            actor->mux.lock();
+            
+            actor->mSimulation.distance = glm::distance(mSimulationPlayerPosition, actor->mSimulation.position);
+            
+            if (actor->mSimulation.distance > mSimulationUpdateDistance) {
+                actor->mux.unlock();
+                continue;
+            }
+            
+            UpdateActorState(actor, random, neuralBatch, nearbyActors);
+            
             actor->mux.unlock();
-            continue;
         }
         
-        UpdateActorState(actor);
-        
-        actor->mux.unlock();
     }
-    mux.unlock();
+    
+    return;
 }
 
-void ActorSystem::UpdateActorState(Actor* actor) {
+void ActorSystem::UpdateActorState(Actor* actor, RandomStream& random, std::vector<NeuralBatchEntry>& neuralBatch, std::vector<Actor*>& nearbyActors) {
     
-    actor->mAge++;
+    actor->mSimulation.age++;
     
-    bool isAquatic = actor->mHeightPreferenceMax < mWorldWaterLevel;
+    bool isAquatic = actor->mHeightPreferenceMax < mSimulationWaterLevel;
     
-    HandleWalkingChance(actor);
+    HandleWalkingChance(actor, random);
     HandleObservationCooldown(actor);
-    HandleFocusOnNearbyActor(actor);
-    HandleMovementCooldown(actor, isAquatic);
-    HandleStopWalkingChance(actor);
+    HandleFocusOnNearbyActor(actor, random, nearbyActors);
+    HandleMovementCooldown(actor, random, isAquatic);
+    HandleStopWalkingChance(actor, random);
+    HandleNearbyPrey(actor, nearbyActors);
+    HandleNearbyThreats(actor, nearbyActors);
     
-    HandleNeuralNetwork(actor);
+    HandleNeuralNetwork(actor, neuralBatch);
     
     return;
 }
 
-void ActorSystem::HandleNeuralNetwork(Actor* actor) {
+void ActorSystem::HandleNeuralNetwork(Actor* actor, std::vector<NeuralBatchEntry>& neuralBatch) {
     
     actor->EncodeInputLayer();
     
-    actor->DecodeOutputLayer();
+    if (actor->mNeuralOutputs.size() == 0)
+        return;
+    
+    // Queue the actor to run with the other actors sharing its network
+    NeuralBatchEntry entry;
+    entry.fingerprint    = actor->mNeuralNetwork.GetFingerprint();
+    entry.numberOfInputs = actor->mNeuralInputs.size();
+    entry.actor          = actor;
+    
+    neuralBatch.push_back(entry);
+    
+    return;
+}
+
+void ActorSystem::ProcessNeuralBatches(void) {
+    
+    // Stable so actors sharing a network keep their actor order
+    std::stable_sort(mNeuralBatch.begin(), mNeuralBatch.end());
+    
+    unsigned int numberOfEntries = mNeuralBatch.size();
+    unsigned int numberOfInputs  = 0;
+    unsigned int numberOfOutputs = 0;
+    unsigned int begin = 0;
+    
+    mNeuralRuns.clear();
+    
+    while (begin < numberOfEntries) {
+        
+        // Find the run of actors sharing the same network, split so large
+        // runs spread across the workers. Each slice runs through the
+        // network of its first actor.
+        unsigned int end = begin + 1;
+        while ((end < numberOfEntries) &&
+               (end - begin < ACTOR_SYSTEM_BATCH_SIZE) &&
+               !(mNeuralBatch[begin] < mNeuralBatch[end]))
+            end++;
+        
+        NeuralBatchRun run;
+        run.begin        = begin;
+        run.end          = end;
+        run.inputOffset  = numberOfInputs;
+        run.outputOffset = numberOfOutputs;
+        
+        mNeuralRuns.push_back(run);
+        
+        numberOfInputs  += (end - begin) * mNeuralBatch[begin].numberOfInputs;
+        numberOfOutputs += (end - begin) * mNeuralBatch[begin].actor->mNeuralOutputs.size();
+        
+        begin = end;
+    }
+    
+    mNeuralBatchInputs.resize(numberOfInputs);
+    mNeuralBatchOutputs.resize(numberOfOutputs);
+    
+    mWorkers.ParallelFor(mNeuralRuns.size(), 1, [this](unsigned int begin, unsigned int end) {
+        for (unsigned int i=begin; i < end; i++)
+            ProcessNeuralRun(i);
+    });
+    
+    mNeuralBatch.clear();
+    
+    return;
+}
+
+void ActorSystem::ProcessNeuralRun(unsigned int index) {
+    
+    const NeuralBatchRun& run = mNeuralRuns[index];
+    
+    Actor* leadActor = mNeuralBatch[run.begin].actor;
+    
+    unsigned int batchSize       = run.end - run.begin;
+    unsigned int numberOfInputs  = mNeuralBatch[run.begin].numberOfInputs;
+    unsigned int numberOfOutputs = leadActor->mNeuralOutputs.size();
+    
+    float* batchInputs  = mNeuralBatchInputs.data() + run.inputOffset;
+    float* batchOutputs = mNeuralBatchOutputs.data() + run.outputOffset;
+    
+    // Gather the encoded inputs. The main thread can write inputs
+    // through the exchange so each copy is taken under the actor lock.
+    for (unsigned int i=0; i < batchSize; i++) {
+        Actor* actor = mNeuralBatch[run.begin + i].actor;
+        float* actorInputs = batchInputs + i * numberOfInputs;
+        
+        actor->mux.lock();
+        
+        if (actor->mNeuralInputs.size() == numberOfInputs) {
+            std::copy(actor->mNeuralInputs.begin(), actor->mNeuralInputs.end(), actorInputs);
+        } else {
+            std::fill(actorInputs, actorInputs + numberOfInputs, 0.0f);
+        }
+        
+        actor->mux.unlock();
+    }
+    
+    leadActor->mux.lock();
+    leadActor->mNeuralNetwork.FeedForwardBatch(batchInputs, numberOfInputs, batchOutputs, batchSize);
+    leadActor->mux.unlock();
+    
+    // Scatter the results back into each actor
+    for (unsigned int i=0; i < batchSize; i++) {
+        Actor* actor = mNeuralBatch[run.begin + i].actor;
+        
+        actor->mux.lock();
+        
+        if (actor->mNeuralOutputs.size() == numberOfOutputs) {
+            std::copy(batchOutputs + i * numberOfOutputs,
+                      batchOutputs + (i + 1) * numberOfOutputs,
+                      actor->mNeuralOutputs.begin());
+            
+            actor->DecodeOutputLayer();
+        }
+        
+        actor->mux.unlock();
+    }
     
     return;
 }
@@ -95,12 +233,12 @@ void ActorSystem::HandleNeuralNetwork(Actor* actor) {
 
 bool ActorSystem::HandleBreedingState(Actor* actor) {
     
-    if ((actor->mTargetPoint.y < actor->mHeightPreferenceMax) | (actor->mTargetPoint.y > actor->mHeightPreferenceMin)) {
+    if ((actor->mSimulation.targetPoint.y < actor->mHeightPreferenceMax) | (actor->mSimulation.targetPoint.y > actor->mHeightPreferenceMin)) {
         
         if (actor->mBreedWithActor) {
             
-            actor->mTargetPoint = actor->mBreedWithActor->mPosition;
-            actor->mIsWalking = glm::distance(actor->mPosition, actor->mBreedWithActor->mPosition) > DISTANCE_MINIMUM_TARGET_BREEDING;
+            actor->mSimulation.targetPoint = actor->mBreedWithActor->mSimulation.position;
+            actor->mSimulation.isWalking = glm::distance(actor->mSimulation.position, actor->mBreedWithActor->mSimulation.position) > DISTANCE_MINIMUM_TARGET_BREEDING;
             
             return true;
         }
@@ -109,12 +247,12 @@ bool ActorSystem::HandleBreedingState(Actor* actor) {
     return false;
 }
 
-bool ActorSystem::HandleWalkingChance(Actor* actor) {
+bool ActorSystem::HandleWalkingChance(Actor* actor, RandomStream& random) {
     
-    if (actor->mTargetPoint.y > mWorldWaterLevel) {
+    if (actor->mSimulation.targetPoint.y > mSimulationWaterLevel) {
         
-        if (Random.Range(0, DECISION_CHANCE_TO_WALK) < actor->mChanceToWalk) 
-            actor->mIsWalking = true;
+        if (random.Range(0, DECISION_CHANCE_TO_WALK) < actor->mChanceToWalk)
+            actor->mSimulation.isWalking = true;
         
         return true;
     }
@@ -124,27 +262,55 @@ bool ActorSystem::HandleWalkingChance(Actor* actor) {
 
 void ActorSystem::HandleObservationCooldown(Actor* actor) {
     
-    if (actor->mObservationCoolDownCounter < COOLDOWN_OBSERVATION_MAX) 
+    if (actor->mObservationCoolDownCounter < COOLDOWN_OBSERVATION_MAX)
         actor->mObservationCoolDownCounter++;
     
     return;
 }
 
-void ActorSystem::HandleFocusOnNearbyActor(Actor* actor) {
+void ActorSystem::HandleFocusOnNearbyActor(Actor* actor, RandomStream& random, std::vector<Actor*>& nearbyActors) {
     
-    if (Random.Range(0, DECISION_CHANCE_TO_FOCUS_NEARBY) < actor->mChanceToFocusOnActor) {
+    if (random.Range(0, DECISION_CHANCE_TO_FOCUS_NEARBY) < actor->mChanceToFocusOnActor) {
         
-        if (actor->mDistance < actor->mDistanceToFocusOnActor) {
+        if (actor->mSimulation.distance < actor->mDistanceToFocusOnActor) {
             
-            actor->mTargetPoint = mPlayerPosition;
+            actor->mSimulation.targetPoint = mSimulationPlayerPosition;
             actor->mObservationCoolDownCounter = 0;
             
-            actor->mIsWalking = false;
-            actor->mIsRunning = false;
+            actor->mSimulation.isWalking = false;
+            actor->mSimulation.isRunning = false;
             
         } else {
             
-            // TODO: Focus on nearby actor.
+            // Watch the closest actor within focus range
+            nearbyActors.clear();
+            mGrid.QueryRadius(actor->mSimulation.position, actor->mDistanceToFocusOnActor, nearbyActors);
+            
+            Actor* focus = nullptr;
+            float focusDistance = actor->mDistanceToFocusOnActor;
+            
+            for (unsigned int i=0; i < nearbyActors.size(); i++) {
+                
+                Actor* neighbor = nearbyActors[i];
+                if (neighbor == actor)
+                    continue;
+                
+                float distance = glm::distance(actor->mSimulation.position, neighbor->mSimulation.position);
+                if (distance > focusDistance)
+                    continue;
+                
+                focus = neighbor;
+                focusDistance = distance;
+            }
+            
+            if (focus != nullptr) {
+                
+                actor->mSimulation.targetPoint = focus->mSimulation.position;
+                actor->mObservationCoolDownCounter = 0;
+                
+                actor->mSimulation.isWalking = false;
+                actor->mSimulation.isRunning = false;
+            }
             
         }
     }
@@ -152,18 +318,18 @@ void ActorSystem::HandleFocusOnNearbyActor(Actor* actor) {
     return;
 }
 
-void ActorSystem::HandleMovementCooldown(Actor* actor, bool isAquatic) {
+void ActorSystem::HandleMovementCooldown(Actor* actor, RandomStream& random, bool isAquatic) {
     
-    if (!actor->mIsWalking && actor->mObservationCoolDownCounter != 0) {
+    if (!actor->mSimulation.isWalking && actor->mObservationCoolDownCounter != 0) {
         
         actor->mObservationCoolDownCounter = 0;
         
-        if (Random.Range(0, DECISION_CHANCE_TO_CHANGE_DIRECTION) < actor->mChanceToChangeDirection) {
+        if (random.Range(0, DECISION_CHANCE_TO_CHANGE_DIRECTION) < actor->mChanceToChangeDirection) {
             
-            float randA = Random.Range(0.0f, actor->mDistanceToWalk);
-            float randB = Random.Range(0.0f, actor->mDistanceToWalk);
-            float randC = Random.Range(0.0f, actor->mDistanceToWalk);
-            float randD = Random.Range(0.0f, actor->mDistanceToWalk);
+            float randA = random.Range(0.0f, actor->mDistanceToWalk);
+            float randB = random.Range(0.0f, actor->mDistanceToWalk);
+            float randC = random.Range(0.0f, actor->mDistanceToWalk);
+            float randD = random.Range(0.0f, actor->mDistanceToWalk);
             
             // Add cool down to expand random range distance
             randA += actor->mMovementCoolDownCounter + 1;
@@ -171,42 +337,139 @@ void ActorSystem::HandleMovementCooldown(Actor* actor, bool isAquatic) {
             randC += actor->mMovementCoolDownCounter + 1;
             randD += actor->mMovementCoolDownCounter + 1;
             
-            actor->mTargetPoint.x = (randA - randB) + actor->mPosition.x;
-            actor->mTargetPoint.z = (randC - randD) + actor->mPosition.z;
+            actor->mSimulation.targetPoint.x = (randA - randB) + actor->mSimulation.position.x;
+            actor->mSimulation.targetPoint.z = (randC - randD) + actor->mSimulation.position.z;
         }
         
     } else {
         
-        if ((actor->mTargetPoint.y > actor->mHeightPreferenceMax) | (actor->mTargetPoint.y < actor->mHeightPreferenceMin)) {
+        if ((actor->mSimulation.targetPoint.y > actor->mHeightPreferenceMax) | (actor->mSimulation.targetPoint.y < actor->mHeightPreferenceMin)) {
             
-            if (++actor->mMovementCoolDownCounter > COOLDOWN_MOVEMENT_MAX) 
+            if (++actor->mMovementCoolDownCounter > COOLDOWN_MOVEMENT_MAX)
                 actor->mMovementCoolDownCounter = COOLDOWN_MOVEMENT_MAX;
             
             if (!isAquatic) {
                 
-                if (actor->mPosition.y < mWorldWaterLevel && actor->mTargetPoint.y < actor->mPosition.y) 
-                    actor->mIsWalking = false;
-                
+                if (actor->mSimulation.position.y < mSimulationWaterLevel && actor->mSimulation.targetPoint.y < actor->mSimulation.position.y)
+                    actor->mSimulation.isWalking = false;
+                    
             } else {
                 
-                if (actor->mPosition.y > mWorldWaterLevel && actor->mTargetPoint.y > actor->mPosition.y) 
-                    actor->mIsWalking = false;
+                if (actor->mSimulation.position.y > mSimulationWaterLevel && actor->mSimulation.targetPoint.y > actor->mSimulation.position.y)
+                    actor->mSimulation.isWalking = false;
             }
         }
         
-        if (glm::distance(actor->mTargetPoint, actor->mPosition) < DISTANCE_MINIMUM_TARGET_REACHED) {
+        if (glm::distance(actor->mSimulation.targetPoint, actor->mSimulation.position) < DISTANCE_MINIMUM_TARGET_REACHED) {
             actor->mMovementCoolDownCounter = 0;
-            actor->mIsWalking = false;
+            actor->mSimulation.isWalking = false;
+        }
+    }
+    
+    return;
+}
+
+void ActorSystem::HandleStopWalkingChance(Actor* actor, RandomStream& random) {
+    
+    if (random.Range(0, DECISION_CHANCE_TO_STOP_MOVING) < actor->mChanceToStopWalking)
+        actor->mSimulation.isWalking = false;
+    
+    return;
+}
+
+void ActorSystem::HandleNearbyPrey(Actor* actor, std::vector<Actor*>& nearbyActors) {
+    
+    if (actor->mAttackActors.size() == 0)
+        return;
+    
+    nearbyActors.clear();
+    mGrid.QueryRadius(actor->mSimulation.position, actor->mDistanceToAttack, nearbyActors);
+    
+    Actor* prey = nullptr;
+    float preyDistance = actor->mDistanceToAttack;
+    
+    for (unsigned int i=0; i < nearbyActors.size(); i++) {
+        
+        Actor* neighbor = nearbyActors[i];
+        if (neighbor == actor)
+            continue;
+        
+        float distance = glm::distance(actor->mSimulation.position, neighbor->mSimulation.position);
+        if (distance > preyDistance)
+            continue;
+        
+        for (unsigned int n=0; n < actor->mAttackActors.size(); n++) {
+            
+            if (actor->mAttackActors[n] != neighbor->mSimulation.name)
+                continue;
+            
+            prey = neighbor;
+            preyDistance = distance;
+            
+            break;
         }
+        
     }
     
+    if (prey == nullptr)
+        return;
+    
+    // Run down the closest prey, a nearby threat still takes priority
+    actor->mSimulation.targetPoint = prey->mSimulation.position;
+    actor->mSimulation.isWalking = true;
+    actor->mSimulation.isRunning = true;
+    
     return;
 }
 
-void ActorSystem::HandleStopWalkingChance(Actor* actor) {
+void ActorSystem::HandleNearbyThreats(Actor* actor, std::vector<Actor*>& nearbyActors) {
+    
+    if (actor->mFleeFromActors.size() == 0)
+        return;
+    
+    // The grid and the neighbor positions and names only change during the exchange
+    nearbyActors.clear();
+    mGrid.QueryRadius(actor->mSimulation.position, actor->mDistanceToFlee, nearbyActors);
+    
+    Actor* threat = nullptr;
+    float threatDistance = actor->mDistanceToFlee;
+    
+    for (unsigned int i=0; i < nearbyActors.size(); i++) {
+        
+        Actor* neighbor = nearbyActors[i];
+        if (neighbor == actor)
+            continue;
+        
+        float distance = glm::distance(actor->mSimulation.position, neighbor->mSimulation.position);
+        if (distance > threatDistance)
+            continue;
+        
+        for (unsigned int n=0; n < actor->mFleeFromActors.size(); n++) {
+            
+            if (actor->mFleeFromActors[n] != neighbor->mSimulation.name)
+                continue;
+            
+            threat = neighbor;
+            threatDistance = distance;
+            
+            break;
+        }
+        
+    }
+    
+    if (threat == nullptr)
+        return;
+    
+    // Run directly away from the closest threat
+    glm::vec3 away = actor->mSimulation.position - threat->mSimulation.position;
+    away.y = 0.0f;
+    
+    if (glm::length(away) < 0.001f)
+        away = glm::vec3(1, 0, 0);
     
-    if (Random.Range(0, DECISION_CHANCE_TO_STOP_MOVING) < actor->mChanceToStopWalking) 
-        actor->mIsWalking = false;
+    actor->mSimulation.targetPoint = actor->mSimulation.position + glm::normalize(away) * actor->mDistanceToFlee;
+    actor->mSimulation.isWalking = true;
+    actor->mSimulation.isRunning = true;
     
     return;
 }
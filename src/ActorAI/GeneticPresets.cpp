@@ -6,6 +6,8 @@
 #include <GameEngineFramework/Engine/types/color.h>
 #include <GameEngineFramework/Types/Types.h>
 
+#include <cstring>
+
 extern NumberGeneration  Random;
 extern ColorPreset       Colors;
 extern FloatType         Float;
@@ -77,11 +79,17 @@ std::string GeneticPresets::ExtractGenome(Actor* actorSource) {
     return genetics;
 }
 
-bool GeneticPresets::InjectGenome(Actor* actorSource, std::string genome) {
+bool GeneticPresets::InjectGenome(Actor* actorSource, const std::string& genome) {
+    
+    if (IsBinaryGenome(genome)) 
+        return DecodeGenome(actorSource, genome);
     
     // Inject actor idiosyncrasies into the genome
     std::vector<std::string> traits = String.Explode( genome, ':' );
     
+    if (traits.size() < 15) 
+        return false;
+    
     actorSource->SetName(traits[0]);
     
     actorSource->SetSpeed( String.ToFloat(traits[1]) );
@@ -152,6 +160,244 @@ bool GeneticPresets::InjectGenome(Actor* actorSource, std::string genome) {
     return true;
 }
 
+
+//
+// Binary genomes
+//
+// Header of magic, version, gene count and a checksum of the payload 
+// followed by the name, traits and genes. Values are little endian.
+//
+
+static const char genomeMagic[4] = {'S', 'S', 'G', 'N'};
+
+static const unsigned int genomeHeaderSize   = 16;
+static const unsigned int genomeNumberOfTraits = 14;
+static const unsigned int genomeGeneSize     = (19 * sizeof(float)) + sizeof(uint32_t) + sizeof(uint8_t);
+
+static const uint8_t genomeFlagExpress          = 0x01;
+static const uint8_t genomeFlagAnimationCycle   = 0x02;
+static const uint8_t genomeFlagInverseAnimation = 0x04;
+
+static inline void GenomeWriteUInt(std::string& buffer, uint32_t value) {
+    char bytes[4] = {(char)(value & 0xff), (char)((value >> 8) & 0xff), (char)((value >> 16) & 0xff), (char)((value >> 24) & 0xff)};
+    buffer.append(bytes, 4);
+}
+
+static inline void GenomeWriteFloat(std::string& buffer, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    GenomeWriteUInt(buffer, bits);
+}
+
+static inline void GenomeWriteBase(std::string& buffer, const BaseGene& base) {
+    GenomeWriteFloat(buffer, base.x);
+    GenomeWriteFloat(buffer, base.y);
+    GenomeWriteFloat(buffer, base.z);
+}
+
+static inline uint32_t GenomeReadUInt(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static inline float GenomeReadFloat(const uint8_t*& data) {
+    uint32_t bits = GenomeReadUInt(data);
+    data += sizeof(float);
+    
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+static inline void GenomeReadBase(const uint8_t*& data, BaseGene& base) {
+    base.x = GenomeReadFloat(data);
+    base.y = GenomeReadFloat(data);
+    base.z = GenomeReadFloat(data);
+}
+
+// FNV-1a
+static uint32_t GenomeChecksum(const uint8_t* data, unsigned int size) {
+    uint32_t hash = 2166136261u;
+    for (unsigned int i=0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool GeneticPresets::IsBinaryGenome(const std::string& genome) {
+    
+    if (genome.size() < genomeHeaderSize) 
+        return false;
+    
+    return std::memcmp(genome.data(), genomeMagic, 4) == 0;
+}
+
+void GeneticPresets::EncodeGenome(Actor* actorSource, std::string& genome) {
+    
+    actorSource->mux.lock();
+    
+    uint32_t numberOfGenes = actorSource->mGenes.size();
+    uint32_t nameLength    = actorSource->mName.size();
+    
+    genome.clear();
+    genome.reserve(genomeHeaderSize + sizeof(uint32_t) + nameLength + 
+                   (genomeNumberOfTraits * sizeof(float)) + (numberOfGenes * genomeGeneSize));
+    
+    // Header with the checksum filled in below
+    genome.append(genomeMagic, 4);
+    GenomeWriteUInt(genome, GENOME_VERSION);
+    GenomeWriteUInt(genome, numberOfGenes);
+    GenomeWriteUInt(genome, 0);
+    
+    GenomeWriteUInt(genome, nameLength);
+    genome.append(actorSource->mName);
+    
+    GenomeWriteFloat(genome, actorSource->mSpeed);
+    GenomeWriteFloat(genome, actorSource->mSpeedMul);
+    GenomeWriteFloat(genome, actorSource->mSpeedYouth);
+    
+    GenomeWriteFloat(genome, actorSource->mYouthScale);
+    GenomeWriteFloat(genome, actorSource->mAdultScale);
+    
+    // Personality
+    GenomeWriteFloat(genome, actorSource->mChanceToChangeDirection);
+    GenomeWriteFloat(genome, actorSource->mChanceToFocusOnActor);
+    GenomeWriteFloat(genome, actorSource->mChanceToStopWalking);
+    GenomeWriteFloat(genome, actorSource->mChanceToWalk);
+    
+    GenomeWriteFloat(genome, actorSource->mDistanceToWalk);
+    GenomeWriteFloat(genome, actorSource->mDistanceToAttack);
+    GenomeWriteFloat(genome, actorSource->mDistanceToFlee);
+    GenomeWriteFloat(genome, actorSource->mHeightPreferenceMin);
+    GenomeWriteFloat(genome, actorSource->mHeightPreferenceMax);
+    
+    for (unsigned int i=0; i < numberOfGenes; i++) {
+        
+        const Gene& gene = actorSource->mGenes[i];
+        
+        GenomeWriteBase(genome, gene.offset);
+        GenomeWriteBase(genome, gene.position);
+        GenomeWriteBase(genome, gene.rotation);
+        GenomeWriteBase(genome, gene.scale);
+        GenomeWriteBase(genome, gene.color);
+        GenomeWriteBase(genome, gene.animationAxis);
+        GenomeWriteFloat(genome, gene.animationRange);
+        
+        GenomeWriteUInt(genome, gene.attachmentIndex);
+        
+        uint8_t flags = 0;
+        if (gene.doExpress)          flags |= genomeFlagExpress;
+        if (gene.doAnimationCycle)   flags |= genomeFlagAnimationCycle;
+        if (gene.doInverseAnimation) flags |= genomeFlagInverseAnimation;
+        
+        genome.push_back((char)flags);
+        
+        continue;
+    }
+    
+    actorSource->mux.unlock();
+    
+    uint32_t checksum = GenomeChecksum((const uint8_t*)genome.data() + genomeHeaderSize, genome.size() - genomeHeaderSize);
+    
+    for (unsigned int i=0; i < 4; i++) 
+        genome[12 + i] = (char)((checksum >> (i * 8)) & 0xff);
+    
+    return;
+}
+
+bool GeneticPresets::DecodeGenome(Actor* actorSource, const std::string& genome) {
+    
+    if (!IsBinaryGenome(genome)) 
+        return false;
+    
+    const uint8_t* data = (const uint8_t*)genome.data();
+    unsigned int size = genome.size();
+    
+    uint32_t version       = GenomeReadUInt(data + 4);
+    uint32_t numberOfGenes = GenomeReadUInt(data + 8);
+    uint32_t checksum      = GenomeReadUInt(data + 12);
+    
+    if (version != GENOME_VERSION) 
+        return false;
+    
+    if (size < genomeHeaderSize + sizeof(uint32_t)) 
+        return false;
+    
+    uint32_t nameLength = GenomeReadUInt(data + genomeHeaderSize);
+    
+    // Check the sizes add up before reading any values
+    uint64_t expectedSize = (uint64_t)genomeHeaderSize + sizeof(uint32_t) + nameLength + 
+                            (genomeNumberOfTraits * sizeof(float)) + ((uint64_t)numberOfGenes * genomeGeneSize);
+    
+    if (expectedSize != size) 
+        return false;
+    
+    if (GenomeChecksum(data + genomeHeaderSize, size - genomeHeaderSize) != checksum) 
+        return false;
+    
+    const uint8_t* cursor = data + genomeHeaderSize + sizeof(uint32_t);
+    
+    actorSource->mux.lock();
+    
+    actorSource->mName.assign((const char*)cursor, nameLength);
+    cursor += nameLength;
+    
+    actorSource->mSpeed      = GenomeReadFloat(cursor);
+    actorSource->mSpeedMul   = GenomeReadFloat(cursor);
+    actorSource->mSpeedYouth = GenomeReadFloat(cursor);
+    
+    actorSource->mYouthScale = GenomeReadFloat(cursor);
+    actorSource->mAdultScale = GenomeReadFloat(cursor);
+    
+    // Personality
+    actorSource->mChanceToChangeDirection = GenomeReadFloat(cursor);
+    actorSource->mChanceToFocusOnActor    = GenomeReadFloat(cursor);
+    actorSource->mChanceToStopWalking     = GenomeReadFloat(cursor);
+    actorSource->mChanceToWalk            = GenomeReadFloat(cursor);
+    
+    actorSource->mDistanceToWalk      = GenomeReadFloat(cursor);
+    actorSource->mDistanceToAttack    = GenomeReadFloat(cursor);
+    actorSource->mDistanceToFlee      = GenomeReadFloat(cursor);
+    actorSource->mHeightPreferenceMin = GenomeReadFloat(cursor);
+    actorSource->mHeightPreferenceMax = GenomeReadFloat(cursor);
+    
+    // Genes are read straight into the actor genome
+    unsigned int firstGene = actorSource->mGenes.size();
+    actorSource->mGenes.resize(firstGene + numberOfGenes);
+    
+    for (unsigned int i=0; i < numberOfGenes; i++) {
+        
+        Gene& gene = actorSource->mGenes[firstGene + i];
+        
+        GenomeReadBase(cursor, gene.offset);
+        GenomeReadBase(cursor, gene.position);
+        GenomeReadBase(cursor, gene.rotation);
+        GenomeReadBase(cursor, gene.scale);
+        GenomeReadBase(cursor, gene.color);
+        GenomeReadBase(cursor, gene.animationAxis);
+        gene.animationRange = GenomeReadFloat(cursor);
+        
+        gene.attachmentIndex = GenomeReadUInt(cursor);
+        cursor += sizeof(uint32_t);
+        
+        uint8_t flags = *cursor;
+        cursor++;
+        
+        gene.doExpress          = (flags & genomeFlagExpress) != 0;
+        gene.doAnimationCycle   = (flags & genomeFlagAnimationCycle) != 0;
+        gene.doInverseAnimation = (flags & genomeFlagInverseAnimation) != 0;
+        
+        continue;
+    }
+    
+    actorSource->mDoUpdateGenetics = true;
+    
+    actorSource->mux.unlock();
+    
+    return true;
+}
+
+
 bool GeneticPresets::ConjugateGenome(Actor* actorA, Actor* actorB, Actor* targetActor) {
     
     unsigned int numberOfGenesA = actorA->mGenes.size();
@@ -3,21 +3,372 @@
 #include <GameEngineFramework/Engine/Engine.h>
 
 #include <sstream>
+#include <atomic>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define NEURAL_NETWORK_SSE
+ #include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+ #define NEURAL_NETWORK_AVX2
+ #include <immintrin.h>
+#endif
 
 extern FloatType    Float;
 extern UIntType     UInt;
 extern StringType   String;
 
 
-NeuralNetwork::NeuralNetwork() {}
+//
+// Neural buffer storage
+//
+
+static std::atomic<unsigned long long int> neuralAllocationCount(0);
+
+void* NeuralAllocate(std::size_t size, std::size_t alignment) {
+    
+    // Over allocate and keep the original address just before the aligned block
+    void* block = std::malloc(size + alignment + sizeof(void*));
+    if (block == nullptr) 
+        throw std::bad_alloc();
+    
+    uintptr_t address = ((uintptr_t)block + sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    ((void**)address)[-1] = block;
+    
+    neuralAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    
+    return (void*)address;
+}
+
+void NeuralFree(void* block) {
+    
+    if (block == nullptr) 
+        return;
+    
+    std::free( ((void**)block)[-1] );
+    
+    return;
+}
+
+unsigned long long int NeuralGetAllocationCount(void) {
+    
+    return neuralAllocationCount.load(std::memory_order_relaxed);
+}
+
+
+//
+// Inference kernels
+//
+// Weight rows and neuron buffers are padded with zeros to a multiple of 
+// NEURAL_LANE_WIDTH floats and aligned, so the dot products run over whole 
+// vectors without tail handling. Four rows are reduced together so the 
+// horizontal sums are shared.
+//
+
+// Rational tanh approximation, accurate to a few float ulp
+static const float tanhClamp = 7.90531110763549805f;
+
+static const float tanhAlpha1  =  4.89352455891786e-03f;
+static const float tanhAlpha3  =  6.37261928875436e-04f;
+static const float tanhAlpha5  =  1.48572235717979e-05f;
+static const float tanhAlpha7  =  5.12229709037114e-08f;
+static const float tanhAlpha9  = -8.60467152213735e-11f;
+static const float tanhAlpha11 =  2.00018790482477e-13f;
+static const float tanhAlpha13 = -2.76076847742355e-16f;
+
+static const float tanhBeta0 = 4.89352518554385e-03f;
+static const float tanhBeta2 = 2.26843463243900e-03f;
+static const float tanhBeta4 = 1.18534705686654e-04f;
+static const float tanhBeta6 = 1.19825839466702e-06f;
+
+static inline float NeuralTanh(float x) {
+    
+    x = std::min(std::max(x, -tanhClamp), tanhClamp);
+    
+    float x2 = x * x;
+    
+    float p = tanhAlpha13;
+    p = p * x2 + tanhAlpha11;
+    p = p * x2 + tanhAlpha9;
+    p = p * x2 + tanhAlpha7;
+    p = p * x2 + tanhAlpha5;
+    p = p * x2 + tanhAlpha3;
+    p = p * x2 + tanhAlpha1;
+    p = p * x;
+    
+    float q = tanhBeta6;
+    q = q * x2 + tanhBeta4;
+    q = q * x2 + tanhBeta2;
+    q = q * x2 + tanhBeta0;
+    
+    return p / q;
+}
+
+#ifdef NEURAL_NETWORK_SSE
+
+static inline __m128 NeuralTanh4(__m128 x) {
+    
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-tanhClamp)), _mm_set1_ps(tanhClamp));
+    
+    __m128 x2 = _mm_mul_ps(x, x);
+    
+    __m128 p = _mm_set1_ps(tanhAlpha13);
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha11));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha9));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha7));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha5));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha3));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(tanhAlpha1));
+    p = _mm_mul_ps(p, x);
+    
+    __m128 q = _mm_set1_ps(tanhBeta6);
+    q = _mm_add_ps(_mm_mul_ps(q, x2), _mm_set1_ps(tanhBeta4));
+    q = _mm_add_ps(_mm_mul_ps(q, x2), _mm_set1_ps(tanhBeta2));
+    q = _mm_add_ps(_mm_mul_ps(q, x2), _mm_set1_ps(tanhBeta0));
+    
+    return _mm_div_ps(p, q);
+}
+
+// Multiply and accumulate a block of lanes from four rows
+static inline void NeuralAccumulate4(const float* row, unsigned int stride, const float* input, unsigned int count, __m128* sum) {
+    
+#ifdef NEURAL_NETWORK_AVX2
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    
+    for (unsigned int i=0; i < count; i += 8) {
+        __m256 value = _mm256_load_ps(input + i);
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_load_ps(row + i), value));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_load_ps(row + stride + i), value));
+        sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(_mm256_load_ps(row + stride * 2 + i), value));
+        sum3 = _mm256_add_ps(sum3, _mm256_mul_ps(_mm256_load_ps(row + stride * 3 + i), value));
+    }
+    
+    sum[0] = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    sum[1] = _mm_add_ps(_mm256_castps256_ps128(sum1), _mm256_extractf128_ps(sum1, 1));
+    sum[2] = _mm_add_ps(_mm256_castps256_ps128(sum2), _mm256_extractf128_ps(sum2, 1));
+    sum[3] = _mm_add_ps(_mm256_castps256_ps128(sum3), _mm256_extractf128_ps(sum3, 1));
+#else
+    sum[0] = _mm_setzero_ps();
+    sum[1] = _mm_setzero_ps();
+    sum[2] = _mm_setzero_ps();
+    sum[3] = _mm_setzero_ps();
+    
+    for (unsigned int i=0; i < count; i += 4) {
+        __m128 value = _mm_load_ps(input + i);
+        sum[0] = _mm_add_ps(sum[0], _mm_mul_ps(_mm_load_ps(row + i), value));
+        sum[1] = _mm_add_ps(sum[1], _mm_mul_ps(_mm_load_ps(row + stride + i), value));
+        sum[2] = _mm_add_ps(sum[2], _mm_mul_ps(_mm_load_ps(row + stride * 2 + i), value));
+        sum[3] = _mm_add_ps(sum[3], _mm_mul_ps(_mm_load_ps(row + stride * 3 + i), value));
+    }
+#endif
+    
+    return;
+}
+
+#endif
+
+// Output = weights * input + biases for a layer of rows
+static void NeuralMatrixVector(const float* weights, unsigned int stride, unsigned int numberOfRows, const float* input, const float* biases, float* output) {
+    
+    unsigned int row = 0;
+    
+#ifdef NEURAL_NETWORK_SSE
+    for (; row + 4 <= numberOfRows; row += 4) {
+        
+        __m128 sum[4];
+        NeuralAccumulate4(weights + row * stride, stride, input, stride, sum);
+        
+        // Transpose so each lane holds the total of one row
+        _MM_TRANSPOSE4_PS(sum[0], sum[1], sum[2], sum[3]);
+        
+        __m128 total = _mm_add_ps(_mm_add_ps(sum[0], sum[1]), _mm_add_ps(sum[2], sum[3]));
+        
+        _mm_storeu_ps(output + row, _mm_add_ps(total, _mm_loadu_ps(biases + row)));
+    }
+#endif
+    
+    for (; row < numberOfRows; row++) {
+        
+        const float* weightRow = weights + row * stride;
+        
+        float sum = 0.0f;
+        for (unsigned int i=0; i < stride; i++) 
+            sum += weightRow[i] * input[i];
+        
+        output[row] = sum + biases[row];
+    }
+    
+    return;
+}
+
+// Output rows = weights * input rows + biases for a batch of padded input rows
+static void NeuralMatrixMatrix(const float* weights, unsigned int stride, unsigned int numberOfRows, const float* input, const float* biases, float* output, unsigned int width, unsigned int batchSize) {
+    
+    // Work through the batch in tiles so the tile inputs stay in cache while
+    // each block of weight rows is applied to every dataset in the tile
+    const unsigned int tileSize = 64;
+    
+    for (unsigned int tile = 0; tile < batchSize; tile += tileSize) {
+        
+        unsigned int tileEnd = std::min(tile + tileSize, batchSize);
+        
+        unsigned int row = 0;
+
+#ifdef NEURAL_NETWORK_SSE
+        for (; row + 4 <= numberOfRows; row += 4) {
+            
+            const float* weightBlock = weights + row * stride;
+            __m128 bias = _mm_loadu_ps(biases + row);
+            
+            for (unsigned int b = tile; b < tileEnd; b++) {
+                
+                __m128 sum[4];
+                NeuralAccumulate4(weightBlock, stride, input + b * width, stride, sum);
+                
+                _MM_TRANSPOSE4_PS(sum[0], sum[1], sum[2], sum[3]);
+                
+                __m128 total = _mm_add_ps(_mm_add_ps(sum[0], sum[1]), _mm_add_ps(sum[2], sum[3]));
+                
+                _mm_storeu_ps(output + b * width + row, _mm_add_ps(total, bias));
+            }
+        }
+#endif
+        
+        for (; row < numberOfRows; row++) {
+            
+            const float* weightRow = weights + row * stride;
+            
+            for (unsigned int b = tile; b < tileEnd; b++) {
+                
+                const float* inputRow = input + b * width;
+                
+                float sum = 0.0f;
+                for (unsigned int i=0; i < stride; i++) 
+                    sum += weightRow[i] * inputRow[i];
+                
+                output[b * width + row] = sum + biases[row];
+            }
+        }
+        
+    }
+    
+    return;
+}
+
+// Apply the activation over a padded neuron buffer
+static void NeuralActivate(float* values, unsigned int count) {
+    
+    unsigned int i = 0;
+    
+#ifdef NEURAL_NETWORK_SSE
+    for (; i + 4 <= count; i += 4) 
+        _mm_store_ps(values + i, NeuralTanh4(_mm_load_ps(values + i)));
+#endif
+    
+    for (; i < count; i++) 
+        values[i] = NeuralTanh(values[i]);
+    
+    return;
+}
+
+
+//
+// Training kernels
+//
+// Back propagation walks each weight row once, adding the row gradient and 
+// passing the error back to the previous layer in the same pass.
+//
+
+// y += a * x
+static inline void NeuralAxpy(float* y, const float* x, float a, unsigned int count) {
+    
+    unsigned int i = 0;
+
+#ifdef NEURAL_NETWORK_SSE
+    __m128 scale = _mm_set1_ps(a);
+    
+    for (; i + 4 <= count; i += 4) 
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(scale, _mm_loadu_ps(x + i))));
+#endif
+    
+    for (; i < count; i++) 
+        y[i] += a * x[i];
+    
+    return;
+}
+
+// Add delta * previous to a gradient row and delta * weights to the previous layer error
+static inline void NeuralBackwardRow(const float* weightRow, float* gradientRow, const float* previous, float* error, float delta, unsigned int count) {
+    
+    unsigned int i = 0;
+
+#ifdef NEURAL_NETWORK_SSE
+    __m128 scale = _mm_set1_ps(delta);
+    
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(gradientRow + i, _mm_add_ps(_mm_loadu_ps(gradientRow + i), _mm_mul_ps(scale, _mm_loadu_ps(previous + i))));
+        _mm_storeu_ps(error + i,       _mm_add_ps(_mm_loadu_ps(error + i),       _mm_mul_ps(scale, _mm_loadu_ps(weightRow + i))));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        gradientRow[i] += delta * previous[i];
+        error[i]       += delta * weightRow[i];
+    }
+    
+    return;
+}
+
+static inline unsigned int NeuralPadding(unsigned int count) {
+    return (count + NEURAL_LANE_WIDTH - 1) & ~(NEURAL_LANE_WIDTH - 1);
+}
+
+static uint64_t NeuralHash(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i=0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+
+NeuralNetwork::NeuralNetwork() : 
+    mLayerWidth(0),
+    mNumberOfInputs(0),
+    mFingerprint(0),
+    mIsFingerprintValid(false)
+{
+}
 
 void NeuralNetwork::FeedForward(const std::vector<float>& input) {
     
+    FeedForward(input.data(), input.size(), nullptr);
+    
+    return;
+}
+
+void NeuralNetwork::FeedForward(const float* input, unsigned int numberOfInputs, float* output) {
+    
     if (mTopology.empty()) 
         return;
     
     // Set input layer
-    mTopology[0].neurons = input;
+    NeuralLayer& inputLayer = mTopology[0];
+    
+    if (numberOfInputs > mLayerWidth) 
+        numberOfInputs = mLayerWidth;
+    
+    std::copy(input, input + numberOfInputs, inputLayer.neurons.begin());
+    std::fill(inputLayer.neurons.begin() + numberOfInputs, inputLayer.neurons.end(), 0.0f);
+    
+    mNumberOfInputs = numberOfInputs;
     
     // Forward propagate
     for (size_t i = 1; i < mTopology.size(); ++i) {
@@ -25,26 +376,87 @@ void NeuralNetwork::FeedForward(const std::vector<float>& input) {
         NeuralLayer& previousLayer = mTopology[i - 1];
         NeuralLayer& currentLayer = mTopology[i];
         
-        for (size_t j = 0; j < currentLayer.neurons.size(); ++j) {
-            
-            float sum = currentLayer.biases[j];
-            
-            for (size_t k = 0; k < previousLayer.neurons.size(); ++k) {
-                sum += previousLayer.neurons[k] * currentLayer.weights[j][k];
-            }
+        NeuralMatrixVector(currentLayer.weights.data(), currentLayer.weightStride, currentLayer.numberOfNeurons, 
+                           previousLayer.neurons.data(), currentLayer.biases.data(), currentLayer.neurons.data());
+        
+        NeuralActivate(currentLayer.neurons.data(), NeuralPadding(currentLayer.numberOfNeurons));
+        
+    }
+    
+    if (output == nullptr) 
+        return;
+    
+    const float* results = mTopology.back().neurons.data();
+    std::copy(results, results + GetNumberOfOutputs(), output);
+    
+    return;
+}
+
+void NeuralNetwork::FeedForwardBatch(const float* inputs, unsigned int numberOfInputs, float* outputs, unsigned int batchSize) {
+    
+    if ((mTopology.empty()) | (batchSize == 0)) 
+        return;
+    
+    unsigned int numberOfValues = std::min(numberOfInputs, mLayerWidth);
+    
+    // Buffers only grow when the batch is larger than any before it
+    if (mBatchInput.size() < batchSize * mLayerWidth) {
+        mBatchInput.resize(batchSize * mLayerWidth);
+        mBatchOutput.resize(batchSize * mLayerWidth);
+    }
+    
+    // Set input rows
+    for (unsigned int b=0; b < batchSize; b++) {
+        
+        float* row = &mBatchInput[b * mLayerWidth];
+        
+        std::copy(inputs + b * numberOfInputs, inputs + b * numberOfInputs + numberOfValues, row);
+        std::fill(row + numberOfValues, row + mLayerWidth, 0.0f);
+    }
+    
+    float* previous = mBatchInput.data();
+    float* current  = mBatchOutput.data();
+    
+    // Forward propagate one layer across the whole batch
+    for (size_t i = 1; i < mTopology.size(); ++i) {
+        
+        NeuralLayer& currentLayer = mTopology[i];
+        
+        NeuralMatrixMatrix(currentLayer.weights.data(), currentLayer.weightStride, currentLayer.numberOfNeurons, 
+                           previous, currentLayer.biases.data(), current, mLayerWidth, batchSize);
+        
+        for (unsigned int b=0; b < batchSize; b++) {
             
-            currentLayer.neurons[j] = tanh(sum);
+            float* row = current + b * mLayerWidth;
             
-            //currentLayer.neurons[j] = ActivationReLU(sum);
+            std::fill(row + currentLayer.numberOfNeurons, row + mLayerWidth, 0.0f);
             
+            NeuralActivate(row, NeuralPadding(currentLayer.numberOfNeurons));
         }
+        
+        std::swap(previous, current);
     }
+    
+    unsigned int numberOfOutputs = (mTopology.size() == 1) ? numberOfValues : mTopology.back().numberOfNeurons;
+    
+    for (unsigned int b=0; b < batchSize; b++) 
+        std::copy(previous + b * mLayerWidth, previous + b * mLayerWidth + numberOfOutputs, outputs + b * numberOfOutputs);
+    
     return;
 }
 
 std::vector<float> NeuralNetwork::GetResults(void) {
     if (mTopology.empty()) return {0.0f};
-    return mTopology.back().neurons;
+    const float* results = mTopology.back().neurons.data();
+    return std::vector<float>(results, results + GetNumberOfOutputs());
+}
+
+unsigned int NeuralNetwork::GetNumberOfOutputs(void) {
+    
+    if (mTopology.empty()) 
+        return 0;
+    
+    return GetLayerSize(mTopology.size() - 1);
 }
 
 unsigned int NeuralNetwork::GetNumberOfLayers(void) {
@@ -52,20 +464,57 @@ unsigned int NeuralNetwork::GetNumberOfLayers(void) {
     return mTopology.size();
 }
 
+std::size_t NeuralNetwork::GetBufferCapacity(void) {
+    
+    std::size_t capacity = mTopology.capacity();
+    
+    for (size_t i = 0; i < mTopology.size(); ++i) 
+        capacity += mTopology[i].neurons.capacity() + mTopology[i].weights.capacity() + mTopology[i].biases.capacity();
+    
+    capacity += mBatchInput.capacity() + mBatchOutput.capacity();
+    capacity += mDeltas.capacity() + mBiasGradients.capacity() + mWeightGradients.capacity();
+    
+    return capacity;
+}
+
+uint64_t NeuralNetwork::GetFingerprint(void) {
+    
+    if (mIsFingerprintValid) 
+        return mFingerprint;
+    
+    // FNV-1a over the layer sizes and parameters
+    uint64_t hash = 14695981039346656037ULL;
+    
+    for (size_t i = 0; i < mTopology.size(); ++i) {
+        
+        NeuralLayer& layer = mTopology[i];
+        
+        hash = NeuralHash(hash, &layer.numberOfInputs, sizeof(unsigned int));
+        hash = NeuralHash(hash, &layer.numberOfNeurons, sizeof(unsigned int));
+        hash = NeuralHash(hash, layer.biases.data(), layer.biases.size() * sizeof(float));
+        hash = NeuralHash(hash, layer.weights.data(), layer.weights.size() * sizeof(float));
+    }
+    
+    mFingerprint = hash;
+    mIsFingerprintValid = true;
+    
+    return mFingerprint;
+}
+
 void NeuralNetwork::AddNeuralLayer(int numberOfNeurons, int numberOfInputs) {
     NeuralLayer layer;
     
     layer.numberOfInputs = numberOfInputs;
     layer.numberOfNeurons = numberOfNeurons;
+    layer.weightStride = NeuralPadding(numberOfInputs);
     
-    layer.neurons.resize(numberOfNeurons);
     layer.biases.resize(numberOfNeurons);
-    layer.weights.resize(numberOfNeurons, std::vector<float>(numberOfInputs));
+    layer.weights.resize(numberOfNeurons * layer.weightStride);
     
     
     for (int i = 0; i < numberOfNeurons; ++i) {
         for (int j = 0; j < numberOfInputs; ++j) {
-            layer.weights[i][j] = ((Random.Range(0, 100) * 0.01) / 2) * 0.5f;
+            layer.weights[i * layer.weightStride + j] = ((Random.Range(0, 100) * 0.01) / 2) * 0.5f;
         }
     }
     
@@ -75,86 +524,202 @@ void NeuralNetwork::AddNeuralLayer(int numberOfNeurons, int numberOfInputs) {
     
     for (int i = 0; i < numberOfNeurons; ++i) {
         for (int j = 0; j < numberOfInputs; ++j) {
-            layer.weights[i][j] = (static_cast<float>(rand()) / RAND_MAX) * 2 * range - range;
+            layer.weights[i * layer.weightStride + j] = (static_cast<float>(rand()) / RAND_MAX) * 2 * range - range;
         }
     }
     */
     
+    if (mTopology.empty()) 
+        mNumberOfInputs = numberOfNeurons;
+    
     mTopology.push_back(layer);
+    mIsFingerprintValid = false;
+    
+    UpdateLayerWidth();
     return;
 }
 
 void NeuralNetwork::ClearTopology(void) {
     mTopology.clear();
+    mDeltas.clear();
+    mBiasGradients.clear();
+    mWeightGradients.clear();
+    mLayerWidth = 0;
+    mNumberOfInputs = 0;
+    mIsFingerprintValid = false;
+    return;
+}
+
+unsigned int NeuralNetwork::GetLayerSize(unsigned int index) {
+    
+    // The input layer holds the values last fed into the network
+    if (index == 0) 
+        return mNumberOfInputs;
+    
+    return mTopology[index].numberOfNeurons;
+}
+
+void NeuralNetwork::UpdateLayerWidth(void) {
+    
+    unsigned int width = mNumberOfInputs;
+    
+    for (size_t i = 0; i < mTopology.size(); ++i) {
+        width = std::max(width, mTopology[i].numberOfNeurons);
+        width = std::max(width, mTopology[i].numberOfInputs);
+    }
+    
+    mLayerWidth = NeuralPadding(width);
+    
+    for (size_t i = 0; i < mTopology.size(); ++i) 
+        mTopology[i].neurons.resize(mLayerWidth, 0.0f);
+    
     return;
 }
 
 void NeuralNetwork::Train(TrainingSet& trainingSet, float learningRate) {
-    FeedForward(trainingSet.input);
-    std::vector<std::vector<float>> deltas = CalculateDeltas(trainingSet.target);
-    UpdateWeights(trainingSet.input, deltas, learningRate);
+    TrainBatch(&trainingSet, 1, learningRate);
     return;
 }
 
-std::vector<std::vector<float>> NeuralNetwork::CalculateDeltas(const std::vector<float>& target) {
-    std::vector<std::vector<float>> deltas(mTopology.size());
+void NeuralNetwork::TrainBatch(const TrainingSet* trainingSets, unsigned int numberOfSets, float learningRate) {
+    
+    if ((mTopology.empty()) | (numberOfSets == 0)) 
+        return;
+    
+    // Scratch is sized once per topology so training steps stay off the heap
+    if (mDeltas.size() != mTopology.size() * mLayerWidth) 
+        UpdateTrainingBuffers();
+    
+    for (unsigned int s=0; s < numberOfSets; s++) {
+        
+        const TrainingSet& trainingSet = trainingSets[s];
+        
+        FeedForward(trainingSet.input.data(), trainingSet.input.size(), nullptr);
+        
+        CalculateDeltas(trainingSet.input.data(), trainingSet.input.size(), 
+                        trainingSet.target.data(), trainingSet.target.size());
+    }
+    
+    UpdateWeights(learningRate / numberOfSets);
+    
+    return;
+}
+
+void NeuralNetwork::UpdateTrainingBuffers(void) {
+    
+    unsigned int numberOfWeights = 0;
+    
+    for (size_t i = 0; i < mTopology.size(); ++i) 
+        numberOfWeights += mTopology[i].weights.size();
+    
+    mDeltas.assign(mTopology.size() * mLayerWidth, 0.0f);
+    mBiasGradients.assign(mTopology.size() * mLayerWidth, 0.0f);
+    mWeightGradients.assign(numberOfWeights, 0.0f);
+    
+    return;
+}
+
+void NeuralNetwork::CalculateDeltas(const float* input, unsigned int numberOfInputs, const float* target, unsigned int numberOfTargets) {
+    
+    unsigned int outputIndex = mTopology.size() - 1;
+    unsigned int weightOffset = mWeightGradients.size();
     
     // Calculate output layer deltas
     NeuralLayer& outputLayer = mTopology.back();
-    deltas.back().resize(outputLayer.neurons.size());
+    unsigned int outputSize = GetLayerSize(outputIndex);
+    
+    float* deltas = &mDeltas[outputIndex * mLayerWidth];
     
-    for (size_t i = 0; i < outputLayer.neurons.size(); ++i) {
+    for (size_t i = 0; i < outputSize; ++i) {
         
-        float error = target[i] - outputLayer.neurons[i];
+        float error = (i < numberOfTargets) ? target[i] - outputLayer.neurons[i] : 0.0f;
         
-        //deltas.back()[i] = error * ActivationFunctionDerivative( outputLayer.neurons[i] );
-        deltas.back()[i] = error * ActivationReLUDerivative( outputLayer.neurons[i] );
+        //deltas[i] = error * ActivationFunctionDerivative( outputLayer.neurons[i] );
+        deltas[i] = error * ActivationReLUDerivative( outputLayer.neurons[i] );
         
     }
     
-    // Calculate hidden layer deltas
-    for (int i = mTopology.size() - 2; i >= 0; --i) {
+    // Walk back through the layers adding the gradients for each layer 
+    // while gathering the error for the layer before it
+    for (int i = outputIndex; i >= 0; --i) {
         
         NeuralLayer& currentLayer = mTopology[i];
-        NeuralLayer& nextLayer = mTopology[i + 1];
         
-        deltas[i].resize(currentLayer.neurons.size());
+        weightOffset -= currentLayer.weights.size();
         
-        for (size_t j = 0; j < currentLayer.neurons.size(); ++j) {
-            
-            float error = 0.0f;
+        const float* previousLayerOutputs = (i == 0) ? input : mTopology[i - 1].neurons.data();
+        unsigned int previousLayerSize    = (i == 0) ? numberOfInputs : GetLayerSize(i - 1);
+        
+        unsigned int currentSize = std::min(GetLayerSize(i), currentLayer.numberOfNeurons);
+        unsigned int numberOfWeights = std::min(previousLayerSize, currentLayer.numberOfInputs);
+        
+        float* currentDeltas = &mDeltas[i * mLayerWidth];
+        float* biasGradients = &mBiasGradients[i * mLayerWidth];
+        float* weightGradients = &mWeightGradients[weightOffset];
+        
+        if (i == 0) {
             
-            for (size_t k = 0; k < nextLayer.neurons.size(); ++k) {
-                error += nextLayer.weights[k][j] * deltas[i + 1][k];
+            for (size_t j = 0; j < currentSize; ++j) {
+                biasGradients[j] += currentDeltas[j];
+                NeuralAxpy(&weightGradients[j * currentLayer.weightStride], previousLayerOutputs, currentDeltas[j], numberOfWeights);
             }
             
-            //deltas[i][j] = error * ActivationFunctionDerivative( currentLayer.neurons[j] );
-            deltas[i][j] = error * ActivationReLUDerivative( currentLayer.neurons[j] );
+            break;
+        }
+        
+        float* previousDeltas = &mDeltas[(i - 1) * mLayerWidth];
+        std::fill(previousDeltas, previousDeltas + mLayerWidth, 0.0f);
+        
+        for (size_t j = 0; j < currentSize; ++j) {
+            
+            const float* weightRow = &currentLayer.weights[j * currentLayer.weightStride];
+            float* gradientRow = &weightGradients[j * currentLayer.weightStride];
             
+            biasGradients[j] += currentDeltas[j];
+            
+            NeuralBackwardRow(weightRow, gradientRow, previousLayerOutputs, previousDeltas, currentDeltas[j], numberOfWeights);
+            
+            // Weights past the previous layer size still carry the error back
+            NeuralAxpy(previousDeltas + numberOfWeights, weightRow + numberOfWeights, currentDeltas[j], currentLayer.weightStride - numberOfWeights);
         }
+        
+        // Scale the gathered error by the activation slope
+        unsigned int previousSize = GetLayerSize(i - 1);
+        
+        for (size_t j = 0; j < previousSize; ++j) {
+            
+            //previousDeltas[j] *= ActivationFunctionDerivative( previousLayerOutputs[j] );
+            previousDeltas[j] *= ActivationReLUDerivative( previousLayerOutputs[j] );
+            
+        }
+        
     }
     
-    return deltas;
+    return;
 }
 
-void NeuralNetwork::UpdateWeights(const std::vector<float>& input, const std::vector<std::vector<float>>& deltas, float learningRate) {
-    std::vector<float> previousLayerOutputs = input;
+void NeuralNetwork::UpdateWeights(float learningRate) {
+    
+    mIsFingerprintValid = false;
+    
+    float* weightGradients = mWeightGradients.data();
     
     for (size_t i = 0; i < mTopology.size(); ++i) {
+        
         NeuralLayer& currentLayer = mTopology[i];
         
-        for (size_t j = 0; j < currentLayer.neurons.size(); ++j) {
-            
-            currentLayer.biases[j] += learningRate * deltas[i][j];
-            
-            for (size_t k = 0; k < previousLayerOutputs.size(); ++k) {
-                
-                currentLayer.weights[j][k] += learningRate * deltas[i][j] * previousLayerOutputs[k];
-            }
-        }
+        float* biasGradients = &mBiasGradients[i * mLayerWidth];
+        unsigned int numberOfWeights = currentLayer.weights.size();
+        
+        NeuralAxpy(currentLayer.biases.data(), biasGradients, learningRate, currentLayer.numberOfNeurons);
+        NeuralAxpy(currentLayer.weights.data(), weightGradients, learningRate, numberOfWeights);
         
-        previousLayerOutputs = currentLayer.neurons;
+        std::fill(biasGradients, biasGradients + mLayerWidth, 0.0f);
+        std::fill(weightGradients, weightGradients + numberOfWeights, 0.0f);
+        
+        weightGradients += numberOfWeights;
     }
+    
     return;
 }
 
@@ -175,7 +740,7 @@ float NeuralNetwork::ActivationFunctionDerivative(float value) {
 // Save/load neural states
 
 void NeuralNetwork::LoadState(std::vector<std::string>& state) {
-    mTopology.clear();
+    ClearTopology();
     
     // Setup the layers
     for (const std::string& layerString : state) {
@@ -190,17 +755,21 @@ void NeuralNetwork::LoadState(std::vector<std::string>& state) {
         stream >> numberOfBiases;
         stream >> numberOfWeightLists;
         
-        // Resize the vectors to hold the biases and weights
-        layer.neurons.resize(numberOfNeurons);
-        layer.biases.resize(numberOfBiases);
-        layer.weights.resize(numberOfWeightLists, std::vector<float>(layer.numberOfInputs));
+        if (!stream) 
+            continue;
+        
+        // Size the biases and weight rows to the layer neuron count
+        layer.weightStride = NeuralPadding(layer.numberOfInputs);
+        layer.biases.resize(layer.numberOfNeurons, 0.0f);
+        layer.weights.resize(layer.numberOfNeurons * layer.weightStride, 0.0f);
         
         // Load biases
         for (unsigned int b = 0; b < numberOfBiases; ++b) {
             std::string biasString;
             stream >> biasString;
             
-            layer.biases[b] = String.ToFloat(biasString);
+            if (b < layer.numberOfNeurons) 
+                layer.biases[b] = String.ToFloat(biasString);
         }
         
         // Load weights
@@ -210,14 +779,21 @@ void NeuralNetwork::LoadState(std::vector<std::string>& state) {
                 std::string weightString;
                 stream >> weightString;
                 
-                layer.weights[ws][w] = String.ToFloat(weightString);
+                if (ws < layer.numberOfNeurons) 
+                    layer.weights[ws * layer.weightStride + w] = String.ToFloat(weightString);
             }
             
         }
         
+        // Input layer size as last fed through the network
+        if (mTopology.empty()) 
+            mNumberOfInputs = numberOfNeurons;
+        
         mTopology.push_back(layer);
     }
     
+    UpdateLayerWidth();
+    
     return;
 }
 
@@ -234,9 +810,9 @@ std::vector<std::string> NeuralNetwork::SaveState(void) {
         
         NeuralLayer& layer = mTopology[i];
         
-        unsigned int numberOfNeurons     = layer.neurons.size();
+        unsigned int numberOfNeurons     = GetLayerSize(i);
         unsigned int numberOfBiases      = layer.biases.size();
-        unsigned int numberOfWeightLists = layer.weights.size();
+        unsigned int numberOfWeightLists = layer.numberOfNeurons;
         
         layerString  = UInt.ToString(layer.numberOfInputs) + " ";
         layerString += UInt.ToString(layer.numberOfNeurons) + " ";
@@ -255,9 +831,9 @@ std::vector<std::string> NeuralNetwork::SaveState(void) {
         // Each set of weights
         for (unsigned int ws=0; ws < numberOfWeightLists; ws++) {
             
-            std::vector<float>& weights = layer.weights[ws];
+            const float* weights = &layer.weights[ws * layer.weightStride];
             
-            unsigned int numberOfWeights = weights.size();
+            unsigned int numberOfWeights = layer.numberOfInputs;
             
             // Each weight
             for (unsigned int w=0; w < numberOfWeights; w++) 
@@ -271,3 +847,171 @@ std::vector<std::string> NeuralNetwork::SaveState(void) {
     return state;
 }
 
+
+// Binary neural states
+//
+// Header of magic, version, layer count and a checksum of the payload 
+// followed by the input size and each layer. Values are little endian.
+
+static const char neuralStateMagic[4] = {'S', 'S', 'N', 'N'};
+
+static const unsigned int neuralStateHeaderSize = 16;
+
+static inline void NeuralWriteUInt(std::string& buffer, uint32_t value) {
+    char bytes[4] = {(char)(value & 0xff), (char)((value >> 8) & 0xff), (char)((value >> 16) & 0xff), (char)((value >> 24) & 0xff)};
+    buffer.append(bytes, 4);
+}
+
+static inline void NeuralWriteFloat(std::string& buffer, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    NeuralWriteUInt(buffer, bits);
+}
+
+static inline uint32_t NeuralReadUInt(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static inline float NeuralReadFloat(const uint8_t* data) {
+    uint32_t bits = NeuralReadUInt(data);
+    
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+void NeuralNetwork::SaveStateBinary(std::string& state) {
+    
+    unsigned int numberOfLayers = mTopology.size();
+    unsigned int numberOfValues = 0;
+    
+    for (unsigned int i=0; i < numberOfLayers; i++) 
+        numberOfValues += 2 + mTopology[i].numberOfNeurons * (1 + mTopology[i].numberOfInputs);
+    
+    state.clear();
+    state.reserve(neuralStateHeaderSize + (1 + numberOfValues) * sizeof(uint32_t));
+    
+    // Header with the checksum filled in below
+    state.append(neuralStateMagic, 4);
+    NeuralWriteUInt(state, NEURAL_STATE_VERSION);
+    NeuralWriteUInt(state, numberOfLayers);
+    NeuralWriteUInt(state, 0);
+    
+    NeuralWriteUInt(state, mNumberOfInputs);
+    
+    for (unsigned int i=0; i < numberOfLayers; i++) {
+        
+        NeuralLayer& layer = mTopology[i];
+        
+        NeuralWriteUInt(state, layer.numberOfInputs);
+        NeuralWriteUInt(state, layer.numberOfNeurons);
+        
+        for (unsigned int b=0; b < layer.numberOfNeurons; b++) 
+            NeuralWriteFloat(state, layer.biases[b]);
+        
+        // Rows are written without their padding
+        for (unsigned int n=0; n < layer.numberOfNeurons; n++) {
+            
+            const float* weights = &layer.weights[n * layer.weightStride];
+            
+            for (unsigned int w=0; w < layer.numberOfInputs; w++) 
+                NeuralWriteFloat(state, weights[w]);
+        }
+        
+    }
+    
+    uint32_t checksum = (uint32_t)NeuralHash(14695981039346656037ULL, state.data() + neuralStateHeaderSize, state.size() - neuralStateHeaderSize);
+    
+    for (unsigned int i=0; i < 4; i++) 
+        state[12 + i] = (char)((checksum >> (i * 8)) & 0xff);
+    
+    return;
+}
+
+bool NeuralNetwork::LoadStateBinary(const std::string& state) {
+    
+    if (!IsBinaryState(state)) 
+        return false;
+    
+    const uint8_t* data = (const uint8_t*)state.data();
+    unsigned int size = state.size();
+    
+    uint32_t version        = NeuralReadUInt(data + 4);
+    uint32_t numberOfLayers = NeuralReadUInt(data + 8);
+    uint32_t checksum       = NeuralReadUInt(data + 12);
+    
+    if (version != NEURAL_STATE_VERSION) 
+        return false;
+    
+    if (size < neuralStateHeaderSize + sizeof(uint32_t)) 
+        return false;
+    
+    if ((uint32_t)NeuralHash(14695981039346656037ULL, data + neuralStateHeaderSize, size - neuralStateHeaderSize) != checksum) 
+        return false;
+    
+    // Check each layer fits before touching the network
+    unsigned int cursor = neuralStateHeaderSize + sizeof(uint32_t);
+    
+    for (unsigned int i=0; i < numberOfLayers; i++) {
+        
+        if (size - cursor < 2 * sizeof(uint32_t)) 
+            return false;
+        
+        uint64_t numberOfInputs  = NeuralReadUInt(data + cursor);
+        uint64_t numberOfNeurons = NeuralReadUInt(data + cursor + 4);
+        uint64_t layerSize = (2 + numberOfNeurons * (1 + numberOfInputs)) * sizeof(float);
+        
+        if (layerSize > size - cursor) 
+            return false;
+        
+        cursor += layerSize;
+    }
+    
+    if (cursor != size) 
+        return false;
+    
+    ClearTopology();
+    
+    mNumberOfInputs = NeuralReadUInt(data + neuralStateHeaderSize);
+    
+    cursor = neuralStateHeaderSize + sizeof(uint32_t);
+    
+    mTopology.resize(numberOfLayers);
+    
+    for (unsigned int i=0; i < numberOfLayers; i++) {
+        
+        NeuralLayer& layer = mTopology[i];
+        
+        layer.numberOfInputs  = NeuralReadUInt(data + cursor);
+        layer.numberOfNeurons = NeuralReadUInt(data + cursor + 4);
+        layer.weightStride    = NeuralPadding(layer.numberOfInputs);
+        cursor += 2 * sizeof(uint32_t);
+        
+        layer.biases.resize(layer.numberOfNeurons);
+        layer.weights.assign(layer.numberOfNeurons * layer.weightStride, 0.0f);
+        
+        for (unsigned int b=0; b < layer.numberOfNeurons; b++, cursor += sizeof(float)) 
+            layer.biases[b] = NeuralReadFloat(data + cursor);
+        
+        for (unsigned int n=0; n < layer.numberOfNeurons; n++) {
+            
+            float* weights = &layer.weights[n * layer.weightStride];
+            
+            for (unsigned int w=0; w < layer.numberOfInputs; w++, cursor += sizeof(float)) 
+                weights[w] = NeuralReadFloat(data + cursor);
+        }
+        
+    }
+    
+    UpdateLayerWidth();
+    
+    return true;
+}
+
+bool NeuralNetwork::IsBinaryState(const std::string& state) {
+    
+    if (state.size() < neuralStateHeaderSize) 
+        return false;
+    
+    return std::memcmp(state.data(), neuralStateMagic, 4) == 0;
+}
@@ -0,0 +1,342 @@
+#include <GameEngineFramework/ActorAI/SpatialGrid.h>
+
+#include <cmath>
+
+// Initial number of hash table slots (Must be a power of two)
+#define  SPATIAL_GRID_INITIAL_CAPACITY  256
+
+
+SpatialGrid::SpatialGrid() :
+    mCellSize(ACTOR_SYSTEM_GRID_CELL_SIZE),
+    mInverseCellSize(1.0f / ACTOR_SYSTEM_GRID_CELL_SIZE),
+    mFreeHead(SPATIAL_GRID_NONE),
+    mCount(0),
+    mMask(SPATIAL_GRID_INITIAL_CAPACITY - 1)
+{
+    Slot empty;
+    empty.x = 0;
+    empty.z = 0;
+    empty.cell = SPATIAL_GRID_NONE;
+    
+    mTable.resize(SPATIAL_GRID_INITIAL_CAPACITY, empty);
+}
+
+void SpatialGrid::SetCellSize(float size) {
+    
+    if (size <= 0.0f)
+        return;
+    
+    Clear();
+    
+    mCells.clear();
+    
+    for (unsigned int i=0; i < mTable.size(); i++)
+        mTable[i].cell = SPATIAL_GRID_NONE;
+    
+    mCellSize = size;
+    mInverseCellSize = 1.0f / size;
+    
+    return;
+}
+
+float SpatialGrid::GetCellSize(void) {
+    return mCellSize;
+}
+
+unsigned int SpatialGrid::Insert(Actor* actor, const glm::vec3& position) {
+    
+    unsigned int handle = mFreeHead;
+    
+    if (handle != SPATIAL_GRID_NONE) {
+        
+        mFreeHead = mEntries[handle].cell;
+        
+    } else {
+        
+        handle = mEntries.size();
+        
+        mEntries.push_back(Entry());
+    }
+    
+    Entry& entry = mEntries[handle];
+    entry.actor = actor;
+    entry.position = position;
+    
+    AddToCell(handle, GetCell(GetCellCoordinate(position.x), GetCellCoordinate(position.z)));
+    
+    mCount++;
+    
+    return handle;
+}
+
+void SpatialGrid::Update(unsigned int handle, const glm::vec3& position) {
+    
+    if (handle >= mEntries.size())
+        return;
+    
+    Entry& entry = mEntries[handle];
+    
+    if (entry.actor == nullptr)
+        return;
+    
+    entry.position = position;
+    
+    int x = GetCellCoordinate(position.x);
+    int z = GetCellCoordinate(position.z);
+    
+    Cell& current = mCells[entry.cell];
+    
+    // Most updates stay within the same cell
+    if ((current.x == x) & (current.z == z))
+        return;
+    
+    RemoveFromCell(handle);
+    
+    AddToCell(handle, GetCell(x, z));
+    
+    return;
+}
+
+void SpatialGrid::Remove(unsigned int handle) {
+    
+    if (handle >= mEntries.size())
+        return;
+    
+    Entry& entry = mEntries[handle];
+    
+    if (entry.actor == nullptr)
+        return;
+    
+    RemoveFromCell(handle);
+    
+    entry.actor = nullptr;
+    entry.cell = mFreeHead;
+    
+    mFreeHead = handle;
+    mCount--;
+    
+    return;
+}
+
+void SpatialGrid::Clear(void) {
+    
+    for (unsigned int i=0; i < mCells.size(); i++)
+        mCells[i].handles.clear();
+    
+    mEntries.clear();
+    
+    mFreeHead = SPATIAL_GRID_NONE;
+    mCount = 0;
+    
+    return;
+}
+
+unsigned int SpatialGrid::GetNumberOfActors(void) {
+    return mCount;
+}
+
+unsigned int SpatialGrid::QueryRadius(const glm::vec3& center, float radius, std::vector<Actor*>& results) {
+    
+    if (radius < 0.0f)
+        return 0;
+    
+    int minX = GetCellCoordinate(center.x - radius);
+    int maxX = GetCellCoordinate(center.x + radius);
+    int minZ = GetCellCoordinate(center.z - radius);
+    int maxZ = GetCellCoordinate(center.z + radius);
+    
+    float radiusSquared = radius * radius;
+    
+    unsigned int numberOfResults = 0;
+    
+    for (int x=minX; x <= maxX; x++) {
+        
+        for (int z=minZ; z <= maxZ; z++) {
+            
+            unsigned int cellIndex = FindCell(x, z);
+            
+            if (cellIndex == SPATIAL_GRID_NONE)
+                continue;
+            
+            std::vector<unsigned int>& handles = mCells[cellIndex].handles;
+            
+            for (unsigned int i=0; i < handles.size(); i++) {
+                
+                Entry& entry = mEntries[ handles[i] ];
+                
+                glm::vec3 offset = entry.position - center;
+                
+                if ((offset.x * offset.x + offset.y * offset.y + offset.z * offset.z) > radiusSquared)
+                    continue;
+                
+                results.push_back(entry.actor);
+                
+                numberOfResults++;
+            }
+            
+        }
+        
+    }
+    
+    return numberOfResults;
+}
+
+unsigned int SpatialGrid::QueryBounds(const glm::vec3& min, const glm::vec3& max, std::vector<Actor*>& results) {
+    
+    int minX = GetCellCoordinate(min.x);
+    int maxX = GetCellCoordinate(max.x);
+    int minZ = GetCellCoordinate(min.z);
+    int maxZ = GetCellCoordinate(max.z);
+    
+    unsigned int numberOfResults = 0;
+    
+    for (int x=minX; x <= maxX; x++) {
+        
+        for (int z=minZ; z <= maxZ; z++) {
+            
+            unsigned int cellIndex = FindCell(x, z);
+            
+            if (cellIndex == SPATIAL_GRID_NONE)
+                continue;
+            
+            std::vector<unsigned int>& handles = mCells[cellIndex].handles;
+            
+            for (unsigned int i=0; i < handles.size(); i++) {
+                
+                Entry& entry = mEntries[ handles[i] ];
+                
+                const glm::vec3& position = entry.position;
+                
+                if ((position.x < min.x) | (position.x > max.x) |
+                    (position.y < min.y) | (position.y > max.y) |
+                    (position.z < min.z) | (position.z > max.z))
+                    continue;
+                
+                results.push_back(entry.actor);
+                
+                numberOfResults++;
+            }
+            
+        }
+        
+    }
+    
+    return numberOfResults;
+}
+
+int SpatialGrid::GetCellCoordinate(float value) {
+    return (int)std::floor(value * mInverseCellSize);
+}
+
+unsigned int SpatialGrid::Hash(int x, int z) {
+    
+    uint64_t key = ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)z;
+    
+    // 64 bit finalizer mix
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    
+    return (unsigned int)key & mMask;
+}
+
+unsigned int SpatialGrid::Probe(int x, int z) {
+    
+    unsigned int slot = Hash(x, z);
+    
+    while (mTable[slot].cell != SPATIAL_GRID_NONE) {
+        
+        if ((mTable[slot].x == x) & (mTable[slot].z == z))
+            return slot;
+        
+        slot = (slot + 1) & mMask;
+    }
+    
+    return slot;
+}
+
+unsigned int SpatialGrid::FindCell(int x, int z) {
+    return mTable[ Probe(x, z) ].cell;
+}
+
+unsigned int SpatialGrid::GetCell(int x, int z) {
+    
+    unsigned int slot = Probe(x, z);
+    
+    if (mTable[slot].cell != SPATIAL_GRID_NONE)
+        return mTable[slot].cell;
+    
+    // Keep the table at most half full
+    if ((mCells.size() + 1) * 2 > mTable.size()) {
+        
+        Grow();
+        
+        slot = Probe(x, z);
+    }
+    
+    Cell cell;
+    cell.x = x;
+    cell.z = z;
+    
+    mCells.push_back(cell);
+    
+    mTable[slot].x = x;
+    mTable[slot].z = z;
+    mTable[slot].cell = mCells.size() - 1;
+    
+    return mTable[slot].cell;
+}
+
+void SpatialGrid::Grow(void) {
+    
+    Slot empty;
+    empty.x = 0;
+    empty.z = 0;
+    empty.cell = SPATIAL_GRID_NONE;
+    
+    mTable.assign(mTable.size() * 2, empty);
+    mMask = mTable.size() - 1;
+    
+    // Cells are stored outside the table so they can be placed again directly
+    for (unsigned int i=0; i < mCells.size(); i++) {
+        
+        unsigned int slot = Probe(mCells[i].x, mCells[i].z);
+        
+        mTable[slot].x = mCells[i].x;
+        mTable[slot].z = mCells[i].z;
+        mTable[slot].cell = i;
+        
+        continue;
+    }
+    
+    return;
+}
+
+void SpatialGrid::AddToCell(unsigned int handle, unsigned int cell) {
+    
+    std::vector<unsigned int>& handles = mCells[cell].handles;
+    
+    mEntries[handle].cell = cell;
+    mEntries[handle].index = handles.size();
+    
+    handles.push_back(handle);
+    
+    return;
+}
+
+void SpatialGrid::RemoveFromCell(unsigned int handle) {
+    
+    Entry& entry = mEntries[handle];
+    
+    std::vector<unsigned int>& handles = mCells[entry.cell].handles;
+    
+    // Swap the last handle into the gap
+    unsigned int last = handles.back();
+    
+    handles[entry.index] = last;
+    mEntries[last].index = entry.index;
+    
+    handles.pop_back();
+    
+    return;
+}
@@ -1,9 +1,23 @@
 #include <GameEngineFramework/ActorAI/components/actor.h>
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/ActorAI/SpatialGrid.h>
 
 extern PhysicsSystem  Physics;
 extern RenderSystem   Renderer;
 
 
+ActorState::ActorState() : 
+    position(glm::vec3(0)),
+    targetPoint(glm::vec3(0)),
+    age(0),
+    distance(0),
+    isActive(false),
+    isWalking(false),
+    isRunning(false),
+    name("")
+{
+}
+
 Actor::Actor() : 
     
     mName(""),
@@ -58,26 +72,32 @@ Actor::Actor() :
     mMovementCoolDownCounter(0),
     mBreedingCoolDownCounter(0),
     
+    mNeuralInputs(1, 0.0f),
+    
     mBitmask(0),
     
     mUserDataA(nullptr),
     mUserDataB(nullptr),
     
-    mBreedWithActor(nullptr)
+    mBreedWithActor(nullptr),
+    
+    mGridHandle(SPATIAL_GRID_NONE),
+    
+    mSystem(nullptr),
+    mIsPending(false)
 {
 }
 
 void Actor::SetName(std::string newName) {
-    mux.lock();
     mName = newName;
-    mux.unlock();
     return;
 }
 
 void Actor::SetActive(bool state) {
-    mux.lock();
     mIsActive = state;
-    mux.unlock();
+    
+    if ((state) & (mSystem != nullptr)) 
+        mSystem->MarkPending(this);
     
     for (unsigned int i=0; i < mGeneticRenderers.size(); i++) 
         mGeneticRenderers[i]->isActive = state;
@@ -99,114 +119,85 @@ void Actor::SetGeneticExpressionFlag(void) {
 }
 
 std::string Actor::GetName(void) {
-    mux.lock();
     std::string nameString = mName;
-    mux.unlock();
     return nameString;
 }
 
 bool Actor::GetActive(void) {
-    mux.lock();
     bool activeState = mIsActive;
-    mux.unlock();
     return activeState;
 }
 
 void Actor::SetAge(unsigned long int newAge) {
-    mux.lock();
     mAge = newAge;
-    mux.unlock();
     return;
 }
 
 unsigned long int Actor::GetAge(void) {
-    mux.lock();
     unsigned long int ageValue = mAge;
-    mux.unlock();
     return ageValue;
 }
 
 void Actor::SetGeneration(unsigned int newGeneration) {
-    mux.lock();
     mGeneration = newGeneration;
-    mux.unlock();
     return;
 }
 
 unsigned int Actor::GetGeneration(void) {
-    mux.lock();
     unsigned int generation = mGeneration;
-    mux.unlock();
     return generation;
 }
 
 void Actor::SetSpeed(float newSpeed) {
-    mux.lock();
     mSpeed = newSpeed;
-    mux.unlock();
     return;
 }
 
 float Actor::GetSpeed(void) {
-    mux.lock();
     float speedValue = mSpeed;
-    mux.unlock();
     return speedValue;
 }
 
 void Actor::SetSpeedYouth(float newSpeed) {
-    mux.lock();
     mSpeedYouth = newSpeed;
-    mux.unlock();
     return;
 }
 
 float Actor::GetSpeedYouth(void) {
-    mux.lock();
     float speedValue = mSpeedYouth;
-    mux.unlock();
     return speedValue;
 }
 
 void Actor::SetSpeedMultiplier(float newSpeedMul) {
-    mux.lock();
     mSpeedMul = newSpeedMul;
-    mux.unlock();
     return;
 }
 
 float Actor::GetSpeedMultiplier(void) {
-    mux.lock();
     float speedMul = mSpeedMul;
-    mux.unlock();
     return speedMul;
 }
 
 void Actor::SetPosition(glm::vec3 position) {
-    mux.lock();
     mPosition = position;
-    mux.unlock();
+    
+    if (mSystem != nullptr) 
+        mSystem->MarkPending(this);
     return;
 }
 
 glm::vec3 Actor::GetPosition(void) {
-    mux.lock();
     glm::vec3 position = mPosition;
-    mux.unlock();
     return position;
 }
 
 void Actor::SetTargetPoint(glm::vec3 position) {
-    mux.lock();
     mTargetPoint = position;
-    mux.unlock();
     return;
 }
 
 glm::vec3 Actor::GetTargetPoint(void) {
-    mux.lock();
     glm::vec3 position = mTargetPoint;
-    mux.unlock();
     return position;
 }
 
@@ -446,28 +437,25 @@ void Actor::LoadNeuralStates(std::vector<std::string> states) {
 void Actor::EncodeInputLayer(void) {
     
     // Encode the data set
-    std::vector<float> dataset;
-    dataset.push_back(0.87f);
+    mNeuralInputs[0] = 0.87f;
     
-    // Send the dataset into the network
-    mNeuralNetwork.FeedForward(dataset);
+    if (mNeuralOutputs.size() != mNeuralNetwork.GetNumberOfOutputs()) 
+        mNeuralOutputs.resize( mNeuralNetwork.GetNumberOfOutputs() );
     
     return;
 }
 
 void Actor::DecodeOutputLayer(void) {
     
-    std::vector<float> resultVals = mNeuralNetwork.GetResults();
-    
-    if (resultVals.size() == 0) 
+    if (mNeuralOutputs.size() == 0) 
         return;
     
-    if (resultVals[0] > 0.249f && resultVals[0] < 0.251f) {
+    if (mNeuralOutputs[0] > 0.249f && mNeuralOutputs[0] < 0.251f) {
         
-        mIsWalking = true;
-        mIsRunning = true;
+        mSimulation.isWalking = true;
+        mSimulation.isRunning = true;
         
-        mIsActive = false;
+        mSimulation.isActive = false;
         
     }
     
@@ -501,6 +489,34 @@ bool Actor::CheckMemoryExists(std::string memory) {
     return false;
 }
 
+void Actor::AddAttackActor(std::string name) {
+    mux.lock();
+    mAttackActors.push_back( name );
+    mux.unlock();
+    return;
+}
+
+void Actor::ClearAttackActors(void) {
+    mux.lock();
+    mAttackActors.clear();
+    mux.unlock();
+    return;
+}
+
+void Actor::AddFleeFromActor(std::string name) {
+    mux.lock();
+    mFleeFromActors.push_back( name );
+    mux.unlock();
+    return;
+}
+
+void Actor::ClearFleeFromActors(void) {
+    mux.lock();
+    mFleeFromActors.clear();
+    mux.unlock();
+    return;
+}
+
 
 
 void Actor::SetYouthScale(float scale) {
@@ -1,6 +1,6 @@
 #include <GameEngineFramework/Application/main.h>
 
-#ifdef RUN_UNIT_TESTS
+#if defined(RUN_UNIT_TESTS) || defined(RUN_BENCHMARKS)
  #include "../../tests/framework.h"
 #endif
 
@@ -59,6 +59,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     AI.Initiate();
     
+    Jobs.Initiate();
+    
     Renderer.Initiate();
     
     Audio.Initiate();
@@ -83,6 +85,27 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     testFrameWork.AddTest( &testFrameWork.TestPhysicsSystem );
     testFrameWork.AddTest( &testFrameWork.TestTransform );
+    testFrameWork.AddTest( &testFrameWork.TestTransformHierarchy );
+    testFrameWork.AddTest( &testFrameWork.TestPoolAllocator );
+    testFrameWork.AddTest( &testFrameWork.TestJobSystem );
+    testFrameWork.AddTest( &testFrameWork.TestChunkGeneration );
+    testFrameWork.AddTest( &testFrameWork.TestRandomStream );
+    testFrameWork.AddTest( &testFrameWork.TestPerlinBatch );
+    testFrameWork.AddTest( &testFrameWork.TestRegionFile );
+    testFrameWork.AddTest( &testFrameWork.TestNeuralNetwork );
+    testFrameWork.AddTest( &testFrameWork.TestNeuralTraining );
+    testFrameWork.AddTest( &testFrameWork.TestGenomeFormat );
+    testFrameWork.AddTest( &testFrameWork.TestActorSystem );
+    testFrameWork.AddTest( &testFrameWork.TestActorSimulation );
+    testFrameWork.AddTest( &testFrameWork.TestSpatialGrid );
+    testFrameWork.AddTest( &testFrameWork.TestHeightFieldQuery );
+    testFrameWork.AddTest( &testFrameWork.TestRaycastBatch );
+    testFrameWork.AddTest( &testFrameWork.TestActorInstancing );
+    testFrameWork.AddTest( &testFrameWork.TestRenderQueueSort );
+    testFrameWork.AddTest( &testFrameWork.TestUniformBuffers );
+    testFrameWork.AddTest( &testFrameWork.TestMeshStreaming );
+    testFrameWork.AddTest( &testFrameWork.TestParticleInstancing );
+    testFrameWork.AddTest( &testFrameWork.TestRenderCommands );
     
     testFrameWork.AddTest( &testFrameWork.TestSerializerSystem );
     
@@ -98,6 +121,39 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         std::cin >> freeze;
     }
     
+#endif
+    
+#ifdef RUN_BENCHMARKS
+    TestFramework benchmarkFrameWork;
+    
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkPoolAllocator );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkComponentStream );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkTransformCache );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkJobSystem );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkChunkIndex );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkChunkGeneration );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkRandomStream );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkTerrainMesh );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkPerlinBatch );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkRegionFile );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkNeuralNetwork );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkNeuralBatch );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkNeuralTraining );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkGenomeFormat );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkActorSystem );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkActorSimulation );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkSpatialGrid );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkHeightFieldQuery );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkRaycastBatch );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkActorInstancing );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkRenderQueueSort );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkUniformBuffers );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkMeshStreaming );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkParticleInstancing );
+    benchmarkFrameWork.AddBenchmark( &benchmarkFrameWork.BenchmarkRenderCommands );
+    
+    benchmarkFrameWork.RunBenchmarkSuite();
+    
 #endif
     
     Log.WriteLn();
@@ -324,6 +380,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     AI.Shutdown();
     
+    Jobs.Shutdown();
+    
     Resources.DestroyAssets();
     
     Platform.DestroyWindowHandle();
@@ -21,9 +21,11 @@ EngineSystemManager::EngineSystemManager(void) :
     mConsoleInputObject(nullptr),
     mConsolePanelObject(nullptr),
     
-    mDataStreamIndex(0),
+    mTransformPass(0),
     mObjectIndex(0),
-    mStreamSize(0),
+    
+    mActorBatch(nullptr),
+    mActorBatchMaterial(nullptr),
     
     usePhysicsDebugRenderer(false),
     debugMeshGameObject(nullptr),
@@ -59,19 +61,38 @@ float EngineSystemManager::AddHeightFieldFromPerlinNoise(float* heightField, uns
     float minimumHeight = 1000.0f;
     unsigned int size = width * height;
     
-    for (unsigned int i = 0; i < size; i++) {
-        unsigned int x = i % width;
-        unsigned int z = i / width;
-        
-        float xCoord = ((float)x + offsetX) * noiseWidth;
-        float zCoord = ((float)z + offsetZ) * noiseHeight;
+    // Evaluate the noise in blocks of samples
+    const unsigned int blockSize = 128;
+    
+    float xCoord[blockSize];
+    float yCoord[blockSize];
+    float zCoord[blockSize];
+    float noise[blockSize];
+    
+    for (unsigned int i = 0; i < blockSize; i++) 
+        yCoord[i] = 0.0f;
+    
+    for (unsigned int begin = 0; begin < size; begin += blockSize) {
+        unsigned int count = ((size - begin) < blockSize) ? (size - begin) : blockSize;
         
-        float noise = Random.Perlin(xCoord, 0, zCoord, seed) * noiseMul;
+        for (unsigned int s = 0; s < count; s++) {
+            unsigned int x = (begin + s) % width;
+            unsigned int z = (begin + s) / width;
+            
+            xCoord[s] = ((float)x + offsetX) * noiseWidth;
+            zCoord[s] = ((float)z + offsetZ) * noiseHeight;
+        }
         
-        heightField[i] += Math.Round((noise * 10.0)) * 0.1;
+        Random.PerlinBatch(xCoord, yCoord, zCoord, noise, count, seed);
         
-        if (heightField[i] < minimumHeight)
-            minimumHeight = heightField[i];
+        for (unsigned int s = 0; s < count; s++) {
+            unsigned int i = begin + s;
+            
+            heightField[i] += Math.Round((noise[s] * noiseMul * 10.0)) * 0.1;
+            
+            if (heightField[i] < minimumHeight)
+                minimumHeight = heightField[i];
+        }
     }
     
     return minimumHeight;
@@ -215,12 +236,76 @@ void EngineSystemManager::AddHeightFieldToMesh(Mesh* mesh,
                                                float offsetX, float offsetZ, 
                                                unsigned int subTessX, unsigned int subTessZ) {
     
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    AddHeightFieldToBuffer(vertexBuffer, indexBuffer, heightField, colorField, width, height, offsetX, offsetZ, subTessX, subTessZ);
+    
+    mesh->AddSubMesh(0, 0, 0, vertexBuffer, indexBuffer, false);
+    
+    return;
+}
+
+void EngineSystemManager::AddHeightFieldToMeshHalfSize(Mesh* mesh, 
+                                               float* heightField, glm::vec3* colorField, 
+                                               unsigned int width, unsigned int height, 
+                                               float offsetX, float offsetZ) {
+    
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    AddHeightFieldToBufferHalfSize(vertexBuffer, indexBuffer, heightField, colorField, width, height, offsetX, offsetZ);
+    
+    mesh->AddSubMesh(0, 0, 0, vertexBuffer, indexBuffer, false);
+    
+    return;
+}
+
+// Quad corners are ordered (x, z), (x+1, z), (x+1, z+1), (x, z+1)
+static const unsigned int heightFieldQuadIndices[6] = {0, 2, 1, 0, 3, 2};
+
+// Write one flat shaded quad into pre-sized buffers
+static inline void WriteHeightFieldQuad(Vertex* vertex, Index* index, unsigned int startVertex) {
+    
+    glm::vec3 U = glm::vec3(vertex[2].x, vertex[2].y, vertex[2].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+    glm::vec3 V = glm::vec3(vertex[1].x, vertex[1].y, vertex[1].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+    glm::vec3 normal = glm::cross(U, V);
+    
+    for (int i = 0; i < 4; i++) {
+        vertex[i].nx = normal.x;
+        vertex[i].ny = normal.y;
+        vertex[i].nz = normal.z;
+    }
+    
+    for (int i = 0; i < 6; i++) 
+        index[i].index = heightFieldQuadIndices[i] + startVertex;
+    
+    return;
+}
+
+void EngineSystemManager::AddHeightFieldToBuffer(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, 
+                                                 float* heightField, glm::vec3* colorField, 
+                                                 unsigned int width, unsigned int height, 
+                                                 float offsetX, float offsetZ, 
+                                                 unsigned int subTessX, unsigned int subTessZ) {
+    
     unsigned int fieldWidth = (width / subTessX) - 1;
     unsigned int fieldHeight = (height / subTessZ) - 1;
     
     float sx = (subTessX > 1) ? subTessX * 4.0f : 1.0f;
     float sz = (subTessZ > 1) ? subTessZ * 4.0f : 1.0f;
     
+    // Size the buffers once for every quad
+    unsigned int startVertex = vertexBuffer.size();
+    unsigned int startIndex  = indexBuffer.size();
+    unsigned int numberOfQuads = fieldWidth * fieldHeight;
+    
+    vertexBuffer.resize(startVertex + numberOfQuads * 4);
+    indexBuffer.resize(startIndex + numberOfQuads * 6, Index(0));
+    
+    Vertex* vertex = &vertexBuffer[startVertex];
+    Index*  index  = &indexBuffer[startIndex];
+    
     for (unsigned int x = 0; x < fieldWidth; x++) {
         
         for (unsigned int z = 0; z < fieldHeight; z++) {
@@ -233,35 +318,21 @@ void EngineSystemManager::AddHeightFieldToMesh(Mesh* mesh,
             float yyD = heightField[(za + 1) * width + xa];
             
             glm::vec3 cA = colorField[za * width + xa];
-            glm::vec3 cB = colorField[za * width + xa];
-            glm::vec3 cC = colorField[za * width + xa];
-            glm::vec3 cD = colorField[za * width + xa];
             
             float xx = (((float)x + offsetX - (float)width / 2) / 2) + 0.25;
             float zz = (((float)z + offsetZ - (float)height / 2) / 2) + 0.25;
             
-            Vertex vertex[4] = {
-                Vertex(xx, yyA, zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0),
-                Vertex(xx + sx, yyB, zz, cB.x, cB.y, cB.z, 0, 1, 0, 1, 0),
-                Vertex(xx + sx, yyC, zz + sz, cC.x, cC.y, cC.z, 0, 1, 0, 1, 1),
-                Vertex(xx, yyD, zz + sz, cD.x, cD.y, cD.z, 0, 1, 0, 0, 1)
-            };
-            
-            glm::vec3 U = glm::vec3(vertex[2].x, vertex[2].y, vertex[2].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
-            glm::vec3 V = glm::vec3(vertex[1].x, vertex[1].y, vertex[1].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
-            glm::vec3 normal = glm::cross(U, V);
+            // Quad position is applied as a sub mesh offset would be
+            vertex[0] = Vertex(xx + xx, yyA, zz + zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0);
+            vertex[1] = Vertex(xx + sx + xx, yyB, zz + zz, cA.x, cA.y, cA.z, 0, 1, 0, 1, 0);
+            vertex[2] = Vertex(xx + sx + xx, yyC, zz + sz + zz, cA.x, cA.y, cA.z, 0, 1, 0, 1, 1);
+            vertex[3] = Vertex(xx + xx, yyD, zz + sz + zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 1);
             
-            for (int i = 0; i < 4; i++) {
-                vertex[i].nx = normal.x;
-                vertex[i].ny = normal.y;
-                vertex[i].nz = normal.z;
-            }
-            
-            SubMesh subBuffer;
-            subBuffer.vertexBuffer.assign(vertex, vertex + 4);
-            subBuffer.indexBuffer = {0, 2, 1, 0, 3, 2};
+            WriteHeightFieldQuad(vertex, index, startVertex);
             
-            mesh->AddSubMesh(xx, 0, zz, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+            vertex += 4;
+            index  += 6;
+            startVertex += 4;
         }
         
     }
@@ -269,20 +340,28 @@ void EngineSystemManager::AddHeightFieldToMesh(Mesh* mesh,
     return;
 }
 
-void EngineSystemManager::AddHeightFieldToMeshHalfSize(Mesh* mesh, 
-                                               float* heightField, glm::vec3* colorField, 
-                                               unsigned int width, unsigned int height, 
-                                               float offsetX, float offsetZ) {
+void EngineSystemManager::AddHeightFieldToBufferHalfSize(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, 
+                                                         float* heightField, glm::vec3* colorField, 
+                                                         unsigned int width, unsigned int height, 
+                                                         float offsetX, float offsetZ) {
     
     unsigned int halfWidth = width / 2.0f;
     unsigned int halfHeight = height / 2.0f;
     
-    unsigned int fieldWidth = halfWidth;
-    unsigned int fieldHeight = halfHeight;
+    // Size the buffers once for every quad
+    unsigned int startVertex = vertexBuffer.size();
+    unsigned int startIndex  = indexBuffer.size();
+    unsigned int numberOfQuads = halfWidth * halfHeight;
     
-    for (unsigned int x = 0; x < fieldWidth; x++) {
+    vertexBuffer.resize(startVertex + numberOfQuads * 4);
+    indexBuffer.resize(startIndex + numberOfQuads * 6, Index(0));
+    
+    Vertex* vertex = &vertexBuffer[startVertex];
+    Index*  index  = &indexBuffer[startIndex];
+    
+    for (unsigned int x = 0; x < halfWidth; x++) {
         
-        for (unsigned int z = 0; z < fieldHeight; z++) {
+        for (unsigned int z = 0; z < halfHeight; z++) {
             unsigned int xa = x * 2;
             unsigned int za = z * 2;
             
@@ -299,28 +378,83 @@ void EngineSystemManager::AddHeightFieldToMeshHalfSize(Mesh* mesh,
             float xx = (((float)x * 2.5f + offsetX - (float)halfWidth)  / 2.5f) - 2.5f;
             float zz = (((float)z * 2.5f + offsetZ - (float)halfHeight) / 2.5f) - 2.5f;
             
-            Vertex vertex[4] = {
-                Vertex(xx, yyA, zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0),
-                Vertex(xx + 2.0f, yyB, zz, cB.x, cB.y, cB.z, 0, 1, 0, 1, 0),
-                Vertex(xx + 2.0f, yyC, zz + 2.0f, cC.x, cC.y, cC.z, 0, 1, 0, 1, 1),
-                Vertex(xx, yyD, zz + 2.0f, cD.x, cD.y, cD.z, 0, 1, 0, 0, 1)
-            };
+            // Quad position is applied as a sub mesh offset would be
+            vertex[0] = Vertex(xx + xx, yyA, zz + zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0);
+            vertex[1] = Vertex(xx + 2.0f + xx, yyB, zz + zz, cB.x, cB.y, cB.z, 0, 1, 0, 1, 0);
+            vertex[2] = Vertex(xx + 2.0f + xx, yyC, zz + 2.0f + zz, cC.x, cC.y, cC.z, 0, 1, 0, 1, 1);
+            vertex[3] = Vertex(xx + xx, yyD, zz + 2.0f + zz, cD.x, cD.y, cD.z, 0, 1, 0, 0, 1);
             
-            glm::vec3 U = glm::vec3(vertex[2].x, vertex[2].y, vertex[2].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
-            glm::vec3 V = glm::vec3(vertex[1].x, vertex[1].y, vertex[1].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
-            glm::vec3 normal = glm::cross(U, V);
+            WriteHeightFieldQuad(vertex, index, startVertex);
             
-            for (int i = 0; i < 4; i++) {
-                vertex[i].nx = normal.x;
-                vertex[i].ny = normal.y;
-                vertex[i].nz = normal.z;
-            }
+            vertex += 4;
+            index  += 6;
+            startVertex += 4;
+        }
+        
+    }
+    
+    return;
+}
+
+void EngineSystemManager::AddHeightFieldToBufferShared(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, 
+                                                       float* heightField, glm::vec3* colorField, 
+                                                       unsigned int width, unsigned int height, 
+                                                       float offsetX, float offsetZ) {
+    
+    // A grid needs at least one quad
+    if ((width < 2) | (height < 2)) 
+        return;
+    
+    unsigned int startVertex = vertexBuffer.size();
+    unsigned int startIndex  = indexBuffer.size();
+    
+    vertexBuffer.resize(startVertex + width * height);
+    indexBuffer.resize(startIndex + (width - 1) * (height - 1) * 6, Index(0));
+    
+    // One vertex per height field point, placed on the same grid as the quad corners
+    Vertex* vertex = &vertexBuffer[startVertex];
+    
+    for (unsigned int z = 0; z < height; z++) {
+        
+        for (unsigned int x = 0; x < width; x++) {
+            unsigned int point = z * width + x;
             
-            SubMesh subBuffer;
-            subBuffer.vertexBuffer.assign(vertex, vertex + 4);
-            subBuffer.indexBuffer = {0, 2, 1, 0, 3, 2};
+            unsigned int xl = (x > 0) ? x - 1 : x;
+            unsigned int xr = (x < width - 1) ? x + 1 : x;
+            unsigned int zl = (z > 0) ? z - 1 : z;
+            unsigned int zr = (z < height - 1) ? z + 1 : z;
             
-            mesh->AddSubMesh(xx, 0, zz, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+            // Smooth normal from the neighboring heights
+            float nx = (heightField[z * width + xl] - heightField[z * width + xr]) / (float)(xr - xl);
+            float nz = (heightField[zl * width + x] - heightField[zr * width + x]) / (float)(zr - zl);
+            
+            float xx = (float)x + offsetX - (float)width / 2 + 0.5f;
+            float zz = (float)z + offsetZ - (float)height / 2 + 0.5f;
+            
+            glm::vec3 color = colorField[point];
+            
+            vertex[point] = Vertex(xx, heightField[point], zz, color.x, color.y, color.z, nx, 1, nz, (float)x, (float)z);
+        }
+        
+    }
+    
+    Index* index = &indexBuffer[startIndex];
+    
+    for (unsigned int x = 0; x < width - 1; x++) {
+        
+        for (unsigned int z = 0; z < height - 1; z++) {
+            
+            unsigned int corner[4] = {
+                startVertex + z * width + x, 
+                startVertex + z * width + (x + 1), 
+                startVertex + (z + 1) * width + (x + 1), 
+                startVertex + (z + 1) * width + x
+            };
+            
+            for (int i = 0; i < 6; i++) 
+                index[i].index = corner[ heightFieldQuadIndices[i] ];
+            
+            index += 6;
         }
         
     }
@@ -488,6 +622,8 @@ void EngineSystemManager::Initiate() {
     shaders.textureUnlit  = Resources.CreateShaderFromTag("textureUnlit");
     shaders.color         = Resources.CreateShaderFromTag("color");
     shaders.colorUnlit    = Resources.CreateShaderFromTag("colorUnlit");
+    shaders.colorInstanced = Resources.CreateShaderFromTag("colorInstanced");
+    shaders.particle      = Resources.CreateShaderFromTag("particle");
     shaders.UI            = Resources.CreateShaderFromTag("UI");
     shaders.shadowCaster  = Resources.CreateShaderFromTag("shadowCaster");
     shaders.sky           = Resources.CreateShaderFromTag("sky");
@@ -525,11 +661,29 @@ void EngineSystemManager::Initiate() {
     sceneMain = Create<Scene>();
     Renderer.AddSceneToRenderQueue( sceneMain );
     
+    // Actor body parts share one material and are drawn in a single instanced call
+    mActorBatchMaterial = Renderer.CreateMaterial();
+    mActorBatchMaterial->isShared = true;
+    mActorBatchMaterial->shader = shaders.colorInstanced;
+    
+    mActorBatchMaterial->DisableBlending();
+    mActorBatchMaterial->EnableCulling();
+    mActorBatchMaterial->EnableDepthTest();
+    mActorBatchMaterial->DisableShadowVolumePass();
+    
+    mActorBatch = Renderer.CreateInstanceBatch();
+    mActorBatch->mesh     = meshes.cube;
+    mActorBatch->material = mActorBatchMaterial;
+    
+    sceneMain->AddInstanceBatchToScene( mActorBatch );
+    
     // Initiate render system defaults
     Renderer.shaders.texture      = shaders.texture;
     Renderer.shaders.textureUnlit = shaders.textureUnlit;
     Renderer.shaders.color        = shaders.color;
     Renderer.shaders.colorUnlit   = shaders.colorUnlit;
+    Renderer.shaders.colorInstanced = shaders.colorInstanced;
+    Renderer.shaders.particle     = shaders.particle;
     Renderer.shaders.UI           = shaders.UI;
     Renderer.shaders.shadowCaster = shaders.shadowCaster;
     Renderer.shaders.sky          = shaders.sky;
@@ -635,10 +789,15 @@ void EngineSystemManager::Shutdown(void) {
     
     Destroy<Scene>(sceneOverlay);
     
+    Renderer.DestroyInstanceBatch(mActorBatch);
+    Renderer.DestroyMaterial(mActorBatchMaterial);
+    
     Renderer.DestroyShader(shaders.texture);
     Renderer.DestroyShader(shaders.textureUnlit);
     Renderer.DestroyShader(shaders.color);
     Renderer.DestroyShader(shaders.colorUnlit);
+    Renderer.DestroyShader(shaders.colorInstanced);
+    Renderer.DestroyShader(shaders.particle);
     Renderer.DestroyShader(shaders.UI);
     Renderer.DestroyShader(shaders.shadowCaster);
     
@@ -680,6 +839,9 @@ void EngineSystemManager::EnablePhysicsDebugRenderer(void) {
     debugLines->SetPrimitive( MESH_LINES );
     debugMesh->SetPrimitive( MESH_LINES );
     
+    debugLines->SetDynamic(true);
+    debugMesh->SetDynamic(true);
+    
     
     debugLinesGameObject = Create<GameObject>();
     debugMeshGameObject = Create<GameObject>();
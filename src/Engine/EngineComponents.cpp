@@ -78,7 +78,7 @@ bool EngineSystemManager::DestroyComponent(Component* componentPtr) {
             Actor* actorPtr = (Actor*)componentPtr->GetComponent();
             
             for (unsigned int i=0; i < actorPtr->mGeneticRenderers.size(); i++) 
-                sceneMain->RemoveMeshRendererFromSceneRoot( actorPtr->mGeneticRenderers[i], RENDER_QUEUE_GEOMETRY );
+                mActorBatch->RemoveMeshRenderer( actorPtr->mGeneticRenderers[i] );
             
             for (unsigned int i=0; i < actorPtr->mGeneticRenderers.size(); i++) 
                 Destroy<MeshRenderer>( actorPtr->mGeneticRenderers[i] );
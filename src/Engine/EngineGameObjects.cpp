@@ -208,6 +208,9 @@ GameObject* EngineSystemManager::CreateOverlayTextRenderer(float x, float y, std
     overlayRenderer->material->DisableCulling();
     overlayRenderer->material->DisableShadowVolumePass();
     
+    // Glyphs are rebuilt whenever the text changes
+    overlayRenderer->mesh->SetDynamic(true);
+    
     return overlayObject;
 }
 
@@ -19,6 +19,7 @@ ENGINE_API AudioPreset          Samples;
 ENGINE_API InputSystem          Input;
 ENGINE_API MathCore             Math;
 ENGINE_API ActorSystem          AI;
+ENGINE_API JobSystem            Jobs;
 
 ENGINE_API StringType           String;
 ENGINE_API FloatType            Float;
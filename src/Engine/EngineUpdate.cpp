@@ -35,20 +35,71 @@ void EngineSystemManager::Update(void) {
     // Update attached components
     //
     
-    for (unsigned int i=0; i < mStreamSize; i++ ) {
-        
-        if (mStreamBuffer[i].rigidBody != nullptr)       UpdateRigidBody(i);
-        if (mStreamBuffer[i].meshRenderer != nullptr)    UpdateMeshRenderer(i);
-        if (mStreamBuffer[i].camera != nullptr)          UpdateCamera(i);
-        if (mStreamBuffer[i].actor != nullptr)           UpdateActor(i);
-        if (mStreamBuffer[i].light != nullptr)           UpdateLight(i);
-        if (mStreamBuffer[i].text != nullptr)            UpdateTextUI(i);
-        
-        if ((mStreamBuffer[i].panel != nullptr) & 
-            (mStreamBuffer[i].meshRenderer != nullptr))  UpdatePanelUI(i);
-        
-        continue;
-    }
+    // Each system runs over its own dense component stream. Rigid bodies
+    // go first so the other systems pick up the current physics transform.
+    Timer streamTimer;
+    
+    streamTimer.Update();
+    Jobs.ParallelFor(mRigidBodyStream.size, JOB_SYSTEM_COMPONENT_BATCH_SIZE, [this](unsigned int begin, unsigned int end) {
+        for (unsigned int i=begin; i < end; i++) 
+            UpdateRigidBody(i);
+    });
+    mRigidBodyStream.milliseconds = streamTimer.GetCurrentDelta();
+    
+    // Mesh renderer sync and light updates only touch their own components
+    // and run on the job workers. Actors create renderers, move their body
+    // part renderers and cast rays so they stay on this thread.
+    JobCounter meshRendererCounter;
+    JobCounter componentCounter;
+    
+    Jobs.Submit([this]() {
+        Timer jobTimer;
+        jobTimer.Update();
+        Jobs.ParallelFor(mMeshRendererStream.size, JOB_SYSTEM_COMPONENT_BATCH_SIZE, [this](unsigned int begin, unsigned int end) {
+            for (unsigned int i=begin; i < end; i++) 
+                UpdateMeshRenderer(i);
+        });
+        mMeshRendererStream.milliseconds = jobTimer.GetCurrentDelta();
+    }, &meshRendererCounter);
+    
+    Jobs.Submit([this]() {
+        Timer jobTimer;
+        jobTimer.Update();
+        Jobs.ParallelFor(mLightStream.size, JOB_SYSTEM_COMPONENT_BATCH_SIZE, [this](unsigned int begin, unsigned int end) {
+            for (unsigned int i=begin; i < end; i++) 
+                UpdateLight(i);
+        });
+        mLightStream.milliseconds = jobTimer.GetCurrentDelta();
+    }, &componentCounter);
+    
+    // Ground queries run while the renderers sync. The actor update
+    // writes renderer transforms, so it waits for the sync to finish.
+    streamTimer.Update();
+    QueryActorGround();
+    
+    Jobs.Wait(&meshRendererCounter);
+    
+    for (unsigned int i=0; i < mActorStream.size; i++) 
+        UpdateActor(i);
+    mActorStream.milliseconds = streamTimer.GetCurrentDelta();
+    
+    Jobs.Wait(&componentCounter);
+    
+    streamTimer.Update();
+    for (unsigned int i=0; i < mCameraStream.size; i++) 
+        UpdateCamera(i);
+    mCameraStream.milliseconds = streamTimer.GetCurrentDelta();
+    
+    streamTimer.Update();
+    for (unsigned int i=0; i < mTextStream.size; i++) 
+        UpdateTextUI(i);
+    mTextStream.milliseconds = streamTimer.GetCurrentDelta();
+    
+    streamTimer.Update();
+    for (unsigned int i=0; i < mPanelStream.size; i++) 
+        UpdatePanelUI(i);
+    mPanelStream.milliseconds = streamTimer.GetCurrentDelta();
+    
     
     
     //
@@ -94,7 +145,27 @@ void EngineSystemManager::Update(void) {
     return;
 }
 
-
-
-
+EngineSystemManager::ComponentStreamProfile EngineSystemManager::GetComponentStreamProfile(ComponentType type) {
+    
+    ComponentStreamProfile profile;
+    profile.count        = 0;
+    profile.milliseconds = 0;
+    
+    switch (type) {
+        
+        case Components.Transform:    profile.count = mTransformStream.size; break;
+        
+        case Components.RigidBody:    profile.count = mRigidBodyStream.size;    profile.milliseconds = mRigidBodyStream.milliseconds; break;
+        case Components.MeshRenderer: profile.count = mMeshRendererStream.size; profile.milliseconds = mMeshRendererStream.milliseconds; break;
+        case Components.Camera:       profile.count = mCameraStream.size;       profile.milliseconds = mCameraStream.milliseconds; break;
+        case Components.Actor:        profile.count = mActorStream.size;        profile.milliseconds = mActorStream.milliseconds; break;
+        case Components.Light:        profile.count = mLightStream.size;        profile.milliseconds = mLightStream.milliseconds; break;
+        case Components.Text:         profile.count = mTextStream.size;         profile.milliseconds = mTextStream.milliseconds; break;
+        case Components.Panel:        profile.count = mPanelStream.size;        profile.milliseconds = mPanelStream.milliseconds; break;
+        
+        default: break;
+    }
+    
+    return profile;
+}
 
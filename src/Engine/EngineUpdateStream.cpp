@@ -40,8 +40,14 @@ void EngineSystemManager::UpdateComponentStream(void) {
         
         // Check last object
         if (mObjectIndex == numberOfGameObjects - 1) {
-            mStreamSize = mDataStreamIndex;
-            mDataStreamIndex = 0;
+            mTransformStream.Close();
+            mRigidBodyStream.Close();
+            mMeshRendererStream.Close();
+            mCameraStream.Close();
+            mActorStream.Close();
+            mLightStream.Close();
+            mTextStream.Close();
+            mPanelStream.Close();
         }
         
         // UI elements should always be added to the stream buffer
@@ -80,17 +86,45 @@ void EngineSystemManager::UpdateComponentStream(void) {
         if ((!gameObject->isActive || !shouldRender) && !isUIElement) 
             continue;
         
-        mStreamBuffer[mDataStreamIndex].gameObject    = gameObject;
-        mStreamBuffer[mDataStreamIndex].transform     = gameObject->mTransformCache;
-        mStreamBuffer[mDataStreamIndex].light         = gameObject->mLightCache;
-        mStreamBuffer[mDataStreamIndex].actor         = gameObject->mActorCache;
-        mStreamBuffer[mDataStreamIndex].camera        = gameObject->mCameraCache;
-        mStreamBuffer[mDataStreamIndex].rigidBody     = gameObject->mRigidBodyCache;
-        mStreamBuffer[mDataStreamIndex].meshRenderer  = gameObject->mMeshRendererCache;
-        mStreamBuffer[mDataStreamIndex].text          = gameObject->mTextCache;
-        mStreamBuffer[mDataStreamIndex].panel         = gameObject->mPanelCache;
-        
-        mDataStreamIndex++;
-        mStreamSize = std::max(mStreamSize, mDataStreamIndex);
+        Transform* transform = gameObject->mTransformCache;
+        
+        mTransformStream.Push( transform );
+        
+        // Emit the object into the stream of each attached component type
+        if (gameObject->mRigidBodyCache != nullptr) {
+            RigidBodyStream entry = {transform, gameObject->mRigidBodyCache};
+            mRigidBodyStream.Push(entry);
+        }
+        
+        if (gameObject->mMeshRendererCache != nullptr) {
+            MeshRendererStream entry = {transform, gameObject->mMeshRendererCache};
+            mMeshRendererStream.Push(entry);
+        }
+        
+        if (gameObject->mCameraCache != nullptr) {
+            CameraStream entry = {transform, gameObject->mCameraCache, gameObject->mPanelCache};
+            mCameraStream.Push(entry);
+        }
+        
+        if (gameObject->mActorCache != nullptr) {
+            ActorStream entry = {gameObject, transform, gameObject->mActorCache, gameObject->mRigidBodyCache};
+            mActorStream.Push(entry);
+        }
+        
+        if (gameObject->mLightCache != nullptr) {
+            LightStream entry = {transform, gameObject->mLightCache};
+            mLightStream.Push(entry);
+        }
+        
+        if ((gameObject->mTextCache != nullptr) & (gameObject->mMeshRendererCache != nullptr)) {
+            TextStream entry = {gameObject, transform, gameObject->mMeshRendererCache, gameObject->mTextCache};
+            mTextStream.Push(entry);
+        }
+        
+        if ((gameObject->mPanelCache != nullptr) & (gameObject->mMeshRendererCache != nullptr)) {
+            PanelStream entry = {transform, gameObject->mPanelCache};
+            mPanelStream.Push(entry);
+        }
+        
     }
 }
@@ -2,11 +2,11 @@
 
 void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
     
-    for (unsigned int a = 0; a < mStreamBuffer[index].actor->mGeneticRenderers.size(); a++) {
+    for (unsigned int a = 0; a < mActorStream[index].actor->mGeneticRenderers.size(); a++) {
         
-        MeshRenderer* geneRenderer = mStreamBuffer[index].actor->mGeneticRenderers[a];
+        MeshRenderer* geneRenderer = mActorStream[index].actor->mGeneticRenderers[a];
         
-        geneRenderer->transform.position = mStreamBuffer[index].actor->mPosition;
+        geneRenderer->transform.position = mActorStream[index].actor->mPosition;
         
         glm::mat4 matrix = glm::translate(glm::mat4(1), geneRenderer->transform.position);
         
@@ -23,10 +23,10 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
 
 void EngineSystemManager::ApplyScaleByAge(glm::mat4& matrix, unsigned int index, unsigned int a) {
     
-    float ageScalerValue = std::min(((float)mStreamBuffer[index].actor->mAge) * 0.001f, 1.0f);
+    float ageScalerValue = std::min(((float)mActorStream[index].actor->mAge) * 0.001f, 1.0f);
     
-    float ageScale = Math.Lerp(mStreamBuffer[index].actor->mYouthScale, 
-                               mStreamBuffer[index].actor->mAdultScale, 
+    float ageScale = Math.Lerp(mActorStream[index].actor->mYouthScale, 
+                               mActorStream[index].actor->mAdultScale, 
                                ageScalerValue);
     
     matrix = glm::scale(matrix, glm::vec3(ageScale));
@@ -36,30 +36,30 @@ void EngineSystemManager::ApplyScaleByAge(glm::mat4& matrix, unsigned int index,
 
 void EngineSystemManager::ApplyRotation(glm::mat4& matrix, unsigned int index, unsigned int a) {
     
-    float orientationCenterMass = glm::length(mStreamBuffer[index].actor->mRotation);
+    float orientationCenterMass = glm::length(mActorStream[index].actor->mRotation);
     
     if (orientationCenterMass > 0) {
         matrix = glm::rotate(matrix, glm::radians(orientationCenterMass), 
-                             glm::normalize(mStreamBuffer[index].actor->mRotation));
+                             glm::normalize(mActorStream[index].actor->mRotation));
     }
     
     return;
 }
 
 void EngineSystemManager::ApplyOffsetFromCenter(glm::mat4& matrix, unsigned int index, unsigned int a) {
-    matrix = glm::translate(matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].offset.x,
-                                              mStreamBuffer[index].actor->mGenes[a].offset.y,
-                                              mStreamBuffer[index].actor->mGenes[a].offset.z));
+    matrix = glm::translate(matrix, glm::vec3(mActorStream[index].actor->mGenes[a].offset.x,
+                                              mActorStream[index].actor->mGenes[a].offset.y,
+                                              mActorStream[index].actor->mGenes[a].offset.z));
 }
 
 void EngineSystemManager::UpdateAnimation(glm::mat4& matrix, unsigned int index, unsigned int a) {
     
     // Check skip animation for this renderer
-    if (!mStreamBuffer[index].actor->mGenes[a].doAnimationCycle || !mStreamBuffer[index].actor->mIsWalking) {
+    if (!mActorStream[index].actor->mGenes[a].doAnimationCycle || !mActorStream[index].actor->mIsWalking) {
         
-        matrix = glm::translate(matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].position.x,
-                                                mStreamBuffer[index].actor->mGenes[a].position.y,
-                                                mStreamBuffer[index].actor->mGenes[a].position.z));
+        matrix = glm::translate(matrix, glm::vec3(mActorStream[index].actor->mGenes[a].position.x,
+                                                mActorStream[index].actor->mGenes[a].position.y,
+                                                mActorStream[index].actor->mGenes[a].position.z));
         
         return;
     }
@@ -68,17 +68,17 @@ void EngineSystemManager::UpdateAnimation(glm::mat4& matrix, unsigned int index,
     
     ApplyAnimationRotation(matrix, index, a);
     
-    matrix = glm::translate(matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].position.x,
-                                              mStreamBuffer[index].actor->mGenes[a].position.y,
-                                              mStreamBuffer[index].actor->mGenes[a].position.z));
+    matrix = glm::translate(matrix, glm::vec3(mActorStream[index].actor->mGenes[a].position.x,
+                                              mActorStream[index].actor->mGenes[a].position.y,
+                                              mActorStream[index].actor->mGenes[a].position.z));
     
-    glm::vec4 animationFactor = glm::normalize(glm::vec4(mStreamBuffer[index].actor->mGenes[a].animationAxis.x, 
-                                                         mStreamBuffer[index].actor->mGenes[a].animationAxis.y, 
-                                                         mStreamBuffer[index].actor->mGenes[a].animationAxis.z, 0));
+    glm::vec4 animationFactor = glm::normalize(glm::vec4(mActorStream[index].actor->mGenes[a].animationAxis.x, 
+                                                         mActorStream[index].actor->mGenes[a].animationAxis.y, 
+                                                         mActorStream[index].actor->mGenes[a].animationAxis.z, 0));
     
-    float animationMaxSwingRange = mStreamBuffer[index].actor->mGenes[a].animationRange;
+    float animationMaxSwingRange = mActorStream[index].actor->mGenes[a].animationRange;
     
-    if (mStreamBuffer[index].actor->mAnimationStates[a].w < 0) {
+    if (mActorStream[index].actor->mAnimationStates[a].w < 0) {
         
         HandleAnimationSwingForward(index, a, animationFactor, animationMaxSwingRange);
         
@@ -91,53 +91,53 @@ void EngineSystemManager::UpdateAnimation(glm::mat4& matrix, unsigned int index,
 }
 
 void EngineSystemManager::HandleAnimationSwingForward(unsigned int index, unsigned int a, glm::vec4& animationFactor, float animationMaxSwingRange) {
-    if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
-        mStreamBuffer[index].actor->mAnimationStates[a] += animationFactor;
-        if (glm::any(glm::greaterThan(mStreamBuffer[index].actor->mAnimationStates[a], glm::vec4(animationMaxSwingRange)))) {
-            mStreamBuffer[index].actor->mAnimationStates[a].w = mStreamBuffer[index].actor->mGenes[a].doInverseAnimation ? 1 : -1;
+    if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
+        mActorStream[index].actor->mAnimationStates[a] += animationFactor;
+        if (glm::any(glm::greaterThan(mActorStream[index].actor->mAnimationStates[a], glm::vec4(animationMaxSwingRange)))) {
+            mActorStream[index].actor->mAnimationStates[a].w = mActorStream[index].actor->mGenes[a].doInverseAnimation ? 1 : -1;
         }
     } else {
-        mStreamBuffer[index].actor->mAnimationStates[a] -= animationFactor;
-        if (glm::any(glm::lessThan(mStreamBuffer[index].actor->mAnimationStates[a], glm::vec4(-animationMaxSwingRange)))) {
-            mStreamBuffer[index].actor->mAnimationStates[a].w = mStreamBuffer[index].actor->mGenes[a].doInverseAnimation ? -1 : 1;
+        mActorStream[index].actor->mAnimationStates[a] -= animationFactor;
+        if (glm::any(glm::lessThan(mActorStream[index].actor->mAnimationStates[a], glm::vec4(-animationMaxSwingRange)))) {
+            mActorStream[index].actor->mAnimationStates[a].w = mActorStream[index].actor->mGenes[a].doInverseAnimation ? -1 : 1;
         }
     }
 }
 
 void EngineSystemManager::HandleAnimationSwingBackward(unsigned int index, unsigned int a, glm::vec4& animationFactor, float animationMaxSwingRange) {
-    if (!mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
-        mStreamBuffer[index].actor->mAnimationStates[a] += animationFactor;
-        if (glm::any(glm::greaterThan(mStreamBuffer[index].actor->mAnimationStates[a], glm::vec4(animationMaxSwingRange)))) {
-            mStreamBuffer[index].actor->mAnimationStates[a].w = mStreamBuffer[index].actor->mGenes[a].doInverseAnimation ? 1 : -1;
+    if (!mActorStream[index].actor->mGenes[a].doInverseAnimation) {
+        mActorStream[index].actor->mAnimationStates[a] += animationFactor;
+        if (glm::any(glm::greaterThan(mActorStream[index].actor->mAnimationStates[a], glm::vec4(animationMaxSwingRange)))) {
+            mActorStream[index].actor->mAnimationStates[a].w = mActorStream[index].actor->mGenes[a].doInverseAnimation ? 1 : -1;
         }
     } else {
-        mStreamBuffer[index].actor->mAnimationStates[a] -= animationFactor;
-        if (glm::any(glm::lessThan(mStreamBuffer[index].actor->mAnimationStates[a], glm::vec4(-animationMaxSwingRange)))) {
-            mStreamBuffer[index].actor->mAnimationStates[a].w = mStreamBuffer[index].actor->mGenes[a].doInverseAnimation ? -1 : 1;
+        mActorStream[index].actor->mAnimationStates[a] -= animationFactor;
+        if (glm::any(glm::lessThan(mActorStream[index].actor->mAnimationStates[a], glm::vec4(-animationMaxSwingRange)))) {
+            mActorStream[index].actor->mAnimationStates[a].w = mActorStream[index].actor->mGenes[a].doInverseAnimation ? -1 : 1;
         }
     }
 }
 
 void EngineSystemManager::ApplyAnimationRotation(glm::mat4& matrix, unsigned int index, unsigned int a) {
     EnsureNonZeroAnimationState(index, a);
-    glm::vec3 baseRotation = glm::vec3(mStreamBuffer[index].actor->mGenes[a].rotation.x, 
-                                       mStreamBuffer[index].actor->mGenes[a].rotation.y, 
-                                       mStreamBuffer[index].actor->mGenes[a].rotation.z) + 0.0001f;
+    glm::vec3 baseRotation = glm::vec3(mActorStream[index].actor->mGenes[a].rotation.x, 
+                                       mActorStream[index].actor->mGenes[a].rotation.y, 
+                                       mActorStream[index].actor->mGenes[a].rotation.z) + 0.0001f;
     float rotationLength = glm::length(baseRotation);
     matrix = glm::rotate(matrix, rotationLength, glm::normalize(baseRotation));
 
-    float animationLength = glm::length(mStreamBuffer[index].actor->mAnimationStates[a]);
+    float animationLength = glm::length(mActorStream[index].actor->mAnimationStates[a]);
     matrix = glm::rotate(matrix, glm::radians(animationLength), 
-                         glm::normalize(glm::vec3(mStreamBuffer[index].actor->mAnimationStates[a])));
+                         glm::normalize(glm::vec3(mActorStream[index].actor->mAnimationStates[a])));
 }
 
 void EngineSystemManager::EnsureNonZeroAnimationState(unsigned int index, unsigned int a) {
-    if (mStreamBuffer[index].actor->mAnimationStates[a].x == 0) 
-        mStreamBuffer[index].actor->mAnimationStates[a].x += 0.0001f;
-    if (mStreamBuffer[index].actor->mAnimationStates[a].y == 0) 
-        mStreamBuffer[index].actor->mAnimationStates[a].y += 0.0001f;
-    if (mStreamBuffer[index].actor->mAnimationStates[a].z == 0) 
-        mStreamBuffer[index].actor->mAnimationStates[a].z += 0.0001f;
+    if (mActorStream[index].actor->mAnimationStates[a].x == 0) 
+        mActorStream[index].actor->mAnimationStates[a].x += 0.0001f;
+    if (mActorStream[index].actor->mAnimationStates[a].y == 0) 
+        mActorStream[index].actor->mAnimationStates[a].y += 0.0001f;
+    if (mActorStream[index].actor->mAnimationStates[a].z == 0) 
+        mActorStream[index].actor->mAnimationStates[a].z += 0.0001f;
 }
 
 
@@ -161,27 +161,27 @@ void EngineSystemManager::EnsureNonZeroAnimationState(unsigned int index, unsign
 
 void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
     
-    for (unsigned int a=0; a < mStreamBuffer[index].actor->mGeneticRenderers.size(); a++) {
+    for (unsigned int a=0; a < mActorStream[index].actor->mGeneticRenderers.size(); a++) {
         
-        MeshRenderer* geneRenderer = mStreamBuffer[index].actor->mGeneticRenderers[a];
+        MeshRenderer* geneRenderer = mActorStream[index].actor->mGeneticRenderers[a];
         
-        geneRenderer->transform.position = mStreamBuffer[index].actor->mPosition;
+        geneRenderer->transform.position = mActorStream[index].actor->mPosition;
         
         // Initiate the transform
         glm::mat4 matrix = glm::translate(glm::mat4(1), geneRenderer->transform.position);
         
         // Rotate around center mass
-        float orientationCenterMass = glm::length( mStreamBuffer[index].actor->mRotation );
+        float orientationCenterMass = glm::length( mActorStream[index].actor->mRotation );
         
         
         // Scale by age
-        float ageScalerValue = ((float)mStreamBuffer[index].actor->mAge) * 0.001f;
+        float ageScalerValue = ((float)mActorStream[index].actor->mAge) * 0.001f;
         
         if (ageScalerValue > 1.0f) 
             ageScalerValue = 1.0f;
         
-        float ageScale = Math.Lerp(mStreamBuffer[index].actor->mYouthScale, 
-                                   mStreamBuffer[index].actor->mAdultScale, 
+        float ageScale = Math.Lerp(mActorStream[index].actor->mYouthScale, 
+                                   mActorStream[index].actor->mAdultScale, 
                                    ageScalerValue);
         
         matrix = glm::scale( matrix, glm::vec3( ageScale ));
@@ -195,25 +195,25 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
             
             matrix = glm::rotate(matrix, 
                                 glm::radians( orientationCenterMass ), 
-                                glm::normalize( mStreamBuffer[index].actor->mRotation ));
+                                glm::normalize( mActorStream[index].actor->mRotation ));
             
         }
         
         
         // Offset from center
-        matrix = glm::translate( matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].offset.x,
-                                                   mStreamBuffer[index].actor->mGenes[a].offset.y,
-                                                   mStreamBuffer[index].actor->mGenes[a].offset.z));
+        matrix = glm::translate( matrix, glm::vec3(mActorStream[index].actor->mGenes[a].offset.x,
+                                                   mActorStream[index].actor->mGenes[a].offset.y,
+                                                   mActorStream[index].actor->mGenes[a].offset.z));
         
         //
         // Update animation
         //
         
-        if ((!mStreamBuffer[index].actor->mGenes[a].doAnimationCycle) | (!mStreamBuffer[index].actor->mIsWalking)) {
+        if ((!mActorStream[index].actor->mGenes[a].doAnimationCycle) | (!mActorStream[index].actor->mIsWalking)) {
             
-            matrix = glm::translate( matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].position.x,
-                                                       mStreamBuffer[index].actor->mGenes[a].position.y,
-                                                       mStreamBuffer[index].actor->mGenes[a].position.z));
+            matrix = glm::translate( matrix, glm::vec3(mActorStream[index].actor->mGenes[a].position.x,
+                                                       mActorStream[index].actor->mGenes[a].position.y,
+                                                       mActorStream[index].actor->mGenes[a].position.z));
             
             geneRenderer->transform.matrix = glm::scale(matrix, geneRenderer->transform.scale);
             
@@ -221,54 +221,54 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
         }
         
         // Rotate current animation state
-        glm::vec4 animationFactor(mStreamBuffer[index].actor->mGenes[a].animationAxis.x, 
-                                  mStreamBuffer[index].actor->mGenes[a].animationAxis.y, 
-                                  mStreamBuffer[index].actor->mGenes[a].animationAxis.z, 
+        glm::vec4 animationFactor(mActorStream[index].actor->mGenes[a].animationAxis.x, 
+                                  mActorStream[index].actor->mGenes[a].animationAxis.y, 
+                                  mActorStream[index].actor->mGenes[a].animationAxis.z, 
                                   0);
         
         animationFactor = glm::normalize(animationFactor);
         
         // Step the animation swing direction
-        float animationMaxSwingRange = mStreamBuffer[index].actor->mGenes[a].animationRange;
+        float animationMaxSwingRange = mActorStream[index].actor->mGenes[a].animationRange;
         
-        if (mStreamBuffer[index].actor->mAnimationStates[a].w < 0) {
+        if (mActorStream[index].actor->mAnimationStates[a].w < 0) {
             
             // Check inverted animation cycle
-            if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+            if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                 
                 // Swing forward
-                mStreamBuffer[index].actor->mAnimationStates[a] += animationFactor;
+                mActorStream[index].actor->mAnimationStates[a] += animationFactor;
                 
-                if ((mStreamBuffer[index].actor->mAnimationStates[a].x > animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].y > animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].z > animationMaxSwingRange)) {
+                if ((mActorStream[index].actor->mAnimationStates[a].x > animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].y > animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].z > animationMaxSwingRange)) {
                     
-                    if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+                    if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = 1;
+                        mActorStream[index].actor->mAnimationStates[a].w = 1;
                         
                     } else {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = -1;
+                        mActorStream[index].actor->mAnimationStates[a].w = -1;
                     }
                 }
                 
             } else {
                 
                 // Swing backward
-                mStreamBuffer[index].actor->mAnimationStates[a] -= animationFactor;
+                mActorStream[index].actor->mAnimationStates[a] -= animationFactor;
                 
-                if ((mStreamBuffer[index].actor->mAnimationStates[a].x < -animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].y < -animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].z < -animationMaxSwingRange)) {
+                if ((mActorStream[index].actor->mAnimationStates[a].x < -animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].y < -animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].z < -animationMaxSwingRange)) {
                     
-                    if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+                    if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = -1;
+                        mActorStream[index].actor->mAnimationStates[a].w = -1;
                         
                     } else {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = 1;
+                        mActorStream[index].actor->mAnimationStates[a].w = 1;
                     }
                 }
                 
@@ -277,23 +277,23 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
         } else {
             
             // Check to invert the animation
-            if (!mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+            if (!mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                 
                 // Animation cycle
                 
-                mStreamBuffer[index].actor->mAnimationStates[a] += animationFactor;
+                mActorStream[index].actor->mAnimationStates[a] += animationFactor;
                 
-                if ((mStreamBuffer[index].actor->mAnimationStates[a].x > animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].y > animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].z > animationMaxSwingRange)) {
+                if ((mActorStream[index].actor->mAnimationStates[a].x > animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].y > animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].z > animationMaxSwingRange)) {
                     
-                    if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+                    if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = 1;
+                        mActorStream[index].actor->mAnimationStates[a].w = 1;
                         
                     } else {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = -1;
+                        mActorStream[index].actor->mAnimationStates[a].w = -1;
                         
                     }
                 }
@@ -302,19 +302,19 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
                 
                 // Inverse animation cycle
                 
-                mStreamBuffer[index].actor->mAnimationStates[a] -= animationFactor;
+                mActorStream[index].actor->mAnimationStates[a] -= animationFactor;
                 
-                if ((mStreamBuffer[index].actor->mAnimationStates[a].x < -animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].y < -animationMaxSwingRange) | 
-                    (mStreamBuffer[index].actor->mAnimationStates[a].z < -animationMaxSwingRange)) {
+                if ((mActorStream[index].actor->mAnimationStates[a].x < -animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].y < -animationMaxSwingRange) | 
+                    (mActorStream[index].actor->mAnimationStates[a].z < -animationMaxSwingRange)) {
                     
-                    if (mStreamBuffer[index].actor->mGenes[a].doInverseAnimation) {
+                    if (mActorStream[index].actor->mGenes[a].doInverseAnimation) {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = -1;
+                        mActorStream[index].actor->mAnimationStates[a].w = -1;
                         
                     } else {
                         
-                        mStreamBuffer[index].actor->mAnimationStates[a].w = 1;
+                        mActorStream[index].actor->mAnimationStates[a].w = 1;
                     }
                 }
                 
@@ -326,17 +326,17 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
         // Apply animation rotation state
         
         // Cannot be zero when rotating
-        if (mStreamBuffer[index].actor->mAnimationStates[a].x == 0) 
-            mStreamBuffer[index].actor->mAnimationStates[a].x += 0.0001f;
-        if (mStreamBuffer[index].actor->mAnimationStates[a].y == 0) 
-            mStreamBuffer[index].actor->mAnimationStates[a].y += 0.0001f;
-        if (mStreamBuffer[index].actor->mAnimationStates[a].z == 0) 
-            mStreamBuffer[index].actor->mAnimationStates[a].z += 0.0001f;
+        if (mActorStream[index].actor->mAnimationStates[a].x == 0) 
+            mActorStream[index].actor->mAnimationStates[a].x += 0.0001f;
+        if (mActorStream[index].actor->mAnimationStates[a].y == 0) 
+            mActorStream[index].actor->mAnimationStates[a].y += 0.0001f;
+        if (mActorStream[index].actor->mAnimationStates[a].z == 0) 
+            mActorStream[index].actor->mAnimationStates[a].z += 0.0001f;
         
         // Calculate base rotation
-        glm::vec3 baseRotation = glm::vec3(mStreamBuffer[index].actor->mGenes[a].rotation.x + 0.0001f, 
-                                           mStreamBuffer[index].actor->mGenes[a].rotation.y + 0.0001f, 
-                                           mStreamBuffer[index].actor->mGenes[a].rotation.z + 0.0001f);
+        glm::vec3 baseRotation = glm::vec3(mActorStream[index].actor->mGenes[a].rotation.x + 0.0001f, 
+                                           mActorStream[index].actor->mGenes[a].rotation.y + 0.0001f, 
+                                           mActorStream[index].actor->mGenes[a].rotation.z + 0.0001f);
         
         float rotationLength = glm::length( baseRotation );
         
@@ -345,17 +345,17 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
                             glm::normalize( baseRotation ));
         
         // Calculate animation rotation
-        float animationLength = glm::length( mStreamBuffer[index].actor->mAnimationStates[a] );
+        float animationLength = glm::length( mActorStream[index].actor->mAnimationStates[a] );
         matrix = glm::rotate(matrix, 
                              glm::radians( animationLength ), 
-                             glm::normalize( glm::vec3(mStreamBuffer[index].actor->mAnimationStates[a].x, 
-                                                       mStreamBuffer[index].actor->mAnimationStates[a].y, 
-                                                       mStreamBuffer[index].actor->mAnimationStates[a].z) ));
+                             glm::normalize( glm::vec3(mActorStream[index].actor->mAnimationStates[a].x, 
+                                                       mActorStream[index].actor->mAnimationStates[a].y, 
+                                                       mActorStream[index].actor->mAnimationStates[a].z) ));
         
         // Final position after animation rotation
-        matrix = glm::translate( matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].position.x,
-                                                   mStreamBuffer[index].actor->mGenes[a].position.y,
-                                                   mStreamBuffer[index].actor->mGenes[a].position.z));
+        matrix = glm::translate( matrix, glm::vec3(mActorStream[index].actor->mGenes[a].position.x,
+                                                   mActorStream[index].actor->mGenes[a].position.y,
+                                                   mActorStream[index].actor->mGenes[a].position.z));
         
         geneRenderer->transform.matrix = glm::scale(matrix, geneRenderer->transform.scale);
         
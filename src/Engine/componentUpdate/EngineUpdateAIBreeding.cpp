@@ -2,10 +2,10 @@
 
 void EngineSystemManager::UpdateActorBreeding(unsigned int index) {
     
-    if (!mStreamBuffer[index].actor->mIsActive) 
+    if (!mActorStream[index].actor->mIsActive) 
         return;
     
-    if (mStreamBuffer[index].actor->mBreedWithActor == nullptr) 
+    if (mActorStream[index].actor->mBreedWithActor == nullptr) 
         return;
     
     return;
@@ -5,26 +5,26 @@
 // Function to clear old genetic renderers
 void EngineSystemManager::ClearOldGeneticRenderers(unsigned int index) {
     
-    for (unsigned int a = 0; a < mStreamBuffer[index].actor->mGeneticRenderers.size(); a++) {
+    for (unsigned int a = 0; a < mActorStream[index].actor->mGeneticRenderers.size(); a++) {
         
-        MeshRenderer* geneRenderer = mStreamBuffer[index].actor->mGeneticRenderers[a];
+        MeshRenderer* geneRenderer = mActorStream[index].actor->mGeneticRenderers[a];
         
-        sceneMain->RemoveMeshRendererFromSceneRoot(geneRenderer, RENDER_QUEUE_GEOMETRY);
+        mActorBatch->RemoveMeshRenderer(geneRenderer);
         
         Renderer.DestroyMeshRenderer(geneRenderer);
     }
     
-    mStreamBuffer[index].actor->mGeneticRenderers.clear();
-    mStreamBuffer[index].actor->mAnimationStates.clear();
+    mActorStream[index].actor->mGeneticRenderers.clear();
+    mActorStream[index].actor->mAnimationStates.clear();
 }
 
 // Function to generate collider
 void EngineSystemManager::GenerateCollider(unsigned int index) {
     
-    if (mStreamBuffer[index].rigidBody == nullptr) 
+    if (mActorStream[index].rigidBody == nullptr) 
         return;
     
-    rp3d::RigidBody* rigidBody = mStreamBuffer[index].rigidBody;
+    rp3d::RigidBody* rigidBody = mActorStream[index].rigidBody;
     
     unsigned int numberOfColliders = rigidBody->getNbColliders();
     
@@ -38,8 +38,8 @@ void EngineSystemManager::GenerateCollider(unsigned int index) {
         collider->setCollisionCategoryBits(static_cast<unsigned short>(LayerMask::Actor));
         collider->setCollideWithMaskBits(static_cast<unsigned short>(CollisionMask::Entity));
         
-        collider->setUserData(static_cast<void*>(mStreamBuffer[index].gameObject));
-        rigidBody->setUserData(static_cast<void*>(mStreamBuffer[index].gameObject));
+        collider->setUserData(static_cast<void*>(mActorStream[index].gameObject));
+        rigidBody->setUserData(static_cast<void*>(mActorStream[index].gameObject));
     }
     
     return;
@@ -56,9 +56,9 @@ MeshRenderer* EngineSystemManager::CreateMeshRendererForGene(unsigned int index,
     newRenderer->material = Renderer.CreateMaterial();
     newRenderer->material->isShared = false;
     
-    newRenderer->material->diffuse.r = mStreamBuffer[index].actor->mGenes[geneIndex].color.x;
-    newRenderer->material->diffuse.g = mStreamBuffer[index].actor->mGenes[geneIndex].color.y;
-    newRenderer->material->diffuse.b = mStreamBuffer[index].actor->mGenes[geneIndex].color.z;
+    newRenderer->material->diffuse.r = mActorStream[index].actor->mGenes[geneIndex].color.x;
+    newRenderer->material->diffuse.g = mActorStream[index].actor->mGenes[geneIndex].color.y;
+    newRenderer->material->diffuse.b = mActorStream[index].actor->mGenes[geneIndex].color.z;
     
     newRenderer->material->ambient = Colors.white;
     newRenderer->material->shader = shaders.color;
@@ -68,14 +68,14 @@ MeshRenderer* EngineSystemManager::CreateMeshRendererForGene(unsigned int index,
     newRenderer->material->EnableDepthTest();
     newRenderer->material->DisableShadowVolumePass();
     
-    newRenderer->transform.position = mStreamBuffer[index].actor->mPosition;
-    newRenderer->transform.scale = glm::vec3(mStreamBuffer[index].actor->mGenes[geneIndex].scale.x,
-                                             mStreamBuffer[index].actor->mGenes[geneIndex].scale.y,
-                                             mStreamBuffer[index].actor->mGenes[geneIndex].scale.z);
+    newRenderer->transform.position = mActorStream[index].actor->mPosition;
+    newRenderer->transform.scale = glm::vec3(mActorStream[index].actor->mGenes[geneIndex].scale.x,
+                                             mActorStream[index].actor->mGenes[geneIndex].scale.y,
+                                             mActorStream[index].actor->mGenes[geneIndex].scale.z);
     
-    newRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[geneIndex].rotation.x, glm::vec3(1, 0, 0));
-    newRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[geneIndex].rotation.y, glm::vec3(0, 1, 0));
-    newRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[geneIndex].rotation.z, glm::vec3(0, 0, 1));
+    newRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[geneIndex].rotation.x, glm::vec3(1, 0, 0));
+    newRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[geneIndex].rotation.y, glm::vec3(0, 1, 0));
+    newRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[geneIndex].rotation.z, glm::vec3(0, 0, 1));
     
     return newRenderer;
 }
@@ -83,14 +83,14 @@ MeshRenderer* EngineSystemManager::CreateMeshRendererForGene(unsigned int index,
 // Function to update genetic attributes
 void EngineSystemManager::UpdateGeneticAttributes(unsigned int index, unsigned int geneIndex, unsigned int attachmentIndex) {
     
-    mStreamBuffer[index].actor->mGenes[geneIndex].offset = mStreamBuffer[index].actor->mGenes[attachmentIndex].offset;
-    mStreamBuffer[index].actor->mGenes[geneIndex].color = mStreamBuffer[index].actor->mGenes[attachmentIndex].color;
+    mActorStream[index].actor->mGenes[geneIndex].offset = mActorStream[index].actor->mGenes[attachmentIndex].offset;
+    mActorStream[index].actor->mGenes[geneIndex].color = mActorStream[index].actor->mGenes[attachmentIndex].color;
     
-    mStreamBuffer[index].actor->mGenes[geneIndex].animationAxis = mStreamBuffer[index].actor->mGenes[attachmentIndex].animationAxis;
-    mStreamBuffer[index].actor->mGenes[geneIndex].animationRange = mStreamBuffer[index].actor->mGenes[attachmentIndex].animationRange;
+    mActorStream[index].actor->mGenes[geneIndex].animationAxis = mActorStream[index].actor->mGenes[attachmentIndex].animationAxis;
+    mActorStream[index].actor->mGenes[geneIndex].animationRange = mActorStream[index].actor->mGenes[attachmentIndex].animationRange;
     
-    mStreamBuffer[index].actor->mGenes[geneIndex].doAnimationCycle = mStreamBuffer[index].actor->mGenes[attachmentIndex].doAnimationCycle;
-    mStreamBuffer[index].actor->mGenes[geneIndex].doInverseAnimation = mStreamBuffer[index].actor->mGenes[attachmentIndex].doInverseAnimation;
+    mActorStream[index].actor->mGenes[geneIndex].doAnimationCycle = mActorStream[index].actor->mGenes[attachmentIndex].doAnimationCycle;
+    mActorStream[index].actor->mGenes[geneIndex].doInverseAnimation = mActorStream[index].actor->mGenes[attachmentIndex].doInverseAnimation;
     
     return;
 }
@@ -98,36 +98,36 @@ void EngineSystemManager::UpdateGeneticAttributes(unsigned int index, unsigned i
 // Function to update actor genetics
 void EngineSystemManager::UpdateActorGenetics(unsigned int index) {
     
-    if (!mStreamBuffer[index].actor->mDoUpdateGenetics)
+    if (!mActorStream[index].actor->mDoUpdateGenetics)
         return;
     
     ClearOldGeneticRenderers(index);
     GenerateCollider(index);
     
-    unsigned int numberOfGenes = mStreamBuffer[index].actor->mGenes.size();
+    unsigned int numberOfGenes = mActorStream[index].actor->mGenes.size();
     
     for (unsigned int a = 0; a < numberOfGenes; a++) {
         
-        if (!mStreamBuffer[index].actor->mGenes[a].doExpress)
+        if (!mActorStream[index].actor->mGenes[a].doExpress)
             continue;
         
         MeshRenderer* newRenderer = CreateMeshRendererForGene(index, a, meshes.cube);
         
-        if (mStreamBuffer[index].actor->mGenes[a].attachmentIndex > 0) {
+        if (mActorStream[index].actor->mGenes[a].attachmentIndex > 0) {
             
-            unsigned int attachmentIndex = mStreamBuffer[index].actor->mGenes[a].attachmentIndex - 1;
+            unsigned int attachmentIndex = mActorStream[index].actor->mGenes[a].attachmentIndex - 1;
             
             UpdateGeneticAttributes(index, a, attachmentIndex);
         }
         
         glm::vec4 orientation = glm::vec4(Transform().rotation.w, Transform().rotation.x, Transform().rotation.y, Transform().rotation.z);
-        mStreamBuffer[index].actor->mGeneticRenderers.push_back(newRenderer);
-        mStreamBuffer[index].actor->mAnimationStates.push_back(orientation);
+        mActorStream[index].actor->mGeneticRenderers.push_back(newRenderer);
+        mActorStream[index].actor->mAnimationStates.push_back(orientation);
         
-        sceneMain->AddMeshRendererToSceneRoot(newRenderer, RENDER_QUEUE_GEOMETRY);
+        mActorBatch->AddMeshRenderer(newRenderer);
     }
     
-    mStreamBuffer[index].actor->mDoUpdateGenetics = false;
+    mActorStream[index].actor->mDoUpdateGenetics = false;
     
     return;
 }
@@ -135,47 +135,47 @@ void EngineSystemManager::UpdateActorGenetics(unsigned int index) {
 // Function to express actor genetics
 void EngineSystemManager::ExpressActorGenetics(unsigned int index) {
     
-    if (!mStreamBuffer[index].actor->mDoReexpressGenetics)
+    if (!mActorStream[index].actor->mDoReexpressGenetics)
         return;
     
-    unsigned int numberOfGenes = mStreamBuffer[index].actor->mGenes.size();
-    unsigned int numberOfRenderers = mStreamBuffer[index].actor->mGeneticRenderers.size();
+    unsigned int numberOfGenes = mActorStream[index].actor->mGenes.size();
+    unsigned int numberOfRenderers = mActorStream[index].actor->mGeneticRenderers.size();
     
     if (numberOfRenderers != numberOfGenes) {
-        mStreamBuffer[index].actor->mDoUpdateGenetics = true;
+        mActorStream[index].actor->mDoUpdateGenetics = true;
         UpdateActorGenetics(index);
         return;
     }
     
     for (unsigned int a = 0; a < numberOfRenderers; a++) {
-        if (!mStreamBuffer[index].actor->mGenes[a].doExpress)
+        if (!mActorStream[index].actor->mGenes[a].doExpress)
             continue;
         
-        MeshRenderer* meshRenderer = mStreamBuffer[index].actor->mGeneticRenderers[a];
+        MeshRenderer* meshRenderer = mActorStream[index].actor->mGeneticRenderers[a];
         meshRenderer->material->ambient = Colors.white;
-        meshRenderer->material->diffuse = Color(mStreamBuffer[index].actor->mGenes[a].color.x,
-                                                mStreamBuffer[index].actor->mGenes[a].color.y,
-                                                mStreamBuffer[index].actor->mGenes[a].color.z);
+        meshRenderer->material->diffuse = Color(mActorStream[index].actor->mGenes[a].color.x,
+                                                mActorStream[index].actor->mGenes[a].color.y,
+                                                mActorStream[index].actor->mGenes[a].color.z);
         
-        meshRenderer->transform.position = glm::vec3(mStreamBuffer[index].actor->mPosition.x,
-                                                     mStreamBuffer[index].actor->mPosition.y,
-                                                     mStreamBuffer[index].actor->mPosition.z);
+        meshRenderer->transform.position = glm::vec3(mActorStream[index].actor->mPosition.x,
+                                                     mActorStream[index].actor->mPosition.y,
+                                                     mActorStream[index].actor->mPosition.z);
         
-        meshRenderer->transform.scale = glm::clamp(glm::vec3(mStreamBuffer[index].actor->mGenes[a].scale.x,
-                                                             mStreamBuffer[index].actor->mGenes[a].scale.y,
-                                                             mStreamBuffer[index].actor->mGenes[a].scale.z), 0.0f, 2.0f);
+        meshRenderer->transform.scale = glm::clamp(glm::vec3(mActorStream[index].actor->mGenes[a].scale.x,
+                                                             mActorStream[index].actor->mGenes[a].scale.y,
+                                                             mActorStream[index].actor->mGenes[a].scale.z), 0.0f, 2.0f);
         
-        if (mStreamBuffer[index].actor->mGenes[a].attachmentIndex > 0) {
-            unsigned int attachmentIndex = mStreamBuffer[index].actor->mGenes[a].attachmentIndex - 1;
+        if (mActorStream[index].actor->mGenes[a].attachmentIndex > 0) {
+            unsigned int attachmentIndex = mActorStream[index].actor->mGenes[a].attachmentIndex - 1;
             UpdateGeneticAttributes(index, a, attachmentIndex);
         }
         
-        meshRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[a].rotation.x, glm::vec3(1, 0, 0));
-        meshRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[a].rotation.y, glm::vec3(0, 1, 0));
-        meshRenderer->transform.RotateAxis(mStreamBuffer[index].actor->mGenes[a].rotation.z, glm::vec3(0, 0, 1));
+        meshRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[a].rotation.x, glm::vec3(1, 0, 0));
+        meshRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[a].rotation.y, glm::vec3(0, 1, 0));
+        meshRenderer->transform.RotateAxis(mActorStream[index].actor->mGenes[a].rotation.z, glm::vec3(0, 0, 1));
     }
     
-    mStreamBuffer[index].actor->mDoReexpressGenetics = false;
+    mActorStream[index].actor->mDoReexpressGenetics = false;
     
     return;
 }
@@ -1,23 +1,51 @@
 #include <GameEngineFramework/Engine/EngineSystems.h>
 
+void EngineSystemManager::QueryActorGround(void) {
+    
+    unsigned int numberOfActors = mActorStream.size;
+    
+    if (numberOfActors == 0) 
+        return;
+    
+    mActorGroundQueries.resize(numberOfActors * 2);
+    mActorGroundHits.resize(numberOfActors * 2);
+    mActorGroundIsHit.resize(numberOfActors * 2);
+    
+    // Actor positions first, then the target points searched from above the world
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        
+        glm::vec3 actorTarget = mActorStream[i].actor->mTargetPoint;
+        
+        mActorGroundQueries[i] = mActorStream[i].transform->position;
+        mActorGroundQueries[numberOfActors + i] = glm::vec3(actorTarget.x, 1000, actorTarget.z);
+    }
+    
+    Physics.QueryGroundBatch(&mActorGroundQueries[0], numberOfActors, 1000, &mActorGroundHits[0], &mActorGroundIsHit[0], LayerMask::Ground);
+    
+    Physics.QueryGroundBatch(&mActorGroundQueries[numberOfActors], numberOfActors, 2000, 
+                             &mActorGroundHits[numberOfActors], &mActorGroundIsHit[numberOfActors], LayerMask::Ground);
+    
+    return;
+}
+
 void EngineSystemManager::UpdateActorPhysics(unsigned int index) {
     
-    if (mStreamBuffer[index].rigidBody == nullptr) 
+    if (mActorStream[index].rigidBody == nullptr) 
         return;
     
-    glm::vec3 actorPosition = mStreamBuffer[index].transform->position;
-    glm::vec3 actorRotation = mStreamBuffer[index].actor->mRotation;
-    glm::vec3 actorVelocity = mStreamBuffer[index].actor->mVelocity;
-    glm::vec3 actorTarget = mStreamBuffer[index].actor->mTargetPoint;
+    glm::vec3 actorPosition = mActorStream[index].transform->position;
+    glm::vec3 actorRotation = mActorStream[index].actor->mRotation;
+    glm::vec3 actorVelocity = mActorStream[index].actor->mVelocity;
+    glm::vec3 actorTarget = mActorStream[index].actor->mTargetPoint;
     
-    rp3d::Transform transform = mStreamBuffer[index].rigidBody->getTransform();
+    rp3d::Transform transform = mActorStream[index].rigidBody->getTransform();
     rp3d::Vector3 currentPosition = transform.getPosition();
-    mStreamBuffer[index].rigidBody->setTransform(transform);
+    mActorStream[index].rigidBody->setTransform(transform);
     
     // Check not on ground
-    Hit hit;
+    Hit& hit = mActorGroundHits[index];
     
-    if (Physics.Raycast(actorPosition, glm::vec3(0, -1, 0), 1000, hit, LayerMask::Ground)) {
+    if (mActorGroundIsHit[index]) {
         
         // Standing on ground
         if (actorPosition.y > hit.point.y) {
@@ -39,10 +67,10 @@ void EngineSystemManager::UpdateActorPhysics(unsigned int index) {
         }
         
         
-        unsigned int numberOfRenderers = mStreamBuffer[index].actor->GetNumberOfMeshRenderers();
+        unsigned int numberOfRenderers = mActorStream[index].actor->GetNumberOfMeshRenderers();
         for (unsigned int i=0; i < numberOfRenderers; i++) {
             
-            Material* actorMaterial = mStreamBuffer[index].actor->GetMeshRendererAtIndex(i)->material;
+            Material* actorMaterial = mActorStream[index].actor->GetMeshRendererAtIndex(i)->material;
             
             actorMaterial->ambient = Colors.white;
         }
@@ -51,16 +79,16 @@ void EngineSystemManager::UpdateActorPhysics(unsigned int index) {
         // Set current chunk
         GameObject* gameObject = (GameObject*)hit.gameObject;
         
-        mStreamBuffer[index].actor->mUserDataA = gameObject->GetUserData();
+        mActorStream[index].actor->mUserDataA = gameObject->GetUserData();
         
     } else {
         
         actorVelocity = glm::vec3(0, 0, 0);
         
-        unsigned int numberOfRenderers = mStreamBuffer[index].actor->GetNumberOfMeshRenderers();
+        unsigned int numberOfRenderers = mActorStream[index].actor->GetNumberOfMeshRenderers();
         for (unsigned int i=0; i < numberOfRenderers; i++) {
             
-            Material* actorMaterial = mStreamBuffer[index].actor->GetMeshRendererAtIndex(i)->material;
+            Material* actorMaterial = mActorStream[index].actor->GetMeshRendererAtIndex(i)->material;
             
             actorMaterial->ambient = Colors.black;
             
@@ -70,11 +98,11 @@ void EngineSystemManager::UpdateActorPhysics(unsigned int index) {
     }
     
     // Get actor target height
-    actorTarget.y = 1000;
+    unsigned int targetIndex = mActorStream.size + index;
     
-    if (Physics.Raycast(actorTarget, glm::vec3(0, -1, 0), 2000, hit, LayerMask::Ground)) {
+    if (mActorGroundIsHit[targetIndex]) {
         
-        actorTarget.y = hit.point.y;
+        actorTarget.y = mActorGroundHits[targetIndex].point.y;
         
     } else {
         
@@ -83,22 +111,22 @@ void EngineSystemManager::UpdateActorPhysics(unsigned int index) {
     
     // Move the actor into position
     transform.setPosition(currentPosition);
-    mStreamBuffer[index].rigidBody->setTransform(transform);
+    mActorStream[index].rigidBody->setTransform(transform);
     
     // Factor in youth speed multiplier
-    if (mStreamBuffer[index].actor->mAge < 1000) 
-        actorVelocity *= mStreamBuffer[index].actor->mSpeedYouth;
+    if (mActorStream[index].actor->mAge < 1000) 
+        actorVelocity *= mActorStream[index].actor->mSpeedYouth;
     
     // Apply force velocity
-    mStreamBuffer[index].rigidBody->applyLocalForceAtCenterOfMass( rp3d::Vector3(actorVelocity.x, 
-                                                                                 actorVelocity.y, 
-                                                                                 actorVelocity.z) );
+    mActorStream[index].rigidBody->applyLocalForceAtCenterOfMass( rp3d::Vector3(actorVelocity.x, 
+                                                                                actorVelocity.y, 
+                                                                                actorVelocity.z) );
     
     // Sync actor position
-    mStreamBuffer[index].actor->mPosition = actorPosition;
-    mStreamBuffer[index].actor->mRotation = actorRotation;
-    mStreamBuffer[index].actor->mVelocity = actorVelocity;
-    mStreamBuffer[index].actor->mTargetPoint = actorTarget;
+    mActorStream[index].actor->mPosition = actorPosition;
+    mActorStream[index].actor->mRotation = actorRotation;
+    mActorStream[index].actor->mVelocity = actorVelocity;
+    mActorStream[index].actor->mTargetPoint = actorTarget;
     
     return;
 }
@@ -3,43 +3,43 @@
 void EngineSystemManager::UpdateCamera(unsigned int index) {
     
     // Update mouse looking
-    if (mStreamBuffer[index].camera->useMouseLook) {
+    if (mCameraStream[index].camera->useMouseLook) {
         
         double mouseDiffX = Input.mouseX - Renderer.displayCenter.x;
         double mouseDiffY = Input.mouseY - Renderer.displayCenter.y;
         
         Input.SetMousePosition(Renderer.displayCenter.x, Renderer.displayCenter.y);
         
-        double lookAngleX = mouseDiffX * mStreamBuffer[index].camera->mouseSensitivityYaw * 0.002f;
-        double lookAngleY = mouseDiffY * mStreamBuffer[index].camera->mouseSensitivityPitch * 0.002f;
+        double lookAngleX = mouseDiffX * mCameraStream[index].camera->mouseSensitivityYaw * 0.002f;
+        double lookAngleY = mouseDiffY * mCameraStream[index].camera->mouseSensitivityPitch * 0.002f;
         
-        mStreamBuffer[index].camera->transform.RotateEuler(lookAngleX, -lookAngleY, 0);
+        mCameraStream[index].camera->transform.RotateEuler(lookAngleX, -lookAngleY, 0);
         
-        mStreamBuffer[index].camera->mouseLookAngle.x += lookAngleX / 128.0f;
-        mStreamBuffer[index].camera->mouseLookAngle.y -= lookAngleY / 128.0f;
+        mCameraStream[index].camera->mouseLookAngle.x += lookAngleX / 128.0f;
+        mCameraStream[index].camera->mouseLookAngle.y -= lookAngleY / 128.0f;
         
         // Yaw limit
-        if (mStreamBuffer[index].camera->mouseLookAngle.x >= 0.109655) {mStreamBuffer[index].camera->mouseLookAngle.x -= 0.109655;}
-        if (mStreamBuffer[index].camera->mouseLookAngle.x <= 0.109655) {mStreamBuffer[index].camera->mouseLookAngle.x += 0.109655;}
+        if (mCameraStream[index].camera->mouseLookAngle.x >= 0.109655) {mCameraStream[index].camera->mouseLookAngle.x -= 0.109655;}
+        if (mCameraStream[index].camera->mouseLookAngle.x <= 0.109655) {mCameraStream[index].camera->mouseLookAngle.x += 0.109655;}
         
         // Pitch limit
-        if (mStreamBuffer[index].camera->mouseLookAngle.y >  0.0274f) mStreamBuffer[index].camera->mouseLookAngle.y =  0.0274f;
-        if (mStreamBuffer[index].camera->mouseLookAngle.y < -0.0274f) mStreamBuffer[index].camera->mouseLookAngle.y = -0.0274f;
+        if (mCameraStream[index].camera->mouseLookAngle.y >  0.0274f) mCameraStream[index].camera->mouseLookAngle.y =  0.0274f;
+        if (mCameraStream[index].camera->mouseLookAngle.y < -0.0274f) mCameraStream[index].camera->mouseLookAngle.y = -0.0274f;
         
     }
     
     // Calculate degree angle from camera looking angle
     // Yaw
-    mStreamBuffer[index].camera->lookAngle.x = (glm::degrees( mStreamBuffer[index].camera->transform.rotation.x ) - 6.28277f) * 1.907f * 30.0f;
-    mStreamBuffer[index].camera->lookAngle.x = Math.Round( +mStreamBuffer[index].camera->lookAngle.x );
-    mStreamBuffer[index].camera->transform.rotation.x = mStreamBuffer[index].camera->mouseLookAngle.x;
+    mCameraStream[index].camera->lookAngle.x = (glm::degrees( mCameraStream[index].camera->transform.rotation.x ) - 6.28277f) * 1.907f * 30.0f;
+    mCameraStream[index].camera->lookAngle.x = Math.Round( +mCameraStream[index].camera->lookAngle.x );
+    mCameraStream[index].camera->transform.rotation.x = mCameraStream[index].camera->mouseLookAngle.x;
     // Pitch
-    mStreamBuffer[index].camera->transform.rotation.y = mStreamBuffer[index].camera->mouseLookAngle.y;
-    mStreamBuffer[index].camera->lookAngle.y = (((glm::degrees( mStreamBuffer[index].camera->transform.rotation.y ) - 6.28277f) * 1.91f * 30.0f) + 360.0f);
-    mStreamBuffer[index].camera->lookAngle.y = Math.Round( +mStreamBuffer[index].camera->lookAngle.y );
+    mCameraStream[index].camera->transform.rotation.y = mCameraStream[index].camera->mouseLookAngle.y;
+    mCameraStream[index].camera->lookAngle.y = (((glm::degrees( mCameraStream[index].camera->transform.rotation.y ) - 6.28277f) * 1.91f * 30.0f) + 360.0f);
+    mCameraStream[index].camera->lookAngle.y = Math.Round( +mCameraStream[index].camera->lookAngle.y );
     
     // Check camera panel
-    if (mStreamBuffer[index].panel != nullptr) {
+    if (mCameraStream[index].panel != nullptr) {
         
         //
         // TODO: Add ability to align the camera view port with a panel canvas here
@@ -47,7 +47,7 @@ void EngineSystemManager::UpdateCamera(unsigned int index) {
         
     } else {
         
-        mStreamBuffer[index].camera->transform.position = mStreamBuffer[index].transform->position;
+        mCameraStream[index].camera->transform.position = mCameraStream[index].transform->position;
         
     }
     
@@ -2,8 +2,8 @@
 
 void EngineSystemManager::UpdateLight(unsigned int index) {
     
-    mStreamBuffer[index].light->position  = mStreamBuffer[index].transform->position;
-    mStreamBuffer[index].light->direction = mStreamBuffer[index].transform->EulerAngles();
+    mLightStream[index].light->position  = mLightStream[index].transform->position;
+    mLightStream[index].light->direction = mLightStream[index].transform->EulerAngles();
     
     return;
 }
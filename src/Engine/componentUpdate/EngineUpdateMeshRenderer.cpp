@@ -2,11 +2,11 @@
 
 void EngineSystemManager::UpdateMeshRenderer(unsigned int index) {
     
-    mStreamBuffer[index].meshRenderer->transform.position  = mStreamBuffer[index].transform->position;
-    mStreamBuffer[index].meshRenderer->transform.rotation  = mStreamBuffer[index].transform->rotation;
-    mStreamBuffer[index].meshRenderer->transform.scale     = mStreamBuffer[index].transform->scale;
+    mMeshRendererStream[index].meshRenderer->transform.position  = mMeshRendererStream[index].transform->position;
+    mMeshRendererStream[index].meshRenderer->transform.rotation  = mMeshRendererStream[index].transform->rotation;
+    mMeshRendererStream[index].meshRenderer->transform.scale     = mMeshRendererStream[index].transform->scale;
     
-    mStreamBuffer[index].meshRenderer->transform.matrix = mStreamBuffer[index].transform->matrix;
+    mMeshRendererStream[index].meshRenderer->transform.matrix = mMeshRendererStream[index].transform->matrix;
     
     return;
 }
@@ -3,18 +3,18 @@
 void EngineSystemManager::UpdateRigidBody(unsigned int index) {
     
     // Get the rigid body transform
-    rp3d::Transform bodyTransform = mStreamBuffer[index].rigidBody->getTransform();
+    rp3d::Transform bodyTransform = mRigidBodyStream[index].rigidBody->getTransform();
     rp3d::Vector3 bodyPosition = bodyTransform.getPosition();
     rp3d::Quaternion quaterion = bodyTransform.getOrientation();
     
-    mStreamBuffer[index].transform->position = glm::vec3(bodyPosition.x, 
-                                                         bodyPosition.y, 
-                                                         bodyPosition.z);
+    mRigidBodyStream[index].transform->position = glm::vec3(bodyPosition.x, 
+                                                            bodyPosition.y, 
+                                                            bodyPosition.z);
     
-    mStreamBuffer[index].transform->rotation = glm::quat(quaterion.w, 
-                                                         quaterion.x, 
-                                                         quaterion.y, 
-                                                         quaterion.z);
+    mRigidBodyStream[index].transform->rotation = glm::quat(quaterion.w, 
+                                                            quaterion.x, 
+                                                            quaterion.y, 
+                                                            quaterion.z);
     
     return;
 }
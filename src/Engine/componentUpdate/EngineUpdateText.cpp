@@ -2,16 +2,16 @@
 
 void EngineSystemManager::UpdateTextUI(unsigned int index) {
     
-    if (mStreamBuffer[index].meshRenderer == nullptr) 
+    if (mTextStream[index].meshRenderer == nullptr) 
         return;
     
-    if (mStreamBuffer[index].gameObject->isActive) {
+    if (mTextStream[index].gameObject->isActive) {
         
-        mStreamBuffer[index].meshRenderer->isActive = true;
+        mTextStream[index].meshRenderer->isActive = true;
         
     } else {
         
-        mStreamBuffer[index].meshRenderer->isActive = false;
+        mTextStream[index].meshRenderer->isActive = false;
         
     }
     
@@ -19,68 +19,68 @@ void EngineSystemManager::UpdateTextUI(unsigned int index) {
     //
     // Anchor RIGHT
     
-    if (mStreamBuffer[index].text->canvas.anchorRight) {
-        mStreamBuffer[index].transform->position.z = Renderer.viewport.w + 
-                                                     mStreamBuffer[index].text->size * 
-                                                     mStreamBuffer[index].text->canvas.x;
+    if (mTextStream[index].text->canvas.anchorRight) {
+        mTextStream[index].transform->position.z = Renderer.viewport.w + 
+                                                   mTextStream[index].text->size * 
+                                                   mTextStream[index].text->canvas.x;
         
         // Keep text on screen when anchored right
-        mStreamBuffer[index].transform->position.z -= mStreamBuffer[index].text->text.size() * // length of string
-                                                                   mStreamBuffer[index].text->size;         // Size of font text
+        mTextStream[index].transform->position.z -= mTextStream[index].text->text.size() * // length of string
+                                                                 mTextStream[index].text->size;         // Size of font text
         
     } else {
         
         // Anchor LEFT by default
-        mStreamBuffer[index].transform->position.z  = (mStreamBuffer[index].text->canvas.x * mStreamBuffer[index].text->size);
-        mStreamBuffer[index].transform->position.z += mStreamBuffer[index].text->size;
+        mTextStream[index].transform->position.z  = (mTextStream[index].text->canvas.x * mTextStream[index].text->size);
+        mTextStream[index].transform->position.z += mTextStream[index].text->size;
         
         // Anchor CENTER horizontally
-        if (mStreamBuffer[index].text->canvas.anchorCenterHorz) 
-            mStreamBuffer[index].transform->position.z = (Renderer.viewport.w / 2) + (mStreamBuffer[index].text->canvas.x * mStreamBuffer[index].text->size);
+        if (mTextStream[index].text->canvas.anchorCenterHorz) 
+            mTextStream[index].transform->position.z = (Renderer.viewport.w / 2) + (mTextStream[index].text->canvas.x * mTextStream[index].text->size);
         
     }
     
     //
     // Anchor TOP
     
-    if (mStreamBuffer[index].text->canvas.anchorTop) {
+    if (mTextStream[index].text->canvas.anchorTop) {
         int topAnchorTotal = Renderer.displaySize.y - Renderer.viewport.h;
         
-        topAnchorTotal += (mStreamBuffer[index].text->size * mStreamBuffer[index].text->size) / 2;
-        topAnchorTotal += mStreamBuffer[index].text->size * mStreamBuffer[index].text->canvas.y;
+        topAnchorTotal += (mTextStream[index].text->size * mTextStream[index].text->size) / 2;
+        topAnchorTotal += mTextStream[index].text->size * mTextStream[index].text->canvas.y;
         
-        mStreamBuffer[index].transform->position.y = topAnchorTotal;
+        mTextStream[index].transform->position.y = topAnchorTotal;
     } else {
         
         // Anchor BOTTOM by default
-        mStreamBuffer[index].transform->position.y  = Renderer.displaySize.y - mStreamBuffer[index].text->size;
-        mStreamBuffer[index].transform->position.y -= mStreamBuffer[index].text->size * -(mStreamBuffer[index].text->canvas.y);
+        mTextStream[index].transform->position.y  = Renderer.displaySize.y - mTextStream[index].text->size;
+        mTextStream[index].transform->position.y -= mTextStream[index].text->size * -(mTextStream[index].text->canvas.y);
         
         // Anchor CENTER vertically
-        if (mStreamBuffer[index].text->canvas.anchorCenterVert) {
+        if (mTextStream[index].text->canvas.anchorCenterVert) {
             int topAnchorTotal = Renderer.displaySize.y - Renderer.viewport.h / 2;
             
-            topAnchorTotal += (mStreamBuffer[index].text->size * mStreamBuffer[index].text->size) / 2;
-            topAnchorTotal += (mStreamBuffer[index].text->size * mStreamBuffer[index].text->canvas.y) - (mStreamBuffer[index].text->size * 2);
+            topAnchorTotal += (mTextStream[index].text->size * mTextStream[index].text->size) / 2;
+            topAnchorTotal += (mTextStream[index].text->size * mTextStream[index].text->canvas.y) - (mTextStream[index].text->size * 2);
             
-            mStreamBuffer[index].transform->position.y = topAnchorTotal;
+            mTextStream[index].transform->position.y = topAnchorTotal;
         }
         
     }
     
     // Flip height and width
-    float textGlyphWidth  = mStreamBuffer[index].text->glyphHeight;
-    float textGlyphHeight = mStreamBuffer[index].text->glyphWidth;
+    float textGlyphWidth  = mTextStream[index].text->glyphHeight;
+    float textGlyphHeight = mTextStream[index].text->glyphWidth;
     
     // Check to refresh the vertex buffer
-    if (mStreamBuffer[index].text->mCurrentText != mStreamBuffer[index].text->text) {
-        mStreamBuffer[index].text->mCurrentText = mStreamBuffer[index].text->text;
+    if (mTextStream[index].text->mCurrentText != mTextStream[index].text->text) {
+        mTextStream[index].text->mCurrentText = mTextStream[index].text->text;
         
         // Clear the text mesh
-        mStreamBuffer[index].meshRenderer->mesh->ClearSubMeshes();
+        mTextStream[index].meshRenderer->mesh->ClearSubMeshes();
         
         // Update the text string characters 
-        AddMeshText(mStreamBuffer[index].gameObject, 0, 0, textGlyphWidth, textGlyphHeight, mStreamBuffer[index].text->text, mStreamBuffer[index].text->color);
+        AddMeshText(mTextStream[index].gameObject, 0, 0, textGlyphWidth, textGlyphHeight, mTextStream[index].text->text, mTextStream[index].text->color);
         
     }
     
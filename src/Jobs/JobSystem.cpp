@@ -0,0 +1,304 @@
+#include <GameEngineFramework/Jobs/JobSystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+#include <GameEngineFramework/Types/Types.h>
+
+extern Logger  Log;
+extern IntType Int;
+
+// Queue owned by the current thread and the job system it belongs to.
+// Threads outside a pool share queue zero of that pool.
+static thread_local JobSystem*   currentJobSystem  = nullptr;
+static thread_local unsigned int currentQueueIndex = 0;
+
+
+JobCounter::JobCounter() :
+    mCount(0)
+{
+}
+
+bool JobCounter::IsComplete(void) {
+    return mCount.load() == 0;
+}
+
+unsigned int JobCounter::GetCount(void) {
+    return mCount.load();
+}
+
+
+JobSystem::JobSystem() :
+    mNumberOfQueuedJobs(0),
+    mIsActive(false)
+{
+    mQueues.push_back( new JobQueue() );
+}
+
+void JobSystem::Initiate(unsigned int numberOfWorkers) {
+    
+    if (mIsActive.load())
+        return;
+    
+    if (numberOfWorkers == 0) {
+        
+        unsigned int numberOfThreads = std::thread::hardware_concurrency();
+        
+        numberOfWorkers = (numberOfThreads > 1) ? numberOfThreads - 1 : 1;
+    }
+    
+    for (unsigned int i=0; i < numberOfWorkers; i++)
+        mQueues.push_back( new JobQueue() );
+    
+    mIsActive.store(true);
+    
+    for (unsigned int i=0; i < numberOfWorkers; i++)
+        mWorkers.push_back( new std::thread(&JobSystem::WorkerMain, this, i + 1) );
+    
+    Log.Write( " >> Starting job workers " + Int.ToString(numberOfWorkers) );
+    
+    return;
+}
+
+void JobSystem::Shutdown(void) {
+    
+    if (!mIsActive.load())
+        return;
+    
+    // Drain the remaining jobs before the workers exit
+    JobEntry entry;
+    while (PopJob(entry))
+        RunJob(entry);
+    
+    {
+        std::lock_guard<std::mutex> lock(mWakeMux);
+        mIsActive.store(false);
+    }
+    mWakeCondition.notify_all();
+    
+    for (unsigned int i=0; i < mWorkers.size(); i++) {
+        mWorkers[i]->join();
+        delete mWorkers[i];
+    }
+    mWorkers.clear();
+    
+    for (unsigned int i=1; i < mQueues.size(); i++)
+        delete mQueues[i];
+    mQueues.resize(1);
+    
+    return;
+}
+
+void JobSystem::Submit(std::function<void()> job, JobCounter* counter) {
+    Submit(job, counter, nullptr);
+    return;
+}
+
+void JobSystem::Submit(std::function<void()> job, JobCounter* counter, JobCounter* dependency) {
+    
+    JobEntry entry;
+    entry.function   = job;
+    entry.counter    = counter;
+    entry.dependency = dependency;
+    
+    if (counter != nullptr)
+        counter->mCount.fetch_add(1);
+    
+    // Hold jobs back until their dependency is released
+    if (dependency != nullptr) {
+        
+        std::lock_guard<std::mutex> lock(mDeferredMux);
+        
+        if (!dependency->IsComplete()) {
+            mDeferredJobs.push_back(entry);
+            return;
+        }
+    }
+    
+    PushJob(entry);
+    
+    return;
+}
+
+void JobSystem::Wait(JobCounter* counter) {
+    
+    JobEntry entry;
+    
+    while (!counter->IsComplete()) {
+        
+        if (PopJob(entry)) {
+            RunJob(entry);
+            continue;
+        }
+        
+        std::this_thread::yield();
+    }
+    
+    return;
+}
+
+void JobSystem::ParallelFor(unsigned int count, unsigned int batchSize, std::function<void(unsigned int begin, unsigned int end)> function) {
+    
+    if (count == 0)
+        return;
+    
+    if (batchSize == 0)
+        batchSize = 1;
+    
+    // Run small ranges in place
+    if ((count <= batchSize) | mWorkers.empty()) {
+        function(0, count);
+        return;
+    }
+    
+    JobCounter counter;
+    
+    for (unsigned int begin=0; begin < count; begin += batchSize) {
+        
+        unsigned int end = begin + batchSize;
+        if (end > count)
+            end = count;
+        
+        Submit([&function, begin, end]() {function(begin, end);}, &counter);
+    }
+    
+    Wait(&counter);
+    
+    return;
+}
+
+unsigned int JobSystem::GetNumberOfWorkers(void) {
+    return mWorkers.size();
+}
+
+
+
+//
+// Worker pool
+//
+
+void JobSystem::WorkerMain(unsigned int queueIndex) {
+    
+    currentJobSystem  = this;
+    currentQueueIndex = queueIndex;
+    
+    JobEntry entry;
+    
+    while (true) {
+        
+        if (PopJob(entry)) {
+            RunJob(entry);
+            continue;
+        }
+        
+        // Sleep until work is queued or the pool shuts down
+        std::unique_lock<std::mutex> lock(mWakeMux);
+        
+        mWakeCondition.wait(lock, [this]() {return (mNumberOfQueuedJobs.load() > 0) | !mIsActive.load();});
+        
+        if (!mIsActive.load())
+            break;
+        
+        continue;
+    }
+    
+    return;
+}
+
+void JobSystem::PushJob(JobEntry& entry) {
+    
+    JobQueue* queue = mQueues[GetQueueIndex()];
+    
+    queue->mux.lock();
+    queue->jobs.push_back(entry);
+    mNumberOfQueuedJobs.fetch_add(1);
+    queue->mux.unlock();
+    
+    // Lock to avoid waking between a worker checking the count and sleeping
+    mWakeMux.lock();
+    mWakeMux.unlock();
+    mWakeCondition.notify_one();
+    
+    return;
+}
+
+bool JobSystem::PopJob(JobEntry& entry) {
+    
+    if (mNumberOfQueuedJobs.load() == 0)
+        return false;
+    
+    unsigned int numberOfQueues = mQueues.size();
+    unsigned int queueIndex = GetQueueIndex();
+    
+    // Newest job from our own queue first
+    JobQueue* queue = mQueues[queueIndex];
+    
+    queue->mux.lock();
+    if (!queue->jobs.empty()) {
+        entry = queue->jobs.back();
+        queue->jobs.pop_back();
+        mNumberOfQueuedJobs.fetch_sub(1);
+        queue->mux.unlock();
+        return true;
+    }
+    queue->mux.unlock();
+    
+    // Steal the oldest job from another queue
+    for (unsigned int i=1; i < numberOfQueues; i++) {
+        
+        JobQueue* victim = mQueues[ (queueIndex + i) % numberOfQueues ];
+        
+        victim->mux.lock();
+        if (!victim->jobs.empty()) {
+            entry = victim->jobs.front();
+            victim->jobs.pop_front();
+            mNumberOfQueuedJobs.fetch_sub(1);
+            victim->mux.unlock();
+            return true;
+        }
+        victim->mux.unlock();
+    }
+    
+    return false;
+}
+
+void JobSystem::RunJob(JobEntry& entry) {
+    
+    entry.function();
+    
+    // The last job on a counter releases any jobs waiting on it
+    if (entry.counter != nullptr) 
+        if (entry.counter->mCount.fetch_sub(1) == 1) 
+            ReleaseDeferred();
+    
+    return;
+}
+
+void JobSystem::ReleaseDeferred(void) {
+    
+    std::vector<JobEntry> released;
+    
+    mDeferredMux.lock();
+    for (unsigned int i=0; i < mDeferredJobs.size(); i++) {
+        
+        if (!mDeferredJobs[i].dependency->IsComplete()) 
+            continue;
+        
+        released.push_back( mDeferredJobs[i] );
+        
+        mDeferredJobs[i] = mDeferredJobs.back();
+        mDeferredJobs.pop_back();
+        i--;
+    }
+    mDeferredMux.unlock();
+    
+    for (unsigned int i=0; i < released.size(); i++) 
+        PushJob(released[i]);
+    
+    return;
+}
+
+unsigned int JobSystem::GetQueueIndex(void) {
+    
+    if (currentJobSystem != this) 
+        return 0;
+    
+    return currentQueueIndex;
+}
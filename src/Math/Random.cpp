@@ -3,19 +3,124 @@
 #define STB_PERLIN_IMPLEMENTATION
 #include "../../vendor/stb/stb_perlin.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define RANDOM_PERLIN_SSE2
+ #include <emmintrin.h>
+#endif
+
+
+static inline uint32_t RotateLeft(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+
+RandomStream::RandomStream() {
+    
+    SetSeed(100);
+    
+    return;
+}
+
+RandomStream::RandomStream(int seed) {
+    
+    SetSeed(seed);
+    
+    return;
+}
+
+void RandomStream::SetSeed(int seed) {
+    
+    mSeed = seed;
+    
+    // Expand the seed into the stream state with splitmix64
+    uint64_t value = (uint64_t)(uint32_t)seed;
+    
+    for (unsigned int i=0; i < 4; i++) {
+        
+        value += 0x9e3779b97f4a7c15ull;
+        
+        uint64_t mix = value;
+        mix = (mix ^ (mix >> 30)) * 0xbf58476d1ce4e5b9ull;
+        mix = (mix ^ (mix >> 27)) * 0x94d049bb133111ebull;
+        mix =  mix ^ (mix >> 31);
+        
+        mState[i] = (uint32_t)(mix >> 32);
+    }
+    
+    return;
+}
+
+int RandomStream::GetSeed(void) {
+    
+    return mSeed;
+}
+
+uint32_t RandomStream::Next(void) {
+    
+    // xoshiro128**
+    uint32_t result = RotateLeft(mState[1] * 5, 7) * 9;
+    uint32_t shift  = mState[1] << 9;
+    
+    mState[2] ^= mState[0];
+    mState[3] ^= mState[1];
+    mState[1] ^= mState[2];
+    mState[0] ^= mState[3];
+    
+    mState[2] ^= shift;
+    mState[3] = RotateLeft(mState[3], 11);
+    
+    return result;
+}
+
+// Ranges keep the same mapping as the engine number generator
+
+int RandomStream::Range(int min, int max) {
+    return ((int)(Next() >> 1) % max) + min;
+}
+
+float RandomStream::Range(float min, float max) {
+    return ((float)((int)(Next() >> 1) % (int)(max * 100.0f)) * 0.01f) + min;
+}
+
+double RandomStream::Range(double min, double max) {
+    return ((double)((int)(Next() >> 1) % (int)(max * (double)100.0)) * (double)0.01) + min;
+}
+
+float RandomStream::Perlin(float xcoord, float ycoord, float zcoord) {
+    return stb_perlin_noise3_seed(xcoord, ycoord, zcoord, 0, 0, 0, mSeed);
+}
+
+void RandomStream::Fill(uint32_t* buffer, unsigned int count) {
+    
+    for (unsigned int i=0; i < count; i++) 
+        buffer[i] = Next();
+    
+    return;
+}
+
+void RandomStream::Fill(float* buffer, unsigned int count, float min, float max) {
+    
+    float scale = (max - min) * (1.0f / 16777216.0f);
+    
+    for (unsigned int i=0; i < count; i++) 
+        buffer[i] = (float)(Next() >> 8) * scale + min;
+    
+    return;
+}
+
+
 
 NumberGeneration::NumberGeneration() :
-    mSeed(100)
+    mSeed(100),
+    mStream(100)
 {
     
-    srand(100);
-    
     return;
 }
 
 void NumberGeneration::SetSeed(int seed) {
     
-    srand( seed );
+    mStream.SetSeed( seed );
     
     mSeed = seed;
     
@@ -28,21 +133,168 @@ int NumberGeneration::GetSeed(void) {
 }
 
 int NumberGeneration::Range(int min, int max) {
-    return (rand() % max) + min;
+    return mStream.Range(min, max);
 }
 
 float NumberGeneration::Range(float min, float max) {
-    return ((float)(rand() % (int)(max * 100.0f)) * 0.01f) + min;
+    return mStream.Range(min, max);
 }
 
 double NumberGeneration::Range(double min, double max) {
-    return ((double)(rand() % (int)(max * (double)100.0)) * (double)0.01) + min;
+    return mStream.Range(min, max);
 }
 
 float NumberGeneration::Perlin(float xcoord, float ycoord, float zcoord, int seed) {
     return stb_perlin_noise3_seed(xcoord, ycoord, zcoord, 0, 0, 0, seed);
 }
 
+void NumberGeneration::PerlinBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count, int seed) {
+    PerlinNoiseBatch(xcoord, ycoord, zcoord, output, count, seed);
+}
+
+void RandomStream::PerlinBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count) {
+    PerlinNoiseBatch(xcoord, ycoord, zcoord, output, count, mSeed);
+}
+
+
+//
+// Batched perlin noise
+//
+// The lanes repeat the stb_perlin operations in the same order so 
+// results match stb_perlin_noise3_seed bit for bit. The table lookups 
+// are done per lane as SSE2 has no gather.
+//
+
+#ifdef RANDOM_PERLIN_SSE2
+
+static inline __m128 PerlinEase(__m128 a) {
+    __m128 ease = _mm_sub_ps(_mm_mul_ps(a, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+    ease = _mm_add_ps(_mm_mul_ps(ease, a), _mm_set1_ps(10.0f));
+    ease = _mm_mul_ps(ease, a);
+    ease = _mm_mul_ps(ease, a);
+    return _mm_mul_ps(ease, a);
+}
+
+static inline __m128 PerlinLerp(__m128 a, __m128 b, __m128 t) {
+    return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+}
+
+static inline __m128 PerlinGrad(const float* grad, __m128 x, __m128 y, __m128 z) {
+    __m128 result = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(grad), x), _mm_mul_ps(_mm_loadu_ps(grad + 4), y));
+    return _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(grad + 8), z));
+}
+
+static inline __m128i PerlinFloor(__m128 a) {
+    __m128i truncated = _mm_cvttps_epi32(a);
+    __m128 isBelow = _mm_cmplt_ps(a, _mm_cvtepi32_ps(truncated));
+    return _mm_add_epi32(truncated, _mm_castps_si128(isBelow));
+}
+
+static void PerlinNoise4(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned char seed) {
+    
+    static const float basis[12][3] = {
+        { 1, 1, 0}, {-1, 1, 0}, { 1,-1, 0}, {-1,-1, 0}, 
+        { 1, 0, 1}, {-1, 0, 1}, { 1, 0,-1}, {-1, 0,-1}, 
+        { 0, 1, 1}, { 0,-1, 1}, { 0, 1,-1}, { 0,-1,-1}
+    };
+    
+    __m128 x = _mm_loadu_ps(xcoord);
+    __m128 y = _mm_loadu_ps(ycoord);
+    __m128 z = _mm_loadu_ps(zcoord);
+    
+    __m128i px = PerlinFloor(x);
+    __m128i py = PerlinFloor(y);
+    __m128i pz = PerlinFloor(z);
+    
+    int cellX[4], cellY[4], cellZ[4];
+    _mm_storeu_si128((__m128i*)cellX, px);
+    _mm_storeu_si128((__m128i*)cellY, py);
+    _mm_storeu_si128((__m128i*)cellZ, pz);
+    
+    // Gradient components for each corner laid out as [corner][component][lane]
+    float grad[8][3][4];
+    
+    for (unsigned int lane=0; lane < 4; lane++) {
+        
+        int x0 = cellX[lane] & 255, x1 = (cellX[lane] + 1) & 255;
+        int y0 = cellY[lane] & 255, y1 = (cellY[lane] + 1) & 255;
+        int z0 = cellZ[lane] & 255, z1 = (cellZ[lane] + 1) & 255;
+        
+        int r0 = stb__perlin_randtab[x0 + seed];
+        int r1 = stb__perlin_randtab[x1 + seed];
+        
+        int r00 = stb__perlin_randtab[r0 + y0];
+        int r01 = stb__perlin_randtab[r0 + y1];
+        int r10 = stb__perlin_randtab[r1 + y0];
+        int r11 = stb__perlin_randtab[r1 + y1];
+        
+        int corner[8] = {
+            stb__perlin_randtab_grad_idx[r00 + z0], stb__perlin_randtab_grad_idx[r00 + z1], 
+            stb__perlin_randtab_grad_idx[r01 + z0], stb__perlin_randtab_grad_idx[r01 + z1], 
+            stb__perlin_randtab_grad_idx[r10 + z0], stb__perlin_randtab_grad_idx[r10 + z1], 
+            stb__perlin_randtab_grad_idx[r11 + z0], stb__perlin_randtab_grad_idx[r11 + z1]
+        };
+        
+        for (unsigned int c=0; c < 8; c++) {
+            grad[c][0][lane] = basis[corner[c]][0];
+            grad[c][1][lane] = basis[corner[c]][1];
+            grad[c][2][lane] = basis[corner[c]][2];
+        }
+    }
+    
+    x = _mm_sub_ps(x, _mm_cvtepi32_ps(px));
+    y = _mm_sub_ps(y, _mm_cvtepi32_ps(py));
+    z = _mm_sub_ps(z, _mm_cvtepi32_ps(pz));
+    
+    __m128 u = PerlinEase(x);
+    __m128 v = PerlinEase(y);
+    __m128 w = PerlinEase(z);
+    
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 x1 = _mm_sub_ps(x, one);
+    __m128 y1 = _mm_sub_ps(y, one);
+    __m128 z1 = _mm_sub_ps(z, one);
+    
+    __m128 n000 = PerlinGrad(&grad[0][0][0], x,  y,  z);
+    __m128 n001 = PerlinGrad(&grad[1][0][0], x,  y,  z1);
+    __m128 n010 = PerlinGrad(&grad[2][0][0], x,  y1, z);
+    __m128 n011 = PerlinGrad(&grad[3][0][0], x,  y1, z1);
+    __m128 n100 = PerlinGrad(&grad[4][0][0], x1, y,  z);
+    __m128 n101 = PerlinGrad(&grad[5][0][0], x1, y,  z1);
+    __m128 n110 = PerlinGrad(&grad[6][0][0], x1, y1, z);
+    __m128 n111 = PerlinGrad(&grad[7][0][0], x1, y1, z1);
+    
+    __m128 n00 = PerlinLerp(n000, n001, w);
+    __m128 n01 = PerlinLerp(n010, n011, w);
+    __m128 n10 = PerlinLerp(n100, n101, w);
+    __m128 n11 = PerlinLerp(n110, n111, w);
+    
+    __m128 n0 = PerlinLerp(n00, n01, v);
+    __m128 n1 = PerlinLerp(n10, n11, v);
+    
+    _mm_storeu_ps(output, PerlinLerp(n0, n1, u));
+    
+    return;
+}
+
+#endif
+
+void PerlinNoiseBatch(const float* xcoord, const float* ycoord, const float* zcoord, float* output, unsigned int count, int seed) {
+    
+    unsigned int i = 0;
+    
+#ifdef RANDOM_PERLIN_SSE2
+    for (; i + 4 <= count; i += 4) 
+        PerlinNoise4(xcoord + i, ycoord + i, zcoord + i, output + i, (unsigned char)seed);
+#endif
+    
+    // Remaining samples or builds without SSE2
+    for (; i < count; i++) 
+        output[i] = stb_perlin_noise3_seed(xcoord[i], ycoord[i], zcoord[i], 0, 0, 0, seed);
+    
+    return;
+}
+
 
 
 /*
@@ -0,0 +1,234 @@
+#include <GameEngineFramework/Physics/HeightFieldQuery.h>
+
+#include <cmath>
+
+// Largest offset from the tile grid still accepted as aligned
+#define  HEIGHT_FIELD_GRID_TOLERANCE  0.001f
+
+
+HeightFieldQuery::HeightFieldQuery() :
+    mTileSizeX(0),
+    mTileSizeZ(0),
+    mGridOriginX(0),
+    mGridOriginZ(0)
+{
+}
+
+bool HeightFieldQuery::AddHeightField(const float* heights, unsigned int width, unsigned int length, glm::vec3 position, glm::vec3 scale, void* userData) {
+    
+    if ((heights == nullptr) | (width < 2) | (length < 2))
+        return false;
+    
+    float sizeX = (float)(width - 1) * scale.x;
+    float sizeZ = (float)(length - 1) * scale.z;
+    
+    if ((sizeX <= 0.0f) | (sizeZ <= 0.0f))
+        return false;
+    
+    Tile tile;
+    tile.heights  = heights;
+    tile.width    = width;
+    tile.length   = length;
+    tile.originX  = position.x - sizeX * 0.5f;
+    tile.originY  = position.y;
+    tile.originZ  = position.z - sizeZ * 0.5f;
+    tile.scale    = scale;
+    tile.userData = userData;
+    
+    // The first tile lays out the grid
+    if (mTiles.size() == 0) {
+        
+        mTileSizeX = sizeX;
+        mTileSizeZ = sizeZ;
+        mGridOriginX = tile.originX;
+        mGridOriginZ = tile.originZ;
+    }
+    
+    if ((std::fabs(sizeX - mTileSizeX) > HEIGHT_FIELD_GRID_TOLERANCE) |
+        (std::fabs(sizeZ - mTileSizeZ) > HEIGHT_FIELD_GRID_TOLERANCE))
+        return false;
+    
+    float cellX = (tile.originX - mGridOriginX) / mTileSizeX;
+    float cellZ = (tile.originZ - mGridOriginZ) / mTileSizeZ;
+    
+    tile.cellX = (int)std::floor(cellX + 0.5f);
+    tile.cellZ = (int)std::floor(cellZ + 0.5f);
+    
+    if ((std::fabs(cellX - tile.cellX) > HEIGHT_FIELD_GRID_TOLERANCE) |
+        (std::fabs(cellZ - tile.cellZ) > HEIGHT_FIELD_GRID_TOLERANCE))
+        return false;
+    
+    uint64_t key = GetKey(tile.cellX, tile.cellZ);
+    
+    if (mTileIndex.find(key) != mTileIndex.end())
+        return false;
+    
+    mTileIndex[key] = mTiles.size();
+    
+    mTiles.push_back(tile);
+    
+    return true;
+}
+
+bool HeightFieldQuery::RemoveHeightField(const float* heights) {
+    
+    for (unsigned int i=0; i < mTiles.size(); i++) {
+        
+        if (mTiles[i].heights != heights)
+            continue;
+        
+        mTileIndex.erase( GetKey(mTiles[i].cellX, mTiles[i].cellZ) );
+        
+        // Move the last tile into the gap
+        unsigned int last = mTiles.size() - 1;
+        
+        if (i != last) {
+            
+            mTiles[i] = mTiles[last];
+            
+            mTileIndex[ GetKey(mTiles[i].cellX, mTiles[i].cellZ) ] = i;
+        }
+        
+        mTiles.pop_back();
+        
+        return true;
+    }
+    
+    return false;
+}
+
+void HeightFieldQuery::Clear(void) {
+    
+    mTiles.clear();
+    mTileIndex.clear();
+    
+    return;
+}
+
+unsigned int HeightFieldQuery::GetNumberOfHeightFields(void) {
+    return mTiles.size();
+}
+
+HeightFieldResult HeightFieldQuery::Query(glm::vec3 from, float distance, Hit& hit) {
+    
+    unsigned int lastTile = 0;
+    
+    const Tile* tile = FindTile(from.x, from.z, lastTile);
+    
+    if (tile == nullptr)
+        return HeightFieldResult::Uncovered;
+    
+    return Sample(*tile, from, distance, hit);
+}
+
+void HeightFieldQuery::QueryBatch(const glm::vec3* from, unsigned int count, float distance, Hit* hits, HeightFieldResult* results) {
+    
+    // Neighboring points usually share a tile
+    unsigned int lastTile = 0;
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        const Tile* tile = FindTile(from[i].x, from[i].z, lastTile);
+        
+        if (tile == nullptr) {
+            
+            results[i] = HeightFieldResult::Uncovered;
+            
+            continue;
+        }
+        
+        results[i] = Sample(*tile, from[i], distance, hits[i]);
+    }
+    
+    return;
+}
+
+uint64_t HeightFieldQuery::GetKey(int cellX, int cellZ) {
+    return ((uint64_t)(uint32_t)cellX << 32) | (uint64_t)(uint32_t)cellZ;
+}
+
+const HeightFieldQuery::Tile* HeightFieldQuery::FindTile(float x, float z, unsigned int& lastTile) {
+    
+    if (mTiles.size() == 0)
+        return nullptr;
+    
+    if (lastTile < mTiles.size()) {
+        
+        const Tile& tile = mTiles[lastTile];
+        
+        if ((x >= tile.originX) & (x <= tile.originX + mTileSizeX) &
+            (z >= tile.originZ) & (z <= tile.originZ + mTileSizeZ))
+            return &tile;
+    }
+    
+    int cellX = (int)std::floor((x - mGridOriginX) / mTileSizeX);
+    int cellZ = (int)std::floor((z - mGridOriginZ) / mTileSizeZ);
+    
+    std::unordered_map<uint64_t, unsigned int>::iterator it = mTileIndex.find( GetKey(cellX, cellZ) );
+    
+    if (it == mTileIndex.end())
+        return nullptr;
+    
+    lastTile = it->second;
+    
+    return &mTiles[lastTile];
+}
+
+HeightFieldResult HeightFieldQuery::Sample(const Tile& tile, glm::vec3 from, float distance, Hit& hit) {
+    
+    float u = (from.x - tile.originX) / tile.scale.x;
+    float v = (from.z - tile.originZ) / tile.scale.z;
+    
+    int maxX = (int)tile.width  - 2;
+    int maxZ = (int)tile.length - 2;
+    
+    int i = (int)std::floor(u);
+    int j = (int)std::floor(v);
+    
+    if (i < 0) i = 0;
+    if (j < 0) j = 0;
+    if (i > maxX) i = maxX;
+    if (j > maxZ) j = maxZ;
+    
+    float fx = glm::clamp(u - (float)i, 0.0f, 1.0f);
+    float fz = glm::clamp(v - (float)j, 0.0f, 1.0f);
+    
+    const float* row     = tile.heights + j * tile.width + i;
+    const float* nextRow = row + tile.width;
+    
+    float h00 = row[0];
+    float h10 = row[1];
+    float h01 = nextRow[0];
+    float h11 = nextRow[1];
+    
+    float height;
+    float slopeX;
+    float slopeZ;
+    
+    // Each cell is split along the diagonal from (i, j+1) to (i+1, j)
+    if (fx + fz <= 1.0f) {
+        
+        slopeX = h10 - h00;
+        slopeZ = h01 - h00;
+        height = h00 + fx * slopeX + fz * slopeZ;
+        
+    } else {
+        
+        slopeX = h11 - h01;
+        slopeZ = h11 - h10;
+        height = h11 - (1.0f - fx) * slopeX - (1.0f - fz) * slopeZ;
+    }
+    
+    height = tile.originY + height * tile.scale.y;
+    
+    if ((from.y < height) | (from.y - height > distance))
+        return HeightFieldResult::Miss;
+    
+    hit.point  = glm::vec3(from.x, height, from.z);
+    hit.normal = glm::normalize( glm::vec3(-slopeX * tile.scale.y / tile.scale.x, 1.0f, -slopeZ * tile.scale.y / tile.scale.z) );
+    
+    hit.collider   = nullptr;
+    hit.gameObject = tile.userData;
+    
+    return HeightFieldResult::Hit;
+}
@@ -1,4 +1,9 @@
 #include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Jobs/JobSystem.h>
+
+#include <atomic>
+
+extern JobSystem Jobs;
 
 PhysicsSystem::PhysicsSystem() : 
     
@@ -15,6 +20,14 @@ RaybackCastCaller::RaybackCastCaller() :
 {
 }
 
+RaycastQuery::RaycastQuery() : 
+    from(glm::vec3(0, 0, 0)),
+    direction(glm::vec3(0, -1, 0)),
+    distance(0),
+    layer(LayerMask::Default)
+{
+}
+
 void PhysicsSystem::Initiate(void) {
     
     rp3d::PhysicsWorld::WorldSettings worldSettings;
@@ -119,11 +132,17 @@ MeshCollider* PhysicsSystem::CreateHeightFieldMap(float* heightField, unsigned i
     
     collider->heightFieldShape->setScale( rp3d::Vector3(scaleX, scaleY, scaleZ) );
     
+    collider->heightMapWidth  = width;
+    collider->heightMapLength = height;
+    collider->heightMapScale  = glm::vec3(scaleX, scaleY, scaleZ);
+    
     return collider;
 }
 
 bool PhysicsSystem::DestroyHeightFieldMap(MeshCollider* collider) {
     
+    mTerrain.RemoveHeightField( collider->heightMapBuffer );
+    
     common.destroyHeightFieldShape( collider->heightFieldShape );
     
     delete( collider->heightMapBuffer );
@@ -199,21 +218,174 @@ bool PhysicsSystem::Raycast(glm::vec3 from, glm::vec3 direction, float distance,
     
     rp3d::Ray ray(fromVec, fromVec + toVec);
     
-    mRaybackCastCaller.isHit = false;
+    // Each cast gets its own callback so rays can be cast from any thread
+    RaybackCastCaller raycastCaller;
     
-    world->raycast( ray, &mRaybackCastCaller, (unsigned short)layer );
+    world->raycast( ray, &raycastCaller, (unsigned short)layer );
     
-    if (!mRaybackCastCaller.isHit) 
+    if (!raycastCaller.isHit) 
         return false;
     
-    hit.point  = mRaybackCastCaller.point;
-    hit.normal = mRaybackCastCaller.normal;
+    hit.point  = raycastCaller.point;
+    hit.normal = raycastCaller.normal;
     
-    hit.gameObject = mRaybackCastCaller.userData;
-    hit.collider   = mRaybackCastCaller.collider;
+    hit.gameObject = raycastCaller.userData;
+    hit.collider   = raycastCaller.collider;
     
     return true;
 }
 
+unsigned int PhysicsSystem::RaycastBatch(const RaycastQuery* queries, unsigned int count, Hit* hits, uint8_t* isHit) {
+    
+    std::atomic<unsigned int> numberOfHits(0);
+    
+    Jobs.ParallelFor(count, PHYSICS_RAYCAST_BATCH_SIZE, [this, queries, hits, isHit, &numberOfHits](unsigned int begin, unsigned int end) {
+        
+        unsigned int batchHits = 0;
+        
+        for (unsigned int i=begin; i < end; i++) {
+            
+            const RaycastQuery& query = queries[i];
+            
+            isHit[i] = Raycast(query.from, query.direction, query.distance, hits[i], query.layer);
+            
+            batchHits += isHit[i];
+        }
+        
+        numberOfHits += batchHits;
+    });
+    
+    return numberOfHits;
+}
+
+bool PhysicsSystem::AddTerrainHeightField(MeshCollider* collider, glm::vec3 position, void* userData) {
+    
+    if (collider->heightMapBuffer == nullptr) 
+        return false;
+    
+    return mTerrain.AddHeightField(collider->heightMapBuffer, collider->heightMapWidth, collider->heightMapLength, 
+                                   position, collider->heightMapScale, userData);
+}
 
+bool PhysicsSystem::RemoveTerrainHeightField(MeshCollider* collider) {
+    return mTerrain.RemoveHeightField( collider->heightMapBuffer );
+}
 
+void PhysicsSystem::GetGroundObstacles(LayerMask layer, std::vector<rp3d::AABB>& obstacles) {
+    
+    unsigned int numberOfBodies = world->getNbRigidBodies();
+    
+    for (unsigned int i=0; i < numberOfBodies; i++) {
+        
+        rp3d::RigidBody* body = world->getRigidBody(i);
+        
+        if (!body->isActive()) 
+            continue;
+        
+        unsigned int numberOfColliders = body->getNbColliders();
+        
+        for (unsigned int c=0; c < numberOfColliders; c++) {
+            
+            const rp3d::Collider* collider = body->getCollider(c);
+            
+            if ((collider->getCollisionCategoryBits() & (unsigned short)layer) == 0) 
+                continue;
+            
+            // Height fields are the terrain sampled directly
+            if (collider->getCollisionShape()->getName() == rp3d::CollisionShapeName::HEIGHTFIELD) 
+                continue;
+            
+            obstacles.push_back( collider->getWorldAABB() );
+        }
+    }
+    
+    return;
+}
+
+bool PhysicsSystem::IsColumnBlocked(const std::vector<rp3d::AABB>& obstacles, glm::vec3 from, float distance) {
+    
+    for (unsigned int i=0; i < obstacles.size(); i++) {
+        
+        const rp3d::Vector3& min = obstacles[i].getMin();
+        const rp3d::Vector3& max = obstacles[i].getMax();
+        
+        if ((from.x < min.x) | (from.x > max.x) | (from.z < min.z) | (from.z > max.z)) 
+            continue;
+        
+        if ((min.y > from.y) | (max.y < from.y - distance)) 
+            continue;
+        
+        return true;
+    }
+    
+    return false;
+}
+
+bool PhysicsSystem::QueryGround(glm::vec3 from, float distance, Hit& hit, LayerMask layer) {
+    
+    HeightFieldResult result = mTerrain.Query(from, distance, hit);
+    
+    if (result != HeightFieldResult::Uncovered) {
+        
+        // Other ground colliders over the terrain need the ray cast
+        std::vector<rp3d::AABB> obstacles;
+        GetGroundObstacles(layer, obstacles);
+        
+        if (!IsColumnBlocked(obstacles, from, distance)) 
+            return result == HeightFieldResult::Hit;
+    }
+    
+    return Raycast(from, glm::vec3(0, -1, 0), distance, hit, layer);
+}
+
+unsigned int PhysicsSystem::QueryGroundBatch(const glm::vec3* from, unsigned int count, float distance, Hit* hits, uint8_t* isHit, LayerMask layer) {
+    
+    std::vector<HeightFieldResult> results(count);
+    
+    mTerrain.QueryBatch(from, count, distance, hits, results.data());
+    
+    std::vector<rp3d::AABB> obstacles;
+    GetGroundObstacles(layer, obstacles);
+    
+    // Only points off the terrain or over other ground colliders need a ray cast
+    std::vector<unsigned int> uncovered;
+    std::vector<RaycastQuery> queries;
+    
+    unsigned int numberOfHits = 0;
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        if ((results[i] == HeightFieldResult::Uncovered) || IsColumnBlocked(obstacles, from[i], distance)) {
+            
+            RaycastQuery query;
+            query.from     = from[i];
+            query.distance = distance;
+            query.layer    = layer;
+            
+            queries.push_back(query);
+            uncovered.push_back(i);
+            
+            continue;
+        }
+        
+        isHit[i] = (results[i] == HeightFieldResult::Hit);
+        
+        numberOfHits += isHit[i];
+    }
+    
+    if (queries.size() == 0) 
+        return numberOfHits;
+    
+    std::vector<Hit> rayHits(queries.size());
+    std::vector<uint8_t> isRayHit(queries.size());
+    
+    numberOfHits += RaycastBatch(queries.data(), queries.size(), rayHits.data(), isRayHit.data());
+    
+    for (unsigned int r=0; r < uncovered.size(); r++) {
+        
+        hits[ uncovered[r] ]  = rayHits[r];
+        isHit[ uncovered[r] ] = isRayHit[r];
+    }
+    
+    return numberOfHits;
+}
@@ -4,6 +4,9 @@ MeshCollider::MeshCollider() :
     
     heightFieldShape(nullptr),
     heightMapBuffer(nullptr),
+    heightMapWidth(0),
+    heightMapLength(0),
+    heightMapScale(glm::vec3(1)),
     
     triangleMesh(nullptr),
     vertexBuffer(nullptr),
@@ -2,6 +2,19 @@
 
 Chunk ChunkManager::CreateChunk(float x, float y) {
     
+    ChunkBuildData data;
+    
+    ChunkGenerator generator = GetGenerator();
+    generator.Build(data, x, y);
+    
+    return CreateChunk(data);
+}
+
+Chunk ChunkManager::CreateChunk(ChunkBuildData& data) {
+    
+    float x = data.x;
+    float y = data.y;
+    
     Chunk chunk;
     
     chunk.x = x;
@@ -64,52 +77,10 @@ Chunk ChunkManager::CreateChunk(float x, float y) {
     staticRenderer->material = staticMaterial;
     
     
-    // Generate perlin
-    int chunkSZ = chunkSize+1;
-    
-    float heightField [ chunkSZ * chunkSZ ];
-    glm::vec3 colorField  [ chunkSZ * chunkSZ ];
-    
-    Engine.SetHeightFieldValues(heightField, chunkSZ, chunkSZ, 0);
-    Engine.SetColorFieldValues(colorField, chunkSZ, chunkSZ, Colors.white);
-    
-    unsigned int numberOfLayers = perlin.size();
-    
-    float min=0.0;
-    
-    for (unsigned int l=0; l < numberOfLayers; l++) {
-        
-        Perlin* perlinLayer = &perlin[l];
-        
-        min = 
-        Engine.AddHeightFieldFromPerlinNoise(heightField, chunkSZ, chunkSZ, 
-                                            perlinLayer->noiseWidth, 
-                                            perlinLayer->noiseHeight, 
-                                            perlinLayer->heightMultuplier, 
-                                            x, y, worldSeed);
-        
-        continue;
-    }
-    
-    // Generate terrain color
-    
-    Color colorLow;
-    Color colorHigh;
-    
-    colorLow  = Colors.brown * Colors.green * Colors.MakeGrayScale(0.4f);
-    colorHigh = Colors.brown * Colors.MakeGrayScale(0.2f);
-    
-    Engine.GenerateColorFieldFromHeightField(colorField, heightField, chunkSZ, chunkSZ, colorLow, colorHigh, 0.024f);
-    
-    Engine.AddColorFieldSnowCap(colorField, heightField, chunkSZ, chunkSZ, Colors.white, 80.0f, 2.0f);
-    
-    Engine.GenerateWaterTableFromHeightField(heightField, chunkSZ, chunkSZ, 0);
-    
-    
     // Finalize chunk
     
-    Engine.AddHeightFieldToMesh(chunkRenderer->mesh, heightField, colorField, chunkSZ, chunkSZ, 0, 0, 1, 1);
-    Engine.AddHeightFieldToMeshHalfSize(chunkRenderer->meshLod, heightField, colorField, chunkSZ, chunkSZ, 0, 0);
+    chunkRenderer->mesh->AddSubMesh(0, 0, 0, data.meshVertices, data.meshIndices, false);
+    chunkRenderer->meshLod->AddSubMesh(0, 0, 0, data.lodVertices, data.lodIndices, false);
     
     chunkRenderer->mesh->Load();
     chunkRenderer->meshLod->Load();
@@ -130,7 +101,7 @@ Chunk ChunkManager::CreateChunk(float x, float y) {
     
     // Generate a height field collider
     
-    MeshCollider*  meshCollider = Physics.CreateHeightFieldMap(heightField, chunkSZ, chunkSZ, 1, 1, 1);
+    MeshCollider*  meshCollider = Physics.CreateHeightFieldMap(&data.heightField[0], data.fieldSize, data.fieldSize, 1, 1, 1);
     
     rp3d::Collider* bodyCollider = chunk.rigidBody->addCollider( meshCollider->heightFieldShape, rp3d::Transform::identity() );
     bodyCollider->setUserData( (void*)chunk.gameObject );
@@ -140,6 +111,34 @@ Chunk ChunkManager::CreateChunk(float x, float y) {
     chunk.bodyCollider = bodyCollider;
     chunk.meshCollider = meshCollider;
     
+    // Ground queries over the chunk sample the height field directly
+    Physics.AddTerrainHeightField(meshCollider, glm::vec3(x, 0, y), (void*)chunk.gameObject);
+    
     return chunk;
 }
 
+
+ChunkGenerator ChunkManager::GetGenerator(void) {
+    
+    ChunkGenerator generator;
+    
+    generator.chunkSize = chunkSize;
+    generator.worldSeed = worldSeed;
+    generator.perlin    = perlin;
+    
+    generator.doSharedVertices = doSharedVertexTerrain;
+    
+    Color colorLow;
+    Color colorHigh;
+    
+    colorLow  = Colors.brown * Colors.green * Colors.MakeGrayScale(0.4f);
+    colorHigh = Colors.brown * Colors.MakeGrayScale(0.2f);
+    
+    generator.colorLow  = glm::vec3(colorLow.r, colorLow.g, colorLow.b);
+    generator.colorHigh = glm::vec3(colorHigh.r, colorHigh.g, colorHigh.b);
+    
+    generator.snowCapColor  = glm::vec3(1.0f, 1.0f, 1.0f);
+    generator.snowCapHeight = 80.0f;
+    
+    return generator;
+}
@@ -0,0 +1,103 @@
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkGenerator.h>
+
+ChunkBuildData::ChunkBuildData() :
+    x(0),
+    y(0),
+    seed(0),
+    fieldSize(0)
+{
+}
+
+
+ChunkGenerator::ChunkGenerator() :
+    chunkSize(50),
+    worldSeed(100),
+    
+    colorLow(0.0f, 0.0f, 0.0f),
+    colorHigh(1.0f, 1.0f, 1.0f),
+    
+    snowCapColor(1.0f, 1.0f, 1.0f),
+    snowCapHeight(80.0f),
+    
+    doSharedVertices(false)
+{
+}
+
+void ChunkGenerator::Build(ChunkBuildData& data, float x, float y) {
+    
+    data.x = x;
+    data.y = y;
+    data.seed = worldSeed + ((x * 2) + (y * 4) / 2);
+    
+    // Generate perlin
+    unsigned int chunkSZ = chunkSize + 1;
+    unsigned int fieldArea = chunkSZ * chunkSZ;
+    
+    data.fieldSize = chunkSZ;
+    data.heightField.assign(fieldArea, 0.0f);
+    data.colorField.assign(fieldArea, glm::vec3(1.0f, 1.0f, 1.0f));
+    
+    float* heightField    = &data.heightField[0];
+    glm::vec3* colorField = &data.colorField[0];
+    
+    for (unsigned int l=0; l < perlin.size(); l++) {
+        
+        Perlin* perlinLayer = &perlin[l];
+        
+        Engine.AddHeightFieldFromPerlinNoise(heightField, chunkSZ, chunkSZ,
+                                            perlinLayer->noiseWidth,
+                                            perlinLayer->noiseHeight,
+                                            perlinLayer->heightMultuplier,
+                                            x, y, worldSeed);
+    }
+    
+    // Generate terrain color
+    RandomStream random(data.seed);
+    
+    for (unsigned int i=0; i < fieldArea; i++) {
+        
+        float heightBias = glm::clamp(heightField[i] * 0.024f, 0.0f, 1.0f);
+        
+        glm::vec3 color(glm::lerp(colorLow.x, colorHigh.x, heightBias),
+                        glm::lerp(colorLow.y, colorHigh.y, heightBias),
+                        glm::lerp(colorLow.z, colorHigh.z, heightBias));
+        
+        float uniformVariant = (random.Range(0, 100) * 0.00001f) - (random.Range(0, 10) * 0.00001f);
+        
+        colorField[i] = color + uniformVariant;
+    }
+    
+    // Snow cap
+    const float snowCapBias = 2.0f;
+    
+    for (unsigned int i=0; i < fieldArea; i++) {
+        
+        int diff = ((snowCapHeight - (snowCapHeight - 20)) - (heightField[i] - snowCapHeight)) * snowCapBias;
+        
+        if (random.Range(0, 100) <= diff)
+            continue;
+        
+        float bias = heightField[i] * 0.07;
+        
+        colorField[i] = glm::vec3(glm::lerp(colorField[i].x, snowCapColor.x, bias),
+                                  glm::lerp(colorField[i].y, snowCapColor.y, bias),
+                                  glm::lerp(colorField[i].z, snowCapColor.z, bias));
+    }
+    
+    Engine.GenerateWaterTableFromHeightField(heightField, chunkSZ, chunkSZ, 0);
+    
+    // Mesh buffers
+    data.meshVertices.clear();
+    data.meshIndices.clear();
+    data.lodVertices.clear();
+    data.lodIndices.clear();
+    
+    if (doSharedVertices) {
+        Engine.AddHeightFieldToBufferShared(data.meshVertices, data.meshIndices, heightField, colorField, chunkSZ, chunkSZ, 0, 0);
+    } else {
+        Engine.AddHeightFieldToBuffer(data.meshVertices, data.meshIndices, heightField, colorField, chunkSZ, chunkSZ, 0, 0, 1, 1);
+    }
+    Engine.AddHeightFieldToBufferHalfSize(data.lodVertices, data.lodIndices, heightField, colorField, chunkSZ, chunkSZ, 0, 0);
+    
+    return;
+}
@@ -2,85 +2,65 @@
 
 bool ChunkManager::LoadChunk(Chunk& chunk) {
     
-    std::string chunkPosStr = Float.ToString( chunk.x ) + "_" + Float.ToString( chunk.y );
-    std::string worldChunks = "worlds/" + world.name + "/chunks/";
-    std::string worldStatic = "worlds/" + world.name + "/static/";
+    int cellX;
+    int cellZ;
     
-    std::string chunkName = worldChunks + chunkPosStr;
-    std::string staticName = worldStatic + chunkPosStr;
+    GetChunkCell(chunk.x, chunk.y, cellX, cellZ);
+    
+    RegionFile* region = GetRegion(cellX, cellZ, false);
+    
+    if (region == nullptr) 
+        return 0;
+    
+    std::vector<uint8_t> buffer;
+    
+    if (!region->Read(cellX, cellZ, buffer)) 
+        return 0;
+    
+    ChunkRecord record;
+    
+    if (!record.Decode(buffer.data(), buffer.size())) 
+        return 0;
     
     // Load actors
     
-    if (Serializer.CheckExists( chunkName )) {
+    unsigned int numberOfActors = record.actors.size();
+    
+    for (unsigned int i=0; i < numberOfActors; i++) {
         
-        unsigned int fileSize = Serializer.GetFileSize(chunkName);
+        ChunkActorRecord& actorRecord = record.actors[i];
         
-        if (fileSize != 0) {
-            
-            std::string dataBuffer;
-            dataBuffer.resize(fileSize);
-            
-            Serializer.Deserialize(chunkName, (void*)dataBuffer.data(), fileSize);
-            
-            std::vector<std::string> bufferArray = String.Explode(dataBuffer, '\n');
-            
-            unsigned int numberOfLines = bufferArray.size();
-            
-            for (unsigned int i=0; i < numberOfLines; i++) {
-                
-                std::string lineString = bufferArray[i];
-                
-                std::vector<std::string> lineArray = String.Explode(lineString, '~');
-                
-                float posX = String.ToFloat( lineArray[0] );
-                float posY = String.ToFloat( lineArray[1] );
-                float posZ = String.ToFloat( lineArray[2] );
-                
-                glm::vec3 pos(posX, posY, posZ);
-                
-                unsigned long long int age = String.ToLongUint( lineArray[3] );
-                
-                GameObject* actorObject = SpawnActor(posX, posY, posZ);
-                Actor* actorPtr = actorObject->GetComponent<Actor>();
-                
-                AI.genomes.InjectGenome(actorPtr, lineArray[4]);
-                
-                actorPtr->SetAge(age);
-                
-                continue;
-            }
-            
-        }
+        GameObject* actorObject = SpawnActor(actorRecord.position.x, actorRecord.position.y, actorRecord.position.z);
+        Actor* actorPtr = actorObject->GetComponent<Actor>();
+        
+        AI.genomes.InjectGenome(actorPtr, actorRecord.genome);
         
+        actorPtr->SetAge(actorRecord.age);
+        
+        continue;
     }
     
     
     // Load static
     
-    if (Serializer.CheckExists( staticName )) {
+    unsigned int numberOfStaticElements = record.statics.size();
+    
+    if (numberOfStaticElements > 0) {
         
         MeshRenderer* meshRenderer = chunk.staticObject->GetComponent<MeshRenderer>();
         Mesh* staticMesh = meshRenderer->mesh;
         
-        unsigned int fileSize = Serializer.GetFileSize(staticName);
-        
-        unsigned int numberOfStaticElements = fileSize / sizeof(StaticElement);
-        
-        StaticElement staticElements[numberOfStaticElements];
-        
-        Serializer.Deserialize(staticName, (void*)staticElements, fileSize);
-        
         for (unsigned int i=0; i < numberOfStaticElements; i++) {
             
-            float posX = staticElements[i].position.x;
-            float posY = staticElements[i].position.y;
-            float posZ = staticElements[i].position.z;
+            float posX = record.statics[i].position.x;
+            float posY = record.statics[i].position.y;
+            float posZ = record.statics[i].position.z;
             
-            float colR = staticElements[i].color.r;
-            float colG = staticElements[i].color.g;
-            float colB = staticElements[i].color.b;
+            float colR = record.statics[i].color.r;
+            float colG = record.statics[i].color.g;
+            float colB = record.statics[i].color.b;
             
-            uint8_t type = staticElements[i].type;
+            uint8_t type = record.statics[i].type;
             
             StaticObject staticObj;
             
@@ -95,7 +75,7 @@ bool ChunkManager::LoadChunk(Chunk& chunk) {
             staticObj.type = type;
             
             
-            if (type = DECORATION_GRASS) {
+            if (type == DECORATION_GRASS) {
                 
                 chunk.statics.push_back(staticObj);
                 
@@ -113,7 +93,7 @@ bool ChunkManager::LoadChunk(Chunk& chunk) {
                 continue;
             }
             
-            if (type = DECORATION_GRASS_THICK) {
+            if (type == DECORATION_GRASS_THICK) {
                 
                 chunk.statics.push_back(staticObj);
                 
@@ -131,7 +111,7 @@ bool ChunkManager::LoadChunk(Chunk& chunk) {
                 continue;
             }
             
-            if (type = DECORATION_GRASS_THIN) {
+            if (type == DECORATION_GRASS_THIN) {
                 
                 chunk.statics.push_back(staticObj);
                 
@@ -149,7 +129,7 @@ bool ChunkManager::LoadChunk(Chunk& chunk) {
                 continue;
             }
             
-            if (type = DECORATION_TREE) {
+            if (type == DECORATION_TREE) {
                 
                 chunk.statics.push_back(staticObj);
                 
@@ -166,7 +146,7 @@ bool ChunkManager::LoadChunk(Chunk& chunk) {
             }
             
             
-            if (type = DECORATION_LEAVES) {
+            if (type == DECORATION_LEAVES) {
                 
                 chunk.statics.push_back(staticObj);
                 
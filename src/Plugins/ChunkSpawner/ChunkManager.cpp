@@ -11,6 +11,12 @@ ChunkManager::ChunkManager() :
     
     worldSeed(100),
     
+    doAsyncGeneration(true),
+    generationBudget(4.0f),
+    generationJobLimit(8),
+    doSharedVertexTerrain(false),
+    doCompressRegions(true),
+    
     numberOfActiveActors(0),
     
     waterMaterial(nullptr),
@@ -19,7 +25,6 @@ ChunkManager::ChunkManager() :
     staticMaterial(nullptr),
     
     mActorIndex(0),
-    mChunkIndex(0),
     
     mChunkCounterX(0),
     mChunkCounterZ(0),
@@ -101,6 +106,7 @@ void ChunkManager::WorldDirectoryInitiate(void) {
     std::string worldName   = "worlds/" + world.name;
     std::string worldChunks = "worlds/" + world.name + "/chunks";
     std::string worldStatic = "worlds/" + world.name + "/static";
+    std::string worldRegions = "worlds/" + world.name + "/regions";
     
     // Check world directory structure exists
     if (!fs.DirectoryExists(worldName)) {
@@ -119,6 +125,10 @@ void ChunkManager::WorldDirectoryInitiate(void) {
         
     }
     
+    // Worlds saved before region files were added
+    if (!fs.DirectoryExists(worldRegions)) 
+        fs.DirectoryCreate(worldRegions);
+    
     return;
 }
 
@@ -128,8 +138,12 @@ void ChunkManager::ClearWorld(void) {
     
     isInitiated = false;
     
-    for (unsigned int c=0; c < chunks.size(); c++) 
-        DestroyChunk( chunks[c] );
+    CancelChunkBuilds();
+    
+    CloseRegions();
+    
+    for (unsigned int c=0; c < chunks.Size(); c++) 
+        DestroyChunk( *chunks[c] );
     
     for (unsigned int a=0; a < actors.size(); a++) 
         KillActor(actors[a]);
@@ -137,7 +151,7 @@ void ChunkManager::ClearWorld(void) {
     mChunkCounterX = 0;
     mChunkCounterZ = 0;
     
-    chunks.clear();
+    chunks.Clear();
     mWorldRules.clear();
     
     return;
@@ -153,8 +167,11 @@ bool ChunkManager::DestroyWorld(std::string worldname) {
     if (!fs.DirectoryExists(worldPath)) 
         return false;
     
+    CloseRegions();
+    
     fs.DirectoryDelete( worldPath + "/chunks" );
     fs.DirectoryDelete( worldPath + "/static" );
+    fs.DirectoryDelete( worldPath + "/regions" );
     
     fs.DirectoryDelete( worldPath );
     
@@ -197,6 +214,9 @@ GameObject* ChunkManager::SpawnActor(float x, float y, float z) {
     
     Actor* actorPtr = actorObject->GetComponent<Actor>();
     
+    // Map proximity query results back to their game objects
+    actorPtr->SetUserDataB(actorObject);
+    
     actorPtr->SetTargetPoint(glm::vec3(x, y, z));
     
     actorPtr->SetUserBitmask(0);
@@ -344,20 +364,7 @@ bool ChunkManager::ApplyWorldRule(std::string key, std::string value) {
 }
 
 Chunk* ChunkManager::FindChunk(int x, int y) {
-    
-    unsigned int numberOfChunks = chunks.size();
-    
-    for (unsigned int i=0; i < numberOfChunks; i++) {
-        
-        Chunk* chunk = &chunks[i];
-        
-        if ((chunk->x != x) | (chunk->y != y)) 
-            continue;
-        
-        return chunk;
-    }
-    
-    return nullptr;
+    return chunks.Find(x, y);
 }
 
 
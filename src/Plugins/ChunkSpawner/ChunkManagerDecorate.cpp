@@ -3,6 +3,32 @@
 
 
 
+// Evaluate the noise for every decoration cell of a chunk in one batch
+void GenerateDecorNoiseTile(RandomStream& random, std::vector<float>& tile, int side, float scale) {
+    
+    unsigned int tileArea = side * side;
+    
+    std::vector<float> xCoord(tileArea);
+    std::vector<float> yCoord(tileArea, 0.0f);
+    std::vector<float> zCoord(tileArea);
+    
+    for (int xx=0; xx < side; xx++) {
+        
+        for (int zz=0; zz < side; zz++) {
+            
+            xCoord[xx * side + zz] = (float)xx * scale;
+            zCoord[xx * side + zz] = (float)zz * scale;
+        }
+    }
+    
+    tile.resize(tileArea);
+    
+    random.PerlinBatch(xCoord.data(), yCoord.data(), zCoord.data(), tile.data(), tileArea);
+    
+    return;
+}
+
+
 void DecodeGenome(DecorationSpecifier& decor, Actor* actorPtr) {
     
     if (decor.name == "Sheep")  {AI.genomes.presets.Sheep( actorPtr );}
@@ -75,7 +101,7 @@ void ChunkManager::AddDecorGrassThin(Chunk& chunk, StaticObject& staticObject, M
     return;
 }
 
-void ChunkManager::AddDecorGrassThick(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz) {
+void ChunkManager::AddDecorGrassThick(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, RandomStream& random) {
     
     StaticObject newStaticObject = staticObject;
     
@@ -93,8 +119,8 @@ void ChunkManager::AddDecorGrassThick(Chunk& chunk, StaticObject& staticObject,
     finalColor.g = newStaticObject.g;
     finalColor.b = newStaticObject.b;
     
-    if (Random.Range(0, 100) < 20) finalColor = Colors.yellow * 0.05f;
-    if (Random.Range(0, 100) < 20) finalColor = Colors.orange * 0.01f;
+    if (random.Range(0, 100) < 20) finalColor = Colors.yellow * 0.05f;
+    if (random.Range(0, 100) < 20) finalColor = Colors.orange * 0.01f;
     
     staticMesh->ChangeSubMeshColor(index, finalColor);
     staticMesh->ChangeSubMeshColor(index-1, finalColor);
@@ -139,8 +165,6 @@ void ChunkManager::AddDecorTreeLogs(Chunk& chunk, StaticObject& staticObject, Me
 
 void ChunkManager::AddDecorTreeLeaves(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz) {
     
-    unsigned int leafAccent = Random.Range(0, 100);
-    
     StaticObject newStaticObject = staticObject;
     newStaticObject.type = DECORATION_LEAVES;
     
@@ -164,19 +188,19 @@ void ChunkManager::AddDecorTreeLeaves(Chunk& chunk, StaticObject& staticObject,
 }
 
 
-void ChunkManager::AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, Decoration treeType) {
+void ChunkManager::AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh* staticMesh, float xx, float yy, float zz, Decoration treeType, RandomStream& random) {
     
-    unsigned int leafCount   = Random.Range(10, 14);
-    unsigned int logHeight   = Random.Range(6, 8);
-    unsigned int leafAccent  = Random.Range(0, 100);
+    unsigned int leafCount   = random.Range(10, 14);
+    unsigned int logHeight   = random.Range(6, 8);
+    unsigned int leafAccent  = random.Range(0, 100);
     
     float leafSpreadArea     = world.leafSpreadArea;
     float leafSpreadHeight   = world.leafSpreadHeight;
     
     if (treeType == Decoration::TreeOak) {
         
-        leafCount   = Random.Range(10, 15);
-        logHeight   = Random.Range(6, 8);
+        leafCount   = random.Range(10, 15);
+        logHeight   = random.Range(6, 8);
         leafAccent  = 0;
         
         leafSpreadArea     = 3.0f;
@@ -208,9 +232,9 @@ void ChunkManager::AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh*
     
     for (unsigned int s=0; s < leafCount; s++) {
         
-        float offset_xx = Random.Range(0.0f, leafSpreadArea)   - Random.Range(0.0f, leafSpreadArea);
-        float offset_yy = Random.Range(0.0f, leafSpreadHeight) - Random.Range(0.0f, leafSpreadHeight);
-        float offset_zz = Random.Range(0.0f, leafSpreadArea)   - Random.Range(0.0f, leafSpreadArea);
+        float offset_xx = random.Range(0.0f, leafSpreadArea)   - random.Range(0.0f, leafSpreadArea);
+        float offset_yy = random.Range(0.0f, leafSpreadHeight) - random.Range(0.0f, leafSpreadHeight);
+        float offset_zz = random.Range(0.0f, leafSpreadArea)   - random.Range(0.0f, leafSpreadArea);
         
         StaticObject newStaticObject = staticObject;
         newStaticObject.x += offset_xx;
@@ -230,7 +254,7 @@ void ChunkManager::AddDecorTree(Chunk& chunk, StaticObject& staticObject, Mesh*
         if ((leafAccent > 20) & (leafAccent < 40)) 
             lowLeaves = Colors.yellow * 0.1f;
         
-        finalColor = Colors.Lerp(lowLeaves, highLeaves, Random.Range(0, 100) * 0.01f);
+        finalColor = Colors.Lerp(lowLeaves, highLeaves, random.Range(0, 100) * 0.01f);
         
         newStaticObject.r = finalColor.r;
         newStaticObject.g = finalColor.g;
@@ -258,6 +282,25 @@ void ChunkManager::Decorate(Chunk& chunk) {
     
     staticMesh->ClearSubMeshes();
     
+    // Decoration draws from a stream seeded by the chunk alone
+    RandomStream random(chunk.seed);
+    
+    // Noise tiles are generated the first time a decoration is picked
+    int tileSide = chunkSize - 1;
+    
+    std::vector<std::vector<float>> decorNoise( world.mDecorations.size() );
+    std::vector<float> structureNoise;
+    
+    if (world.mStructures.size() > 0) 
+        GenerateDecorNoiseTile(random, structureNoise, tileSide, 0.9f);
+    
+    // Find the ground below every decoration cell in one batch
+    unsigned int tileArea = tileSide * tileSide;
+    
+    std::vector<glm::vec3> groundQueries(tileArea);
+    std::vector<Hit>       groundHits(tileArea);
+    std::vector<uint8_t>   groundIsHit(tileArea);
+    
     for (int xx=0; xx < chunkSize-1; xx++) {
         
         for (int zz=0; zz < chunkSize-1; zz++) {
@@ -265,31 +308,37 @@ void ChunkManager::Decorate(Chunk& chunk) {
             float xp = xx - (chunkSize / 2);
             float zp = zz - (chunkSize / 2);
             
-            float staticX = (chunk.x - xp);
-            float staticZ = (chunk.y - zp);
+            groundQueries[xx * tileSide + zz] = glm::vec3(chunk.x - xp, 0, chunk.y - zp);
+        }
+    }
+    
+    Physics.QueryGroundBatch(groundQueries.data(), tileArea, 2000.0f, groundHits.data(), groundIsHit.data(), LayerMask::Ground);
+    
+    for (int xx=0; xx < chunkSize-1; xx++) {
+        
+        for (int zz=0; zz < chunkSize-1; zz++) {
             
-            glm::vec3 from(staticX, 0, staticZ);
-            glm::vec3 direction(0, -1, 0);
+            float xp = xx - (chunkSize / 2);
+            float zp = zz - (chunkSize / 2);
             
             // Pick a random decoration for this world
-            unsigned int decorIndex = Random.Range(0, world.mDecorations.size());
+            unsigned int decorIndex = random.Range(0, world.mDecorations.size());
             
             DecorationSpecifier decor = world.mDecorations[ decorIndex ];
             
             // Perlin generation
-            float xCoord = (float)xx * decor.noise;
-            float zCoord = (float)zz * decor.noise;
+            std::vector<float>& noiseTile = decorNoise[ decorIndex ];
             
-            if (Random.Perlin(xCoord, 0, zCoord, chunk.seed) < decor.threshold) 
-                continue;
+            if (noiseTile.size() == 0) 
+                GenerateDecorNoiseTile(random, noiseTile, tileSide, decor.noise);
             
-            Hit hit;
+            if (noiseTile[xx * tileSide + zz] < decor.threshold) 
+                continue;
             
-            float distance = 2000.0f;
             float height = 0.0f;
             
-            if (Physics.Raycast(from, direction, distance, hit, LayerMask::Ground)) 
-                height = hit.point.y;
+            if (groundIsHit[xx * tileSide + zz]) 
+                height = groundHits[xx * tileSide + zz].point.y;
             
             if (height > world.staticHeightCutoff) 
                 continue;
@@ -311,13 +360,10 @@ void ChunkManager::Decorate(Chunk& chunk) {
             
             for (unsigned int s=0; s < world.mStructures.size(); s++) {
                 
-                float xCoord = (float)xx * 0.9f;
-                float zCoord = (float)zz * 0.9f;
-                
-                if (Random.Perlin(xCoord, 0, zCoord, chunk.seed) < 0.1f) 
+                if (structureNoise[xx * tileSide + zz] < 0.1f) 
                     continue;
                 
-                if (Random.Range(0, (world.mStructures[s].rarity)) > 1) 
+                if (random.Range(0, (world.mStructures[s].rarity)) > 1) 
                     break;
                 
                 unsigned int numberOfElements = world.mStructures[s].elements.size();
@@ -335,7 +381,7 @@ void ChunkManager::Decorate(Chunk& chunk) {
                         AddDecorGrassThin(chunk, staticObj, staticMesh, pos.x, pos.y, pos.z);
                     
                     if (world.mStructures[s].elements[e].type == DECORATION_GRASS_THICK) 
-                        AddDecorGrassThick(chunk, staticObj, staticMesh, pos.x, pos.y, pos.z);
+                        AddDecorGrassThick(chunk, staticObj, staticMesh, pos.x, pos.y, pos.z, random);
                     
                     if (world.mStructures[s].elements[e].type == DECORATION_TREE) 
                         AddDecorTreeLogs(chunk, staticObj, staticMesh, pos.x, pos.y, pos.z);
@@ -353,15 +399,15 @@ void ChunkManager::Decorate(Chunk& chunk) {
             // Grass
             if (decor.type == DECORATION_GRASS) {
                 
-                if ((unsigned int)Random.Range(0, 100) < decor.density) {
+                if ((unsigned int)random.Range(0, 100) < decor.density) {
                     
                     
                     Color finalColor;
                     finalColor = Colors.green * 0.04f;
                     
-                    finalColor += Colors.Make(Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                              Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                              Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f);
+                    finalColor += Colors.Make(random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                              random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                              random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f);
                     
                     staticObj.r = finalColor.r;
                     staticObj.g = finalColor.g;
@@ -375,18 +421,18 @@ void ChunkManager::Decorate(Chunk& chunk) {
             // Thin grass
             if (decor.type == DECORATION_GRASS_THIN) {
                 
-                if ((unsigned int)Random.Range(0, 100) < decor.density) {
+                if ((unsigned int)random.Range(0, 100) < decor.density) {
                     
-                    unsigned int stackHeight = Random.Range((float)decor.spawnStackHeightMin, (float)decor.spawnStackHeightMax);
+                    unsigned int stackHeight = random.Range((float)decor.spawnStackHeightMin, (float)decor.spawnStackHeightMax);
                     
                     for (unsigned int s=0; s < stackHeight; s++) {
                         
                         Color finalColor;
                         finalColor = (Colors.green * 0.018f) + (s * 0.001f);
                         
-                        finalColor += Colors.Make(Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                                Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                                Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f);
+                        finalColor += Colors.Make(random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                                random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                                random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f);
                         
                         staticObj.r = finalColor.r;
                         staticObj.g = finalColor.g;
@@ -402,20 +448,20 @@ void ChunkManager::Decorate(Chunk& chunk) {
             // Thick grass
             if (decor.type == DECORATION_GRASS_THICK) {
                 
-                if ((unsigned int)Random.Range(0, 100) < decor.density) {
+                if ((unsigned int)random.Range(0, 100) < decor.density) {
                     
                     Color finalColor;
                     finalColor = Colors.green * 0.05f;
                     
-                    finalColor += Colors.Make(Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                            Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f, 
-                                            Random.Range(0, 10) * 0.001f - Random.Range(0, 10) * 0.001f);
+                    finalColor += Colors.Make(random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                            random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f, 
+                                            random.Range(0, 10) * 0.001f - random.Range(0, 10) * 0.001f);
                     
                     staticObj.r = finalColor.r;
                     staticObj.g = finalColor.g;
                     staticObj.b = finalColor.b;
                     
-                    AddDecorGrassThick(chunk, staticObj, staticMesh, -xp, height, -zp);
+                    AddDecorGrassThick(chunk, staticObj, staticMesh, -xp, height, -zp, random);
                     
                 }
                 
@@ -424,9 +470,9 @@ void ChunkManager::Decorate(Chunk& chunk) {
             // Trees
             if (decor.type == DECORATION_TREE) {
                 
-                if ((unsigned int)Random.Range(0, 100) < decor.density) {
+                if ((unsigned int)random.Range(0, 100) < decor.density) {
                     
-                    AddDecorTree(chunk, staticObj, staticMesh, -xp, height, -zp, Decoration::TreeOak);
+                    AddDecorTree(chunk, staticObj, staticMesh, -xp, height, -zp, Decoration::TreeOak, random);
                 }
                 
             }
@@ -434,7 +480,7 @@ void ChunkManager::Decorate(Chunk& chunk) {
             // Actor generation
             if (decor.type == DECORATION_ACTOR) {
                 
-                if ((unsigned int)Random.Range(0, 10000) < decor.density) {
+                if ((unsigned int)random.Range(0, 10000) < decor.density) {
                     
                     GameObject* actorObject = SpawnActor(from.x, 0, from.z);
                     
@@ -442,17 +488,17 @@ void ChunkManager::Decorate(Chunk& chunk) {
                     
                     DecodeGenome(decor, actor);
                     
-                    actor->SetAge( 1000 + Random.Range(0, 1000) );
+                    actor->SetAge( 1000 + random.Range(0, 1000) );
                     
-                    if (Random.Range(0, 100) > 95) {
+                    if (random.Range(0, 100) > 95) {
                         
-                        unsigned int numberOfChildren = Random.Range(0, 4);
+                        unsigned int numberOfChildren = random.Range(0, 4);
                         
                         for (unsigned int c=0; c < numberOfChildren; c++) {
                             
                             glm::vec3 actorPosition = from;
-                            actorPosition.x += Random.Range(0, 3) - Random.Range(0, 3);
-                            actorPosition.z += Random.Range(0, 3) - Random.Range(0, 3);
+                            actorPosition.x += random.Range(0, 3) - random.Range(0, 3);
+                            actorPosition.z += random.Range(0, 3) - random.Range(0, 3);
                             
                             GameObject* actorObject = SpawnActor(actorPosition.x, 0, actorPosition.z);
                             
@@ -460,7 +506,7 @@ void ChunkManager::Decorate(Chunk& chunk) {
                             
                             DecodeGenome(decor, actor);
                             
-                            actor->SetAge( 100 + Random.Range(0, 200) );
+                            actor->SetAge( 100 + random.Range(0, 200) );
                             
                         }
                         
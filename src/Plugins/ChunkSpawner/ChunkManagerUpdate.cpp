@@ -1,5 +1,7 @@
 #include <GameEngineFramework/Plugins/ChunkSpawner/ChunkManager.h>
 
+#include <algorithm>
+
 void ChunkManager::Update(void) {
     
     if (Engine.cameraController == nullptr || !world.doGenerateChunks)
@@ -22,6 +24,11 @@ void ChunkManager::Update(void) {
 
 void ChunkManager::GenerateChunks(const glm::vec3 &playerPosition) {
     
+    // Chunks are built on the job workers when there are any to run them
+    bool doQueueBuilds = doAsyncGeneration && (Jobs.GetNumberOfWorkers() > 0);
+    
+    mChunkBuildCandidates.clear();
+    
     for (mChunkCounterX = 0; mChunkCounterX <= renderDistance; mChunkCounterX++) {
         
         if (mChunkCounterX >= renderDistance) {
@@ -49,9 +56,9 @@ void ChunkManager::GenerateChunks(const glm::vec3 &playerPosition) {
             glm::vec2 playerPos(playerPosition.x, playerPosition.z);
             
             
-            if (IsChunkFound(chunkPos)) {
-                
-                Chunk* chunk = FindChunk(chunkPos.x, chunkPos.y);
+            Chunk* chunk = chunks.Find(chunkPos.x, chunkPos.y);
+            
+            if (chunk != nullptr) {
                 
                 // Check active fade in
                 if (!chunk->isActive) {
@@ -78,77 +85,215 @@ void ChunkManager::GenerateChunks(const glm::vec3 &playerPosition) {
             if (glm::distance(chunkPos, playerPos) > (renderDistance * (chunkSize / 2))) 
                 continue;
             
-            GenerateChunk(chunkPos);
+            if (!doQueueBuilds) {
+                
+                GenerateChunk(chunkPos);
+                
+                continue;
+            }
+            
+            if (IsChunkBuildQueued(chunkPos)) 
+                continue;
+            
+            mChunkBuildCandidates.push_back(chunkPos);
+        }
+    }
+    
+    if (doQueueBuilds) {
+        
+        // Queue the chunks nearest the player first
+        glm::vec2 playerPos(playerPosition.x, playerPosition.z);
+        
+        std::sort(mChunkBuildCandidates.begin(), mChunkBuildCandidates.end(), 
+                  [&playerPos](const glm::vec2& a, const glm::vec2& b) {
+                      return glm::distance(a, playerPos) < glm::distance(b, playerPos);
+                  });
+        
+        for (unsigned int i=0; i < mChunkBuildCandidates.size(); i++) {
+            
+            if (mChunkBuilds.size() >= generationJobLimit) 
+                break;
+            
+            QueueChunkBuild(mChunkBuildCandidates[i]);
         }
     }
+    
+    FinalizeChunkBuilds(playerPosition);
+    
+    return;
 }
 
-bool ChunkManager::IsChunkFound(const glm::vec2 &chunkPosition) {
-    for (const auto& chunkPtr : chunks) {
-        if (glm::vec3(chunkPtr.x, 0, chunkPtr.y) == glm::vec3(chunkPosition.x, 0, chunkPosition.y)) {
+void ChunkManager::QueueChunkBuild(const glm::vec2 &chunkPosition) {
+    
+    ChunkBuildJob* build = new ChunkBuildJob();
+    
+    build->data.x = chunkPosition.x;
+    build->data.y = chunkPosition.y;
+    
+    mChunkBuilds.push_back(build);
+    
+    ChunkGenerator generator = GetGenerator();
+    
+    Jobs.Submit([build, generator]() mutable {
+        generator.Build(build->data, build->data.x, build->data.y);
+    }, &build->counter);
+    
+    return;
+}
+
+bool ChunkManager::IsChunkBuildQueued(const glm::vec2 &chunkPosition) {
+    
+    for (unsigned int i=0; i < mChunkBuilds.size(); i++) {
+        
+        if (mChunkBuilds[i]->data.x == chunkPosition.x && 
+            mChunkBuilds[i]->data.y == chunkPosition.y) 
             return true;
-        }
     }
+    
     return false;
 }
 
-void ChunkManager::GenerateChunk(const glm::vec2 &chunkPosition) {
-    std::string filename = Int.ToString(chunkPosition.x) + "_" + Int.ToString(chunkPosition.y);
-    std::string chunkFilename = "worlds/" + world.name + "/chunks/" + filename;
-    std::string staticFilename = "worlds/" + world.name + "/static/" + filename;
+void ChunkManager::FinalizeChunkBuilds(const glm::vec3 &playerPosition) {
     
-    Chunk chunk = CreateChunk(chunkPosition.x, chunkPosition.y);
-    MeshRenderer* staticRenderer = chunk.staticObject->GetComponent<MeshRenderer>();
+    glm::vec2 playerPos(playerPosition.x, playerPosition.z);
     
-    if (Serializer.CheckExists(chunkFilename) || Serializer.CheckExists(staticFilename)) {
+    // Drop finished builds for chunks that have left the view range
+    for (unsigned int i=0; i < mChunkBuilds.size(); i++) {
         
-        LoadChunk(chunk);
+        ChunkBuildJob* build = mChunkBuilds[i];
         
-    } else {
+        if (!build->counter.IsComplete()) 
+            continue;
+        
+        if (glm::distance(glm::vec2(build->data.x, build->data.y), playerPos) <= (renderDistance * (chunkSize / 2))) 
+            continue;
         
-        chunk.seed = worldSeed + ((chunkPosition.x * 2) + (chunkPosition.y * 4) / 2);
+        mChunkBuilds.erase(mChunkBuilds.begin() + i);
         
-        Random.SetSeed(chunk.seed);
+        delete build;
         
-        Decorate(chunk);
+        i--;
     }
     
-    staticRenderer->mesh->Load();
-    chunks.push_back(chunk);
-}
-
-void ChunkManager::DestroyChunks(const glm::vec3 &playerPosition) {
+    Timer timer;
+    timer.Update();
     
-    unsigned int numberOfChunks = chunks.size();
-    
-    if (numberOfChunks > 0) {
-        unsigned int numberOfCycles = numberOfChunks / 3;
+    // At least one chunk is finished per frame regardless of the budget
+    while (mChunkBuilds.size() > 0) {
         
-        for (unsigned int c = 0; c < numberOfChunks; c++) {
+        // Find the nearest finished chunk
+        int nearestIndex = -1;
+        float nearestDistance = 0.0f;
+        
+        for (unsigned int i=0; i < mChunkBuilds.size(); i++) {
             
-            Chunk& chunk = chunks[mChunkIndex];
+            ChunkBuildJob* build = mChunkBuilds[i];
             
-            if (chunk.gameObject == nullptr) 
+            if (!build->counter.IsComplete()) 
                 continue;
             
-            glm::vec3 chunkPos(chunk.x, 0, chunk.y);
-            glm::vec3 playerPos(playerPosition.x, 0, playerPosition.z);
+            float distance = glm::distance(glm::vec2(build->data.x, build->data.y), playerPos);
             
-            if (glm::distance(chunkPos, playerPos) > (renderDistance * chunkSize) * 1.5f) {
-                
-                SaveChunk(chunk, true);
-                
-                DestroyChunk(chunk);
-                
-                chunks.erase(chunks.begin() + mChunkIndex);
+            if (nearestIndex == -1 || distance < nearestDistance) {
+                nearestIndex = i;
+                nearestDistance = distance;
             }
-            
-            mChunkIndex++;
-            if (mChunkIndex >= numberOfChunks) 
-                mChunkIndex = 0;
-            
+        }
+        
+        if (nearestIndex == -1) 
+            break;
+        
+        ChunkBuildJob* build = mChunkBuilds[nearestIndex];
+        
+        mChunkBuilds.erase(mChunkBuilds.begin() + nearestIndex);
+        
+        // The chunk may have been generated while it was building
+        if (!IsChunkFound(glm::vec2(build->data.x, build->data.y))) 
+            GenerateChunk(build->data);
+        
+        delete build;
+        
+        if (timer.GetCurrentDelta() >= generationBudget) 
+            break;
+    }
+    
+    return;
+}
+
+void ChunkManager::CancelChunkBuilds(void) {
+    
+    for (unsigned int i=0; i < mChunkBuilds.size(); i++) {
+        
+        Jobs.Wait( &mChunkBuilds[i]->counter );
+        
+        delete mChunkBuilds[i];
+    }
+    
+    mChunkBuilds.clear();
+    
+    return;
+}
+
+bool ChunkManager::IsChunkFound(const glm::vec2 &chunkPosition) {
+    return chunks.Find(chunkPosition.x, chunkPosition.y) != nullptr;
+}
+
+void ChunkManager::GenerateChunk(const glm::vec2 &chunkPosition) {
+    
+    ChunkBuildData data;
+    
+    ChunkGenerator generator = GetGenerator();
+    generator.Build(data, chunkPosition.x, chunkPosition.y);
+    
+    GenerateChunk(data);
+}
+
+void ChunkManager::GenerateChunk(ChunkBuildData& data) {
+    glm::vec2 chunkPosition(data.x, data.y);
+    
+    Chunk* chunk = chunks.Create(chunkPosition.x, chunkPosition.y);
+    *chunk = CreateChunk(data);
+    
+    MeshRenderer* staticRenderer = chunk->staticObject->GetComponent<MeshRenderer>();
+    
+    if (IsChunkSaved(chunkPosition)) {
+        
+        LoadChunk(*chunk);
+        
+    } else {
+        
+        chunk->seed = worldSeed + ((chunkPosition.x * 2) + (chunkPosition.y * 4) / 2);
+        
+        Decorate(*chunk);
+    }
+    
+    staticRenderer->mesh->Load();
+}
+
+void ChunkManager::DestroyChunks(const glm::vec3 &playerPosition) {
+    
+    glm::vec3 playerPos(playerPosition.x, 0, playerPosition.z);
+    
+    // Destroying a chunk moves the last chunk into its index
+    unsigned int index = 0;
+    
+    while (index < chunks.Size()) {
+        
+        Chunk* chunk = chunks[index];
+        
+        glm::vec3 chunkPos(chunk->x, 0, chunk->y);
+        
+        if ((chunk->gameObject == nullptr) || 
+            (glm::distance(chunkPos, playerPos) <= (renderDistance * chunkSize) * 1.5f)) {
+            index++;
             continue;
         }
+        
+        SaveChunk(*chunk, true);
+        
+        DestroyChunk(*chunk);
+        
+        chunks.Destroy(chunk);
     }
 }
 
@@ -225,30 +370,49 @@ void ChunkManager::HandleAutoBreeding(Actor* actorPtr, unsigned int numberOfActo
 void ChunkManager::AttemptBreeding(unsigned int numberOfActors) {
     for (unsigned int i = 0; i < 8; i++) {
         GameObject* actorObjectA = actors[Random.Range(0, numberOfActors)];
-        GameObject* actorObjectB = actors[Random.Range(0, numberOfActors)];
         
-        if (!actorObjectA->isActive || !actorObjectB->isActive || actorObjectA == actorObjectB) 
+        if (!actorObjectA->isActive) 
             continue;
         
         Actor* actorA = actorObjectA->GetComponent<Actor>();
-        Actor* actorB = actorObjectB->GetComponent<Actor>();
         
-        if (actorA->GetCoolDownBreeding() != 0 || actorB->GetCoolDownBreeding() != 0) 
+        if (actorA->GetCoolDownBreeding() != 0 || actorA->GetAge() < 1000) 
             continue;
         
         glm::vec3 posA = actorObjectA->GetPosition();
-        glm::vec3 posB = actorObjectB->GetPosition();
         
-        if (glm::distance(posA, posB) > 50.0f || actorA->GetAge() < 1000 || actorB->GetAge() < 1000) 
-            continue;
+        // Pair with a partner from the nearby actors
+        mNearbyActors.clear();
+        unsigned int numberOfNearby = AI.GetActorsInRadius(posA, 50.0f, mNearbyActors);
         
-        actorA->SetBreedWithActor(actorB);
-        actorB->SetBreedWithActor(actorA);
+        if (numberOfNearby < 2) 
+            continue;
         
-        actorA->SetCoolDownBreeding(200);
-        actorB->SetCoolDownBreeding(200);
+        unsigned int offset = Random.Range(0, numberOfNearby);
         
-        break;
+        for (unsigned int n = 0; n < numberOfNearby; n++) {
+            Actor* actorB = mNearbyActors[(offset + n) % numberOfNearby];
+            GameObject* actorObjectB = (GameObject*)actorB->GetUserDataB();
+            
+            if (actorObjectB == nullptr || actorObjectB == actorObjectA || !actorObjectB->isActive) 
+                continue;
+            
+            if (actorB->GetCoolDownBreeding() != 0 || actorB->GetAge() < 1000) 
+                continue;
+            
+            glm::vec3 posB = actorObjectB->GetPosition();
+            
+            if (glm::distance(posA, posB) > 50.0f) 
+                continue;
+            
+            actorA->SetBreedWithActor(actorB);
+            actorB->SetBreedWithActor(actorA);
+            
+            actorA->SetCoolDownBreeding(200);
+            actorB->SetCoolDownBreeding(200);
+            
+            return;
+        }
     }
 }
 
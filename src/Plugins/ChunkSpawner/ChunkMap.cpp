@@ -0,0 +1,159 @@
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkMap.h>
+
+// Initial number of hash table slots (Must be a power of two)
+#define  CHUNK_MAP_INITIAL_CAPACITY  256
+
+
+ChunkMap::ChunkMap() :
+    mChunks(256, 1),
+    mMask(CHUNK_MAP_INITIAL_CAPACITY - 1),
+    mCount(0)
+{
+    Entry empty;
+    empty.x = 0;
+    empty.z = 0;
+    empty.chunk = nullptr;
+    
+    mTable.resize(CHUNK_MAP_INITIAL_CAPACITY, empty);
+}
+
+Chunk* ChunkMap::Create(int x, int z) {
+    
+    // Keep the table at most half full
+    if ((mCount + 1) * 2 > mTable.size())
+        Grow();
+    
+    unsigned int slot = Probe(x, z);
+    
+    if (mTable[slot].chunk != nullptr)
+        return mTable[slot].chunk;
+    
+    Chunk* chunk = mChunks.Create();
+    chunk->x = x;
+    chunk->y = z;
+    
+    mTable[slot].x = x;
+    mTable[slot].z = z;
+    mTable[slot].chunk = chunk;
+    
+    mCount++;
+    
+    return chunk;
+}
+
+Chunk* ChunkMap::Find(int x, int z) {
+    return mTable[ Probe(x, z) ].chunk;
+}
+
+bool ChunkMap::Destroy(Chunk* chunk) {
+    
+    if (chunk == nullptr)
+        return false;
+    
+    unsigned int slot = Probe((int)chunk->x, (int)chunk->y);
+    
+    if (mTable[slot].chunk != chunk)
+        return false;
+    
+    // Shift the following entries back to close the gap, leaving
+    // any entry that already sits at or after its home slot
+    unsigned int hole = slot;
+    unsigned int next = slot;
+    
+    while (true) {
+        
+        next = (next + 1) & mMask;
+        
+        if (mTable[next].chunk == nullptr)
+            break;
+        
+        unsigned int home = Hash(mTable[next].x, mTable[next].z);
+        
+        bool isBetween = (hole <= next) ? ((hole < home) & (home <= next)) : ((hole < home) | (home <= next));
+        
+        if (isBetween)
+            continue;
+        
+        mTable[hole] = mTable[next];
+        hole = next;
+    }
+    
+    mTable[hole].chunk = nullptr;
+    mCount--;
+    
+    mChunks.Destroy(chunk);
+    
+    return true;
+}
+
+void ChunkMap::Clear(void) {
+    
+    for (unsigned int i=0; i < mTable.size(); i++)
+        mTable[i].chunk = nullptr;
+    
+    while (mChunks.Size() > 0)
+        mChunks.Destroy( mChunks[0] );
+    
+    mCount = 0;
+    
+    return;
+}
+
+unsigned int ChunkMap::Size(void) {
+    return mCount;
+}
+
+Chunk* ChunkMap::operator[] (unsigned int const index) {
+    return mChunks[index];
+}
+
+unsigned int ChunkMap::Hash(int x, int z) {
+    
+    uint64_t key = ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)z;
+    
+    // 64 bit finalizer mix
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    
+    return (unsigned int)key & mMask;
+}
+
+unsigned int ChunkMap::Probe(int x, int z) {
+    
+    unsigned int slot = Hash(x, z);
+    
+    while (mTable[slot].chunk != nullptr) {
+        
+        if ((mTable[slot].x == x) & (mTable[slot].z == z))
+            return slot;
+        
+        slot = (slot + 1) & mMask;
+    }
+    
+    return slot;
+}
+
+void ChunkMap::Grow(void) {
+    
+    std::vector<Entry> oldTable;
+    oldTable.swap(mTable);
+    
+    Entry empty;
+    empty.x = 0;
+    empty.z = 0;
+    empty.chunk = nullptr;
+    
+    mTable.resize(oldTable.size() * 2, empty);
+    mMask = mTable.size() - 1;
+    
+    for (unsigned int i=0; i < oldTable.size(); i++) {
+        
+        if (oldTable[i].chunk == nullptr)
+            continue;
+        
+        mTable[ Probe(oldTable[i].x, oldTable[i].z) ] = oldTable[i];
+    }
+    
+    return;
+}
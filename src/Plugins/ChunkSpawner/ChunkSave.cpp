@@ -1,31 +1,43 @@
 #include <GameEngineFramework/Plugins/ChunkSpawner/ChunkManager.h>
 
+#include <cfloat>
+
 bool ChunkManager::SaveChunk(Chunk& chunk, bool doClearActors) {
     
-    std::string chunkPosStr = Float.ToString( chunk.x ) + "_" + Float.ToString( chunk.y );
-    std::string worldChunks = "worlds/" + world.name + "/chunks/";
-    std::string worldStatic = "worlds/" + world.name + "/static/";
+    int cellX;
+    int cellZ;
+    
+    GetChunkCell(chunk.x, chunk.y, cellX, cellZ);
+    
+    ChunkRecord record;
     
-    std::string chunkName = worldChunks + chunkPosStr;
-    std::string staticName = worldStatic + chunkPosStr;
     
-    std::string buffer = "";
+    // Save actors within chunk range. Actors placed since the last exchange are
+    // merged into the query where they stand now. Actors walking under physics
+    // may have left their grid position, so the query reaches one chunk further.
     
+    glm::vec3 chunkPos(chunk.x, 0, chunk.y);
     
-    // Save actors within chunk range
+    float chunkSz = chunkSize * 0.5f;
+    float queryMargin = chunkSize;
     
-    unsigned int numberOfActors = actors.size();
+    glm::vec3 queryMin(chunkPos.x - chunkSz - queryMargin, -FLT_MAX, chunkPos.z - chunkSz - queryMargin);
+    glm::vec3 queryMax(chunkPos.x + chunkSz + queryMargin,  FLT_MAX, chunkPos.z + chunkSz + queryMargin);
+    
+    mNearbyActors.clear();
+    
+    unsigned int numberOfActors = AI.GetActorsInBounds(queryMin, queryMax, mNearbyActors);
     if (numberOfActors > 0) {
         for (unsigned int a=0; a < numberOfActors; a++) {
             
-            GameObject* actorObject = actors[a];
-            
-            glm::vec3 actorPos = actorObject->GetPosition();
-            glm::vec3 chunkPos(chunk.x, 0, chunk.y);
+            Actor* actorPtr = mNearbyActors[a];
             
-            float chunkSz = chunkSize * 0.5f;
+            // Only actors spawned by the chunk manager
+            GameObject* actorObject = (GameObject*)actorPtr->GetUserDataB();
+            if (actorObject == nullptr) 
+                continue;
             
-            Actor* actorPtr = actorObject->GetComponent<Actor>();
+            glm::vec3 actorPos = actorObject->GetPosition();
             
             // Check actor within chunk bounds
             if (((actorPos.x < (chunkPos.x - chunkSz)) | actorPos.x > (chunkPos.x + chunkSz)) | 
@@ -44,15 +56,14 @@ bool ChunkManager::SaveChunk(Chunk& chunk, bool doClearActors) {
             if (!actorPtr->GetActive()) 
                 continue;
             
-            std::string actorPosStr = Float.ToString(actorPos.x) + "~" + 
-                                      Float.ToString(actorPos.y) + "~" + 
-                                      Float.ToString(actorPos.z) + "~";
+            ChunkActorRecord actorRecord;
             
-            std::string actorAge = IntLong.ToString( actorPtr->GetAge() ) + "~";
+            actorRecord.position = actorPos;
+            actorRecord.age      = actorPtr->GetAge();
             
-            std::string actorGenome = AI.genomes.ExtractGenome(actorPtr);
+            AI.genomes.EncodeGenome(actorPtr, actorRecord.genome);
             
-            buffer += actorPosStr + actorAge + actorGenome + '\n';
+            record.actors.push_back(actorRecord);
             
             if (!doClearActors) 
                 continue;
@@ -64,11 +75,6 @@ bool ChunkManager::SaveChunk(Chunk& chunk, bool doClearActors) {
             continue;
         }
         
-        unsigned int bufferSz = buffer.size();
-        
-        if (bufferSz != 0) 
-            Serializer.Serialize(chunkName, (void*)buffer.data(), bufferSz);
-        
     }
     
     
@@ -77,29 +83,39 @@ bool ChunkManager::SaveChunk(Chunk& chunk, bool doClearActors) {
     
     unsigned int numberOfStatics = chunk.statics.size();
     
-    StaticElement staticElements[numberOfStatics];
+    record.statics.resize(numberOfStatics);
     
-    if (numberOfStatics > 0) {
+    for (unsigned int s=0; s < numberOfStatics; s++) {
         
-        for (unsigned int s=0; s < numberOfStatics; s++) {
-            
-            staticElements[s].position = glm::vec3(chunk.statics[s].x, 
-                                                   chunk.statics[s].y, 
-                                                   chunk.statics[s].z);
-            
-            staticElements[s].color = glm::vec3(chunk.statics[s].r, 
-                                                chunk.statics[s].g, 
-                                                chunk.statics[s].b);
-            
-            staticElements[s].type = chunk.statics[s].type;
-            
-            continue;
-        }
+        record.statics[s].position = glm::vec3(chunk.statics[s].x, 
+                                               chunk.statics[s].y, 
+                                               chunk.statics[s].z);
+        
+        record.statics[s].color = glm::vec3(chunk.statics[s].r, 
+                                            chunk.statics[s].g, 
+                                            chunk.statics[s].b);
         
-        Serializer.Serialize(staticName, (void*)staticElements, sizeof(StaticElement) * numberOfStatics);
+        record.statics[s].type = chunk.statics[s].type;
         
+        continue;
     }
     
     
-    return 0;
+    // Write the chunk record into its region
+    
+    bool isEmpty = (record.actors.size() == 0) & (numberOfStatics == 0);
+    
+    RegionFile* region = GetRegion(cellX, cellZ, !isEmpty);
+    
+    if (region == nullptr) 
+        return 0;
+    
+    // Empty chunks only overwrite an earlier record
+    if ((isEmpty) & (!region->Contains(cellX, cellZ))) 
+        return 0;
+    
+    std::vector<uint8_t> buffer;
+    record.Encode(buffer);
+    
+    return region->Write(cellX, cellZ, buffer, doCompressRegions);
 }
@@ -0,0 +1,604 @@
+#include <GameEngineFramework/Plugins/ChunkSpawner/RegionFile.h>
+
+#include <cstring>
+
+// Region file layout
+//
+//   RegionHeader   magic "SSRG", version, grid size
+//   RegionEntry    one per chunk cell in the region grid
+//   records        chunk records at the offsets given by the table
+//
+// Records are rewritten in place while they fit their reserved space
+// and are otherwise appended to the end of the file.
+
+static const char regionMagic[4] = {'S', 'S', 'R', 'G'};
+
+// Space reserved for a record is rounded up so it can grow a little between saves
+static const uint32_t regionRecordAlignment = 256;
+
+
+static void AppendBytes(std::vector<uint8_t>& buffer, const void* data, unsigned int size) {
+    
+    const uint8_t* bytes = (const uint8_t*)data;
+    
+    buffer.insert(buffer.end(), bytes, bytes + size);
+    
+    return;
+}
+
+static bool ReadBytes(const uint8_t* buffer, unsigned int size, unsigned int& cursor, void* data, unsigned int length) {
+    
+    if (length > size - cursor)
+        return false;
+    
+    memcpy(data, buffer + cursor, length);
+    
+    cursor += length;
+    
+    return true;
+}
+
+
+ChunkActorRecord::ChunkActorRecord() :
+    position(0.0f),
+    age(0)
+{
+}
+
+ChunkStaticRecord::ChunkStaticRecord() :
+    position(0.0f),
+    color(0.0f),
+    type(0)
+{
+}
+
+
+void ChunkRecord::Encode(std::vector<uint8_t>& buffer) {
+    
+    buffer.clear();
+    
+    uint32_t numberOfActors  = actors.size();
+    uint32_t numberOfStatics = statics.size();
+    
+    AppendBytes(buffer, &numberOfActors, sizeof(uint32_t));
+    
+    for (unsigned int a=0; a < numberOfActors; a++) {
+        
+        ChunkActorRecord& actor = actors[a];
+        
+        uint64_t age = actor.age;
+        uint32_t genomeLength = actor.genome.size();
+        
+        AppendBytes(buffer, &actor.position.x, sizeof(float) * 3);
+        AppendBytes(buffer, &age, sizeof(uint64_t));
+        AppendBytes(buffer, &genomeLength, sizeof(uint32_t));
+        AppendBytes(buffer, actor.genome.data(), genomeLength);
+        
+        continue;
+    }
+    
+    AppendBytes(buffer, &numberOfStatics, sizeof(uint32_t));
+    
+    for (unsigned int s=0; s < numberOfStatics; s++) {
+        
+        ChunkStaticRecord& staticRecord = statics[s];
+        
+        AppendBytes(buffer, &staticRecord.position.x, sizeof(float) * 3);
+        AppendBytes(buffer, &staticRecord.color.x, sizeof(float) * 3);
+        AppendBytes(buffer, &staticRecord.type, sizeof(uint8_t));
+        
+        continue;
+    }
+    
+    return;
+}
+
+bool ChunkRecord::Decode(const uint8_t* buffer, unsigned int size) {
+    
+    actors.clear();
+    statics.clear();
+    
+    unsigned int cursor = 0;
+    
+    uint32_t numberOfActors;
+    
+    if (!ReadBytes(buffer, size, cursor, &numberOfActors, sizeof(uint32_t)))
+        return false;
+    
+    for (unsigned int a=0; a < numberOfActors; a++) {
+        
+        ChunkActorRecord actor;
+        
+        uint64_t age;
+        uint32_t genomeLength;
+        
+        if (!ReadBytes(buffer, size, cursor, &actor.position.x, sizeof(float) * 3))
+            return false;
+        
+        if (!ReadBytes(buffer, size, cursor, &age, sizeof(uint64_t)))
+            return false;
+        
+        if (!ReadBytes(buffer, size, cursor, &genomeLength, sizeof(uint32_t)))
+            return false;
+        
+        if (genomeLength > size - cursor)
+            return false;
+        
+        actor.age = age;
+        actor.genome.assign((const char*)buffer + cursor, genomeLength);
+        
+        cursor += genomeLength;
+        
+        actors.push_back(actor);
+        
+        continue;
+    }
+    
+    uint32_t numberOfStatics;
+    
+    if (!ReadBytes(buffer, size, cursor, &numberOfStatics, sizeof(uint32_t)))
+        return false;
+    
+    statics.resize(numberOfStatics);
+    
+    for (unsigned int s=0; s < numberOfStatics; s++) {
+        
+        ChunkStaticRecord& staticRecord = statics[s];
+        
+        if (!ReadBytes(buffer, size, cursor, &staticRecord.position.x, sizeof(float) * 3))
+            return false;
+        
+        if (!ReadBytes(buffer, size, cursor, &staticRecord.color.x, sizeof(float) * 3))
+            return false;
+        
+        if (!ReadBytes(buffer, size, cursor, &staticRecord.type, sizeof(uint8_t)))
+            return false;
+        
+        continue;
+    }
+    
+    return cursor == size;
+}
+
+
+
+RegionFile::RegionFile() :
+    mEndOfFile(0),
+    mBytesWritten(0)
+{
+    memset(mTable, 0, sizeof(mTable));
+}
+
+RegionFile::~RegionFile() {
+    
+    Close();
+}
+
+bool RegionFile::Open(std::string filename) {
+    
+    Close();
+    
+    mFilename = filename;
+    mBytesWritten = 0;
+    
+    memset(mTable, 0, sizeof(mTable));
+    
+    mFile.open(filename.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    
+    // Create a new region with an empty table
+    if (!mFile.is_open()) {
+        
+        std::ofstream create(filename.c_str(), std::ios::out | std::ios::binary);
+        
+        if (!create.is_open())
+            return false;
+        
+        RegionHeader header;
+        memcpy(header.magic, regionMagic, sizeof(regionMagic));
+        header.version  = REGION_VERSION;
+        header.gridSize = REGION_GRID_SIZE;
+        header.reserved = 0;
+        
+        create.write((const char*)&header, sizeof(RegionHeader));
+        create.write((const char*)mTable, sizeof(mTable));
+        create.close();
+        
+        mBytesWritten += sizeof(RegionHeader) + sizeof(mTable);
+        
+        mFile.open(filename.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        
+        if (!mFile.is_open())
+            return false;
+            
+    }
+    
+    RegionHeader header;
+    
+    mFile.seekg(0, std::ios::beg);
+    mFile.read((char*)&header, sizeof(RegionHeader));
+    mFile.read((char*)mTable, sizeof(mTable));
+    
+    if ((!mFile) |
+        (memcmp(header.magic, regionMagic, sizeof(regionMagic)) != 0) |
+        (header.version != REGION_VERSION) |
+        (header.gridSize != REGION_GRID_SIZE)) {
+        
+        memset(mTable, 0, sizeof(mTable));
+        
+        mFile.close();
+        
+        return false;
+    }
+    
+    // Append after the reserved capacity of the last record, which may
+    // extend past the bytes actually written
+    mFile.seekg(0, std::ios::end);
+    mEndOfFile = (uint32_t)mFile.tellg();
+    
+    for (unsigned int i=0; i < REGION_GRID_SIZE * REGION_GRID_SIZE; i++) {
+        
+        if (mTable[i].offset == 0)
+            continue;
+        
+        uint32_t recordEnd = mTable[i].offset + mTable[i].capacity;
+        
+        if (recordEnd > mEndOfFile)
+            mEndOfFile = recordEnd;
+    }
+    
+    return true;
+}
+
+void RegionFile::Close(void) {
+    
+    if (!mFile.is_open())
+        return;
+    
+    mFile.flush();
+    mFile.close();
+    mFile.clear();
+    
+    return;
+}
+
+bool RegionFile::IsOpen(void) {
+    
+    return mFile.is_open();
+}
+
+bool RegionFile::Write(int cellX, int cellZ, const std::vector<uint8_t>& data, bool doCompress) {
+    
+    if (!mFile.is_open())
+        return false;
+    
+    unsigned int slot = GetSlot(cellX, cellZ);
+    RegionEntry& entry = mTable[slot];
+    
+    const uint8_t* payload = data.data();
+    uint32_t size  = data.size();
+    uint32_t flags = 0;
+    
+    // Keep the compressed form only when it is smaller
+    if ((doCompress) & (size > 0)) {
+        
+        unsigned int compressedSize = RegionCompress(data.data(), size, mCompressBuffer);
+        
+        if (compressedSize < size) {
+            
+            payload = mCompressBuffer.data();
+            size    = compressedSize;
+            flags  |= REGION_FLAG_COMPRESSED;
+        }
+        
+    }
+    
+    // Move the record to the end of the file if it no longer fits
+    if ((entry.offset == 0) | (size > entry.capacity)) {
+        
+        uint32_t capacity = (size + regionRecordAlignment) & ~(regionRecordAlignment - 1);
+        
+        entry.offset   = mEndOfFile;
+        entry.capacity = capacity;
+        
+        mEndOfFile += capacity;
+    }
+    
+    entry.cellX   = cellX;
+    entry.cellZ   = cellZ;
+    entry.size    = size;
+    entry.rawSize = data.size();
+    entry.flags   = flags;
+    
+    mFile.seekp(entry.offset, std::ios::beg);
+    mFile.write((const char*)payload, size);
+    
+    mBytesWritten += size;
+    
+    return WriteEntry(slot);
+}
+
+bool RegionFile::Read(int cellX, int cellZ, std::vector<uint8_t>& data) {
+    
+    if (!Contains(cellX, cellZ))
+        return false;
+    
+    RegionEntry& entry = mTable[ GetSlot(cellX, cellZ) ];
+    
+    data.resize(entry.rawSize);
+    
+    mFile.seekg(entry.offset, std::ios::beg);
+    
+    if ((entry.flags & REGION_FLAG_COMPRESSED) == 0) {
+        
+        mFile.read((char*)data.data(), entry.size);
+        
+        return !mFile.fail();
+    }
+    
+    mCompressBuffer.resize(entry.size);
+    
+    mFile.read((char*)mCompressBuffer.data(), entry.size);
+    
+    if (!mFile)
+        return false;
+    
+    return RegionDecompress(mCompressBuffer.data(), entry.size, data.data(), entry.rawSize);
+}
+
+bool RegionFile::Contains(int cellX, int cellZ) {
+    
+    if (!mFile.is_open())
+        return false;
+    
+    RegionEntry& entry = mTable[ GetSlot(cellX, cellZ) ];
+    
+    return (entry.offset != 0) & (entry.cellX == cellX) & (entry.cellZ == cellZ);
+}
+
+unsigned int RegionFile::GetBytesWritten(void) {
+    
+    return mBytesWritten;
+}
+
+void RegionFile::GetRegionCoordinates(int cellX, int cellZ, int& regionX, int& regionZ) {
+    
+    // Round toward negative infinity so negative cells land in their own regions
+    regionX = (cellX >= 0) ? cellX / REGION_GRID_SIZE : -((-cellX - 1) / REGION_GRID_SIZE) - 1;
+    regionZ = (cellZ >= 0) ? cellZ / REGION_GRID_SIZE : -((-cellZ - 1) / REGION_GRID_SIZE) - 1;
+    
+    return;
+}
+
+unsigned int RegionFile::GetSlot(int cellX, int cellZ) {
+    
+    int regionX;
+    int regionZ;
+    
+    GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+    
+    unsigned int localX = cellX - (regionX * REGION_GRID_SIZE);
+    unsigned int localZ = cellZ - (regionZ * REGION_GRID_SIZE);
+    
+    return (localX * REGION_GRID_SIZE) + localZ;
+}
+
+bool RegionFile::WriteEntry(unsigned int slot) {
+    
+    mFile.seekp(sizeof(RegionHeader) + (slot * sizeof(RegionEntry)), std::ios::beg);
+    mFile.write((const char*)&mTable[slot], sizeof(RegionEntry));
+    mFile.flush();
+    
+    mBytesWritten += sizeof(RegionEntry);
+    
+    return !mFile.fail();
+}
+
+
+
+//
+// LZ4 style block compression
+//
+// The stream is a series of sequences. Each sequence starts with a token
+// holding the literal length in the high nibble and the match length minus
+// four in the low nibble. A nibble of fifteen is extended by following bytes
+// until a byte below 255. The literals follow, then a two byte match offset.
+// The final sequence carries only literals.
+
+static const unsigned int regionHashBits     = 12;
+static const unsigned int regionMinMatch     = 4;
+static const unsigned int regionLastLiterals = 5;
+static const unsigned int regionMatchLimit   = 12;
+static const unsigned int regionMaxOffset    = 65535;
+
+static inline uint32_t ReadWord(const uint8_t* source) {
+    
+    uint32_t value;
+    memcpy(&value, source, sizeof(uint32_t));
+    
+    return value;
+}
+
+static inline void WriteLength(std::vector<uint8_t>& destination, unsigned int length) {
+    
+    while (length >= 255) {
+        
+        destination.push_back(255);
+        length -= 255;
+    }
+    
+    destination.push_back((uint8_t)length);
+    
+    return;
+}
+
+static void WriteSequence(std::vector<uint8_t>& destination, const uint8_t* literals, unsigned int literalLength, unsigned int offset, unsigned int matchLength) {
+    
+    unsigned int matchCode = matchLength - regionMinMatch;
+    
+    uint8_t token = (uint8_t)(((literalLength < 15) ? literalLength : 15) << 4);
+    
+    if (offset != 0)
+        token |= (uint8_t)((matchCode < 15) ? matchCode : 15);
+    
+    destination.push_back(token);
+    
+    if (literalLength >= 15)
+        WriteLength(destination, literalLength - 15);
+    
+    destination.insert(destination.end(), literals, literals + literalLength);
+    
+    // Final sequence has no match
+    if (offset == 0)
+        return;
+    
+    destination.push_back((uint8_t)(offset & 0xff));
+    destination.push_back((uint8_t)(offset >> 8));
+    
+    if (matchCode >= 15)
+        WriteLength(destination, matchCode - 15);
+    
+    return;
+}
+
+unsigned int RegionCompress(const uint8_t* source, unsigned int size, std::vector<uint8_t>& destination) {
+    
+    destination.clear();
+    destination.reserve(size + (size / 255) + 16);
+    
+    unsigned int anchor = 0;
+    unsigned int cursor = 0;
+    
+    if (size > regionMatchLimit) {
+        
+        int hashTable[1 << regionHashBits];
+        
+        for (unsigned int i=0; i < (1u << regionHashBits); i++)
+            hashTable[i] = -1;
+        
+        unsigned int limit    = size - regionMatchLimit;
+        unsigned int matchEnd = size - regionLastLiterals;
+        
+        while (cursor < limit) {
+            
+            uint32_t sequence = ReadWord(source + cursor);
+            uint32_t hash = (sequence * 2654435761u) >> (32 - regionHashBits);
+            
+            int reference = hashTable[hash];
+            hashTable[hash] = cursor;
+            
+            if ((reference < 0) ||
+                (cursor - reference > regionMaxOffset) ||
+                (ReadWord(source + reference) != sequence)) {
+                
+                cursor++;
+                
+                continue;
+            }
+            
+            unsigned int matchLength = regionMinMatch;
+            
+            while ((cursor + matchLength < matchEnd) &&
+                   (source[reference + matchLength] == source[cursor + matchLength]))
+                matchLength++;
+            
+            WriteSequence(destination, source + anchor, cursor - anchor, cursor - reference, matchLength);
+            
+            cursor += matchLength;
+            anchor  = cursor;
+            
+            continue;
+        }
+        
+    }
+    
+    WriteSequence(destination, source + anchor, size - anchor, 0, regionMinMatch);
+    
+    return destination.size();
+}
+
+bool RegionDecompress(const uint8_t* source, unsigned int size, uint8_t* destination, unsigned int rawSize) {
+    
+    unsigned int cursor = 0;
+    unsigned int output = 0;
+    
+    while (cursor < size) {
+        
+        uint8_t token = source[cursor++];
+        
+        // Literals
+        unsigned int literalLength = token >> 4;
+        
+        if (literalLength == 15) {
+            
+            uint8_t extra;
+            
+            do {
+                
+                if (cursor >= size)
+                    return false;
+                
+                extra = source[cursor++];
+                literalLength += extra;
+                
+            } while (extra == 255);
+            
+        }
+        
+        if ((literalLength > size - cursor) || (literalLength > rawSize - output))
+            return false;
+        
+        memcpy(destination + output, source + cursor, literalLength);
+        
+        cursor += literalLength;
+        output += literalLength;
+        
+        // Final sequence
+        if (cursor == size)
+            break;
+        
+        // Match
+        if (size - cursor < 2)
+            return false;
+        
+        unsigned int offset = source[cursor] | (source[cursor + 1] << 8);
+        cursor += 2;
+        
+        if ((offset == 0) || (offset > output))
+            return false;
+        
+        unsigned int matchLength = token & 0x0f;
+        
+        if (matchLength == 15) {
+            
+            uint8_t extra;
+            
+            do {
+                
+                if (cursor >= size)
+                    return false;
+                
+                extra = source[cursor++];
+                matchLength += extra;
+                
+            } while (extra == 255);
+            
+        }
+        
+        matchLength += regionMinMatch;
+        
+        if (matchLength > rawSize - output)
+            return false;
+        
+        // Matches may overlap their own output so copy forward byte by byte
+        const uint8_t* match = destination + output - offset;
+        
+        for (unsigned int i=0; i < matchLength; i++)
+            destination[output + i] = match[i];
+        
+        output += matchLength;
+        
+        continue;
+    }
+    
+    return output == rawSize;
+}
@@ -26,6 +26,11 @@ bool ChunkManager::LoadWorld(void) {
     
     isInitiated = true;
     
+    // Move chunks saved as separate files into region files
+    if ((fs.DirectoryGetList(worldName + "/chunks").size() > 0) | 
+        (fs.DirectoryGetList(worldName + "/static").size() > 0)) 
+        ConvertWorldToRegions(world.name);
+    
     std::string worldDataBuffer;
     worldDataBuffer.resize(worldFileSize + 1);
     
@@ -0,0 +1,248 @@
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkManager.h>
+
+#include <cmath>
+#include <map>
+
+// Maximum number of region files kept open at once
+static const unsigned int regionCacheSize = 16;
+
+
+void ChunkManager::GetChunkCell(float x, float z, int& cellX, int& cellZ) {
+    
+    cellX = (int)std::floor((x / chunkSize) + 0.5f);
+    cellZ = (int)std::floor((z / chunkSize) + 0.5f);
+    
+    return;
+}
+
+RegionFile* ChunkManager::GetRegion(int cellX, int cellZ, bool doCreate) {
+    
+    int regionX;
+    int regionZ;
+    
+    RegionFile::GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+    
+    unsigned int numberOfRegions = mRegions.size();
+    
+    for (unsigned int r=0; r < numberOfRegions; r++) {
+        
+        if ((mRegions[r].x != regionX) | (mRegions[r].z != regionZ))
+            continue;
+        
+        return mRegions[r].file;
+    }
+    
+    std::string regionName = "worlds/" + world.name + "/regions/" + Int.ToString(regionX) + "_" + Int.ToString(regionZ);
+    
+    if ((!doCreate) & (!Serializer.CheckExists(regionName)))
+        return nullptr;
+    
+    RegionFile* region = new RegionFile();
+    
+    if (!region->Open(regionName)) {
+        
+        delete region;
+        
+        return nullptr;
+    }
+    
+    // Close the oldest region
+    if (mRegions.size() >= regionCacheSize) {
+        
+        delete mRegions[0].file;
+        
+        mRegions.erase(mRegions.begin());
+    }
+    
+    OpenRegion openRegion;
+    openRegion.x = regionX;
+    openRegion.z = regionZ;
+    openRegion.file = region;
+    
+    mRegions.push_back(openRegion);
+    
+    return region;
+}
+
+void ChunkManager::CloseRegions(void) {
+    
+    for (unsigned int r=0; r < mRegions.size(); r++)
+        delete mRegions[r].file;
+    
+    mRegions.clear();
+    
+    return;
+}
+
+bool ChunkManager::IsChunkSaved(const glm::vec2 &chunkPosition) {
+    
+    int cellX;
+    int cellZ;
+    
+    GetChunkCell(chunkPosition.x, chunkPosition.y, cellX, cellZ);
+    
+    RegionFile* region = GetRegion(cellX, cellZ, false);
+    
+    if (region == nullptr)
+        return false;
+    
+    return region->Contains(cellX, cellZ);
+}
+
+
+bool ChunkManager::ConvertWorldToRegions(std::string worldname) {
+    
+    if (worldname == "")
+        return false;
+    
+    std::string worldPath   = "worlds/" + worldname;
+    std::string worldChunks = worldPath + "/chunks";
+    std::string worldStatic = worldPath + "/static";
+    std::string worldRegions = worldPath + "/regions";
+    
+    if (!fs.DirectoryExists(worldPath))
+        return false;
+    
+    if (!fs.DirectoryExists(worldRegions))
+        fs.DirectoryCreate(worldRegions);
+    
+    // Regions are written through their own handles below
+    CloseRegions();
+    
+    // Gather the legacy chunk files by name
+    
+    std::vector<std::string> chunkList  = fs.DirectoryGetList(worldChunks);
+    std::vector<std::string> staticList = fs.DirectoryGetList(worldStatic);
+    
+    std::vector<std::string> nameList = chunkList;
+    nameList.insert(nameList.end(), staticList.begin(), staticList.end());
+    
+    std::map<std::string, ChunkRecord> records;
+    
+    for (unsigned int i=0; i < nameList.size(); i++) {
+        
+        std::string chunkName  = worldChunks + "/" + nameList[i];
+        std::string staticName = worldStatic + "/" + nameList[i];
+        
+        if (records.find(nameList[i]) != records.end())
+            continue;
+        
+        ChunkRecord& record = records[nameList[i]];
+        
+        // Actors
+        
+        unsigned int fileSize = Serializer.GetFileSize(chunkName);
+        
+        if (fileSize != 0) {
+            
+            std::string dataBuffer;
+            dataBuffer.resize(fileSize);
+            
+            Serializer.Deserialize(chunkName, (void*)dataBuffer.data(), fileSize);
+            
+            std::vector<std::string> bufferArray = String.Explode(dataBuffer, '\n');
+            
+            for (unsigned int l=0; l < bufferArray.size(); l++) {
+                
+                std::vector<std::string> lineArray = String.Explode(bufferArray[l], '~');
+                
+                if (lineArray.size() < 5)
+                    continue;
+                
+                ChunkActorRecord actor;
+                
+                actor.position.x = String.ToFloat( lineArray[0] );
+                actor.position.y = String.ToFloat( lineArray[1] );
+                actor.position.z = String.ToFloat( lineArray[2] );
+                
+                actor.age = String.ToLongUint( lineArray[3] );
+                
+                actor.genome = lineArray[4];
+                
+                record.actors.push_back(actor);
+                
+                continue;
+            }
+            
+        }
+        
+        // Static objects
+        
+        fileSize = Serializer.GetFileSize(staticName);
+        
+        unsigned int numberOfStaticElements = fileSize / sizeof(StaticElement);
+        
+        if (numberOfStaticElements != 0) {
+            
+            std::vector<StaticElement> staticElements(numberOfStaticElements);
+            
+            Serializer.Deserialize(staticName, (void*)staticElements.data(), numberOfStaticElements * sizeof(StaticElement));
+            
+            record.statics.resize(numberOfStaticElements);
+            
+            for (unsigned int s=0; s < numberOfStaticElements; s++) {
+                
+                record.statics[s].position = staticElements[s].position;
+                record.statics[s].color    = staticElements[s].color;
+                record.statics[s].type     = staticElements[s].type;
+                
+                continue;
+            }
+            
+        }
+        
+        continue;
+    }
+    
+    // Write the records into their regions
+    
+    std::map<std::pair<int, int>, RegionFile*> regions;
+    std::vector<uint8_t> buffer;
+    
+    bool isConverted = true;
+    
+    for (std::map<std::string, ChunkRecord>::iterator it = records.begin(); it != records.end(); ++it) {
+        
+        std::vector<std::string> position = String.Explode(it->first, '_');
+        
+        if (position.size() < 2)
+            continue;
+        
+        int cellX;
+        int cellZ;
+        
+        GetChunkCell(String.ToFloat(position[0]), String.ToFloat(position[1]), cellX, cellZ);
+        
+        int regionX;
+        int regionZ;
+        
+        RegionFile::GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+        
+        RegionFile*& region = regions[ std::make_pair(regionX, regionZ) ];
+        
+        if (region == nullptr) {
+            
+            region = new RegionFile();
+            region->Open(worldRegions + "/" + Int.ToString(regionX) + "_" + Int.ToString(regionZ));
+        }
+        
+        it->second.Encode(buffer);
+        
+        if (!region->Write(cellX, cellZ, buffer, doCompressRegions)) {
+            
+            isConverted = false;
+            
+            continue;
+        }
+        
+        fs.FileDelete(worldChunks + "/" + it->first);
+        fs.FileDelete(worldStatic + "/" + it->first);
+        
+        continue;
+    }
+    
+    for (std::map<std::pair<int, int>, RegionFile*>::iterator it = regions.begin(); it != regions.end(); ++it)
+        delete it->second;
+    
+    return isConverted;
+}
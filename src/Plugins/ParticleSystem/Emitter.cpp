@@ -26,13 +26,14 @@ Emitter::Emitter() :
     velocityBias(0.01f),
     
     maxParticles(20),
+    lifetime(0),
+    
     mIsActive(true),
     mSpawnRate(0),
     
     mNumberOfParticles(0),
-    mParticleObject(nullptr),
     
-    mMesh(nullptr),
+    mBatch(nullptr),
     mMaterial(nullptr)
 {
 }
@@ -40,27 +41,11 @@ Emitter::Emitter() :
 void Emitter::AddParticle(glm::vec3 position, glm::vec3 initialScale, glm::vec3 force, Color colorBegin, Color colorEnd) {
     mNumberOfParticles++;
     
-    SubMesh particleSubMesh;
-    Engine.meshes.cube->GetSubMesh(0, particleSubMesh);
-    
-    unsigned int numberOfVertices = particleSubMesh.vertexBuffer.size();
-    
-    for (unsigned int i = 0; i < numberOfVertices; i++) {
-        
-        particleSubMesh.vertexBuffer[i].x *= initialScale.x;
-        particleSubMesh.vertexBuffer[i].y *= initialScale.y;
-        particleSubMesh.vertexBuffer[i].z *= initialScale.z;
-        
-        particleSubMesh.vertexBuffer[i].r = colorBegin.r;
-        particleSubMesh.vertexBuffer[i].g = colorBegin.g;
-        particleSubMesh.vertexBuffer[i].b = colorBegin.b;
-    }
-    
-    mMesh->AddSubMesh(position.x, position.y, position.z, particleSubMesh, false);
-    
     mParticlePositions.push_back(position);
     mParticleVelocities.push_back(force);
+    mParticleScales.push_back(initialScale);
     mParticleColors.push_back(glm::vec3(colorBegin.r, colorBegin.g, colorBegin.b));
+    mParticleLife.push_back(0.0f);
     
     ResetParticle(mNumberOfParticles - 1);
     
@@ -92,14 +77,16 @@ unsigned int Emitter::ResetParticle(unsigned int index) {
     mParticleVelocities[index] = direction + randomVelocity;
 
     mParticleColors[index] = glm::vec3(colorBegin.r, colorBegin.g, colorBegin.b);
+    
+    mParticleScales[index] = scale;
+    mParticleLife[index] = 0.0f;
     return index;
 }
 
 void Emitter::Activate(void) {
     if (mIsActive) 
         return;
-    MeshRenderer* particleRenderer = mParticleObject->GetComponent<MeshRenderer>();
-    Engine.sceneMain->AddMeshRendererToSceneRoot(particleRenderer, RENDER_QUEUE_GEOMETRY);
+    mBatch->isActive = true;
     mIsActive = true;
     return;
 }
@@ -107,8 +94,7 @@ void Emitter::Activate(void) {
 void Emitter::Deactivate(void) {
     if (!mIsActive) 
         return;
-    MeshRenderer* particleRenderer = mParticleObject->GetComponent<MeshRenderer>();
-    Engine.sceneMain->RemoveMeshRendererFromSceneRoot(particleRenderer, RENDER_QUEUE_GEOMETRY);
+    mBatch->isActive = false;
     mIsActive = false;
     return;
 }
@@ -116,3 +102,15 @@ void Emitter::Deactivate(void) {
 Material* Emitter::GetMaterial(void) {
     return mMaterial;
 }
+
+unsigned int Emitter::GetNumberOfParticles(void) {
+    return mNumberOfParticles;
+}
+
+glm::vec3 Emitter::GetParticlePosition(unsigned int index) {
+    return mParticlePositions[index];
+}
+
+float Emitter::GetParticleLife(unsigned int index) {
+    return mParticleLife[index];
+}
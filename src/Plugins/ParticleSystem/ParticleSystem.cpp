@@ -65,85 +65,98 @@ void ParticleSystem::Update(void) {
             }
         }
 
+        std::vector<glm::vec3>& positions  = emitterPtr->mParticlePositions;
+        std::vector<glm::vec3>& velocities = emitterPtr->mParticleVelocities;
+        std::vector<glm::vec3>& scales     = emitterPtr->mParticleScales;
+        std::vector<glm::vec3>& colors     = emitterPtr->mParticleColors;
+        std::vector<float>&     life       = emitterPtr->mParticleLife;
+        
+        unsigned int numberOfParticles = emitterPtr->mNumberOfParticles;
+        
         // Point emitter
         if (emitterPtr->type == EmitterType::Point) {
+            
+            glm::vec3 colorEnd(emitterPtr->colorEnd.r, emitterPtr->colorEnd.g, emitterPtr->colorEnd.b);
+            
+            glm::vec3 boundsMin = emitterPtr->position - glm::vec3(emitterPtr->width, emitterPtr->height, emitterPtr->width);
+            glm::vec3 boundsMax = emitterPtr->position + glm::vec3(emitterPtr->width, emitterPtr->height, emitterPtr->width);
+            
             // Update emitter particles
-            for (unsigned int p = 0; p < emitterPtr->mNumberOfParticles; p++) {
+            for (unsigned int p = 0; p < numberOfParticles; p++) {
                 
                 // Solve velocity
-                emitterPtr->mParticlePositions[p] += emitterPtr->mParticleVelocities[p];
+                positions[p] += velocities[p];
                 
                 // Integrate velocities
-                emitterPtr->mParticleVelocities[p] = glm::mix(emitterPtr->mParticleVelocities[p], emitterPtr->velocity, emitterPtr->velocityBias);
+                velocities[p] = glm::mix(velocities[p], emitterPtr->velocity, emitterPtr->velocityBias);
+                
+                // Grow toward the target scale
+                scales[p] *= emitterPtr->scaleTo;
+                
+                life[p] += 1.0f;
                 
                 // Constraints
-                if ((emitterPtr->mParticlePositions[p].x < emitterPtr->position.x - emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].x > emitterPtr->position.x + emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].y < emitterPtr->position.y - emitterPtr->height) || 
-                    (emitterPtr->mParticlePositions[p].y > emitterPtr->position.y + emitterPtr->height) || 
-                    (emitterPtr->mParticlePositions[p].z < emitterPtr->position.z - emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].z > emitterPtr->position.z + emitterPtr->width)) {
+                if ((positions[p].x < boundsMin.x) | (positions[p].x > boundsMax.x) | 
+                    (positions[p].y < boundsMin.y) | (positions[p].y > boundsMax.y) | 
+                    (positions[p].z < boundsMin.z) | (positions[p].z > boundsMax.z) | 
+                    ((emitterPtr->lifetime > 0.0f) & (life[p] > emitterPtr->lifetime))) {
                     
                     emitterPtr->ResetParticle(p);
                 }
                 
                 // Interpolate color
-                Color sourceColor(emitterPtr->mParticleColors[p].x, emitterPtr->mParticleColors[p].y, emitterPtr->mParticleColors[p].z);
-                Color blendedColor = Colors.Lerp(sourceColor, emitterPtr->colorEnd, emitterPtr->colorBias);
-                
-                emitterPtr->mParticleColors[p] = glm::vec3(blendedColor.r, blendedColor.g, blendedColor.b);
-                
-                emitterPtr->mMesh->ChangeSubMeshPosition(p, emitterPtr->mParticlePositions[p].x, emitterPtr->mParticlePositions[p].y, emitterPtr->mParticlePositions[p].z);
-                emitterPtr->mMesh->ChangeSubMeshScale(p, emitterPtr->scaleTo.x, emitterPtr->scaleTo.y, emitterPtr->scaleTo.z);
-                emitterPtr->mMesh->ChangeSubMeshColor(p, blendedColor);
+                colors[p] = glm::mix(colors[p], colorEnd, emitterPtr->colorBias);
             }
             
-            emitterPtr->mMesh->Load();
+            emitterPtr->mBatch->SetParticles(positions.data(), scales.data(), colors.data(), numberOfParticles);
             
             continue;
         }
-
+        
         // Area effector emitter
         if (emitterPtr->type == EmitterType::AreaEffector) {
             
-            // Update emitter particles
+            glm::vec3 boundsMin = playerPosition - glm::vec3(emitterPtr->width, emitterPtr->height, emitterPtr->width);
+            glm::vec3 boundsMax = playerPosition + glm::vec3(emitterPtr->width, emitterPtr->height, emitterPtr->width);
             
-            for (unsigned int p = 0; p < emitterPtr->mNumberOfParticles; p++) {
+            if (boundsMin.y < emitterPtr->heightMinimum) boundsMin.y = emitterPtr->heightMinimum;
+            if (boundsMax.y > emitterPtr->heightMaximum) boundsMax.y = emitterPtr->heightMaximum;
+            
+            // Update emitter particles
+            for (unsigned int p = 0; p < numberOfParticles; p++) {
                 
                 // Solve velocity
-                emitterPtr->mParticlePositions[p] += emitterPtr->mParticleVelocities[p];
+                positions[p] += velocities[p];
                 
                 // Add target scale
                 emitterPtr->scale *= emitterPtr->scaleTo;
                 
                 // Integrate velocities
-                emitterPtr->mParticleVelocities[p] = glm::mix(emitterPtr->mParticleVelocities[p], emitterPtr->velocity, emitterPtr->velocityBias);
+                velocities[p] = glm::mix(velocities[p], emitterPtr->velocity, emitterPtr->velocityBias);
+                
+                life[p] += 1.0f;
                 
                 // Constraints
-                if ((emitterPtr->mParticlePositions[p].x < playerPosition.x - emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].x > playerPosition.x + emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].y < playerPosition.y - emitterPtr->height) || 
-                    (emitterPtr->mParticlePositions[p].y > playerPosition.y + emitterPtr->height) || 
-                    (emitterPtr->mParticlePositions[p].z < playerPosition.z - emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].z > playerPosition.z + emitterPtr->width) || 
-                    (emitterPtr->mParticlePositions[p].y > emitterPtr->heightMaximum) || 
-                    (emitterPtr->mParticlePositions[p].y < emitterPtr->heightMinimum)) {
+                if ((positions[p].x < boundsMin.x) | (positions[p].x > boundsMax.x) | 
+                    (positions[p].y < boundsMin.y) | (positions[p].y > boundsMax.y) | 
+                    (positions[p].z < boundsMin.z) | (positions[p].z > boundsMax.z) | 
+                    ((emitterPtr->lifetime > 0.0f) & (life[p] > emitterPtr->lifetime))) {
                     
                     float randomX = Random.Range(0.0f, emitterPtr->width) - Random.Range(0.0f, emitterPtr->width);
                     float randomY = Random.Range(0.0f, emitterPtr->height) - Random.Range(0.0f, emitterPtr->height);
                     float randomZ = Random.Range(0.0f, emitterPtr->width) - Random.Range(0.0f, emitterPtr->width);
                     
-                    emitterPtr->mParticlePositions[p] = playerPosition + glm::vec3(randomX, randomY, randomZ);
+                    positions[p] = playerPosition + glm::vec3(randomX, randomY, randomZ);
                     
-                    if (emitterPtr->mParticlePositions[p].y < emitterPtr->heightMinimum) 
-                        emitterPtr->mParticlePositions[p].y = emitterPtr->heightMinimum + 200;
+                    if (positions[p].y < emitterPtr->heightMinimum) 
+                        positions[p].y = emitterPtr->heightMinimum + 200;
                     
+                    life[p] = 0.0f;
                 }
                 
-                emitterPtr->mMesh->ChangeSubMeshPosition(p, emitterPtr->mParticlePositions[p].x, emitterPtr->mParticlePositions[p].y, emitterPtr->mParticlePositions[p].z);
             }
             
-            emitterPtr->mMesh->Load();
+            emitterPtr->mBatch->SetParticles(positions.data(), scales.data(), colors.data(), numberOfParticles);
             
             continue;
         }
@@ -155,38 +168,37 @@ Emitter* ParticleSystem::CreateEmitter(void) {
     
     Emitter* newEmitter = mEmitters.Create();
     
-    newEmitter->mParticleObject = Engine.Create<GameObject>();
-    
     // Material
     Material* particleMaterial = Engine.Create<Material>();
     newEmitter->mMaterial = particleMaterial;
     
-    particleMaterial->shader = Engine.shaders.colorUnlit;
+    particleMaterial->shader = Engine.shaders.particle;
     particleMaterial->isShared = false;
     particleMaterial->ambient = Colors.white;
     particleMaterial->diffuse = Colors.white;
     particleMaterial->DisableCulling();
     
-    // Mesh
-    Mesh* particleMesh = Engine.Create<Mesh>();
+    // Particles are drawn as instances of the shared cube
+    ParticleBatch* particleBatch = Renderer.CreateParticleBatch();
     
-    newEmitter->mMesh = particleMesh;
+    particleBatch->mesh     = Engine.meshes.cube;
+    particleBatch->material = particleMaterial;
     
-    particleMesh->isShared = false;
+    newEmitter->mBatch = particleBatch;
     
-    newEmitter->mParticleObject->AddComponent(Engine.CreateComponentMeshRenderer(particleMesh, particleMaterial));
-    
-    Engine.sceneMain->AddMeshRendererToSceneRoot(newEmitter->mParticleObject->GetComponent<MeshRenderer>(), RENDER_QUEUE_GEOMETRY);
+    Engine.sceneMain->AddParticleBatchToScene(particleBatch);
     
     return newEmitter;
 }
 
 void ParticleSystem::DestroyEmitter(Emitter* emitterPtr) {
     
-    MeshRenderer* particleRenderer = emitterPtr->mParticleObject->GetComponent<MeshRenderer>();
+    Engine.sceneMain->RemoveParticleBatchFromScene(emitterPtr->mBatch);
+    
+    Renderer.DestroyParticleBatch(emitterPtr->mBatch);
+    Engine.Destroy<Material>(emitterPtr->mMaterial);
     
-    Engine.sceneMain->RemoveMeshRendererFromSceneRoot(particleRenderer, RENDER_QUEUE_GEOMETRY);
-    Engine.Destroy<GameObject>(emitterPtr->mParticleObject);
+    mEmitters.Destroy(emitterPtr);
     
     return;
 }
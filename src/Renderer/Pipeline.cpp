@@ -7,96 +7,33 @@ int dbgCounter = 0;
 
 void RenderSystem::RenderFrame(void) {
     
-    glm::mat4 viewProjection;
-    glm::vec3 eye;
+    // The workers record each render queue while this thread replays the ones already finished
+    // TODO Prepare the next frame while this one submits. Commands still point at the live
+    // renderers, so this needs a scene snapshot for each frame in flight.
+    BeginRecording(mCommandList);
     
-    mNumberOfDrawCalls = 0;
-    
-    if (doUpdateLightsEveryFrame) {
-        mNumberOfLights = 0;
-        mNumberOfShadows = 0;
-    }
-    
-    // Clear the view port
-    glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
-    
-#ifdef RENDERER_CHECK_OPENGL_ERRORS
-    GetGLErrorCodes("OnRender::BeginFrame::");
-#endif
-    
-    // Run the scene list
-    for (Scene* scenePtr : mActiveScenes) {
-        
-        if (!scenePtr->isActive) 
-            continue;
-        
-        // Set the camera projection angle
-        setTargetCamera(scenePtr->camera, eye, viewProjection);
-        
-        // Extract camera project edges for clipping
-        glm::mat4 inverseViewProjMatrix = glm::inverse( viewProjection );
-        Frustum frustum = FrustumExtractPlanes(inverseViewProjMatrix);
-        
-        // Gather fog layers
-        accumulateSceneFogLayers(scenePtr);
-        
-        // Gather active lights in this scene
-        if (scenePtr->doUpdateLights) {
-            accumulateSceneLights(scenePtr, eye);
-            
-            if (mNumberOfLights > RENDER_NUMBER_OF_LIGHTS) 
-                mNumberOfLights = RENDER_NUMBER_OF_LIGHTS;
-            
-            if (!doUpdateLightsEveryFrame) 
-                scenePtr->doUpdateLights = false;
-        }
-        
-        // Draw the render queues
-        for (unsigned int group = 0; group < RENDER_NUMBER_OF_QUEUE_GROUPS; group++) {
-            
-            std::vector<MeshRenderer*>* renderQueueGroup = nullptr;
-            switch (group) {
-                case 0: renderQueueGroup = &scenePtr->mRenderQueueSky; break;
-                case 1: renderQueueGroup = &scenePtr->mRenderQueueBackground; break;
-                case 2: renderQueueGroup = &scenePtr->mRenderQueuePreGrometry; break;
-                case 3: renderQueueGroup = &scenePtr->mRenderQueueGeometry; break;
-                case 4: renderQueueGroup = &scenePtr->mRenderQueuePostGeometry; break;
-                case 5: renderQueueGroup = &scenePtr->mRenderQueueForeground; break;
-                case 6: renderQueueGroup = &scenePtr->mRenderQueueOverlay; break;
-            }
-            
-            if (!renderQueueGroup || renderQueueGroup->empty()) 
-                continue;
-            
-            // Sorting
-            SortingPass(eye, renderQueueGroup);
-            
-            // Geometry pass
-            for (MeshRenderer* currentEntity : *renderQueueGroup) {
-                
-                if (currentEntity->mDoCulling && CullingPass(currentEntity, scenePtr->camera, viewProjection, frustum))
-                    continue;
-                
-                GeometryPass(currentEntity, eye, scenePtr->camera->forward, viewProjection);
-            }
-            
-            // Shadow pass
-            if (mNumberOfShadows > 0) {
-                
-                shaders.shadowCaster->Bind();
-                
-                for (MeshRenderer* currentEntity : *renderQueueGroup) {
-                    ShadowVolumePass(currentEntity, eye, scenePtr->camera->forward, viewProjection);
-                }
-                
-                mCurrentShader->Bind();
-            }
-        }
-    }
+    SubmitFrame(mCommandList);
     
     mNumberOfFrames++;
-    
-#ifdef RENDERER_CHECK_OPENGL_ERRORS
-    GetGLErrorCodes("OnRender::EndFrame::");
-#endif
+}
+
+void RenderSystem::ResetBindings(void) {
+    
+    mCurrentMesh     = nullptr;
+    mCurrentMaterial = nullptr;
+    mCurrentShader   = nullptr;
+    
+    mCurrentState.doDepthTest           = -1;
+    mCurrentState.depthFunc             = -1;
+    mCurrentState.doFaceCulling         = -1;
+    mCurrentState.faceCullSide          = -1;
+    mCurrentState.faceWinding           = -1;
+    mCurrentState.doBlending            = -1;
+    mCurrentState.blendSource           = -1;
+    mCurrentState.blendDestination      = -1;
+    mCurrentState.blendAlphaSource      = -1;
+    mCurrentState.blendAlphaDestination = -1;
+    mCurrentState.texture               = -1;
+    
+    return;
 }
@@ -13,11 +13,6 @@ extern IntType Int;
 extern ColorPreset  Colors;
 
 
-// Render thread
-bool isThreadActive = true;
-void RenderThreadMain(void);
-
-
 
 RenderSystem::RenderSystem() : 
     viewport(Viewport(0, 0, 0, 0)),
@@ -28,17 +23,40 @@ RenderSystem::RenderSystem() :
     doUpdateLightsEveryFrame(true),
     
     mNumberOfDrawCalls(0),
+    
+    mNumberOfShaderBinds(0),
+    mNumberOfMaterialBinds(0),
+    mNumberOfMeshBinds(0),
+    
     mNumberOfFrames(0),
     
     mCurrentMesh(nullptr),
     mCurrentMaterial(nullptr),
     mCurrentShader(nullptr),
     
+    mMaterialSortId(0),
+    
+    mUniformBufferCamera(0),
+    mUniformBufferLights(0),
+    mUniformBufferFog(0),
+    mUniformBufferObject(0),
+    
+    mObjectBlockStride(sizeof(UniformBlockObject)),
+    
     mNumberOfLights(0),
     mNumberOfShadows(0),
     
     mShadowDistance(300)
 {
+    ResetBindings();
+}
+
+RenderSystem::~RenderSystem() {
+    
+    // Render systems used only for recording may never be shut down
+    mRecorders.Shutdown();
+    
+    return;
 }
 
 MeshRenderer* RenderSystem::CreateMeshRenderer(void) {
@@ -108,6 +126,7 @@ unsigned int RenderSystem::GetNumberOfCameras(void) {
 
 Material* RenderSystem::CreateMaterial(void) {
     Material* materialPtr = mMaterial.Create();
+    materialPtr->mSortId = mMaterialSortId++;
     return materialPtr;
 }
 bool RenderSystem::DestroyMaterial(Material* materialPtr) {
@@ -174,6 +193,32 @@ unsigned int RenderSystem::GetNumberOfFogLayers(void) {
     return mFog.Size();
 }
 
+InstanceBatch* RenderSystem::CreateInstanceBatch(void) {
+    InstanceBatch* batchPtr = mInstanceBatch.Create();
+    return batchPtr;
+}
+
+bool RenderSystem::DestroyInstanceBatch(InstanceBatch* batchPtr) {
+    return mInstanceBatch.Destroy(batchPtr);
+}
+
+unsigned int RenderSystem::GetNumberOfInstanceBatches(void) {
+    return mInstanceBatch.Size();
+}
+
+ParticleBatch* RenderSystem::CreateParticleBatch(void) {
+    ParticleBatch* batchPtr = mParticleBatch.Create();
+    return batchPtr;
+}
+
+bool RenderSystem::DestroyParticleBatch(ParticleBatch* batchPtr) {
+    return mParticleBatch.Destroy(batchPtr);
+}
+
+unsigned int RenderSystem::GetNumberOfParticleBatches(void) {
+    return mParticleBatch.Size();
+}
+
 
 void RenderSystem::Initiate(void) {
     
@@ -181,18 +226,24 @@ void RenderSystem::Initiate(void) {
     GetGLErrorCodes("OnInitiate::");
 #endif
     
-    renderThreadMain = new std::thread( RenderThreadMain );
+    CreateUniformBlocks();
     
-    Log.Write( " >> Starting thread renderer" );
+    SetNumberOfRecordingWorkers(RENDER_NUMBER_OF_RECORDING_WORKERS);
     
     return;
 }
 
 void RenderSystem::Shutdown(void) {
     
-    isThreadActive = false;
+    // Let any segment still recording finish before the render assets go away
+    for (unsigned int i=0; i < mCommandList.GetNumberOfSegments(); i++) 
+        mRecorders.Wait( &mCommandList.GetSegment(i)->counter );
     
-    renderThreadMain->join();
+    mRecorders.Shutdown();
+    
+    mCommandList.Clear();
+    
+    DestroyUniformBlocks();
     
     return;
 }
@@ -219,6 +270,22 @@ unsigned int RenderSystem::GetRenderQueueSize(void) {
     return mActiveScenes.size();
 }
 
+void RenderSystem::SetNumberOfRecordingWorkers(unsigned int numberOfWorkers) {
+    
+    // Let the last frame finish recording before replacing the workers
+    for (unsigned int i=0; i < mCommandList.GetNumberOfSegments(); i++) 
+        mRecorders.Wait( &mCommandList.GetSegment(i)->counter );
+    
+    mRecorders.Shutdown();
+    mRecorders.Initiate(numberOfWorkers);
+    
+    return;
+}
+
+unsigned int RenderSystem::GetNumberOfRecordingWorkers(void) {
+    return mRecorders.GetNumberOfWorkers();
+}
+
 void RenderSystem::SetViewport(unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
     viewport.x = x;
     viewport.y = y;
@@ -358,26 +425,18 @@ unsigned int RenderSystem::GetNumberOfDrawCalls(void) {
     return mNumberOfDrawCalls;
 }
 
-
-
-//
-// Render thread
-//
-
-void RenderThreadMain(void) {
-    
-    while (isThreadActive) {
-        
-        std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
-        
-        continue;
-    }
-    
-    std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(3) );
-    Log.Write( " >> Shutting down on thread renderer" );
-    
-    return;
+unsigned int RenderSystem::GetNumberOfShaderBinds(void) {
+    return mNumberOfShaderBinds;
 }
 
+unsigned int RenderSystem::GetNumberOfMaterialBinds(void) {
+    return mNumberOfMaterialBinds;
+}
 
+unsigned int RenderSystem::GetNumberOfMeshBinds(void) {
+    return mNumberOfMeshBinds;
+}
 
+unsigned int RenderSystem::GetNumberOfUniformUpdates(void) {
+    return Shader::mNumberOfUniformUpdates;
+}
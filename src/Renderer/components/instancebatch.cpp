@@ -0,0 +1,76 @@
+#include <GameEngineFramework/Renderer/components/instancebatch.h>
+
+#define GLEW_STATIC
+#include <gl/glew.h>
+
+
+InstanceBatch::InstanceBatch() :
+    isActive(true),
+    mesh(nullptr),
+    material(nullptr),
+    
+    mVertexArray(0),
+    mBufferInstance(0),
+    
+    mAttachedVertexBuffer(0),
+    mAttachedIndexBuffer(0)
+{
+    glGenVertexArrays(1, &mVertexArray);
+    glGenBuffers(1, &mBufferInstance);
+    
+    return;
+}
+
+InstanceBatch::~InstanceBatch() {
+    
+    glDeleteVertexArrays(1, &mVertexArray);
+    glDeleteBuffers(1, &mBufferInstance);
+    
+    return;
+}
+
+void InstanceBatch::AddMeshRenderer(MeshRenderer* meshRenderer) {
+    
+    if (mRendererIndex.find(meshRenderer) != mRendererIndex.end())
+        return;
+    
+    mRendererIndex[meshRenderer] = mMeshRenderers.size();
+    
+    mMeshRenderers.push_back(meshRenderer);
+    
+    return;
+}
+
+bool InstanceBatch::RemoveMeshRenderer(MeshRenderer* meshRenderer) {
+    
+    std::unordered_map<MeshRenderer*, unsigned int>::iterator it = mRendererIndex.find(meshRenderer);
+    
+    if (it == mRendererIndex.end())
+        return false;
+    
+    unsigned int index = it->second;
+    
+    mRendererIndex.erase(it);
+    
+    // Move the last renderer into the gap
+    MeshRenderer* lastRenderer = mMeshRenderers.back();
+    
+    mMeshRenderers.pop_back();
+    
+    if (lastRenderer != meshRenderer) {
+        
+        mMeshRenderers[index] = lastRenderer;
+        
+        mRendererIndex[lastRenderer] = index;
+    }
+    
+    return true;
+}
+
+unsigned int InstanceBatch::GetNumberOfMeshRenderers(void) {
+    return mMeshRenderers.size();
+}
+
+unsigned int InstanceBatch::GetNumberOfInstances(void) {
+    return mInstances.size();
+}
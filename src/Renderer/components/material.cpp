@@ -31,7 +31,9 @@ Material::Material() :
     mBlendDestination(BLEND_SRC_ALPHA),
     mBlendAlphaSource(BLEND_ONE_MINUS_SRC_COLOR),
     mBlendAlphaDestination(BLEND_ONE_MINUS_SRC_ALPHA),
-    mBlendFunction(BLEND_EQUATION_ADD)
+    mBlendFunction(BLEND_EQUATION_ADD),
+    
+    mSortId(0)
 {
     ambient = Color(0, 0, 0, 1);
     diffuse = Color(1, 1, 1, 1);
@@ -6,9 +6,41 @@
 #define GLEW_STATIC
 #include <gl/glew.h>
 
+#include <cstring>
+#include <cstdint>
+
 extern MathCore Math;
 extern NumberGeneration Random;
 
+// Range value marking a copy with nothing to upload
+static const unsigned int streamRangeClean = 0xffffffff;
+
+MeshUploadTrace* Mesh::mUploadTrace = nullptr;
+
+
+MeshUploadTrace::MeshUploadTrace() :
+    numberOfUploads(0),
+    numberOfBytes(0),
+    numberOfAllocations(0),
+    numberOfMappedWrites(0),
+    numberOfSubDataWrites(0),
+    numberOfFenceWaits(0),
+    numberOfFenceStalls(0)
+{
+}
+
+void MeshUploadTrace::Clear(void) {
+    numberOfUploads     = 0;
+    numberOfBytes       = 0;
+    numberOfAllocations   = 0;
+    numberOfMappedWrites  = 0;
+    numberOfSubDataWrites = 0;
+    numberOfFenceWaits    = 0;
+    numberOfFenceStalls   = 0;
+    uploadSizes.clear();
+    return;
+}
+
 
 Mesh::Mesh() : 
     
@@ -19,9 +51,29 @@ Mesh::Mesh() :
     mVertexBufferSz(0),
     mIndexBufferSz(0),
     
-    mAreBuffersAllocated(true)
+    mAreBuffersAllocated(true),
+    
+    mIsDynamic(false),
+    
+    mVertexCapacity(0),
+    mIndexCapacity(0),
+    
+    mNumberOfStreamSlots(1),
+    mStreamSlot(0),
+    
+    mStreamVertex(nullptr),
+    mStreamIndex(nullptr)
 {
     
+    for (unsigned int s=0; s < RENDER_NUMBER_OF_STREAM_BUFFERS; s++) {
+        mStreamFence[s] = nullptr;
+        
+        mDirtyVertexBegin[s] = streamRangeClean;
+        mDirtyVertexEnd[s]   = 0;
+        mDirtyIndexBegin[s]  = streamRangeClean;
+        mDirtyIndexEnd[s]    = 0;
+    }
+    
     AllocateBuffers();
     
     SetDefaultAttributes();
@@ -234,6 +286,9 @@ int Mesh::AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer,
                 i++;
             }
             
+            MarkDirty(freeMeshPtr.vertexBegin, freeMeshPtr.vertexBegin + freeMeshPtr.vertexCount,
+                      freeMeshPtr.indexBegin,  freeMeshPtr.indexBegin  + freeMeshPtr.indexCount);
+            
             if (doUploadToGpu) 
                 Load();
             
@@ -269,6 +324,8 @@ int Mesh::AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer,
         mIndexBuffer.push_back(index);
     }
     
+    MarkDirty(startVertex, mVertexBuffer.size(), startIndex, mIndexBuffer.size());
+    
     if (doUploadToGpu) 
         Load();
     
@@ -309,9 +366,19 @@ bool Mesh::RemoveSubMesh(unsigned int index) {
     
     mSubMesh.erase(mSubMesh.begin() + index);
     
+    // Dynamic meshes pick up the cleared vertices on the next load
+    if (mIsDynamic) {
+        
+        MarkDirty(sourceMesh.vertexBegin, sourceMesh.vertexBegin + sourceMesh.vertexCount, 0, 0);
+        
+        return true;
+    }
+    
     glBindVertexArray(mVertexArray);
     glBufferSubData(GL_ARRAY_BUFFER, sourceMesh.vertexBegin * sizeof(Vertex), sourceMesh.vertexCount * sizeof(Vertex), &destMesh[0]);
     
+    TraceUpload(sourceMesh.vertexCount * sizeof(Vertex));
+    
     return true;
 }
 
@@ -371,6 +438,8 @@ bool Mesh::ChangeSubMeshPosition(unsigned int index, float x, float y, float z)
     
     mSubMesh[index].position = glm::vec3(x, y, z);
     
+    MarkDirty(sourceMesh.vertexBegin, sourceMesh.vertexBegin + sourceMesh.vertexCount, 0, 0);
+    
     return true;
 }
 
@@ -399,6 +468,8 @@ bool Mesh::ChangeSubMeshRotation(unsigned int index, float angle, glm::vec3 axis
         vertex.z = position.z + sourceMesh.position.z;
     }
     
+    MarkDirty(sourceMesh.vertexBegin, sourceMesh.vertexBegin + sourceMesh.vertexCount, 0, 0);
+    
     return true;
 }
 
@@ -425,6 +496,8 @@ bool Mesh::ChangeSubMeshScale(unsigned int index, float scaleX, float scaleY, fl
         vertex.z += sourceMesh.position.z;
     }
     
+    MarkDirty(sourceMesh.vertexBegin, sourceMesh.vertexBegin + sourceMesh.vertexCount, 0, 0);
+    
     return true;
 }
 
@@ -443,6 +516,8 @@ bool Mesh::ChangeSubMeshColor(unsigned int index, Color newColor) {
         vertex.b = newColor.b;
     }
     
+    MarkDirty(sourceMesh.vertexBegin, sourceMesh.vertexBegin + sourceMesh.vertexCount, 0, 0);
+    
     return true;
 }
 
@@ -463,6 +538,8 @@ bool Mesh::ChangeSubMeshPoints(unsigned int index, std::vector<glm::vec3> points
         
     }
     
+    MarkDirty(0, sourceMesh.vertexCount, 0, 0);
+    
     return true;
 }
 
@@ -485,6 +562,12 @@ void Mesh::Load(void) {
         mAreBuffersAllocated = true;
     }
     
+    if (mIsDynamic) {
+        
+        StreamBuffers();
+        
+        return;
+    }
     
     glBindVertexArray(mVertexArray);
     
@@ -494,6 +577,10 @@ void Mesh::Load(void) {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferIndex);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferSz * sizeof(Index), &mIndexBuffer[0], GL_STATIC_DRAW);
     
+    TraceAllocation();
+    TraceUpload(mVertexBufferSz * sizeof(Vertex));
+    TraceUpload(mIndexBufferSz * sizeof(Index));
+    
     return;
 }
 
@@ -507,6 +594,16 @@ bool Mesh::LoadRange(unsigned int start, unsigned int count) {
         return false;
     }
     
+    // The ring is written through its own copies
+    if (mIsDynamic) {
+        
+        MarkDirty(start, start + count, start, start + count);
+        
+        Load();
+        
+        return true;
+    }
+    
     if (!mAreBuffersAllocated) {
         AllocateBuffers();
         mAreBuffersAllocated = true;
@@ -552,6 +649,7 @@ Vertex Mesh::GetVertex(unsigned int index) {
 }
 
 void Mesh::SetVertex(unsigned int index, Vertex vertex) {
+    MarkDirty(index, index + 1, 0, 0);
     mVertexBuffer[index] = vertex;
     return;
 }
@@ -561,12 +659,15 @@ Index Mesh::GetIndex(unsigned int index) {
 }
 
 void Mesh::SetIndex(unsigned int index, Index position) {
+    MarkDirty(0, 0, index, index + 1);
     mIndexBuffer[index] = position;
     return;
 }
 
 void Mesh::CalculateNormals(void) {
     
+    MarkDirty(0, mVertexBufferSz, 0, 0);
+    
     for (unsigned int i=0; i < mVertexBufferSz; i += 3) {
         
         if (i > mVertexBuffer.size()) 
@@ -611,6 +712,8 @@ void Mesh::CalculateNormals(void) {
 
 void Mesh::SetNormals(glm::vec3 normals) {
     
+    MarkDirty(0, mVertexBufferSz, 0, 0);
+    
     for (unsigned int i=0; i < mVertexBufferSz; i++) {
         
         mVertexBuffer[i].nx = normals.x;
@@ -643,6 +746,15 @@ void Mesh::DisableAttribute(int index) {
 }
 
 void Mesh::LoadVertexBuffer(Vertex* bufferData, int vertexCount) {
+    
+    // Immutable ring storage cannot be respecified
+    if (mIsDynamic) {
+        mVertexBuffer.assign(bufferData, bufferData + vertexCount);
+        MarkDirty(0, vertexCount, 0, 0);
+        Load();
+        return;
+    }
+    
     glBindVertexArray(mVertexArray);
     glBindBuffer(GL_ARRAY_BUFFER, mBufferVertex);
     glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Vertex), &bufferData[0], GL_STATIC_DRAW);
@@ -650,6 +762,15 @@ void Mesh::LoadVertexBuffer(Vertex* bufferData, int vertexCount) {
 }
 
 void Mesh::LoadIndexBuffer(Index* bufferData, int indexCount) {
+    
+    // Immutable ring storage cannot be respecified
+    if (mIsDynamic) {
+        mIndexBuffer.assign(bufferData, bufferData + indexCount);
+        MarkDirty(0, 0, 0, indexCount);
+        Load();
+        return;
+    }
+    
     glBindVertexArray(mVertexArray);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferIndex);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(Index), &bufferData[0], GL_STATIC_DRAW);
@@ -681,22 +802,51 @@ void Mesh::AllocateBuffers(void) {
 }
 
 void Mesh::FreeBuffers(void) {
+    ReleaseStreamBuffers();
     glDeleteVertexArrays(1, &mVertexArray);
     glDeleteBuffers(1, &mBufferVertex);
     glDeleteBuffers(1, &mBufferIndex);
+    
+    // A dynamic mesh rebuilds its ring on the next load
+    mVertexCapacity = 0;
+    mIndexCapacity  = 0;
     return;
 }
 
 void Mesh::DrawVertexArray(void) {
     
-    glDrawArrays(mPrimitive, 0, mVertexBufferSz);
+    glDrawArrays(mPrimitive, mStreamSlot * mVertexCapacity, mVertexBufferSz);
+    
+    if (mStreamVertex != nullptr) {
+        
+        if (mStreamFence[mStreamSlot] != nullptr)
+            glDeleteSync( (GLsync)mStreamFence[mStreamSlot] );
+        
+        mStreamFence[mStreamSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
     
     return;
 }
 
 void Mesh::DrawIndexArray(void) {
     
-    glDrawElements(mPrimitive, mIndexBufferSz, GL_UNSIGNED_INT, (void*)0);
+    if (mStreamVertex == nullptr) {
+        
+        glDrawElements(mPrimitive, mIndexBufferSz, GL_UNSIGNED_INT, (void*)0);
+        
+        return;
+    }
+    
+    // Draw from the copy written by the last load
+    uintptr_t indexOffset = mStreamSlot * mIndexCapacity * sizeof(Index);
+    
+    glDrawElementsBaseVertex(mPrimitive, mIndexBufferSz, GL_UNSIGNED_INT, (void*)indexOffset, mStreamSlot * mVertexCapacity);
+    
+    // Fence the copy so it is not rewritten while the draw is in flight
+    if (mStreamFence[mStreamSlot] != nullptr)
+        glDeleteSync( (GLsync)mStreamFence[mStreamSlot] );
+    
+    mStreamFence[mStreamSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     
     return;
 }
@@ -716,3 +866,279 @@ void Mesh::SetDefaultAttributes(void) {
     
     return;
 }
+
+
+//
+// Streaming
+//
+
+void Mesh::SetDynamic(bool isDynamic) {
+    
+    if (mIsDynamic == isDynamic)
+        return;
+    
+    mIsDynamic = isDynamic;
+    
+    if (!mAreBuffersAllocated)
+        return;
+    
+    // Drop the current buffers, the next load allocates the matching kind
+    FreeBuffers();
+    AllocateBuffers();
+    SetDefaultAttributes();
+    
+    mVertexBufferSz = 0;
+    mIndexBufferSz  = 0;
+    
+    return;
+}
+
+bool Mesh::IsDynamic(void) {
+    return mIsDynamic;
+}
+
+void Mesh::SetUploadTrace(MeshUploadTrace* trace) {
+    mUploadTrace = trace;
+    return;
+}
+
+void Mesh::MarkDirty(unsigned int vertexBegin, unsigned int vertexEnd, unsigned int indexBegin, unsigned int indexEnd) {
+    
+    for (unsigned int s=0; s < RENDER_NUMBER_OF_STREAM_BUFFERS; s++) {
+        
+        if (vertexBegin < vertexEnd) {
+            if (vertexBegin < mDirtyVertexBegin[s]) mDirtyVertexBegin[s] = vertexBegin;
+            if (vertexEnd   > mDirtyVertexEnd[s])   mDirtyVertexEnd[s]   = vertexEnd;
+        }
+        
+        if (indexBegin < indexEnd) {
+            if (indexBegin < mDirtyIndexBegin[s]) mDirtyIndexBegin[s] = indexBegin;
+            if (indexEnd   > mDirtyIndexEnd[s])   mDirtyIndexEnd[s]   = indexEnd;
+        }
+        
+    }
+    
+    return;
+}
+
+void Mesh::ReserveStreamBuffers(void) {
+    
+    ReleaseStreamBuffers();
+    
+    // Grow with headroom so a mesh that keeps adding sub meshes is not reallocated every load
+    if (mVertexBufferSz > mVertexCapacity)
+        mVertexCapacity = mVertexBufferSz + mVertexBufferSz / 2;
+    
+    if (mIndexBufferSz > mIndexCapacity)
+        mIndexCapacity = mIndexBufferSz + mIndexBufferSz / 2;
+    
+    // Persistent mapping needs immutable storage, otherwise a single buffer takes sub data uploads
+    bool doPersist = (GLEW_ARB_buffer_storage != 0);
+    
+    mNumberOfStreamSlots = doPersist ? RENDER_NUMBER_OF_STREAM_BUFFERS : 1;
+    mStreamSlot = 0;
+    
+    GLsizeiptr vertexBytes = (GLsizeiptr)mVertexCapacity * sizeof(Vertex) * mNumberOfStreamSlots;
+    GLsizeiptr indexBytes  = (GLsizeiptr)mIndexCapacity  * sizeof(Index)  * mNumberOfStreamSlots;
+    
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    
+    glDeleteBuffers(1, &mBufferVertex);
+    glDeleteBuffers(1, &mBufferIndex);
+    
+    glBindVertexArray(mVertexArray);
+    
+    glGenBuffers(1, &mBufferVertex);
+    glBindBuffer(GL_ARRAY_BUFFER, mBufferVertex);
+    
+    glGenBuffers(1, &mBufferIndex);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferIndex);
+    
+    if (doPersist) {
+        
+        glBufferStorage(GL_ARRAY_BUFFER, vertexBytes, NULL, flags);
+        glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, indexBytes, NULL, flags);
+        
+        mStreamVertex = glMapBufferRange(GL_ARRAY_BUFFER, 0, vertexBytes, flags);
+        mStreamIndex  = glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexBytes, flags);
+        
+    } else {
+        
+        glBufferData(GL_ARRAY_BUFFER, vertexBytes, NULL, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, NULL, GL_DYNAMIC_DRAW);
+    }
+    
+    // New buffers need the attribute layout pointed at them
+    SetDefaultAttributes();
+    
+    TraceAllocation();
+    
+    // Fill every copy so later loads only carry the changes
+    MarkDirty(0, mVertexBufferSz, 0, mIndexBufferSz);
+    
+    for (unsigned int s=0; s < mNumberOfStreamSlots; s++) 
+        WriteStreamSlot(s);
+    
+    mStreamSlot = mNumberOfStreamSlots - 1;
+    
+    return;
+}
+
+void Mesh::ReleaseStreamBuffers(void) {
+    
+    // Deleting the buffers also unmaps them
+    for (unsigned int s=0; s < RENDER_NUMBER_OF_STREAM_BUFFERS; s++) {
+        
+        if (mStreamFence[s] == nullptr)
+            continue;
+        
+        glDeleteSync( (GLsync)mStreamFence[s] );
+        mStreamFence[s] = nullptr;
+    }
+    
+    mStreamVertex = nullptr;
+    mStreamIndex  = nullptr;
+    
+    mNumberOfStreamSlots = 1;
+    mStreamSlot = 0;
+    
+    return;
+}
+
+void Mesh::StreamBuffers(void) {
+    
+    if ((mVertexBufferSz == 0) | (mIndexBufferSz == 0)) 
+        return;
+    
+    if ((mVertexBufferSz > mVertexCapacity) | (mIndexBufferSz > mIndexCapacity)) 
+        ReserveStreamBuffers();
+    
+    unsigned int slot = (mStreamSlot + 1) % mNumberOfStreamSlots;
+    
+    // Wait for the GPU to finish drawing from this copy
+    if (mStreamFence[slot] != nullptr) {
+        
+        GLenum result = glClientWaitSync( (GLsync)mStreamFence[slot], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 );
+        
+        TraceFenceWait(result != GL_ALREADY_SIGNALED);
+        
+        while (result == GL_TIMEOUT_EXPIRED) 
+            result = glClientWaitSync( (GLsync)mStreamFence[slot], 0, 1000000 );
+        
+        glDeleteSync( (GLsync)mStreamFence[slot] );
+        mStreamFence[slot] = nullptr;
+    }
+    
+    WriteStreamSlot(slot);
+    
+    mStreamSlot = slot;
+    
+    return;
+}
+
+void Mesh::WriteStreamSlot(unsigned int slot) {
+    
+    // Vertices
+    
+    unsigned int vertexEnd = mDirtyVertexEnd[slot];
+    if (vertexEnd > mVertexBufferSz)
+        vertexEnd = mVertexBufferSz;
+    
+    if (mDirtyVertexBegin[slot] < vertexEnd) {
+        
+        unsigned int offset = (slot * mVertexCapacity + mDirtyVertexBegin[slot]) * sizeof(Vertex);
+        unsigned int size   = (vertexEnd - mDirtyVertexBegin[slot]) * sizeof(Vertex);
+        
+        if (mStreamVertex != nullptr) {
+            
+            std::memcpy( (uint8_t*)mStreamVertex + offset, &mVertexBuffer[ mDirtyVertexBegin[slot] ], size );
+            
+        } else {
+            
+            glBindBuffer(GL_ARRAY_BUFFER, mBufferVertex);
+            glBufferSubData(GL_ARRAY_BUFFER, offset, size, &mVertexBuffer[ mDirtyVertexBegin[slot] ]);
+        }
+        
+        TraceStreamWrite(size, mStreamVertex != nullptr);
+    }
+    
+    // Indices
+    
+    unsigned int indexEnd = mDirtyIndexEnd[slot];
+    if (indexEnd > mIndexBufferSz)
+        indexEnd = mIndexBufferSz;
+    
+    if (mDirtyIndexBegin[slot] < indexEnd) {
+        
+        unsigned int offset = (slot * mIndexCapacity + mDirtyIndexBegin[slot]) * sizeof(Index);
+        unsigned int size   = (indexEnd - mDirtyIndexBegin[slot]) * sizeof(Index);
+        
+        if (mStreamIndex != nullptr) {
+            
+            std::memcpy( (uint8_t*)mStreamIndex + offset, &mIndexBuffer[ mDirtyIndexBegin[slot] ], size );
+            
+        } else {
+            
+            glBindVertexArray(mVertexArray);
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, size, &mIndexBuffer[ mDirtyIndexBegin[slot] ]);
+        }
+        
+        TraceStreamWrite(size, mStreamIndex != nullptr);
+    }
+    
+    mDirtyVertexBegin[slot] = streamRangeClean;
+    mDirtyVertexEnd[slot]   = 0;
+    mDirtyIndexBegin[slot]  = streamRangeClean;
+    mDirtyIndexEnd[slot]    = 0;
+    
+    return;
+}
+
+void Mesh::TraceUpload(unsigned int size) {
+    
+    if (mUploadTrace == nullptr)
+        return;
+    
+    mUploadTrace->numberOfUploads++;
+    mUploadTrace->numberOfBytes += size;
+    mUploadTrace->uploadSizes.push_back(size);
+    
+    return;
+}
+
+void Mesh::TraceStreamWrite(unsigned int size, bool isMapped) {
+    
+    TraceUpload(size);
+    
+    if (mUploadTrace == nullptr)
+        return;
+    
+    if (isMapped) {
+        mUploadTrace->numberOfMappedWrites++;
+    } else {
+        mUploadTrace->numberOfSubDataWrites++;
+    }
+    
+    return;
+}
+
+void Mesh::TraceFenceWait(bool isStalled) {
+    
+    if (mUploadTrace == nullptr)
+        return;
+    
+    mUploadTrace->numberOfFenceWaits++;
+    mUploadTrace->numberOfFenceStalls += isStalled;
+    
+    return;
+}
+
+void Mesh::TraceAllocation(void) {
+    
+    if (mUploadTrace == nullptr)
+        return;
+    
+    mUploadTrace->numberOfAllocations++;
+    
+    return;
+}
@@ -0,0 +1,53 @@
+#include <GameEngineFramework/Renderer/components/particlebatch.h>
+
+#define GLEW_STATIC
+#include <gl/glew.h>
+
+
+ParticleBatch::ParticleBatch() :
+    isActive(true),
+    mesh(nullptr),
+    material(nullptr),
+    
+    mPositions(nullptr),
+    mScales(nullptr),
+    mColors(nullptr),
+    
+    mNumberOfParticles(0),
+    
+    mVertexArray(0),
+    mBufferInstance(0),
+    
+    mCapacity(0),
+    
+    mAttachedVertexBuffer(0),
+    mAttachedIndexBuffer(0)
+{
+    glGenVertexArrays(1, &mVertexArray);
+    glGenBuffers(1, &mBufferInstance);
+    
+    return;
+}
+
+ParticleBatch::~ParticleBatch() {
+    
+    glDeleteVertexArrays(1, &mVertexArray);
+    glDeleteBuffers(1, &mBufferInstance);
+    
+    return;
+}
+
+void ParticleBatch::SetParticles(const glm::vec3* positions, const glm::vec3* scales, const glm::vec3* colors, unsigned int count) {
+    
+    mPositions = positions;
+    mScales    = scales;
+    mColors    = colors;
+    
+    mNumberOfParticles = count;
+    
+    return;
+}
+
+unsigned int ParticleBatch::GetNumberOfParticles(void) {
+    return mNumberOfParticles;
+}
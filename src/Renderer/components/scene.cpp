@@ -49,6 +49,38 @@ bool Scene::RemoveMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int rend
     return false;
 }
 
+void Scene::AddInstanceBatchToScene(InstanceBatch* batch) {
+    mInstanceBatches.push_back( batch );
+    return;
+}
+
+bool Scene::RemoveInstanceBatchFromScene(InstanceBatch* batch) {
+    for (std::vector<InstanceBatch*>::iterator it = mInstanceBatches.begin(); it != mInstanceBatches.end(); ++it) {
+        InstanceBatch* batchPtr = *it;
+        if (batch == batchPtr) {
+            mInstanceBatches.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Scene::AddParticleBatchToScene(ParticleBatch* batch) {
+    mParticleBatches.push_back( batch );
+    return;
+}
+
+bool Scene::RemoveParticleBatchFromScene(ParticleBatch* batch) {
+    for (std::vector<ParticleBatch*>::iterator it = mParticleBatches.begin(); it != mParticleBatches.end(); ++it) {
+        ParticleBatch* batchPtr = *it;
+        if (batch == batchPtr) {
+            mParticleBatches.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
 void Scene::AddLightToSceneRoot(Light* light) {
     mLightList.push_back( light );
     return;
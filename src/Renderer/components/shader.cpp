@@ -1,10 +1,13 @@
 #include <GameEngineFramework/Renderer/components/shader.h>
+#include <GameEngineFramework/Renderer/enumerators.h>
 
 #define GLEW_STATIC
 #include <gl/glew.h>
 
 #include <iostream>
 
+unsigned int Shader::mNumberOfUniformUpdates = 0;
+
 
 Shader::Shader() : 
     mShaderProgram(0),
@@ -44,113 +47,135 @@ Shader::~Shader() {
 }
 
 void Shader::SetModelMatrix(glm::mat4 &ModelMatrix) {
+    mNumberOfUniformUpdates++;
     glUniformMatrix4fv(mModelMatrixLocation, 1, GL_FALSE, &ModelMatrix[0][0]);
     return;
 }
 
 void Shader::SetInverseModelMatrix(glm::mat3 &InverseModelMatrix) {
+    mNumberOfUniformUpdates++;
     glUniformMatrix3fv(mModelInvMatrixLocation, 1, GL_FALSE, &InverseModelMatrix[0][0]);
     return;
 }
 
 void Shader::SetShadowMatrix(glm::mat4 &shadowMatrix) {
+    mNumberOfUniformUpdates++;
     glUniformMatrix4fv(mShadowMatrixLocation, 1, GL_FALSE, &shadowMatrix[0][0]);
     return;
 }
 
 void Shader::SetProjectionMatrix(glm::mat4 &projectionMatrix) {
+    mNumberOfUniformUpdates++;
     glUniformMatrix4fv(mProjectionMatrixLocation, 1, GL_FALSE, &projectionMatrix[0][0]);
     return;
 }
 
 void Shader::SetCameraPosition(glm::vec3 cameraPosition) {
+    mNumberOfUniformUpdates++;
     glUniform3f(mCameraPosition, cameraPosition.x, cameraPosition.y, cameraPosition.z);
     return;
 }
 
 void Shader::SetCameraAngle(glm::vec3 cameraAngle) {
+    mNumberOfUniformUpdates++;
     glUniform3f(mCameraAngle, cameraAngle.x, cameraAngle.y, cameraAngle.z);
     return;
 }
 
 void Shader::SetMaterialAmbient(Color color) {
+    mNumberOfUniformUpdates++;
     glUniform3f(mMaterialAmbientLocation, color.r, color.g, color.b);
     return;
 }
 
 void Shader::SetMaterialDiffuse(Color color) {
+    mNumberOfUniformUpdates++;
     glUniform3f(mMaterialDiffuseLocation, color.r, color.g, color.b);
     return;
 }
 
 void Shader::SetMaterialSpecular(Color color) {
+    mNumberOfUniformUpdates++;
     glUniform3f(mMaterialSpecularLocation, color.r, color.g, color.b);
     return;
 }
 
 void Shader::SetTextureSampler(unsigned int index) {
+    mNumberOfUniformUpdates++;
     glUniform1i(mSamplerLocation, index);
     return;
 }
 
 
 void Shader::SetFogCount(int numberOfFogLayers) {
+    mNumberOfUniformUpdates++;
     glUniform1i(mFogCountLocation, numberOfFogLayers);
     return;
 }
 
 void Shader::SetFogDensity(unsigned int numberOfLayers, float* density) {
+    mNumberOfUniformUpdates++;
     glUniform1fv(mFogDensityLocation, numberOfLayers, density);
     return;
 }
 
 void Shader::SetFogHeightCutoff(unsigned int numberOfLayers, float* height) {
+    mNumberOfUniformUpdates++;
     glUniform1fv(mFogHeightCutoffLocation, numberOfLayers, height);
     return;
 }
 
 void Shader::SetFogBegin(unsigned int numberOfLayers, float* begin) {
+    mNumberOfUniformUpdates++;
     glUniform1fv(mFogBeginLocation, numberOfLayers, begin);
     return;
 }
 
 void Shader::SetFogEnd(unsigned int numberOfLayers, float* end) {
+    mNumberOfUniformUpdates++;
     glUniform1fv(mFogEndLocation, numberOfLayers, end);
     return;
 }
 
 void Shader::SetFogColorBegin(unsigned int numberOfLayers, glm::vec3* color) {
+    mNumberOfUniformUpdates++;
     glUniform3fv(mFogBeginColorLocation, numberOfLayers, &color[0][0]);
     return;
 }
 
 void Shader::SetFogColorEnd(unsigned int numberOfLayers, glm::vec3* color) {
+    mNumberOfUniformUpdates++;
     glUniform3fv(mFogEndColorLocation, numberOfLayers, &color[0][0]);
     return;
 }
 
 
 void Shader::SetLightCount(unsigned int numberOfLights) {
+    mNumberOfUniformUpdates++;
     glUniform1i(mLightCount, numberOfLights);
     return;
 }
 
 void Shader::SetLightPositions(unsigned int numberOfLights, glm::vec3* lightPositions) {
+    mNumberOfUniformUpdates++;
     glUniform3fv(mLightPosition, numberOfLights, &lightPositions[0][0]);
     return;
 }
 
 void Shader::SetLightDirections(unsigned int numberOfLights, glm::vec3* lightDirections) {
+    mNumberOfUniformUpdates++;
     glUniform3fv(mLightDirection, numberOfLights, &lightDirections[0][0]);
     return;
 }
 
 void Shader::SetLightAttenuation(unsigned int numberOfLights, glm::vec4* lightAttenuation) {
+    mNumberOfUniformUpdates++;
     glUniform4fv(mLightAttenuation, numberOfLights, &lightAttenuation[0][0]);
     return;
 }
 
 void Shader::SetLightColors(unsigned int numberOfLights, glm::vec3* lightColors) {
+    mNumberOfUniformUpdates++;
     glUniform3fv(mLightColor, numberOfLights, &lightColors[0][0]);
     return;
 }
@@ -215,6 +240,24 @@ void Shader::SetUniformLocations(void) {
     mLightAttenuation          = glGetUniformLocation(mShaderProgram, lightAttenuationUniformName.c_str());
     mLightColor                = glGetUniformLocation(mShaderProgram, lightColorUniformName.c_str());
     
+    // Per frame and per draw data shared through uniform buffers
+    BindUniformBlock("CameraBlock", RENDER_UNIFORM_BLOCK_CAMERA);
+    BindUniformBlock("LightBlock",  RENDER_UNIFORM_BLOCK_LIGHTS);
+    BindUniformBlock("FogBlock",    RENDER_UNIFORM_BLOCK_FOG);
+    BindUniformBlock("ObjectBlock", RENDER_UNIFORM_BLOCK_OBJECT);
+    
+    return;
+}
+
+void Shader::BindUniformBlock(std::string blockName, unsigned int bindingPoint) {
+    
+    unsigned int blockIndex = glGetUniformBlockIndex(mShaderProgram, blockName.c_str());
+    
+    if (blockIndex == GL_INVALID_INDEX) 
+        return;
+    
+    glUniformBlockBinding(mShaderProgram, blockIndex, bindingPoint);
+    
     return;
 }
 
@@ -248,6 +291,10 @@ int Shader::CreateShaderProgram(std::string VertexScript, std::string FragmentSc
     
     SetUniformLocations();
     
+    // Every material texture is bound to the first slot
+    glUseProgram(mShaderProgram);
+    glUniform1i(mSamplerLocation, 0);
+    
     mIsShaderLoaded = true;
     return 1;
 }
@@ -18,6 +18,9 @@ void RenderSystem::accumulateSceneFogLayers(Scene* currentScene) {
         if (!fogLayer->fogActive) 
             continue;
         
+        if (mNumberOfFogLayers >= RENDER_NUMBER_OF_FOG_LAYERS) 
+            break;
+        
         mFogDensity[mNumberOfFogLayers]       = fogLayer->fogDensity;
         mFogHeightCutoff[mNumberOfFogLayers]  = fogLayer->fogHeightCutoff;
         mFogBegin[mNumberOfFogLayers]         = fogLayer->fogBegin;
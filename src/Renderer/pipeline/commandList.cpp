@@ -0,0 +1,64 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+
+
+RenderCommandList::RenderCommandList() :
+    mNumberOfSegments(0)
+{
+}
+
+RenderCommandList::~RenderCommandList() {
+    
+    for (unsigned int i=0; i < mSegments.size(); i++)
+        delete mSegments[i];
+    
+    return;
+}
+
+unsigned int RenderCommandList::GetNumberOfSegments(void) {
+    return mNumberOfSegments;
+}
+
+RenderCommandSegment* RenderCommandList::GetSegment(unsigned int index) {
+    
+    if (index >= mNumberOfSegments)
+        return nullptr;
+    
+    return mSegments[index];
+}
+
+unsigned int RenderCommandList::GetNumberOfScenes(void) {
+    return mScenes.size();
+}
+
+unsigned int RenderCommandList::GetNumberOfCommands(void) {
+    
+    unsigned int numberOfCommands = 0;
+    
+    for (unsigned int i=0; i < mNumberOfSegments; i++)
+        numberOfCommands += mSegments[i]->commands.size();
+    
+    return numberOfCommands;
+}
+
+void RenderCommandList::Clear(void) {
+    
+    mScenes.clear();
+    
+    for (unsigned int i=0; i < mNumberOfSegments; i++) {
+        
+        mSegments[i]->commands.clear();
+        mSegments[i]->objectBlocks.clear();
+    }
+    
+    mNumberOfSegments = 0;
+    
+    return;
+}
+
+RenderCommandSegment* RenderCommandList::AddSegment(void) {
+    
+    if (mNumberOfSegments == mSegments.size())
+        mSegments.push_back( new RenderCommandSegment() );
+    
+    return mSegments[mNumberOfSegments++];
+}
@@ -10,50 +10,85 @@ bool RenderSystem::BindMaterial(Material* materialPtr) {
         return false;
     
     mCurrentMaterial = materialPtr;
+    mNumberOfMaterialBinds++;
     
-    mCurrentMaterial->texture.Bind();
-    mCurrentMaterial->texture.BindTextureSlot(0);
+    // Only the state which differs from the last material is sent
+    
+    if (mCurrentState.texture != mCurrentMaterial->texture.mTextureBuffer) {
+        
+        mCurrentMaterial->texture.Bind();
+        mCurrentMaterial->texture.BindTextureSlot(0);
+        
+        mCurrentState.texture = mCurrentMaterial->texture.mTextureBuffer;
+    }
     
     // Depth testing
     
     if (mCurrentMaterial->mDoDepthTest) {
         
-        glEnable(GL_DEPTH_TEST);
-        
-        glDepthMask(mCurrentMaterial->mDoDepthTest);
-        
-        glDepthFunc(mCurrentMaterial->mDepthFunc);
+        if (mCurrentState.doDepthTest != 1) {
+            
+            glEnable(GL_DEPTH_TEST);
+            
+            glDepthMask(mCurrentMaterial->mDoDepthTest);
+            
+            mCurrentState.doDepthTest = 1;
+        }
+        
+        if (mCurrentState.depthFunc != mCurrentMaterial->mDepthFunc) {
+            
+            glDepthFunc(mCurrentMaterial->mDepthFunc);
+            
+            mCurrentState.depthFunc = mCurrentMaterial->mDepthFunc;
+        }
         
 #ifdef RENDERER_CHECK_OPENGL_ERRORS
     GetGLErrorCodes("OnRender::Material::DepthTest::");
 #endif
         
-    } else {
+    } else if (mCurrentState.doDepthTest != 0) {
         
         glDisable(GL_DEPTH_TEST);
         
+        mCurrentState.doDepthTest = 0;
     }
     
     // Face culling and winding
     
     if (mCurrentMaterial->mDoFaceCulling) {
         
-        glEnable(GL_CULL_FACE);
+        if (mCurrentState.doFaceCulling != 1) {
+            
+            glEnable(GL_CULL_FACE);
+            
+            mCurrentState.doFaceCulling = 1;
+        }
         
-        glCullFace(mCurrentMaterial->mFaceCullSide);
+        if (mCurrentState.faceCullSide != mCurrentMaterial->mFaceCullSide) {
+            
+            glCullFace(mCurrentMaterial->mFaceCullSide);
+            
+            mCurrentState.faceCullSide = mCurrentMaterial->mFaceCullSide;
+        }
         
 #ifdef RENDERER_CHECK_OPENGL_ERRORS
     GetGLErrorCodes("OnRender::Material::Culling::");
 #endif
         
-    } else {
+    } else if (mCurrentState.doFaceCulling != 0) {
         
         glDisable(GL_CULL_FACE);
         
+        mCurrentState.doFaceCulling = 0;
     }
     
     // Face winding order
-    glFrontFace(mCurrentMaterial->mFaceWinding);
+    if (mCurrentState.faceWinding != mCurrentMaterial->mFaceWinding) {
+        
+        glFrontFace(mCurrentMaterial->mFaceWinding);
+        
+        mCurrentState.faceWinding = mCurrentMaterial->mFaceWinding;
+    }
     
 #ifdef RENDERER_CHECK_OPENGL_ERRORS
     GetGLErrorCodes("OnRender::Material::FaceWinding::");
@@ -63,21 +98,38 @@ bool RenderSystem::BindMaterial(Material* materialPtr) {
     
     if (mCurrentMaterial->mDoBlending) {
         
-        glEnable(GL_BLEND);
-        
-        glBlendFuncSeparate(mCurrentMaterial->mBlendSource,
-                            mCurrentMaterial->mBlendDestination,
-                            mCurrentMaterial->mBlendAlphaSource,
-                            mCurrentMaterial->mBlendAlphaDestination);
+        if (mCurrentState.doBlending != 1) {
+            
+            glEnable(GL_BLEND);
+            
+            mCurrentState.doBlending = 1;
+        }
+        
+        if ((mCurrentState.blendSource           != mCurrentMaterial->mBlendSource) |
+            (mCurrentState.blendDestination      != mCurrentMaterial->mBlendDestination) |
+            (mCurrentState.blendAlphaSource      != mCurrentMaterial->mBlendAlphaSource) |
+            (mCurrentState.blendAlphaDestination != mCurrentMaterial->mBlendAlphaDestination)) {
+            
+            glBlendFuncSeparate(mCurrentMaterial->mBlendSource,
+                                mCurrentMaterial->mBlendDestination,
+                                mCurrentMaterial->mBlendAlphaSource,
+                                mCurrentMaterial->mBlendAlphaDestination);
+            
+            mCurrentState.blendSource           = mCurrentMaterial->mBlendSource;
+            mCurrentState.blendDestination      = mCurrentMaterial->mBlendDestination;
+            mCurrentState.blendAlphaSource      = mCurrentMaterial->mBlendAlphaSource;
+            mCurrentState.blendAlphaDestination = mCurrentMaterial->mBlendAlphaDestination;
+        }
         
 #ifdef RENDERER_CHECK_OPENGL_ERRORS
     GetGLErrorCodes("OnRender::Material::Blending::");
 #endif
         
-    } else {
+    } else if (mCurrentState.doBlending != 0) {
         
         glDisable(GL_BLEND);
         
+        mCurrentState.doBlending = 0;
     }
     
     return true;
@@ -10,6 +10,7 @@ bool RenderSystem::BindMesh(Mesh* meshPtr) {
         return false;
     
     mCurrentMesh = meshPtr;
+    mNumberOfMeshBinds++;
     
     mCurrentMesh->Bind();
     
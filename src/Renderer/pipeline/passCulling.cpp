@@ -7,7 +7,7 @@
 #include <glm/gtc/matrix_inverse.hpp>
 
 // Perform frustum culling
-bool RenderSystem::CullingPass(MeshRenderer* currentEntity, Camera* currentCamera, glm::mat4& viewProjection, Frustum& frustum) {
+bool RenderSystem::CullingPass(MeshRenderer* currentEntity, Frustum& frustum) {
     
     // Calculate frustum position
     glm::vec3 mBoundingAreaMax = currentEntity->transform.position + currentEntity->mBoundingBoxMax;
@@ -4,27 +4,18 @@
 #include <GameEngineFramework/Types/types.h>
 
 
-bool RenderSystem::GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection) {
-    
-    if (!currentEntity->isActive) 
-        return false;
+bool RenderSystem::GeometryPass(RenderCommand& command) {
     
     // Mesh binding
     
-    // Level of detail shift selection
-    Mesh* meshLOD = LevelOfDetailPass(currentEntity, eye);
-    
-    if (meshLOD == nullptr) 
-        return false;
+    // Level of detail was selected when the command was recorded
+    Mesh* meshLOD = command.mesh;
     
     BindMesh( meshLOD );
     
     // Material binding
     
-    Material* materialPtr = currentEntity->material;
-    
-    if (materialPtr == nullptr) 
-        return false;
+    Material* materialPtr = command.material;
     
     BindMaterial( materialPtr );
     
@@ -37,26 +28,12 @@ bool RenderSystem::GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm
     
     BindShader( shaderPtr );
     
-    // Set the projection
-    
-    mCurrentShader->SetProjectionMatrix( viewProjection );
-    mCurrentShader->SetModelMatrix( currentEntity->transform.matrix );
-    
-    // Inverse transpose model matrix for lighting with non linear scaling
-    glm::mat3 invTransposeMatrix = glm::transpose( glm::inverse( currentEntity->transform.matrix ) );
-    
-    mCurrentShader->SetInverseModelMatrix( invTransposeMatrix );
-    
-    mCurrentShader->SetCameraPosition(eye);
-    mCurrentShader->SetCameraAngle(cameraAngle);
-    
-    // Set the material
-    mCurrentShader->SetMaterialAmbient(mCurrentMaterial->ambient);
-    mCurrentShader->SetMaterialDiffuse(mCurrentMaterial->diffuse);
-    mCurrentShader->SetMaterialSpecular(mCurrentMaterial->specular);
+    // Point the object block at this renderers transform and colors
+    glBindBufferRange(GL_UNIFORM_BUFFER, RENDER_UNIFORM_BLOCK_OBJECT, mUniformBufferObject,
+                      command.objectIndex * mObjectBlockStride, sizeof(UniformBlockObject));
     
     // Render the geometry
-    currentEntity->mesh->DrawIndexArray();
+    meshLOD->DrawIndexArray();
     mNumberOfDrawCalls++;
     
     return true;
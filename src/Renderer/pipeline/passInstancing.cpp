@@ -0,0 +1,128 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/types.h>
+#include <cstddef>
+
+
+unsigned int RenderSystem::PackInstances(InstanceBatch* batch, Frustum& frustum) {
+    
+    batch->mInstances.clear();
+    
+    if (!batch->isActive)
+        return 0;
+    
+    Material* materialPtr = batch->material;
+    
+    if ((batch->mesh == nullptr) | (materialPtr == nullptr))
+        return 0;
+    
+    if (materialPtr->shader == nullptr)
+        return 0;
+    
+    // Pack the visible renderers into the instance list
+    
+    for (unsigned int i=0; i < batch->mMeshRenderers.size(); i++) {
+        
+        MeshRenderer* currentEntity = batch->mMeshRenderers[i];
+        
+        if (!currentEntity->isActive)
+            continue;
+        
+        if (currentEntity->mDoCulling && CullingPass(currentEntity, frustum))
+            continue;
+        
+        // Colors come from the renderer material when it has one
+        Material* colorSource = (currentEntity->material != nullptr) ? currentEntity->material : materialPtr;
+        
+        RenderInstance instance;
+        instance.model   = currentEntity->transform.matrix;
+        instance.diffuse = glm::vec4(colorSource->diffuse.r, colorSource->diffuse.g, colorSource->diffuse.b, 1.0f);
+        instance.ambient = glm::vec4(colorSource->ambient.r, colorSource->ambient.g, colorSource->ambient.b, 1.0f);
+        
+        batch->mInstances.push_back(instance);
+    }
+    
+    return batch->mInstances.size();
+}
+
+
+bool RenderSystem::InstancingPass(InstanceBatch* batch) {
+    
+    unsigned int numberOfInstances = batch->mInstances.size();
+    
+    if (numberOfInstances == 0)
+        return false;
+    
+    Mesh* meshPtr = batch->mesh;
+    Material* materialPtr = batch->material;
+    
+    // The batch draws through its own vertex array
+    glBindVertexArray(batch->mVertexArray);
+    mCurrentMesh = nullptr;
+    mNumberOfMeshBinds++;
+    
+    // Attach the mesh buffers when the mesh changes
+    if ((batch->mAttachedVertexBuffer != meshPtr->mBufferVertex) |
+        (batch->mAttachedIndexBuffer  != meshPtr->mBufferIndex)) {
+        
+        glBindBuffer(GL_ARRAY_BUFFER, meshPtr->mBufferVertex);
+        
+        // Same layout as the mesh vertex array
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(2);
+        glEnableVertexAttribArray(3);
+        
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)12);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)24);
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)36);
+        
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshPtr->mBufferIndex);
+        
+        // Instance attributes advance once per instance
+        glBindBuffer(GL_ARRAY_BUFFER, batch->mBufferInstance);
+        
+        for (unsigned int column=0; column < 4; column++) {
+            
+            glEnableVertexAttribArray(RENDER_INSTANCE_ATTRIBUTE + column);
+            glVertexAttribPointer(RENDER_INSTANCE_ATTRIBUTE + column, 4, GL_FLOAT, GL_FALSE, sizeof(RenderInstance),
+                                  (void*)(sizeof(glm::vec4) * column));
+            glVertexAttribDivisor(RENDER_INSTANCE_ATTRIBUTE + column, 1);
+        }
+        
+        glEnableVertexAttribArray(RENDER_INSTANCE_ATTRIBUTE + 4);
+        glVertexAttribPointer(RENDER_INSTANCE_ATTRIBUTE + 4, 4, GL_FLOAT, GL_FALSE, sizeof(RenderInstance),
+                              (void*)offsetof(RenderInstance, diffuse));
+        glVertexAttribDivisor(RENDER_INSTANCE_ATTRIBUTE + 4, 1);
+        
+        glEnableVertexAttribArray(RENDER_INSTANCE_ATTRIBUTE + 5);
+        glVertexAttribPointer(RENDER_INSTANCE_ATTRIBUTE + 5, 4, GL_FLOAT, GL_FALSE, sizeof(RenderInstance),
+                              (void*)offsetof(RenderInstance, ambient));
+        glVertexAttribDivisor(RENDER_INSTANCE_ATTRIBUTE + 5, 1);
+        
+        batch->mAttachedVertexBuffer = meshPtr->mBufferVertex;
+        batch->mAttachedIndexBuffer  = meshPtr->mBufferIndex;
+    }
+    
+    // Replace the instance data for this frame
+    glBindBuffer(GL_ARRAY_BUFFER, batch->mBufferInstance);
+    glBufferData(GL_ARRAY_BUFFER, numberOfInstances * sizeof(RenderInstance), batch->mInstances.data(), GL_STREAM_DRAW);
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::Instancing::Upload::");
+#endif
+    
+    BindMaterial( materialPtr );
+    BindShader( materialPtr->shader );
+    
+    // Camera, lights and fog come from the scene uniform blocks
+    mCurrentShader->SetMaterialSpecular(mCurrentMaterial->specular);
+    
+    // Render every instance
+    glDrawElementsInstanced(meshPtr->mPrimitive, meshPtr->mIndexBufferSz, GL_UNSIGNED_INT, (void*)0, numberOfInstances);
+    mNumberOfDrawCalls++;
+    
+    return true;
+}
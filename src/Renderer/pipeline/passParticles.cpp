@@ -0,0 +1,97 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/types.h>
+
+
+bool RenderSystem::ParticlePass(ParticleBatch* batch) {
+    
+    if (!batch->isActive)
+        return false;
+    
+    unsigned int numberOfParticles = batch->mNumberOfParticles;
+    
+    if (numberOfParticles == 0)
+        return false;
+    
+    Mesh* meshPtr = batch->mesh;
+    Material* materialPtr = batch->material;
+    
+    if ((meshPtr == nullptr) | (materialPtr == nullptr))
+        return false;
+    
+    if (materialPtr->shader == nullptr)
+        return false;
+    
+    // The batch draws through its own vertex array
+    glBindVertexArray(batch->mVertexArray);
+    mCurrentMesh = nullptr;
+    mNumberOfMeshBinds++;
+    
+    bool doAttach = (batch->mAttachedVertexBuffer != meshPtr->mBufferVertex) |
+                    (batch->mAttachedIndexBuffer  != meshPtr->mBufferIndex);
+    
+    // Grow the instance buffer, positions, scales and colors each take a section
+    if (numberOfParticles > batch->mCapacity) {
+        
+        batch->mCapacity = numberOfParticles + numberOfParticles / 2;
+        
+        doAttach = true;
+    }
+    
+    if (doAttach) {
+        
+        glBindBuffer(GL_ARRAY_BUFFER, meshPtr->mBufferVertex);
+        
+        // Same layout as the mesh vertex array
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(2);
+        glEnableVertexAttribArray(3);
+        
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)12);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)24);
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)36);
+        
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshPtr->mBufferIndex);
+        
+        // Instance attributes advance once per particle
+        glBindBuffer(GL_ARRAY_BUFFER, batch->mBufferInstance);
+        
+        for (unsigned int section=0; section < 3; section++) {
+            
+            glEnableVertexAttribArray(RENDER_INSTANCE_ATTRIBUTE + section);
+            glVertexAttribPointer(RENDER_INSTANCE_ATTRIBUTE + section, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3),
+                                  (void*)(batch->mCapacity * sizeof(glm::vec3) * section));
+            glVertexAttribDivisor(RENDER_INSTANCE_ATTRIBUTE + section, 1);
+        }
+        
+        batch->mAttachedVertexBuffer = meshPtr->mBufferVertex;
+        batch->mAttachedIndexBuffer  = meshPtr->mBufferIndex;
+    }
+    
+    // Orphan last frames storage then copy each particle array into its section
+    unsigned int sectionSize = batch->mCapacity * sizeof(glm::vec3);
+    unsigned int uploadSize  = numberOfParticles * sizeof(glm::vec3);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, batch->mBufferInstance);
+    glBufferData(GL_ARRAY_BUFFER, sectionSize * 3, NULL, GL_STREAM_DRAW);
+    
+    glBufferSubData(GL_ARRAY_BUFFER, 0,               uploadSize, batch->mPositions);
+    glBufferSubData(GL_ARRAY_BUFFER, sectionSize,     uploadSize, batch->mScales);
+    glBufferSubData(GL_ARRAY_BUFFER, sectionSize * 2, uploadSize, batch->mColors);
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::Particles::Upload::");
+#endif
+    
+    BindMaterial( materialPtr );
+    BindShader( materialPtr->shader );
+    
+    // Render every particle
+    glDrawElementsInstanced(meshPtr->mPrimitive, meshPtr->mIndexBufferSz, GL_UNSIGNED_INT, (void*)0, numberOfParticles);
+    mNumberOfDrawCalls++;
+    
+    return true;
+}
@@ -4,29 +4,20 @@
 #include <GameEngineFramework/Types/types.h>
 
 
-bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection) {
+bool RenderSystem::ShadowVolumePass(RenderCommand& command, RenderScenePacket& scene) {
     
-    if (!currentEntity->isActive) 
-        return false;
-    
-    if (currentEntity->material == nullptr) 
-        return false;
-    
-    if (!currentEntity->material->mDoShadowPass)
-        return false;
-    
-    // Calculate shadow distance
-    float shadowDistance = glm::distance( eye, currentEntity->transform.position );
+    // Visibility and shadow distance were checked when the command was recorded
+    MeshRenderer* currentEntity = command.renderer;
     
-    if (shadowDistance > mShadowDistance) 
-        return false;
+    glm::vec3 eye         = glm::vec3(scene.camera.eye);
+    glm::vec3 cameraAngle = glm::vec3(scene.camera.angle);
     
     // Strip out model rotation to prevent shadow rotation
     glm::mat4 modelMatrix = glm::identity<glm::mat4>();
     modelMatrix = glm::translate(modelMatrix, currentEntity->transform.position);
     modelMatrix = glm::scale(modelMatrix, currentEntity->transform.scale);
     
-    shaders.shadowCaster->SetProjectionMatrix( viewProjection );
+    shaders.shadowCaster->SetProjectionMatrix( scene.camera.viewProjection );
     shaders.shadowCaster->SetModelMatrix( modelMatrix );
     shaders.shadowCaster->SetCameraPosition(eye);
     shaders.shadowCaster->SetCameraAngle(cameraAngle);
@@ -36,13 +27,13 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
     
     glEnable( GL_CULL_FACE );
     
-    for (unsigned int s=0; s < mNumberOfShadows; s++) {
+    for (unsigned int s=0; s < scene.numberOfShadows; s++) {
         
         float shadowLength = currentEntity->material->mShadowVolumeLength;
         
         mShadowTransform.SetIdentity();
         
-        mShadowTransform.RotateWorldAxis( 180, mShadowDirection[s], Vector3(0, 0, 0) );
+        mShadowTransform.RotateWorldAxis( 180, scene.shadowDirection[s], Vector3(0, 0, 0) );
         
         // Rotate by the inverse light angle
         glm::vec3 angles = currentEntity->transform.EulerAngles();
@@ -63,8 +54,8 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
         glm::vec4 shadowAttenuation[1];
         glm::vec3 shadowColor[1];
         
-        shadowPosition[0]   = mShadowPosition[s];
-        shadowDirection[0]  = mShadowDirection[s];
+        shadowPosition[0]   = scene.shadowPosition[s];
+        shadowDirection[0]  = scene.shadowDirection[s];
         
         // Shadow color
         shadowColor[0] = glm::vec3(currentEntity->material->mShadowVolumeColor.r, 
@@ -88,12 +79,16 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
         
         // Render the shadow pass
         mNumberOfDrawCalls++;
-        currentEntity->mesh->DrawIndexArray();
+        command.mesh->DrawIndexArray();
         
         continue;
     }
     
     
+    // Restore the state of the last bound material
+    if (mCurrentMaterial == nullptr) 
+        return true;
+    
     if (mCurrentMaterial->mDoBlending) {
         
         glEnable( GL_BLEND );
@@ -223,6 +218,10 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
         continue;
     }
     
+    // Restore the state of the last bound material
+    if (mCurrentMaterial == nullptr) 
+        return true;
+    
     if (mCurrentMaterial->mDoBlending) {
         
         glEnable( GL_BLEND );
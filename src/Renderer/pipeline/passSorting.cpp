@@ -3,29 +3,134 @@
 
 #include <GameEngineFramework/Types/types.h>
 
+#include <cstring>
 
-bool RenderSystem::SortingPass(glm::vec3& eye, std::vector<MeshRenderer*>* renderQueueGroup) {
+// Sort key layout from the most significant bit
+//  3 bits  render queue group
+//  1 bit   blended
+// 60 bits  shader, material, mesh then depth for opaque draws
+//          depth, shader, material then mesh for blended draws
+
+static const unsigned int sortShaderBits    = 12;
+static const unsigned int sortMaterialBits  = 16;
+static const unsigned int sortMeshBits      = 16;
+static const unsigned int sortDepthBits     = 16;
+
+static const uint64_t sortShaderMask    = (1ull << sortShaderBits) - 1;
+static const uint64_t sortMaterialMask  = (1ull << sortMaterialBits) - 1;
+static const uint64_t sortMeshMask      = (1ull << sortMeshBits) - 1;
+
+// Upper bits of a positive float keep its ordering
+static inline uint64_t QuantizeDepth(float depth) {
+    
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(float));
+    
+    return bits >> (32 - sortDepthBits);
+}
+
+
+unsigned int RenderSystem::SortingPass(RenderCommandSegment* segment, glm::vec3& eye, Frustum& frustum, std::vector<MeshRenderer*>* renderQueueGroup) {
+    
+    std::vector<RenderQueueItem>& sorted = segment->sorted;
+    sorted.clear();
+    
+    uint64_t queueGroup = segment->queueGroup;
+    
+    for (MeshRenderer* currentEntity : *renderQueueGroup) {
+        
+        if (!currentEntity->isActive) 
+            continue;
+        
+        if (currentEntity->mDoCulling && CullingPass(currentEntity, frustum))
+            continue;
+        
+        Material* materialPtr = currentEntity->material;
+        Mesh*     meshPtr     = currentEntity->mesh;
+        
+        if ((materialPtr == nullptr) | (meshPtr == nullptr)) 
+            continue;
+        
+        // Squared distance sorts the same as the distance
+        glm::vec3 offset = currentEntity->transform.position - eye;
+        uint64_t depth = QuantizeDepth( glm::dot(offset, offset) );
+        
+        uint64_t shader   = (materialPtr->shader != nullptr) ? (materialPtr->shader->mShaderProgram & sortShaderMask) : 0;
+        uint64_t material = materialPtr->mSortId & sortMaterialMask;
+        uint64_t mesh     = meshPtr->mVertexArray & sortMeshMask;
+        
+        uint64_t state = (((shader << sortMaterialBits) | material) << sortMeshBits) | mesh;
+        
+        RenderQueueItem item;
+        item.renderer = currentEntity;
+        item.key = queueGroup << 61;
+        
+        // Blended draws keep their depth order, opaque draws are grouped by state
+        if (materialPtr->mDoBlending) {
+            item.key |= (1ull << 60) | (depth << 44) | state;
+        } else {
+            item.key |= (state << sortDepthBits) | depth;
+        }
+        
+        sorted.push_back(item);
+    }
+    
+    RenderQueueSort(sorted, segment->buffer);
+    
+    return sorted.size();
+}
+
+
+void RenderQueueSort(std::vector<RenderQueueItem>& items, std::vector<RenderQueueItem>& buffer) {
+    
+    unsigned int numberOfItems = items.size();
+    
+    if (numberOfItems < 2) 
+        return;
+    
+    // Count every byte of the keys in one sweep
+    unsigned int histogram[8][256];
+    std::memset(histogram, 0, sizeof(histogram));
     
-    std::vector< std::pair<float, MeshRenderer*> > sortList;
-    sortList.reserve(renderQueueGroup->size());
+    for (unsigned int i=0; i < numberOfItems; i++) {
+        
+        uint64_t key = items[i].key;
+        
+        for (unsigned int b=0; b < 8; b++) 
+            histogram[b][(key >> (b * 8)) & 0xff]++;
+    }
     
-    std::transform(renderQueueGroup->begin(), renderQueueGroup->end(), std::back_inserter(sortList),
-                   [&eye](MeshRenderer* renderer) {
-                       return std::make_pair(glm::distance(eye, renderer->transform.position), renderer);
-                   });
+    buffer.resize(numberOfItems);
     
-    std::sort(sortList.begin(), sortList.end(), [](const std::pair<float, MeshRenderer*>& a, const std::pair<float, MeshRenderer*>& b) {
-        return a.first < b.first;
-    });
+    RenderQueueItem* source      = items.data();
+    RenderQueueItem* destination = buffer.data();
     
-    renderQueueGroup->clear();
-    renderQueueGroup->reserve(sortList.size());
+    for (unsigned int b=0; b < 8; b++) {
+        
+        unsigned int* counts = histogram[b];
+        
+        // Skip bytes which are the same for every key
+        if (counts[(source[0].key >> (b * 8)) & 0xff] == numberOfItems) 
+            continue;
+        
+        unsigned int offset = 0;
+        for (unsigned int d=0; d < 256; d++) {
+            unsigned int count = counts[d];
+            counts[d] = offset;
+            offset += count;
+        }
+        
+        for (unsigned int i=0; i < numberOfItems; i++) {
+            unsigned int digit = (source[i].key >> (b * 8)) & 0xff;
+            destination[ counts[digit]++ ] = source[i];
+        }
+        
+        std::swap(source, destination);
+    }
     
-    std::transform(sortList.begin(), sortList.end(), std::back_inserter(*renderQueueGroup),
-                   [](const std::pair<float, MeshRenderer*>& pair) {
-                       return pair.second;
-                   });
+    if (source != items.data()) 
+        items.swap(buffer);
     
-    return true;
+    return;
 }
 
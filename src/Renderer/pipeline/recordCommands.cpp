@@ -0,0 +1,224 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/types.h>
+
+
+void RenderSystem::RecordFrame(RenderCommandList& commandList) {
+    
+    BeginRecording(commandList);
+    
+    for (unsigned int i=0; i < commandList.mNumberOfSegments; i++)
+        mRecorders.Wait( &commandList.mSegments[i]->counter );
+    
+    return;
+}
+
+void RenderSystem::BeginRecording(RenderCommandList& commandList) {
+    
+    commandList.Clear();
+    
+    if (doUpdateLightsEveryFrame) {
+        mNumberOfLights = 0;
+        mNumberOfShadows = 0;
+    }
+    
+    // Scene packets are finished before any job starts so the jobs only read them
+    for (Scene* scenePtr : mActiveScenes) {
+        
+        if (!scenePtr->isActive)
+            continue;
+        
+        if (scenePtr->camera == nullptr)
+            continue;
+        
+        commandList.mScenes.resize( commandList.mScenes.size() + 1 );
+        RenderScenePacket& scene = commandList.mScenes.back();
+        
+        scene.scene    = scenePtr;
+        scene.viewport = scenePtr->camera->viewport;
+        
+        glm::mat4 viewProjection;
+        glm::vec3 eye;
+        
+        // Set the camera projection angle
+        setTargetCamera(scenePtr->camera, eye, viewProjection);
+        
+        // Extract camera project edges for clipping
+        glm::mat4 inverseViewProjMatrix = glm::inverse( viewProjection );
+        scene.frustum = FrustumExtractPlanes(inverseViewProjMatrix);
+        
+        // Gather fog layers
+        accumulateSceneFogLayers(scenePtr);
+        
+        // Gather active lights in this scene
+        if (scenePtr->doUpdateLights) {
+            accumulateSceneLights(scenePtr, eye);
+            
+            if (mNumberOfLights > RENDER_NUMBER_OF_LIGHTS)
+                mNumberOfLights = RENDER_NUMBER_OF_LIGHTS;
+            
+            if (!doUpdateLightsEveryFrame)
+                scenePtr->doUpdateLights = false;
+        }
+        
+        RecordUniformBlocks(scene, eye, scenePtr->camera->forward, viewProjection);
+        
+        scene.numberOfShadows = mNumberOfShadows;
+        
+        for (unsigned int s=0; s < mNumberOfShadows; s++) {
+            scene.shadowPosition[s]  = mShadowPosition[s];
+            scene.shadowDirection[s] = mShadowDirection[s];
+        }
+        
+        continue;
+    }
+    
+    // One job for each render queue group with anything to draw
+    for (unsigned int sceneIndex=0; sceneIndex < commandList.mScenes.size(); sceneIndex++) {
+        
+        Scene* scenePtr = commandList.mScenes[sceneIndex].scene;
+        
+        for (unsigned int group = 0; group < RENDER_NUMBER_OF_QUEUE_GROUPS; group++) {
+            
+            std::vector<MeshRenderer*>* renderQueueGroup = nullptr;
+            switch (group) {
+                case 0: renderQueueGroup = &scenePtr->mRenderQueueSky; break;
+                case 1: renderQueueGroup = &scenePtr->mRenderQueueBackground; break;
+                case 2: renderQueueGroup = &scenePtr->mRenderQueuePreGrometry; break;
+                case 3: renderQueueGroup = &scenePtr->mRenderQueueGeometry; break;
+                case 4: renderQueueGroup = &scenePtr->mRenderQueuePostGeometry; break;
+                case 5: renderQueueGroup = &scenePtr->mRenderQueueForeground; break;
+                case 6: renderQueueGroup = &scenePtr->mRenderQueueOverlay; break;
+            }
+            
+            if (!renderQueueGroup)
+                continue;
+            
+            // Batches draw with the geometry queue even when it holds no renderers
+            bool hasBatches = (renderQueueGroup == &scenePtr->mRenderQueueGeometry) &&
+                              (!scenePtr->mInstanceBatches.empty() || !scenePtr->mParticleBatches.empty());
+            
+            if (renderQueueGroup->empty() && !hasBatches)
+                continue;
+            
+            RenderCommandSegment* segment = commandList.AddSegment();
+            segment->scene      = sceneIndex;
+            segment->queueGroup = group;
+            
+            mRecorders.Submit([this, &commandList, segment, renderQueueGroup]() {
+                
+                RecordSegment(commandList, segment, renderQueueGroup);
+                
+            }, &segment->counter);
+        }
+    }
+    
+    return;
+}
+
+void RenderSystem::RecordSegment(RenderCommandList& commandList, RenderCommandSegment* segment, std::vector<MeshRenderer*>* renderQueueGroup) {
+    
+    RenderScenePacket& scene = commandList.mScenes[segment->scene];
+    Scene* scenePtr = scene.scene;
+    
+    glm::vec3 eye = glm::vec3(scene.camera.eye);
+    
+    // Sorting visible renderers by state and depth
+    unsigned int numberOfVisible = SortingPass(segment, eye, scene.frustum, renderQueueGroup);
+    
+    // Per draw transforms and colors for the whole queue
+    segment->objectBlocks.resize(numberOfVisible * mObjectBlockStride);
+    
+    RenderCommand command;
+    command.instanceBatch = nullptr;
+    command.particleBatch = nullptr;
+    
+    for (unsigned int i=0; i < numberOfVisible; i++) {
+        
+        MeshRenderer* currentEntity = segment->sorted[i].renderer;
+        
+        // Level of detail shift selection
+        Mesh* meshLOD = LevelOfDetailPass(currentEntity, eye);
+        
+        if (meshLOD == nullptr)
+            continue;
+        
+        RecordObjectBlock(&segment->objectBlocks[i * mObjectBlockStride], currentEntity);
+        
+        command.type        = RenderCommandType::DrawMesh;
+        command.mesh        = meshLOD;
+        command.material    = currentEntity->material;
+        command.renderer    = currentEntity;
+        command.objectIndex = i;
+        
+        segment->commands.push_back(command);
+    }
+    
+    command.renderer    = nullptr;
+    command.objectIndex = 0;
+    
+    // Instanced geometry
+    if (renderQueueGroup == &scenePtr->mRenderQueueGeometry) {
+        
+        for (InstanceBatch* batch : scenePtr->mInstanceBatches) {
+            
+            if (PackInstances(batch, scene.frustum) == 0)
+                continue;
+            
+            command.type          = RenderCommandType::DrawInstances;
+            command.mesh          = batch->mesh;
+            command.material      = batch->material;
+            command.instanceBatch = batch;
+            
+            segment->commands.push_back(command);
+        }
+        
+        command.instanceBatch = nullptr;
+        
+        for (ParticleBatch* batch : scenePtr->mParticleBatches) {
+            
+            if ((!batch->isActive) | (batch->GetNumberOfParticles() == 0))
+                continue;
+            
+            command.type          = RenderCommandType::DrawParticles;
+            command.mesh          = batch->mesh;
+            command.material      = batch->material;
+            command.particleBatch = batch;
+            
+            segment->commands.push_back(command);
+        }
+        
+        command.particleBatch = nullptr;
+    }
+    
+    // Shadow volumes for every renderer close enough to the camera
+    if (scene.numberOfShadows == 0)
+        return;
+    
+    for (MeshRenderer* currentEntity : *renderQueueGroup) {
+        
+        if (!currentEntity->isActive)
+            continue;
+        
+        Material* materialPtr = currentEntity->material;
+        
+        if ((materialPtr == nullptr) | (currentEntity->mesh == nullptr))
+            continue;
+        
+        if (!materialPtr->mDoShadowPass)
+            continue;
+        
+        if (glm::distance( eye, currentEntity->transform.position ) > mShadowDistance)
+            continue;
+        
+        command.type     = RenderCommandType::DrawShadow;
+        command.mesh     = currentEntity->mesh;
+        command.material = materialPtr;
+        command.renderer = currentEntity;
+        
+        segment->commands.push_back(command);
+    }
+    
+    return;
+}
@@ -10,11 +10,6 @@ bool RenderSystem::setTargetCamera(Camera* currentCamera, glm::vec3& eye, glm::m
     if (currentCamera == nullptr) 
         return false;
     
-    glViewport(currentCamera->viewport.x, 
-               currentCamera->viewport.y, 
-               currentCamera->viewport.w, 
-               currentCamera->viewport.h);
-    
     // Point of origin
     eye.x = currentCamera->transform.position.x;
     eye.y = currentCamera->transform.position.y;
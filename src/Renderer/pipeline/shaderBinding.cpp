@@ -10,30 +10,12 @@ bool RenderSystem::BindShader(Shader* shaderPtr) {
         return false;
     
     mCurrentShader = shaderPtr;
+    mNumberOfShaderBinds++;
     
+    // Lights and fog live in the scene uniform blocks and
+    // the sampler unit is fixed when the program is linked
     mCurrentShader->Bind();
     
-    mCurrentShader->SetTextureSampler(0);
-    
-    // Send in the light list
-    mCurrentShader->SetLightCount(mNumberOfLights);
-    mCurrentShader->SetLightPositions(mNumberOfLights, mLightPosition);
-    mCurrentShader->SetLightDirections(mNumberOfLights, mLightDirection);
-    mCurrentShader->SetLightAttenuation(mNumberOfLights, mLightAttenuation);
-    mCurrentShader->SetLightColors(mNumberOfLights, mLightColor);
-    
-    // Send in the fog list
-    mCurrentShader->SetFogCount(mNumberOfFogLayers);
-    
-    mCurrentShader->SetFogDensity(mNumberOfFogLayers, mFogDensity);
-    mCurrentShader->SetFogHeightCutoff(mNumberOfFogLayers, mFogHeightCutoff);
-    
-    mCurrentShader->SetFogBegin(mNumberOfFogLayers, mFogBegin);
-    mCurrentShader->SetFogEnd(mNumberOfFogLayers, mFogEnd);
-    
-    mCurrentShader->SetFogColorBegin(mNumberOfFogLayers, mFogColorBegin);
-    mCurrentShader->SetFogColorEnd(mNumberOfFogLayers, mFogColorEnd);
-    
     return true;
 }
 
@@ -0,0 +1,110 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/types.h>
+
+
+void RenderSystem::SubmitFrame(RenderCommandList& commandList) {
+    
+    mNumberOfDrawCalls = 0;
+    
+    mNumberOfShaderBinds   = 0;
+    mNumberOfMaterialBinds = 0;
+    mNumberOfMeshBinds     = 0;
+    
+    Shader::mNumberOfUniformUpdates = 0;
+    
+    // Clear the view port
+    glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::BeginFrame::");
+#endif
+    
+    unsigned int currentScene = commandList.mScenes.size();
+    
+    for (unsigned int i=0; i < commandList.mNumberOfSegments; i++) {
+        
+        RenderCommandSegment* segment = commandList.mSegments[i];
+        
+        // Segments are replayed in order as soon as their job has finished.
+        // Waiting only helps with other segments still being recorded.
+        if (!segment->counter.IsComplete())
+            mRecorders.Wait( &segment->counter );
+        
+        if (segment->scene != currentScene) {
+            
+            currentScene = segment->scene;
+            
+            RenderScenePacket& scene = commandList.mScenes[currentScene];
+            
+            ResetBindings();
+            
+            glViewport(scene.viewport.x,
+                       scene.viewport.y,
+                       scene.viewport.w,
+                       scene.viewport.h);
+            
+            // Camera, lights and fog are shared by every shader through uniform blocks
+            UpdateUniformBlocks(scene);
+        }
+        
+        SubmitSegment(commandList, segment);
+    }
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::EndFrame::");
+#endif
+    
+    return;
+}
+
+void RenderSystem::SubmitSegment(RenderCommandList& commandList, RenderCommandSegment* segment) {
+    
+    RenderScenePacket& scene = commandList.mScenes[segment->scene];
+    
+    // Per draw transforms and colors for the whole queue in one upload
+    UpdateObjectBlocks(segment);
+    
+    bool isShadowCasterBound = false;
+    
+    unsigned int numberOfCommands = segment->commands.size();
+    
+    for (unsigned int i=0; i < numberOfCommands; i++) {
+        
+        RenderCommand& command = segment->commands[i];
+        
+        switch (command.type) {
+            
+            case RenderCommandType::DrawMesh:
+                GeometryPass(command);
+                break;
+            
+            case RenderCommandType::DrawInstances:
+                InstancingPass(command.instanceBatch);
+                break;
+            
+            case RenderCommandType::DrawParticles:
+                ParticlePass(command.particleBatch);
+                break;
+            
+            case RenderCommandType::DrawShadow:
+                
+                if (!isShadowCasterBound) {
+                    shaders.shadowCaster->Bind();
+                    isShadowCasterBound = true;
+                }
+                
+                ShadowVolumePass(command, scene);
+                break;
+        }
+        
+        continue;
+    }
+    
+    // The shadow pass changes the shader, blending and culling state
+    if (isShadowCasterBound)
+        ResetBindings();
+    
+    return;
+}
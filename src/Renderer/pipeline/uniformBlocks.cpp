@@ -0,0 +1,165 @@
+#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/types.h>
+
+#include <cstring>
+
+
+void RenderSystem::CreateUniformBlocks(void) {
+    
+    // Object blocks are bound by range so each one must start on the offset alignment
+    int alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    
+    if (alignment < 1)
+        alignment = 1;
+    
+    mObjectBlockStride = ((sizeof(UniformBlockObject) + alignment - 1) / alignment) * alignment;
+    
+    glGenBuffers(1, &mUniformBufferCamera);
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferCamera);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(UniformBlockCamera), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, RENDER_UNIFORM_BLOCK_CAMERA, mUniformBufferCamera);
+    
+    glGenBuffers(1, &mUniformBufferLights);
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferLights);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(UniformBlockLights), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, RENDER_UNIFORM_BLOCK_LIGHTS, mUniformBufferLights);
+    
+    glGenBuffers(1, &mUniformBufferFog);
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferFog);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(UniformBlockFog), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, RENDER_UNIFORM_BLOCK_FOG, mUniformBufferFog);
+    
+    glGenBuffers(1, &mUniformBufferObject);
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferObject);
+    glBufferData(GL_UNIFORM_BUFFER, mObjectBlockStride, NULL, GL_STREAM_DRAW);
+    glBindBufferRange(GL_UNIFORM_BUFFER, RENDER_UNIFORM_BLOCK_OBJECT, mUniformBufferObject, 0, sizeof(UniformBlockObject));
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::UniformBlocks::Create::");
+#endif
+    
+    return;
+}
+
+void RenderSystem::DestroyUniformBlocks(void) {
+    
+    glDeleteBuffers(1, &mUniformBufferCamera);
+    glDeleteBuffers(1, &mUniformBufferLights);
+    glDeleteBuffers(1, &mUniformBufferFog);
+    glDeleteBuffers(1, &mUniformBufferObject);
+    
+    mUniformBufferCamera = 0;
+    mUniformBufferLights = 0;
+    mUniformBufferFog    = 0;
+    mUniformBufferObject = 0;
+    
+    return;
+}
+
+void RenderSystem::RecordUniformBlocks(RenderScenePacket& scene, glm::vec3& eye, glm::vec3& cameraAngle, glm::mat4& viewProjection) {
+    
+    // Camera
+    
+    UniformBlockCamera& camera = scene.camera;
+    camera.viewProjection = viewProjection;
+    camera.eye            = glm::vec4(eye, 1.0f);
+    camera.angle          = glm::vec4(cameraAngle, 0.0f);
+    
+    // Lights
+    
+    UniformBlockLights& lights = scene.lights;
+    lights.count = glm::ivec4(mNumberOfLights, 0, 0, 0);
+    
+    for (unsigned int i=0; i < mNumberOfLights; i++) {
+        
+        lights.position[i]    = glm::vec4(mLightPosition[i], 1.0f);
+        lights.direction[i]   = glm::vec4(mLightDirection[i], 0.0f);
+        lights.attenuation[i] = mLightAttenuation[i];
+        lights.color[i]       = glm::vec4(mLightColor[i], 1.0f);
+        
+        continue;
+    }
+    
+    // Fog
+    
+    UniformBlockFog& fog = scene.fog;
+    fog.count = glm::ivec4(mNumberOfFogLayers, 0, 0, 0);
+    
+    for (unsigned int i=0; i < mNumberOfFogLayers; i++) {
+        
+        fog.colorBegin[i]   = glm::vec4(mFogColorBegin[i], 1.0f);
+        fog.colorEnd[i]     = glm::vec4(mFogColorEnd[i], 1.0f);
+        fog.begin[i]        = glm::vec4(mFogBegin[i], 0.0f, 0.0f, 0.0f);
+        fog.end[i]          = glm::vec4(mFogEnd[i], 0.0f, 0.0f, 0.0f);
+        fog.density[i]      = glm::vec4(mFogDensity[i], 0.0f, 0.0f, 0.0f);
+        fog.heightCutoff[i] = glm::vec4(mFogHeightCutoff[i], 0.0f, 0.0f, 0.0f);
+        
+        continue;
+    }
+    
+    return;
+}
+
+void RenderSystem::RecordObjectBlock(uint8_t* destination, MeshRenderer* renderer) {
+    
+    UniformBlockObject block;
+    block.model = renderer->transform.matrix;
+    
+    // Inverse transpose model matrix for lighting with non linear scaling
+    glm::mat3 invTransposeMatrix = glm::transpose( glm::inverse( glm::mat3(renderer->transform.matrix) ) );
+    
+    block.inverseModel[0] = glm::vec4(invTransposeMatrix[0], 0.0f);
+    block.inverseModel[1] = glm::vec4(invTransposeMatrix[1], 0.0f);
+    block.inverseModel[2] = glm::vec4(invTransposeMatrix[2], 0.0f);
+    
+    Material* materialPtr = renderer->material;
+    
+    if (materialPtr != nullptr) {
+        
+        block.ambient  = glm::vec4(materialPtr->ambient.r,  materialPtr->ambient.g,  materialPtr->ambient.b,  1.0f);
+        block.diffuse  = glm::vec4(materialPtr->diffuse.r,  materialPtr->diffuse.g,  materialPtr->diffuse.b,  1.0f);
+        block.specular = glm::vec4(materialPtr->specular.r, materialPtr->specular.g, materialPtr->specular.b, 1.0f);
+    }
+    
+    std::memcpy(destination, &block, sizeof(UniformBlockObject));
+    
+    return;
+}
+
+void RenderSystem::UpdateUniformBlocks(RenderScenePacket& scene) {
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferCamera);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(UniformBlockCamera), &scene.camera);
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferLights);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(UniformBlockLights), &scene.lights);
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferFog);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(UniformBlockFog), &scene.fog);
+    
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+#ifdef RENDERER_CHECK_OPENGL_ERRORS
+    GetGLErrorCodes("OnRender::UniformBlocks::Update::");
+#endif
+    
+    return;
+}
+
+void RenderSystem::UpdateObjectBlocks(RenderCommandSegment* segment) {
+    
+    if (segment->objectBlocks.empty())
+        return;
+    
+    // Orphan the previous contents so the driver does not stall on draws still in flight
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBufferObject);
+    glBufferData(GL_UNIFORM_BUFFER, segment->objectBlocks.size(), segment->objectBlocks.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    
+    return;
+}
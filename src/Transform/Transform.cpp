@@ -11,11 +11,24 @@ Transform::Transform() :
     localScale(glm::vec3(1.0f, 1.0f, 1.0f)),
     
     matrix(glm::mat4(1.0f)),
+    localMatrix(glm::mat4(1.0f)),
     
     parent(nullptr),
     
     inheritParentRotation(true),
-    inheritParentScale(true)
+    inheritParentScale(true),
+    isDirty(true),
+    
+    mCachedPosition(glm::vec3(0.0f, 0.0f, 0.0f)),
+    mCachedRotation(glm::identity<glm::quat>()),
+    mCachedScale(glm::vec3(1.0f, 1.0f, 1.0f)),
+    mCachedParent(nullptr),
+    
+    mCachedInheritRotation(true),
+    mCachedInheritScale(true),
+    
+    mUpdatePass(0),
+    mWasUpdated(false)
 {
 }
 
@@ -29,11 +42,24 @@ Transform::Transform(glm::vec3 init_position) :
     localScale(glm::vec3(1.0f, 1.0f, 1.0f)),
     
     matrix(glm::mat4(1.0f)),
+    localMatrix(glm::mat4(1.0f)),
     
     parent(nullptr),
     
     inheritParentRotation(true),
-    inheritParentScale(true)
+    inheritParentScale(true),
+    isDirty(true),
+    
+    mCachedPosition(glm::vec3(0.0f, 0.0f, 0.0f)),
+    mCachedRotation(glm::identity<glm::quat>()),
+    mCachedScale(glm::vec3(1.0f, 1.0f, 1.0f)),
+    mCachedParent(nullptr),
+    
+    mCachedInheritRotation(true),
+    mCachedInheritScale(true),
+    
+    mUpdatePass(0),
+    mWasUpdated(false)
 {
 }
 
@@ -42,6 +68,7 @@ void Transform::operator=(const Transform& transform) {
     this->rotation  = transform.rotation;
     this->scale     = transform.scale;
     this->matrix    = transform.matrix;
+    isDirty = true;
     return;
 }
 
@@ -64,31 +91,37 @@ bool Transform::operator!=(const Transform& transform) {
 
 void Transform::SetPosition(float x, float y, float z) {
     position = glm::vec3(x, y, z);
+    isDirty = true;
     return;
 }
 
 void Transform::SetPosition(glm::vec3 newPosition) {
     position = newPosition;
+    isDirty = true;
     return;
 }
 
 void Transform::SetOrientation(float w, float x, float y, float z) {
     rotation = glm::quat(w, x, y, z);
+    isDirty = true;
     return;
 }
 
 void Transform::SetOrientation(glm::quat newRotation) {
     rotation = newRotation;
+    isDirty = true;
     return;
 }
 
 void Transform::SetScale(float x, float y, float z) {
     scale = glm::vec3(x, y, z);
+    isDirty = true;
     return;
 }
 
 void Transform::SetScale(glm::vec3 newScale) {
     scale = newScale;
+    isDirty = true;
     return;
 }
 
@@ -107,18 +140,21 @@ glm::vec3 Transform::GetScale(void) {
 void Transform::Translate(glm::vec3 translation) {
     matrix = glm::translate(matrix, translation);
     position += translation;
+    isDirty = true;
     return;
 }
 
 void Transform::Translate(float x, float y, float z) {
     matrix = glm::translate(matrix, glm::vec3(x, y, z));
     position += glm::vec3(x, y, z);
+    isDirty = true;
     return;
 }
 
 void Transform::RotateAxis(float angle, glm::vec3 axis) {
     matrix = glm::rotate(matrix, glm::radians(angle), glm::normalize(axis));
     rotation = glm::quat_cast(matrix);
+    isDirty = true;
     return;
 }
 
@@ -126,6 +162,7 @@ void Transform::RotateWorldAxis(float angle, glm::vec3 axis, glm::vec3 worldPosi
     matrix = glm::rotate(matrix, glm::radians(angle), glm::normalize(axis));
     matrix = glm::translate(matrix, worldPosition);
     rotation = glm::quat_cast(matrix);
+    isDirty = true;
     return;
 }
 
@@ -137,6 +174,7 @@ void Transform::RotateEuler(glm::vec3 eulerAngle) {
 void Transform::RotateEuler(float yaw, float pitch, float roll) {
     rotation *= glm::quat(glm::radians(glm::vec3(yaw, pitch, roll)));
     matrix *= glm::toMat4(rotation);
+    isDirty = true;
     return;
 }
 
@@ -148,6 +186,7 @@ void Transform::Scale(glm::vec3 scaler) {
 void Transform::Scale(float x, float y, float z) {
     matrix = glm::scale(matrix, glm::vec3(x, y, z));
     scale *= glm::vec3(x, y, z);
+    isDirty = true;
     return;
 }
 
@@ -160,6 +199,7 @@ void Transform::SetIdentity(void) {
     rotation = glm::identity<glm::quat>();
     scale    = glm::vec3(1, 1, 1);
     matrix   = glm::mat4(1);
+    isDirty = true;
     return;
 }
 
@@ -169,3 +209,78 @@ void Transform::UpdateMatrix(void) {
              glm::scale(glm::mat4(1), scale);
     return;
 }
+
+void Transform::MarkDirty(void) {
+    isDirty = true;
+    return;
+}
+
+bool Transform::UpdateCachedMatrix(unsigned int pass) {
+    
+    // Already processed during this pass
+    if (mUpdatePass == pass) 
+        return mWasUpdated;
+    
+    mUpdatePass = pass;
+    
+    // Parents are resolved before their children
+    bool parentChanged = (parent != mCachedParent);
+    if (parent != nullptr) 
+        parentChanged |= parent->UpdateCachedMatrix(pass);
+    
+    // Fields are also written directly so compare against the cached state
+    bool localChanged = isDirty || 
+                        (position != mCachedPosition) || 
+                        (rotation != mCachedRotation) || 
+                        (scale    != mCachedScale) || 
+                        (inheritParentRotation != mCachedInheritRotation) || 
+                        (inheritParentScale    != mCachedInheritScale);
+    
+    mWasUpdated = localChanged || parentChanged;
+    if (!mWasUpdated) 
+        return false;
+    
+    if (localChanged) {
+        localMatrix = glm::translate(glm::mat4(1), position) * 
+                      glm::toMat4(rotation) * 
+                      glm::scale(glm::mat4(1), scale);
+        
+        mCachedPosition = position;
+        mCachedRotation = rotation;
+        mCachedScale    = scale;
+        
+        mCachedInheritRotation = inheritParentRotation;
+        mCachedInheritScale    = inheritParentScale;
+        
+        isDirty = false;
+    }
+    
+    mCachedParent = parent;
+    
+    if (parent == nullptr) {
+        matrix = localMatrix;
+        return true;
+    }
+    
+    // Roll the parent chain into the world matrix
+    glm::vec3 currentPosition = position;
+    glm::quat currentRotation = rotation;
+    glm::vec3 currentScale    = scale;
+    
+    for (Transform* current = parent; current != nullptr; current = current->parent) {
+        
+        currentPosition = current->position + currentPosition * current->rotation;
+        
+        if (current->inheritParentRotation) 
+            currentRotation = current->rotation * currentRotation;
+        
+        if (current->inheritParentScale) 
+            currentScale *= current->scale;
+        
+    }
+    
+    matrix = glm::translate(glm::mat4(1), currentPosition) * 
+             glm::toMat4(currentRotation) * 
+             glm::scale(glm::mat4(1), currentScale);
+    return true;
+}
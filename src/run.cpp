@@ -319,7 +319,9 @@ void Run() {
                 staticObj.y = chunkPosY;
                 staticObj.z = chunkPosZ;
                 
-                GameWorld.AddDecorTree(*chunk, staticObj, chunkRenderer->mesh, -chunkPosX, chunkPosY, -chunkPosZ, Decoration::TreeOak);
+                RandomStream random( Random.Range(0, 10000) );
+                
+                GameWorld.AddDecorTree(*chunk, staticObj, chunkRenderer->mesh, -chunkPosX, chunkPosY, -chunkPosZ, Decoration::TreeOak, random);
                 chunkRenderer->mesh->Load();
                 
             }
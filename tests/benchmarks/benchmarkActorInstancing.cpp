@@ -0,0 +1,113 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern RenderSystem Renderer;
+
+
+void TestFramework::BenchmarkActorInstancing(void) {
+    
+    std::cout << "Actor body part instancing\n";
+    
+    const unsigned int actorCounts[] = {100, 1000, 5000};
+    const unsigned int numberOfPartsPerActor = 8;
+    const unsigned int numberOfFrames = 10;
+    
+    Camera* cameraPtr = Renderer.CreateCamera();
+    
+    Material* batchMaterial = Renderer.CreateMaterial();
+    batchMaterial->shader = Renderer.shaders.colorInstanced;
+    
+    InstanceBatch* batch = Renderer.CreateInstanceBatch();
+    batch->mesh     = Renderer.meshes.cube;
+    batch->material = batchMaterial;
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfParts = actorCounts[c] * numberOfPartsPerActor;
+        
+        std::vector<MeshRenderer*> parts;
+        
+        for (unsigned int i=0; i < numberOfParts; i++) {
+            
+            MeshRenderer* part = Renderer.CreateMeshRenderer();
+            part->mesh = Renderer.meshes.cube;
+            part->material = Renderer.CreateMaterial();
+            part->material->shader = Renderer.shaders.color;
+            part->DisableFrustumCulling();
+            
+            unsigned int actor = i / numberOfPartsPerActor;
+            part->transform.position = glm::vec3((actor % 100) * 3.0f, (i % numberOfPartsPerActor) * 0.5f, (actor / 100) * 3.0f);
+            part->transform.UpdateMatrix();
+            
+            parts.push_back(part);
+        }
+        
+        // One draw per body part
+        Scene* scenePtr = Renderer.CreateScene();
+        scenePtr->camera = cameraPtr;
+        IsolateScene(scenePtr);
+        
+        for (unsigned int i=0; i < numberOfParts; i++)
+            scenePtr->AddMeshRendererToSceneRoot(parts[i], RENDER_QUEUE_GEOMETRY);
+        
+        Renderer.RenderFrame();
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++)
+            Renderer.RenderFrame();
+        
+        double perPartMs = timer.GetCurrentDelta() / numberOfFrames;
+        unsigned int perPartDrawCalls = Renderer.GetNumberOfDrawCalls();
+        
+        RestoreScenes();
+        Renderer.DestroyScene(scenePtr);
+        
+        // One draw for every body part
+        scenePtr = Renderer.CreateScene();
+        scenePtr->camera = cameraPtr;
+        IsolateScene(scenePtr);
+        
+        for (unsigned int i=0; i < numberOfParts; i++)
+            batch->AddMeshRenderer(parts[i]);
+        
+        scenePtr->AddInstanceBatchToScene(batch);
+        
+        Renderer.RenderFrame();
+        
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++)
+            Renderer.RenderFrame();
+        
+        double instancedMs = timer.GetCurrentDelta() / numberOfFrames;
+        unsigned int instancedDrawCalls = Renderer.GetNumberOfDrawCalls();
+        
+        RestoreScenes();
+        Renderer.DestroyScene(scenePtr);
+        
+        for (unsigned int i=0; i < numberOfParts; i++) {
+            batch->RemoveMeshRenderer(parts[i]);
+            
+            Renderer.DestroyMeshRenderer(parts[i]);
+        }
+        
+        std::cout << "  " << actorCounts[c] << " actors, " << numberOfParts << " parts\n";
+        std::cout << "  Per part      " << perPartDrawCalls   << " draw calls   " << perPartMs   << " ms per frame\n";
+        std::cout << "  Instanced     " << instancedDrawCalls << " draw calls   " << instancedMs << " ms per frame\n";
+    }
+    
+    Renderer.DestroyInstanceBatch(batch);
+    Renderer.DestroyMaterial(batchMaterial);
+    
+    Renderer.DestroyCamera(cameraPtr);
+    
+    return;
+}
+
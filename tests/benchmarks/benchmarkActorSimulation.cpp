@@ -0,0 +1,74 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkActorSimulation(void) {
+    
+    std::cout << "Actor simulation scaling\n";
+    
+    NeuralNetwork source;
+    source.AddNeuralLayer(16, 1);
+    source.AddNeuralLayer(16, 16);
+    source.AddNeuralLayer(1, 16);
+    
+    std::vector<std::string> state = source.SaveState();
+    
+    const unsigned int numberOfActors = 20000;
+    const unsigned int numberOfCycles = 20;
+    
+    unsigned int numberOfCores = std::thread::hardware_concurrency();
+    if (numberOfCores == 0)
+        numberOfCores = 1;
+    
+    double baselineRate = 0;
+    
+    for (unsigned int threads=1; threads <= numberOfCores; threads++) {
+        
+        ActorSystem actorSystem;
+        actorSystem.SetNumberOfThreads(threads);
+        actorSystem.SetSeed(77);
+        
+        std::vector<Actor*> actors(numberOfActors);
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            actors[i] = actorSystem.CreateActor();
+            actors[i]->SetPosition( glm::vec3((float)(i % 200), 0, (float)(i / 200)) );
+            actors[i]->LoadNeuralStates(state);
+        }
+        
+        actorSystem.UpdateSendSignal();
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int c=0; c < numberOfCycles; c++)
+            actorSystem.Update();
+        
+        double updateMs = timer.GetCurrentDelta();
+        
+        actorSystem.UpdateSendSignal();
+        
+        unsigned long int checksum = 0;
+        for (unsigned int i=0; i < numberOfActors; i++)
+            checksum += actors[i]->GetAge();
+        
+        actorSystem.Shutdown();
+        
+        for (unsigned int i=0; i < numberOfActors; i++)
+            actorSystem.DestroyActor(actors[i]);
+        
+        double updateRate = (double)(numberOfActors * numberOfCycles) / (updateMs / 1000.0);
+        
+        if (threads == 1)
+            baselineRate = updateRate;
+        
+        std::cout << "  " << threads << " threads  " << (unsigned long int)updateRate << " actor updates/s  " << updateRate / baselineRate << "x  checksum " << checksum << "\n";
+    }
+    
+    return;
+}
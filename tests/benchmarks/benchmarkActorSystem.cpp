@@ -0,0 +1,334 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Copy of the actor system as it was before the state exchange. The AI
+// thread spins on the update flag, holds the system lock for each slice and
+// the actor lock for each actor. Every main thread accessor takes the actor
+// lock. The neural batch is left out as the benchmark actors carry no network.
+
+#define LEGACY_NUMBER_OF_TICKS  10000000
+
+struct LegacyActor {
+    
+    std::mutex mux;
+    
+    glm::vec3 mPosition;
+    glm::vec3 mTargetPoint;
+    unsigned long int mAge;
+    float mDistance;
+    
+    bool mIsActive;
+    bool mIsWalking;
+    bool mIsRunning;
+    
+    int mChanceToChangeDirection;
+    int mChanceToFocusOnActor;
+    int mChanceToWalk;
+    int mChanceToStopWalking;
+    
+    float mDistanceToFocusOnActor;
+    float mDistanceToWalk;
+    float mHeightPreferenceMin;
+    float mHeightPreferenceMax;
+    
+    unsigned int mObservationCoolDownCounter;
+    unsigned int mMovementCoolDownCounter;
+    
+    LegacyActor() :
+        mPosition(0), mTargetPoint(0), mAge(0), mDistance(0),
+        mIsActive(true), mIsWalking(false), mIsRunning(false),
+        mChanceToChangeDirection(40), mChanceToFocusOnActor(1), mChanceToWalk(1200), mChanceToStopWalking(0),
+        mDistanceToFocusOnActor(10), mDistanceToWalk(30), mHeightPreferenceMin(0.0f), mHeightPreferenceMax(1000),
+        mObservationCoolDownCounter(0), mMovementCoolDownCounter(0) {}
+    
+    void SetPosition(glm::vec3 position) {
+        mux.lock();
+        mPosition = position;
+        mux.unlock();
+    }
+    
+    glm::vec3 GetPosition(void) {
+        mux.lock();
+        glm::vec3 position = mPosition;
+        mux.unlock();
+        return position;
+    }
+    
+    glm::vec3 GetTargetPoint(void) {
+        mux.lock();
+        glm::vec3 position = mTargetPoint;
+        mux.unlock();
+        return position;
+    }
+    
+    unsigned long int GetAge(void) {
+        mux.lock();
+        unsigned long int ageValue = mAge;
+        mux.unlock();
+        return ageValue;
+    }
+    
+};
+
+struct LegacyActorSystem {
+    
+    std::mutex mux;
+    
+    std::vector<LegacyActor> mActors;
+    
+    glm::vec3 mPlayerPosition;
+    float mActorUpdateDistance;
+    float mWorldWaterLevel;
+    
+    bool isActorThreadActive;
+    bool doUpdate;
+    int actorCounter;
+    int tickCounter;
+    
+    LegacyActorSystem(unsigned int numberOfActors) :
+        mActors(numberOfActors), mPlayerPosition(0), mActorUpdateDistance(300), mWorldWaterLevel(0.0f),
+        isActorThreadActive(true), doUpdate(false), actorCounter(0), tickCounter(0) {}
+    
+    void SetPlayerWorldPosition(glm::vec3 position) {
+        mux.lock();
+        mPlayerPosition = position;
+        mux.unlock();
+    }
+    
+    void UpdateSendSignal(void) {
+        mux.lock();
+        doUpdate = true;
+        mux.unlock();
+    }
+    
+    void SetActorUpdateDistance(float distance) {
+        mux.lock();
+        mActorUpdateDistance = distance;
+        mux.unlock();
+    }
+    
+    void ThreadMain(void) {
+        while (isActorThreadActive) {
+            if (!doUpdate) {
+                std::this_thread::sleep_for( std::chrono::duration<float, std::micro>(1) );
+                continue;
+            }
+            Update();
+        }
+    }
+    
+    void Update(void) {
+        tickCounter++;
+        if (tickCounter < LEGACY_NUMBER_OF_TICKS)
+            return;
+        
+        tickCounter = 0;
+        int numberOfActors = mActors.size();
+        int numberOfActorsPerCycle = (numberOfActors > 10) ? (numberOfActors / 10) : 1;
+        
+        mux.lock();
+        for (int i = 0; i < numberOfActorsPerCycle; i++) {
+            
+            if (actorCounter >= numberOfActors) {
+                actorCounter = 0;
+                doUpdate = false;
+                break;
+            }
+            
+            LegacyActor* actor = &mActors[actorCounter++];
+            if (!actor->mIsActive)
+                continue;
+            
+            actor->mux.lock();
+            
+            actor->mDistance = glm::distance(mPlayerPosition, actor->mPosition);
+            
+            if (actor->mDistance > mActorUpdateDistance) {
+                actor->mux.unlock();
+                continue;
+            }
+            
+            UpdateActorState(actor);
+            
+            actor->mux.unlock();
+        }
+        mux.unlock();
+    }
+    
+    void UpdateActorState(LegacyActor* actor) {
+        
+        actor->mAge++;
+        
+        bool isAquatic = actor->mHeightPreferenceMax < mWorldWaterLevel;
+        
+        // Walking chance
+        if (actor->mTargetPoint.y > mWorldWaterLevel) {
+            if (Random.Range(0, 1000) < actor->mChanceToWalk)
+                actor->mIsWalking = true;
+        }
+        
+        // Observation cool down
+        if (actor->mObservationCoolDownCounter < 100)
+            actor->mObservationCoolDownCounter++;
+        
+        // Focus on nearby actor
+        if (Random.Range(0, 10000) < actor->mChanceToFocusOnActor) {
+            if (actor->mDistance < actor->mDistanceToFocusOnActor) {
+                actor->mTargetPoint = mPlayerPosition;
+                actor->mObservationCoolDownCounter = 0;
+                actor->mIsWalking = false;
+                actor->mIsRunning = false;
+            }
+        }
+        
+        // Movement cool down
+        if (!actor->mIsWalking && actor->mObservationCoolDownCounter != 0) {
+            
+            actor->mObservationCoolDownCounter = 0;
+            
+            if (Random.Range(0, 1000) < actor->mChanceToChangeDirection) {
+                
+                float randA = Random.Range(0.0f, actor->mDistanceToWalk) + actor->mMovementCoolDownCounter + 1;
+                float randB = Random.Range(0.0f, actor->mDistanceToWalk) + actor->mMovementCoolDownCounter + 1;
+                float randC = Random.Range(0.0f, actor->mDistanceToWalk) + actor->mMovementCoolDownCounter + 1;
+                float randD = Random.Range(0.0f, actor->mDistanceToWalk) + actor->mMovementCoolDownCounter + 1;
+                
+                actor->mTargetPoint.x = (randA - randB) + actor->mPosition.x;
+                actor->mTargetPoint.z = (randC - randD) + actor->mPosition.z;
+            }
+            
+        } else {
+            
+            if ((actor->mTargetPoint.y > actor->mHeightPreferenceMax) | (actor->mTargetPoint.y < actor->mHeightPreferenceMin)) {
+                
+                if (++actor->mMovementCoolDownCounter > 100)
+                    actor->mMovementCoolDownCounter = 100;
+                
+                if (!isAquatic) {
+                    if (actor->mPosition.y < mWorldWaterLevel && actor->mTargetPoint.y < actor->mPosition.y)
+                        actor->mIsWalking = false;
+                } else {
+                    if (actor->mPosition.y > mWorldWaterLevel && actor->mTargetPoint.y > actor->mPosition.y)
+                        actor->mIsWalking = false;
+                }
+            }
+            
+            if (glm::distance(actor->mTargetPoint, actor->mPosition) < 1.5f) {
+                actor->mMovementCoolDownCounter = 0;
+                actor->mIsWalking = false;
+            }
+        }
+        
+        // Stop walking chance
+        if (Random.Range(0, 10000) < actor->mChanceToStopWalking)
+            actor->mIsWalking = false;
+    }
+    
+};
+
+
+void TestFramework::BenchmarkActorSystem(void) {
+    
+    std::cout << "Actor system main thread frame\n";
+    
+    const unsigned int numberOfActors = 5000;
+    const unsigned int numberOfFrames = 2000;
+    
+    glm::vec3 playerPosition(2500, 0, 0);
+    
+    // Legacy - per access actor locking against the old AI thread
+    LegacyActorSystem legacySystem(numberOfActors);
+    legacySystem.SetActorUpdateDistance(1000000.0f);
+    
+    for (unsigned int i=0; i < numberOfActors; i++)
+        legacySystem.mActors[i].SetPosition( glm::vec3((float)i, 0, 0) );
+    
+    std::thread legacyThread([&]() {
+        legacySystem.ThreadMain();
+    });
+    
+    float checksum = 0.0f;
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        
+        legacySystem.SetPlayerWorldPosition(playerPosition);
+        legacySystem.UpdateSendSignal();
+        
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            LegacyActor& actor = legacySystem.mActors[i];
+            glm::vec3 position    = actor.GetPosition();
+            glm::vec3 targetPoint = actor.GetTargetPoint();
+            if (glm::distance(position, targetPoint) > 1.5f)
+                position += glm::normalize(targetPoint - position + glm::vec3(0.001f)) * 0.01f;
+            actor.SetPosition(position);
+            checksum += position.x + (float)actor.GetAge();
+        }
+    }
+    
+    double legacyMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    legacySystem.mux.lock();
+    legacySystem.isActorThreadActive = false;
+    legacySystem.mux.unlock();
+    legacyThread.join();
+    
+    // Double buffered - the main thread works on its own copy and the
+    // states are exchanged once per frame
+    ActorSystem actorSystem;
+    actorSystem.Initiate();
+    actorSystem.SetActorUpdateDistance(1000000.0f);
+    
+    std::vector<Actor*> actors(numberOfActors);
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        actors[i] = actorSystem.CreateActor();
+        actors[i]->SetPosition( glm::vec3((float)i, 0, 0) );
+    }
+    
+    unsigned int numberOfCycles = 0;
+    
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        
+        if (!actorSystem.IsUpdatePending())
+            numberOfCycles++;
+        
+        actorSystem.SetPlayerWorldPosition(playerPosition);
+        actorSystem.UpdateSendSignal();
+        
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            Actor* actor = actors[i];
+            glm::vec3 position    = actor->GetPosition();
+            glm::vec3 targetPoint = actor->GetTargetPoint();
+            if (glm::distance(position, targetPoint) > 1.5f)
+                position += glm::normalize(targetPoint - position + glm::vec3(0.001f)) * 0.01f;
+            actor->SetPosition(position);
+            checksum += position.x + (float)actor->GetAge();
+        }
+    }
+    
+    double exchangeMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    actorSystem.Shutdown();
+    
+    for (unsigned int i=0; i < numberOfActors; i++)
+        actorSystem.DestroyActor(actors[i]);
+    
+    std::cout << "  " << numberOfActors << " actors  locked " << legacyMs << " ms  exchanged " << exchangeMs << " ms  " << legacyMs / exchangeMs << "x\n";
+    std::cout << "  " << numberOfCycles << " AI cycles over " << numberOfFrames << " frames\n";
+    std::cout << "  checksum " << checksum << "\n";
+    
+    return;
+}
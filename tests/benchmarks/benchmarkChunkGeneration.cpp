@@ -0,0 +1,217 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkGenerator.h>
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkMap.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Frame time histogram bucket upper bounds in milliseconds
+static const double histogramBounds[] = {1.0, 2.0, 4.0, 8.0, 16.0, 33.0};
+static const unsigned int histogramSize = 7;
+
+struct ChunkBuildSlot {
+    
+    ChunkBuildData data;
+    
+    JobCounter counter;
+    
+};
+
+struct FrameHistogram {
+    
+    unsigned int buckets[histogramSize];
+    
+    double worstMs;
+    double totalMs;
+    unsigned int frames;
+    
+    FrameHistogram() : worstMs(0), totalMs(0), frames(0) {
+        for (unsigned int i=0; i < histogramSize; i++)
+            buckets[i] = 0;
+    }
+    
+    void Add(double frameMs) {
+        unsigned int bucket = 0;
+        while (bucket < histogramSize - 1 && frameMs >= histogramBounds[bucket])
+            bucket++;
+        buckets[bucket]++;
+        worstMs = std::max(worstMs, frameMs);
+        totalMs += frameMs;
+        frames++;
+    }
+    
+    void Print(std::string name) {
+        std::cout << "  " << name << "  avg " << totalMs / frames << " ms  worst " << worstMs << " ms\n";
+        for (unsigned int i=0; i < histogramSize; i++) {
+            if (i < histogramSize - 1)
+                std::cout << "    < " << histogramBounds[i] << " ms  ";
+            else
+                std::cout << "    >= " << histogramBounds[i - 1] << " ms  ";
+            std::cout << buckets[i] << "\n";
+        }
+    }
+};
+
+// Main thread share of finishing a chunk. Copies the buffers as the mesh upload would.
+static void FinalizeChunkData(ChunkMap& chunks, ChunkBuildData& data, std::vector<Vertex>& uploadVertices, std::vector<Index>& uploadIndices) {
+    uploadVertices.assign(data.meshVertices.begin(), data.meshVertices.end());
+    uploadIndices.assign(data.meshIndices.begin(), data.meshIndices.end());
+    uploadVertices.insert(uploadVertices.end(), data.lodVertices.begin(), data.lodVertices.end());
+    uploadIndices.insert(uploadIndices.end(), data.lodIndices.begin(), data.lodIndices.end());
+    
+    Chunk* chunk = chunks.Create(data.x, data.y);
+    chunk->isActive = true;
+}
+
+// Chunk positions the chunk manager would generate around the player
+static void GatherMissingChunks(ChunkMap& chunks, glm::vec3 playerPosition, float renderDistance, int chunkSize, std::vector<glm::vec2>& missing) {
+    missing.clear();
+    glm::vec2 playerPos(playerPosition.x, playerPosition.z);
+    
+    for (int xx=0; xx < renderDistance; xx++) {
+        for (int zz=0; zz < renderDistance; zz++) {
+            float chunkX = std::round(playerPosition.x / chunkSize + xx);
+            float chunkZ = std::round(playerPosition.z / chunkSize + zz);
+            
+            glm::vec2 chunkPos((chunkX * chunkSize) - (renderDistance * (chunkSize / 2)),
+                               (chunkZ * chunkSize) - (renderDistance * (chunkSize / 2)));
+            
+            if (chunks.Find(chunkPos.x, chunkPos.y) != nullptr)
+                continue;
+            
+            if (glm::distance(chunkPos, playerPos) > (renderDistance * (chunkSize / 2)))
+                continue;
+            
+            missing.push_back(chunkPos);
+        }
+    }
+    
+    std::sort(missing.begin(), missing.end(), [&playerPos](const glm::vec2& a, const glm::vec2& b) {
+        return glm::distance(a, playerPos) < glm::distance(b, playerPos);
+    });
+}
+
+
+void TestFramework::BenchmarkChunkGeneration(void) {
+    
+    std::cout << "Chunk generation frame times\n";
+    
+    ChunkGenerator generator;
+    generator.chunkSize = 50;
+    generator.worldSeed = 100;
+    
+    Perlin layerLow;
+    layerLow.heightMultuplier = 20.0f;
+    layerLow.noiseWidth  = 0.02f;
+    layerLow.noiseHeight = 0.02f;
+    
+    Perlin layerHigh;
+    layerHigh.heightMultuplier = 80.0f;
+    layerHigh.noiseWidth  = 0.005f;
+    layerHigh.noiseHeight = 0.005f;
+    
+    generator.perlin.push_back(layerLow);
+    generator.perlin.push_back(layerHigh);
+    
+    const float renderDistance       = 12;
+    const unsigned int numberOfFrames = 600;
+    const float playerSpeed          = 5.0f;
+    const double frameBudgetMs       = 4.0;
+    const unsigned int jobLimit      = 8;
+    
+    std::vector<glm::vec2> missing;
+    std::vector<Vertex> uploadVertices;
+    std::vector<Index>  uploadIndices;
+    
+    // Every missing chunk is generated on the main thread in the frame it is found
+    {
+        ChunkMap chunks;
+        FrameHistogram histogram;
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+            Timer timer;
+            timer.Update();
+            
+            glm::vec3 playerPosition(f * playerSpeed, 0, f * playerSpeed * 0.5f);
+            GatherMissingChunks(chunks, playerPosition, renderDistance, generator.chunkSize, missing);
+            
+            for (unsigned int i=0; i < missing.size(); i++) {
+                ChunkBuildData data;
+                generator.Build(data, missing[i].x, missing[i].y);
+                FinalizeChunkData(chunks, data, uploadVertices, uploadIndices);
+            }
+            
+            histogram.Add(timer.GetCurrentDelta());
+        }
+        
+        histogram.Print("sync ");
+    }
+    
+    // Chunks are built on the job workers and finished under a frame budget
+    {
+        ChunkMap chunks;
+        FrameHistogram histogram;
+        std::vector<ChunkBuildSlot*> builds;
+        
+        JobSystem jobs;
+        jobs.Initiate();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+            Timer timer;
+            timer.Update();
+            
+            glm::vec3 playerPosition(f * playerSpeed, 0, f * playerSpeed * 0.5f);
+            GatherMissingChunks(chunks, playerPosition, renderDistance, generator.chunkSize, missing);
+            
+            for (unsigned int i=0; i < missing.size() && builds.size() < jobLimit; i++) {
+                bool isQueued = false;
+                for (unsigned int b=0; b < builds.size(); b++)
+                    if (builds[b]->data.x == missing[i].x && builds[b]->data.y == missing[i].y)
+                        isQueued = true;
+                if (isQueued)
+                    continue;
+                
+                ChunkBuildSlot* build = new ChunkBuildSlot();
+                build->data.x = missing[i].x;
+                build->data.y = missing[i].y;
+                builds.push_back(build);
+                
+                jobs.Submit([build, generator]() mutable {
+                    generator.Build(build->data, build->data.x, build->data.y);
+                }, &build->counter);
+            }
+            
+            unsigned int b = 0;
+            while (b < builds.size()) {
+                if (!builds[b]->counter.IsComplete()) {
+                    b++;
+                    continue;
+                }
+                
+                FinalizeChunkData(chunks, builds[b]->data, uploadVertices, uploadIndices);
+                delete builds[b];
+                builds.erase(builds.begin() + b);
+                
+                if (timer.GetCurrentDelta() >= frameBudgetMs)
+                    break;
+            }
+            
+            histogram.Add(timer.GetCurrentDelta());
+        }
+        
+        for (unsigned int b=0; b < builds.size(); b++) {
+            jobs.Wait(&builds[b]->counter);
+            delete builds[b];
+        }
+        
+        jobs.Shutdown();
+        
+        histogram.Print("async");
+    }
+    
+    std::cout << "\n";
+}
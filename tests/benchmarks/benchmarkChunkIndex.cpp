@@ -0,0 +1,135 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkMap.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Linear chunk list as used by the chunk manager before the hashed index
+struct LegacyChunkIndex {
+    
+    std::vector<Chunk> chunks;
+    
+    Chunk* Find(int x, int z) {
+        for (unsigned int i=0; i < chunks.size(); i++)
+            if ((chunks[i].x == x) & (chunks[i].y == z))
+                return &chunks[i];
+        return nullptr;
+    }
+    
+    void Create(int x, int z) {
+        Chunk chunk;
+        chunk.x = x;
+        chunk.y = z;
+        chunks.push_back(chunk);
+    }
+    
+    unsigned int Size(void) {return chunks.size();}
+    Chunk* Get(unsigned int index) {return &chunks[index];}
+    void Destroy(unsigned int index) {chunks.erase(chunks.begin() + index);}
+};
+
+// Wrap the hashed index behind the same interface
+struct HashedChunkIndex {
+    
+    ChunkMap chunks;
+    
+    Chunk* Find(int x, int z) {return chunks.Find(x, z);}
+    void Create(int x, int z) {chunks.Create(x, z);}
+    
+    unsigned int Size(void) {return chunks.Size();}
+    Chunk* Get(unsigned int index) {return chunks[index];}
+    void Destroy(unsigned int index) {chunks.Destroy( chunks[index] );}
+};
+
+// One generate and destroy pass matching the chunk manager update
+template<typename IndexType> void ChunkStreamingPass(IndexType& index, glm::vec3 playerPosition, float renderDistance, int chunkSize) {
+    
+    for (int xx=0; xx < renderDistance; xx++) {
+        
+        for (int zz=0; zz < renderDistance; zz++) {
+            
+            float chunkX = std::round(playerPosition.x / chunkSize + xx);
+            float chunkZ = std::round(playerPosition.z / chunkSize + zz);
+            
+            glm::vec2 chunkPos((chunkX * chunkSize) - (renderDistance * (chunkSize / 2)),
+                               (chunkZ * chunkSize) - (renderDistance * (chunkSize / 2)));
+            
+            glm::vec2 playerPos(playerPosition.x, playerPosition.z);
+            
+            Chunk* chunk = index.Find(chunkPos.x, chunkPos.y);
+            
+            if (chunk != nullptr) {
+                chunk->isActive = true;
+                continue;
+            }
+            
+            if (glm::distance(chunkPos, playerPos) > (renderDistance * (chunkSize / 2)))
+                continue;
+            
+            index.Create(chunkPos.x, chunkPos.y);
+        }
+    }
+    
+    glm::vec3 playerPos(playerPosition.x, 0, playerPosition.z);
+    
+    unsigned int i = 0;
+    while (i < index.Size()) {
+        
+        Chunk* chunk = index.Get(i);
+        
+        if (glm::distance(glm::vec3(chunk->x, 0, chunk->y), playerPos) <= (renderDistance * chunkSize) * 1.5f) {
+            i++;
+            continue;
+        }
+        
+        index.Destroy(i);
+    }
+    
+    return;
+}
+
+template<typename IndexType> double ChunkStreamingBenchmark(float renderDistance, unsigned int numberOfPasses) {
+    
+    const int chunkSize = 50;
+    
+    IndexType index;
+    glm::vec3 playerPosition(0, 0, 0);
+    
+    // Fill the view before timing
+    ChunkStreamingPass(index, playerPosition, renderDistance, chunkSize);
+    
+    Timer timer;
+    timer.Update();
+    
+    // Walk the player across chunk boundaries so chunks stream in and out
+    for (unsigned int p=0; p < numberOfPasses; p++) {
+        playerPosition.x += chunkSize * 2;
+        playerPosition.z += chunkSize;
+        ChunkStreamingPass(index, playerPosition, renderDistance, chunkSize);
+    }
+    
+    return timer.GetCurrentDelta() / numberOfPasses;
+}
+
+
+void TestFramework::BenchmarkChunkIndex(void) {
+    
+    std::cout << "Chunk index streaming pass\n";
+    
+    const float renderDistances[] = {8, 16, 32, 64};
+    const unsigned int numberOfPasses = 20;
+    
+    for (unsigned int i=0; i < 4; i++) {
+        
+        double legacyMs = ChunkStreamingBenchmark<LegacyChunkIndex>(renderDistances[i], numberOfPasses);
+        double hashedMs = ChunkStreamingBenchmark<HashedChunkIndex>(renderDistances[i], numberOfPasses);
+        
+        std::cout << "  renderDistance " << renderDistances[i] << "   linear " << legacyMs << " ms   hashed "
+                  << hashedMs << " ms per pass\n";
+    }
+    
+    return;
+}
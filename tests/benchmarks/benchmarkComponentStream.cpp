@@ -0,0 +1,91 @@
+#include <iostream>
+#include <string>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+
+extern EngineSystemManager  Engine;
+extern EngineComponents     Components;
+
+
+void TestFramework::BenchmarkComponentStream(void) {
+    
+    std::cout << "Component stream update\n";
+    
+    const unsigned int numberOfGameObjects = 100000;
+    const unsigned int numberOfUpdates     = 20;
+    
+    // Populate the world with mixed component sets. Every object carries
+    // a transform, most carry a renderer and few carry the heavier systems.
+    std::vector<GameObject*> gameObjects;
+    
+    for (unsigned int i=0; i < numberOfGameObjects; i++) {
+        
+        GameObject* gameObject = Engine.Create<GameObject>();
+        gameObject->SetPosition(i % 1000, 0, i / 1000);
+        
+        if ((i % 4) != 0)
+            gameObject->AddComponent( Engine.CreateComponent<MeshRenderer>() );
+        
+        if ((i % 4) == 0)
+            gameObject->AddComponent( Engine.CreateComponent<RigidBody>() );
+        
+        if ((i % 64) == 0)
+            gameObject->AddComponent( Engine.CreateComponent<Light>() );
+        
+        if ((i % 16) == 0)
+            gameObject->AddComponent( Engine.CreateComponent<Actor>() );
+        
+        gameObjects.push_back(gameObject);
+    }
+    
+    // The stream covers one eighth of the objects per update
+    for (unsigned int i=0; i < 16; i++)
+        Engine.Update();
+    
+    const ComponentType systems[]  = {Components.RigidBody, Components.MeshRenderer, Components.Camera,
+                                      Components.Actor, Components.Light, Components.Text, Components.Panel};
+    const std::string systemNames[] = {"RigidBody   ", "MeshRenderer", "Camera      ",
+                                       "Actor       ", "Light       ", "Text        ", "Panel       "};
+    
+    double totalMs[7] = {0, 0, 0, 0, 0, 0, 0};
+    unsigned int totalCount[7] = {0, 0, 0, 0, 0, 0, 0};
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfUpdates; i++) {
+        
+        Engine.Update();
+        
+        for (unsigned int s=0; s < 7; s++) {
+            EngineSystemManager::ComponentStreamProfile profile = Engine.GetComponentStreamProfile( systems[s] );
+            totalMs[s]    += profile.milliseconds;
+            totalCount[s] += profile.count;
+        }
+        
+    }
+    
+    double updateMs = timer.GetCurrentDelta() / numberOfUpdates;
+    
+    std::cout << "  " << numberOfGameObjects << " game objects, " << updateMs << " ms per engine update\n";
+    
+    for (unsigned int s=0; s < 7; s++) {
+        
+        if (totalCount[s] == 0)
+            continue;
+        
+        std::cout << "  " << systemNames[s] << "  " << totalCount[s] / numberOfUpdates << " objects  "
+                  << (totalMs[s] * 1000000.0) / totalCount[s] << " ns per object\n";
+    }
+    
+    // Release the objects and let the stream collect the garbage
+    for (unsigned int i=0; i < gameObjects.size(); i++)
+        Engine.Destroy<GameObject>( gameObjects[i] );
+    
+    for (unsigned int i=0; i < 16; i++)
+        Engine.Update();
+    
+    return;
+}
+
@@ -0,0 +1,95 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/EngineSystems.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkGenomeFormat(void) {
+    
+    std::cout << "Genome format\n";
+    
+    const unsigned int numberOfGenomes = 10000;
+    
+    Actor source;
+    AI.genomes.presets.Bear(&source);
+    
+    Actor target;
+    
+    std::string genome;
+    unsigned int checksum = 0;
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfGenomes; i++) {
+        genome = AI.genomes.ExtractGenome(&source);
+        target.ClearGenome();
+        AI.genomes.InjectGenome(&target, genome);
+        checksum += target.GetNumberOfGenes();
+    }
+    
+    double textMs = timer.GetCurrentDelta();
+    unsigned int textBytes = genome.size();
+    
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfGenomes; i++) {
+        AI.genomes.EncodeGenome(&source, genome);
+        target.ClearGenome();
+        AI.genomes.DecodeGenome(&target, genome);
+        checksum += target.GetNumberOfGenes();
+    }
+    
+    double binaryMs = timer.GetCurrentDelta();
+    unsigned int binaryBytes = genome.size();
+    
+    std::cout << "  genome    text   " << (unsigned int)(numberOfGenomes / (textMs * 0.001)) << " per second  " << textBytes << " bytes\n";
+    std::cout << "  genome    binary " << (unsigned int)(numberOfGenomes / (binaryMs * 0.001)) << " per second  " << binaryBytes << " bytes\n";
+    
+    // Actor network states
+    NeuralNetwork network;
+    network.AddNeuralLayer(16, 1);
+    network.AddNeuralLayer(16, 16);
+    network.AddNeuralLayer(16, 16);
+    network.AddNeuralLayer(1, 16);
+    
+    NeuralNetwork restored;
+    
+    const unsigned int numberOfStates = 2000;
+    
+    std::vector<std::string> textState;
+    unsigned int textStateBytes = 0;
+    
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfStates; i++) {
+        textState = network.SaveState();
+        restored.LoadState(textState);
+        checksum += restored.GetNumberOfLayers();
+    }
+    
+    textMs = timer.GetCurrentDelta();
+    
+    for (unsigned int i=0; i < textState.size(); i++)
+        textStateBytes += textState[i].size();
+    
+    std::string binaryState;
+    
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfStates; i++) {
+        network.SaveStateBinary(binaryState);
+        restored.LoadStateBinary(binaryState);
+        checksum += restored.GetNumberOfLayers();
+    }
+    
+    binaryMs = timer.GetCurrentDelta();
+    
+    std::cout << "  network   text   " << (unsigned int)(numberOfStates / (textMs * 0.001)) << " per second  " << textStateBytes << " bytes\n";
+    std::cout << "  network   binary " << (unsigned int)(numberOfStates / (binaryMs * 0.001)) << " per second  " << binaryState.size() << " bytes   checksum " << checksum << "\n";
+    
+    return;
+}
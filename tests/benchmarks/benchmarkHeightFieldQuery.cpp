@@ -0,0 +1,119 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern PhysicsSystem Physics;
+
+// Queries per second from the milliseconds taken
+static double QueryRate(unsigned int numberOfQueries, double milliseconds) {
+    
+    if (milliseconds <= 0.0)
+        return 0.0;
+    
+    return numberOfQueries / (milliseconds / 1000.0);
+}
+
+
+void TestFramework::BenchmarkHeightFieldQuery(void) {
+    
+    std::cout << "Ground queries\n";
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    const unsigned int fieldSize = 33;
+    const int tilesPerSide = 8;
+    const float tileSize = (float)(fieldSize - 1);
+    
+    RandomStream random(91);
+    
+    std::vector<float> heightField(fieldSize * fieldSize);
+    std::vector<MeshCollider*> meshColliders;
+    
+    for (int x=0; x < tilesPerSide; x++) {
+        
+        for (int z=0; z < tilesPerSide; z++) {
+            
+            random.Fill(heightField.data(), heightField.size(), -20.0f, 20.0f);
+            
+            MeshCollider* meshCollider = Physics.CreateHeightFieldMap(heightField.data(), fieldSize, fieldSize, 1, 1, 1);
+            
+            rp3d::Transform bodyTransform = rp3d::Transform::identity();
+            bodyTransform.setPosition( rp3d::Vector3(x * tileSize, 0, z * tileSize) );
+            
+            rp3d::RigidBody* rigidBody = Physics.world->createRigidBody( bodyTransform );
+            rigidBody->setType(rp3d::BodyType::STATIC);
+            
+            rp3d::Collider* bodyCollider = rigidBody->addCollider( meshCollider->heightFieldShape, rp3d::Transform::identity() );
+            bodyCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+            
+            Physics.AddTerrainHeightField(meshCollider, glm::vec3(x * tileSize, 0, z * tileSize), nullptr);
+            
+            meshColliders.push_back(meshCollider);
+        }
+    }
+    
+    const unsigned int queryCounts[] = {1000, 10000, 100000};
+    const float minimum = -tileSize * 0.5f;
+    const float maximum = tileSize * (tilesPerSide - 0.5f);
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfQueries = queryCounts[c];
+        
+        std::vector<glm::vec3> points(numberOfQueries);
+        std::vector<Hit> hits(numberOfQueries);
+        std::vector<uint8_t> isHit(numberOfQueries);
+        
+        for (unsigned int i=0; i < numberOfQueries; i++)
+            points[i] = glm::vec3(random.Range(minimum, maximum), 100.0f, random.Range(minimum, maximum));
+        
+        unsigned int rayHits    = 0;
+        unsigned int singleHits = 0;
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfQueries; i++)
+            rayHits += Physics.Raycast(points[i], glm::vec3(0, -1, 0), 200.0f, hits[i], LayerMask::Ground);
+        
+        double rayMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfQueries; i++)
+            singleHits += Physics.QueryGround(points[i], 200.0f, hits[i]);
+        
+        double singleMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        unsigned int batchHits = Physics.QueryGroundBatch(points.data(), numberOfQueries, 200.0f, hits.data(), isHit.data());
+        
+        double batchMs = timer.GetCurrentDelta();
+        
+        std::cout << "  queries " << numberOfQueries << "   raycast " << QueryRate(numberOfQueries, rayMs)
+                  << " /s   ground " << QueryRate(numberOfQueries, singleMs)
+                  << " /s   batch " << QueryRate(numberOfQueries, batchMs) << " /s";
+        
+        if ((rayHits != singleHits) | (rayHits != batchHits))
+            std::cout << "   MISMATCH";
+        
+        std::cout << "\n";
+    }
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    for (unsigned int i=0; i < meshColliders.size(); i++)
+        Physics.DestroyHeightFieldMap( meshColliders[i] );
+    
+    return;
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/Jobs/JobSystem.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkJobSystem(void) {
+    
+    std::cout << "Job system scaling\n";
+    
+    const unsigned int numberOfElements = 1000000;
+    const unsigned int numberOfUpdates  = 10;
+    const unsigned int batchSize        = 1024;
+    
+    std::vector<float> input(numberOfElements);
+    std::vector<float> output(numberOfElements);
+    
+    for (unsigned int i=0; i < numberOfElements; i++)
+        input[i] = (float)i * 0.001f;
+    
+    // Roughly the cost of a component update per element
+    std::function<void(unsigned int, unsigned int)> kernel = [&input, &output](unsigned int begin, unsigned int end) {
+        for (unsigned int i=begin; i < end; i++) {
+            float value = input[i];
+            for (unsigned int n=0; n < 16; n++)
+                value = std::sin(value) * 0.5f + std::cos(value * 1.3f);
+            output[i] = value;
+        }
+    };
+    
+    unsigned int numberOfCores = std::thread::hardware_concurrency();
+    if (numberOfCores == 0)
+        numberOfCores = 1;
+    
+    double baselineMs = 0;
+    
+    for (unsigned int cores=1; cores <= numberOfCores; cores++) {
+        
+        // The calling thread works alongside the pool
+        JobSystem jobs;
+        if (cores > 1)
+            jobs.Initiate(cores - 1);
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int u=0; u < numberOfUpdates; u++)
+            jobs.ParallelFor(numberOfElements, batchSize, kernel);
+        
+        double updateMs = timer.GetCurrentDelta() / numberOfUpdates;
+        
+        if (cores == 1)
+            baselineMs = updateMs;
+        
+        std::cout << "  " << cores << " cores  " << updateMs << " ms  " << baselineMs / updateMs << "x\n";
+        
+        jobs.Shutdown();
+    }
+    
+    return;
+}
@@ -0,0 +1,173 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern RenderSystem Renderer;
+extern ColorPreset  Colors;
+
+
+void TestFramework::BenchmarkMeshStreaming(void) {
+    
+    std::cout << "Mesh streaming uploads\n";
+    
+    // Rain and snow layers set up as the weather system emitters
+    const unsigned int numberOfLayers    = 2;
+    const unsigned int numberOfParticles = 2000;
+    const unsigned int numberOfFrames    = 60;
+    
+    const glm::vec3 layerScale [numberOfLayers] = {glm::vec3(0.018f, 0.4f, 0.018f), glm::vec3(0.05f, 0.02f, 0.05f)};
+    const float     layerFall  [numberOfLayers] = {0.9f, 0.03f};
+    const float     layerWidth [numberOfLayers] = {40.0f, 30.0f};
+    const float     layerHeight = 70.0f;
+    
+    RandomStream random(19);
+    
+    // Weather scene drawn on its own
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    scenePtr->camera->transform.position = glm::vec3(0, layerHeight * 0.5f, -60.0f);
+    
+    Material* weatherMaterial = Renderer.CreateMaterial();
+    weatherMaterial->shader = Renderer.shaders.color;
+    weatherMaterial->isShared = true;
+    
+    IsolateScene(scenePtr);
+    
+    SubMesh particleSubMesh[numberOfLayers];
+    std::vector<glm::vec3> positions[numberOfLayers];
+    
+    for (unsigned int l=0; l < numberOfLayers; l++) {
+    
+        Renderer.meshes.cube->GetSubMesh(0, particleSubMesh[l]);
+        
+        for (unsigned int v=0; v < particleSubMesh[l].vertexBuffer.size(); v++) {
+            particleSubMesh[l].vertexBuffer[v].x *= layerScale[l].x;
+            particleSubMesh[l].vertexBuffer[v].y *= layerScale[l].y;
+            particleSubMesh[l].vertexBuffer[v].z *= layerScale[l].z;
+        }
+        
+        positions[l].resize(numberOfParticles);
+        
+        for (unsigned int p=0; p < numberOfParticles; p++)
+            positions[l][p] = glm::vec3(random.Range(-layerWidth[l], layerWidth[l]), random.Range(0.0f, layerHeight), random.Range(-layerWidth[l], layerWidth[l]));
+    }
+    
+    MeshUploadTrace trace;
+    Mesh::SetUploadTrace(&trace);
+    
+    Timer timer;
+    
+    for (unsigned int mode=0; mode < 2; mode++) {
+    
+        bool isDynamic = (mode == 1);
+        
+        Mesh*         weatherMesh[numberOfLayers];
+        MeshRenderer* weatherRenderer[numberOfLayers];
+        
+        for (unsigned int l=0; l < numberOfLayers; l++) {
+        
+            weatherMesh[l] = Renderer.CreateMesh();
+            weatherMesh[l]->SetDynamic(isDynamic);
+            
+            for (unsigned int p=0; p < numberOfParticles; p++)
+                weatherMesh[l]->AddSubMesh(positions[l][p].x, positions[l][p].y, positions[l][p].z, particleSubMesh[l], false);
+            
+            weatherMesh[l]->Load();
+            
+            weatherRenderer[l] = Renderer.CreateMeshRenderer();
+            weatherRenderer[l]->mesh = weatherMesh[l];
+            weatherRenderer[l]->material = weatherMaterial;
+            weatherRenderer[l]->DisableFrustumCulling();
+            
+            scenePtr->AddMeshRendererToSceneRoot(weatherRenderer[l], RENDER_QUEUE_GEOMETRY);
+        }
+        
+        Renderer.RenderFrame();
+        glFinish();
+        
+        // Every particle falls each frame. Frames are not finished one at a
+        // time, so a write into a copy the GPU is still drawing from blocks.
+        trace.Clear();
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+        
+            for (unsigned int l=0; l < numberOfLayers; l++) {
+            
+                for (unsigned int p=0; p < numberOfParticles; p++) {
+                    positions[l][p].y -= layerFall[l];
+                    if (positions[l][p].y < 0.0f)
+                        positions[l][p].y += layerHeight;
+                    
+                    weatherMesh[l]->ChangeSubMeshPosition(p, positions[l][p].x, positions[l][p].y, positions[l][p].z);
+                }
+                
+                weatherMesh[l]->Load();
+            }
+            
+            Renderer.RenderFrame();
+        }
+        
+        glFinish();
+        
+        double fallingMs = timer.GetCurrentDelta() / numberOfFrames;
+        unsigned int fallingBytes  = trace.numberOfBytes / numberOfFrames;
+        unsigned int fallingWaits  = trace.numberOfFenceWaits;
+        unsigned int fallingStalls = trace.numberOfFenceStalls;
+        
+        // A handful of particles change each frame, as with text or a partial rebuild
+        trace.Clear();
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+        
+            for (unsigned int p=0; p < 8; p++)
+                weatherMesh[0]->ChangeSubMeshColor((f * 8 + p) % numberOfParticles, Colors.white);
+            
+            weatherMesh[0]->Load();
+            
+            Renderer.RenderFrame();
+        }
+        
+        glFinish();
+        
+        double partialMs = timer.GetCurrentDelta() / numberOfFrames;
+        unsigned int partialBytes  = trace.numberOfBytes / numberOfFrames;
+        unsigned int partialWaits  = trace.numberOfFenceWaits;
+        unsigned int partialStalls = trace.numberOfFenceStalls;
+        
+        std::cout << (isDynamic ? "  Dynamic ring   " : "  Static upload  ");
+        std::cout << "all falling " << fallingBytes << " bytes  " << fallingMs << " ms  "
+                  << fallingWaits << " fence waits  " << fallingStalls << " stalled\n";
+        std::cout << "                 few changed " << partialBytes << " bytes  " << partialMs << " ms  "
+                  << partialWaits << " fence waits  " << partialStalls << " stalled\n";
+        
+        for (unsigned int l=0; l < numberOfLayers; l++) {
+        
+            scenePtr->RemoveMeshRendererFromSceneRoot(weatherRenderer[l], RENDER_QUEUE_GEOMETRY);
+            
+            weatherRenderer[l]->mesh = nullptr;
+            weatherRenderer[l]->material = nullptr;
+            Renderer.DestroyMeshRenderer(weatherRenderer[l]);
+            
+            Renderer.DestroyMesh(weatherMesh[l]);
+        }
+    }
+    
+    std::cout << "  " << numberOfLayers << " layers of " << numberOfParticles << " particles, " << numberOfFrames << " frames\n";
+    
+    Mesh::SetUploadTrace(nullptr);
+    
+    RestoreScenes();
+    
+    Renderer.DestroyMaterial(weatherMaterial);
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}
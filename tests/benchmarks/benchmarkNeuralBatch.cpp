@@ -0,0 +1,89 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/NeuralNetwork.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Actor side network state as held by each actor
+struct BenchmarkNeuralActor {
+    NeuralNetwork network;
+    std::vector<float> inputs;
+    std::vector<float> outputs;
+};
+
+
+void TestFramework::BenchmarkNeuralBatch(void) {
+    
+    std::cout << "Neural network batched actors\n";
+    
+    // Every actor loads the same network state in SpawnActor
+    NeuralNetwork source;
+    source.AddNeuralLayer(16, 1);
+    source.AddNeuralLayer(16, 16);
+    source.AddNeuralLayer(16, 16);
+    source.AddNeuralLayer(1, 16);
+    
+    std::vector<std::string> state = source.SaveState();
+    
+    const unsigned int actorCounts[] = {100, 1000, 10000};
+    const unsigned int numberOfInferences = 400000;
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfActors = actorCounts[c];
+        unsigned int numberOfPasses = numberOfInferences / numberOfActors;
+        
+        RandomStream random(9);
+        
+        std::vector<BenchmarkNeuralActor> actors(numberOfActors);
+        for (unsigned int a=0; a < numberOfActors; a++) {
+            actors[a].network.LoadState(state);
+            actors[a].inputs.resize(1, random.Range(0.0f, 1.0f));
+            actors[a].outputs.resize(actors[a].network.GetNumberOfOutputs());
+        }
+        
+        float checksum = 0.0f;
+        
+        // Each actor runs its own network
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int p=0; p < numberOfPasses; p++) {
+            for (unsigned int a=0; a < numberOfActors; a++) {
+                BenchmarkNeuralActor& actor = actors[a];
+                actor.network.FeedForward(actor.inputs.data(), actor.inputs.size(), actor.outputs.data());
+                checksum += actor.outputs[0];
+            }
+        }
+        
+        double actorMs = timer.GetCurrentDelta();
+        
+        // Gather, run the batch through the first actor network and scatter
+        std::vector<float> batchInputs(numberOfActors);
+        std::vector<float> batchOutputs(numberOfActors);
+        
+        timer.Update();
+        
+        for (unsigned int p=0; p < numberOfPasses; p++) {
+            for (unsigned int a=0; a < numberOfActors; a++)
+                batchInputs[a] = actors[a].inputs[0];
+            
+            actors[0].network.FeedForwardBatch(batchInputs.data(), 1, batchOutputs.data(), numberOfActors);
+            
+            for (unsigned int a=0; a < numberOfActors; a++) {
+                actors[a].outputs[0] = batchOutputs[a];
+                checksum += actors[a].outputs[0];
+            }
+        }
+        
+        double batchMs = timer.GetCurrentDelta();
+        
+        std::cout << "  " << numberOfActors << " actors   per actor " << actorMs / numberOfPasses
+                  << " ms   batched " << batchMs / numberOfPasses << " ms per update   checksum " << checksum << "\n";
+    }
+    
+    return;
+}
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/NeuralNetwork.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Nested vector layers and per call vectors as used before the flat layout
+struct LegacyNeuralNetwork {
+    
+    std::vector<std::vector<float>> neurons;
+    std::vector<std::vector<std::vector<float>>> weights;
+    std::vector<std::vector<float>> biases;
+    
+    void AddNeuralLayer(unsigned int numberOfNeurons, unsigned int numberOfInputs, RandomStream& random) {
+        neurons.push_back(std::vector<float>(numberOfNeurons));
+        biases.push_back(std::vector<float>(numberOfNeurons, 0.0f));
+        weights.push_back(std::vector<std::vector<float>>(numberOfNeurons, std::vector<float>(numberOfInputs)));
+        for (unsigned int n=0; n < numberOfNeurons; n++)
+            for (unsigned int i=0; i < numberOfInputs; i++)
+                weights.back()[n][i] = random.Range(-1.0f, 1.0f);
+    }
+    
+    void FeedForward(const std::vector<float>& input) {
+        neurons[0] = input;
+        for (size_t i = 1; i < neurons.size(); ++i) {
+            for (size_t j = 0; j < neurons[i].size(); ++j) {
+                float sum = biases[i][j];
+                for (size_t k = 0; k < neurons[i - 1].size(); ++k)
+                    sum += neurons[i - 1][k] * weights[i][j][k];
+                neurons[i][j] = tanh(sum);
+            }
+        }
+    }
+    
+    std::vector<float> GetResults(void) {return neurons.back();}
+};
+
+
+void TestFramework::BenchmarkNeuralNetwork(void) {
+    
+    std::cout << "Neural network inference\n";
+    
+    // Sheep, Bear and Dog actors all run the actor network loaded in SpawnActor.
+    // The wider topologies show how the kernels scale past it.
+    const unsigned int numberOfTopologies = 3;
+    const char* names[numberOfTopologies] = {"actor 1-16-16-1 ", "8-32-32-4       ", "16-64-64-8      "};
+    const unsigned int topologies[numberOfTopologies][4] = {{1, 16, 16, 1}, {8, 32, 32, 4}, {16, 64, 64, 8}};
+    
+    const unsigned int numberOfInferences = 200000;
+    
+    for (unsigned int t=0; t < numberOfTopologies; t++) {
+        
+        RandomStream random(55);
+        
+        LegacyNeuralNetwork legacy;
+        NeuralNetwork network;
+        
+        for (unsigned int l=0; l < 4; l++) {
+            unsigned int numberOfInputs = (l == 0) ? 1 : topologies[t][l - 1];
+            legacy.AddNeuralLayer(topologies[t][l], numberOfInputs, random);
+            network.AddNeuralLayer(topologies[t][l], numberOfInputs);
+        }
+        
+        // Actors feed a single encoded value
+        unsigned int numberOfInputs = (t == 0) ? 1 : topologies[t][0];
+        
+        std::vector<float> input(numberOfInputs);
+        std::vector<float> output(network.GetNumberOfOutputs());
+        
+        float checksum = 0.0f;
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfInferences; i++) {
+            input[0] = (i % 100) * 0.01f;
+            legacy.FeedForward(input);
+            checksum += legacy.GetResults()[0];
+        }
+        
+        double legacyMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfInferences; i++) {
+            input[0] = (i % 100) * 0.01f;
+            network.FeedForward(input.data(), input.size(), output.data());
+            checksum += output[0];
+        }
+        
+        double flatMs = timer.GetCurrentDelta();
+        
+        std::cout << "  " << names[t] << "  nested " << (unsigned int)(numberOfInferences / (legacyMs * 0.001))
+                  << "   flat " << (unsigned int)(numberOfInferences / (flatMs * 0.001)) << " inferences per second   checksum " << checksum << "\n";
+    }
+    
+    return;
+}
@@ -0,0 +1,142 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/NeuralNetwork.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Nested vector training allocating its deltas on every step as before the scratch buffers
+struct LegacyNeuralTrainer {
+    
+    std::vector<std::vector<float>> neurons;
+    std::vector<std::vector<std::vector<float>>> weights;
+    std::vector<std::vector<float>> biases;
+    
+    void AddNeuralLayer(unsigned int numberOfNeurons, unsigned int numberOfInputs, RandomStream& random) {
+        neurons.push_back(std::vector<float>(numberOfNeurons));
+        biases.push_back(std::vector<float>(numberOfNeurons, 0.0f));
+        weights.push_back(std::vector<std::vector<float>>(numberOfNeurons, std::vector<float>(numberOfInputs)));
+        for (unsigned int n=0; n < numberOfNeurons; n++)
+            for (unsigned int i=0; i < numberOfInputs; i++)
+                weights.back()[n][i] = random.Range(0, 100) * 0.0025f;
+    }
+    
+    void Train(TrainingSet& trainingSet, float learningRate) {
+        
+        // Feed forward
+        neurons[0] = trainingSet.input;
+        for (size_t i = 1; i < neurons.size(); ++i) {
+            for (size_t j = 0; j < neurons[i].size(); ++j) {
+                float sum = biases[i][j];
+                for (size_t k = 0; k < neurons[i - 1].size(); ++k)
+                    sum += neurons[i - 1][k] * weights[i][j][k];
+                neurons[i][j] = tanh(sum);
+            }
+        }
+        
+        // Deltas
+        std::vector<std::vector<float>> deltas(neurons.size());
+        deltas.back().resize(neurons.back().size());
+        for (size_t i = 0; i < neurons.back().size(); ++i)
+            deltas.back()[i] = (trainingSet.target[i] - neurons.back()[i]) * (neurons.back()[i] > 0 ? 1.0f : 0.0f);
+        
+        for (int i = neurons.size() - 2; i >= 0; --i) {
+            deltas[i].resize(neurons[i].size());
+            for (size_t j = 0; j < neurons[i].size(); ++j) {
+                float error = 0.0f;
+                for (size_t k = 0; k < neurons[i + 1].size(); ++k)
+                    if (j < weights[i + 1][k].size()) error += weights[i + 1][k][j] * deltas[i + 1][k];
+                deltas[i][j] = error * (neurons[i][j] > 0 ? 1.0f : 0.0f);
+            }
+        }
+        
+        // Weights
+        const std::vector<float>* previous = &trainingSet.input;
+        for (size_t i = 0; i < neurons.size(); ++i) {
+            for (size_t j = 0; j < std::min(neurons[i].size(), weights[i].size()); ++j) {
+                biases[i][j] += learningRate * deltas[i][j];
+                for (size_t k = 0; k < std::min(previous->size(), weights[i][j].size()); ++k)
+                    weights[i][j][k] += learningRate * deltas[i][j] * (*previous)[k];
+            }
+            previous = &neurons[i];
+        }
+    }
+};
+
+
+void TestFramework::BenchmarkNeuralTraining(void) {
+    
+    std::cout << "Neural network training\n";
+    
+    const unsigned int numberOfTopologies = 2;
+    const char* names[numberOfTopologies] = {"actor 1-16-16-1 ", "8-32-32-4       "};
+    const unsigned int topologies[numberOfTopologies][4] = {{1, 16, 16, 1}, {8, 32, 32, 4}};
+    
+    const unsigned int numberOfSteps = 100000;
+    const unsigned int batchSize = 32;
+    
+    for (unsigned int t=0; t < numberOfTopologies; t++) {
+        
+        RandomStream random(55);
+        
+        LegacyNeuralTrainer legacy;
+        NeuralNetwork network;
+        NeuralNetwork batchNetwork;
+        
+        for (unsigned int l=0; l < 4; l++) {
+            unsigned int numberOfInputs = (l == 0) ? 1 : topologies[t][l - 1];
+            legacy.AddNeuralLayer(topologies[t][l], numberOfInputs, random);
+            network.AddNeuralLayer(topologies[t][l], numberOfInputs);
+            batchNetwork.AddNeuralLayer(topologies[t][l], numberOfInputs);
+        }
+        
+        std::vector<TrainingSet> trainingBook(batchSize);
+        
+        for (unsigned int s=0; s < batchSize; s++) {
+            trainingBook[s].input.resize(topologies[t][0]);
+            trainingBook[s].target.resize(topologies[t][3]);
+            for (unsigned int i=0; i < trainingBook[s].input.size(); i++)
+                trainingBook[s].input[i] = random.Range(0, 100) * 0.01f;
+            for (unsigned int i=0; i < trainingBook[s].target.size(); i++)
+                trainingBook[s].target[i] = random.Range(0, 50) * 0.01f;
+        }
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfSteps; i++)
+            legacy.Train(trainingBook[i % batchSize], 0.01f);
+        
+        double legacyMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfSteps; i++)
+            network.Train(trainingBook[i % batchSize], 0.01f);
+        
+        double scratchMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        // Each mini-batch counts as one step per training set
+        for (unsigned int i=0; i < numberOfSteps / batchSize; i++)
+            batchNetwork.TrainBatch(trainingBook.data(), batchSize, 0.01f);
+        
+        double batchMs = timer.GetCurrentDelta();
+        
+        network.FeedForward(trainingBook[0].input);
+        batchNetwork.FeedForward(trainingBook[0].input);
+        legacy.Train(trainingBook[0], 0.0f);
+        
+        float checksum = network.GetResults()[0] + batchNetwork.GetResults()[0] + legacy.neurons.back()[0];
+        
+        std::cout << "  " << names[t] << "  allocating " << (unsigned int)(numberOfSteps / (legacyMs * 0.001))
+                  << "   scratch " << (unsigned int)(numberOfSteps / (scratchMs * 0.001))
+                  << "   batch " << (unsigned int)((numberOfSteps / batchSize) * batchSize / (batchMs * 0.001)) << " steps per second   checksum " << checksum << "\n";
+    }
+    
+    return;
+}
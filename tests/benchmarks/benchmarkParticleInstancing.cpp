@@ -0,0 +1,135 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Timer/timer.h>
+#include <GameEngineFramework/plugins.h>
+
+
+void TestFramework::BenchmarkParticleInstancing(void) {
+    
+    std::cout << "Particle emitter update and draw\n";
+    
+    const unsigned int particleCounts[] = {2000, 20000, 200000};
+    const unsigned int numberOfFrames = 10;
+    
+    SubMesh particleSubMesh;
+    Engine.meshes.cube->GetSubMesh(0, particleSubMesh);
+    
+    // Both paths are drawn alone so each frame times the update, the upload and the draw
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    
+    Material* subMeshMaterial = Renderer.CreateMaterial();
+    subMeshMaterial->shader = Renderer.shaders.color;
+    subMeshMaterial->DisableCulling();
+    
+    IsolateScene(scenePtr);
+    
+    // Emitters add their batch to the main scene
+    Scene* sceneMain = Engine.sceneMain;
+    Engine.sceneMain = scenePtr;
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfParticles = particleCounts[c];
+        
+        // Old path, every particle is a sub mesh rewritten and uploaded each frame
+        Mesh* particleMesh = Renderer.CreateMesh();
+        particleMesh->SetDynamic(true);
+        
+        std::vector<glm::vec3> positions(numberOfParticles);
+        std::vector<glm::vec3> velocities(numberOfParticles, glm::vec3(0.01f, 0.02f, 0.01f));
+        
+        for (unsigned int p=0; p < numberOfParticles; p++) {
+            
+            positions[p] = glm::vec3(Random.Range(-100.0f, 100.0f), Random.Range(-100.0f, 100.0f), Random.Range(-100.0f, 100.0f));
+            
+            particleMesh->AddSubMesh(positions[p].x, positions[p].y, positions[p].z, particleSubMesh, false);
+        }
+        
+        particleMesh->Load();
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        meshRenderer->mesh = particleMesh;
+        meshRenderer->material = subMeshMaterial;
+        meshRenderer->DisableFrustumCulling();
+        
+        scenePtr->AddMeshRendererToSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        
+        Renderer.RenderFrame();
+        glFinish();
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+            
+            for (unsigned int p=0; p < numberOfParticles; p++) {
+                
+                positions[p] += velocities[p];
+                
+                particleMesh->ChangeSubMeshPosition(p, positions[p].x, positions[p].y, positions[p].z);
+                particleMesh->ChangeSubMeshScale(p, 1.0f, 1.0f, 1.0f);
+                particleMesh->ChangeSubMeshColor(p, Colors.white);
+            }
+            
+            particleMesh->Load();
+            
+            Renderer.RenderFrame();
+            glFinish();
+        }
+        
+        double subMeshMs = timer.GetCurrentDelta() / numberOfFrames;
+        
+        scenePtr->RemoveMeshRendererFromSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        
+        Renderer.DestroyMeshRenderer(meshRenderer);
+        Renderer.DestroyMesh(particleMesh);
+        
+        // Emitter arrays handed to an instanced batch
+        Emitter* emitter = Particle.CreateEmitter();
+        
+        emitter->type = EmitterType::AreaEffector;
+        emitter->width  = 100.0f;
+        emitter->height = 100.0f;
+        emitter->maxParticles = numberOfParticles;
+        emitter->velocity = glm::vec3(0.01f, 0.02f, 0.01f);
+        
+        // First update spawns the whole area
+        Particle.Update();
+        
+        Renderer.RenderFrame();
+        glFinish();
+        
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++) {
+            
+            Particle.Update();
+            
+            Renderer.RenderFrame();
+            glFinish();
+        }
+        
+        double instancedMs = timer.GetCurrentDelta() / numberOfFrames;
+        
+        Particle.DestroyEmitter(emitter);
+        
+        std::cout << "  " << numberOfParticles << " particles\n";
+        std::cout << "  Sub meshes    " << subMeshMs   << " ms per frame\n";
+        std::cout << "  Instanced     " << instancedMs << " ms per frame\n";
+    }
+    
+    Engine.sceneMain = sceneMain;
+    
+    RestoreScenes();
+    
+    Renderer.DestroyMaterial(subMeshMaterial);
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkPerlinBatch(void) {
+    
+    std::cout << "Perlin noise throughput (single core)\n";
+    
+    // One chunk height field of samples per pass
+    const unsigned int numberOfSamples = 51 * 51;
+    const unsigned int numberOfPasses  = 400;
+    
+    std::vector<float> xCoord(numberOfSamples);
+    std::vector<float> yCoord(numberOfSamples, 0.0f);
+    std::vector<float> zCoord(numberOfSamples);
+    std::vector<float> output(numberOfSamples);
+    
+    for (unsigned int i=0; i < numberOfSamples; i++) {
+        xCoord[i] = (float)(i % 51) * 0.02f + 13.0f;
+        zCoord[i] = (float)(i / 51) * 0.02f - 7.0f;
+    }
+    
+    float checksum = 0.0f;
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int p=0; p < numberOfPasses; p++) {
+        for (unsigned int i=0; i < numberOfSamples; i++)
+            output[i] = Random.Perlin(xCoord[i], yCoord[i], zCoord[i], p);
+        checksum += output[p];
+    }
+    
+    double scalarMs = timer.GetCurrentDelta();
+    
+    timer.Update();
+    
+    for (unsigned int p=0; p < numberOfPasses; p++) {
+        Random.PerlinBatch(xCoord.data(), yCoord.data(), zCoord.data(), output.data(), numberOfSamples, p);
+        checksum += output[p];
+    }
+    
+    double batchMs = timer.GetCurrentDelta();
+    
+    double totalSamples = (double)numberOfSamples * numberOfPasses;
+    
+    std::cout << "  scalar  " << scalarMs << " ms  " << totalSamples / (scalarMs * 1000.0) << " M samples/s\n";
+    std::cout << "  batch   " << batchMs  << " ms  " << totalSamples / (batchMs  * 1000.0) << " M samples/s  " << scalarMs / batchMs << "x\n";
+    std::cout << "  checksum " << checksum << "\n\n";
+}
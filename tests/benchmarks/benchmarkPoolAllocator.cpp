@@ -0,0 +1,183 @@
+#include <iostream>
+#include <string>
+
+#include "../framework.h"
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+struct PoolBenchmarkType {
+    float  position[3];
+    float  rotation[4];
+    float  scale[3];
+    void*  parent;
+    bool   isActive;
+    PoolBenchmarkType() : parent(nullptr), isActive(true) {}
+};
+
+
+// Reference copy of the previous scanning allocator used for comparison.
+// Fill() reserves slots directly so large occupancies can be reached without
+// paying the quadratic cost of the old Create() during setup.
+class LegacyPoolAllocator {
+
+public:
+    
+    LegacyPoolAllocator(unsigned int poolSize) : m_poolSz(poolSize) {}
+    
+    ~LegacyPoolAllocator() {
+        for (unsigned int i=0; i < m_pool.size(); i++)
+            free(m_pool[i].first);
+    }
+    
+    PoolBenchmarkType* Create(void) {
+        for (unsigned int i=0; i < m_pool.size(); i++) {
+            PoolBenchmarkType* poolPtr = m_pool[i].first;
+            std::vector<bool>& boolPtr = m_pool[i].second;
+            for (unsigned int f=0; f < m_poolSz; f++) {
+                if (boolPtr[f]) continue;
+                new (&poolPtr[f]) PoolBenchmarkType();
+                boolPtr[f] = true;
+                m_activeList.push_back(&poolPtr[f]);
+                return &poolPtr[f];
+            }
+        }
+        allocate();
+        return Create();
+    }
+    
+    bool Destroy(PoolBenchmarkType* objectPtr) {
+        for (unsigned int i=0; i < m_pool.size(); i++) {
+            PoolBenchmarkType* poolPtr = m_pool[i].first;
+            std::vector<bool>& boolPtr = m_pool[i].second;
+            for (unsigned int f=0; f < m_poolSz; f++) {
+                if (objectPtr != &poolPtr[f]) continue;
+                if (!boolPtr[f]) return false;
+                poolPtr[f].~PoolBenchmarkType();
+                boolPtr[f] = false;
+                for (unsigned int a=0; a < m_activeList.size(); a++) {
+                    if (m_activeList[a] == objectPtr) {m_activeList.erase( m_activeList.begin() + a ); break;}
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    unsigned int GetObjectCount(void) {
+        unsigned int objectCount = 0;
+        for (unsigned int i=0; i < m_pool.size(); i++) {
+            std::vector<bool> boolPtr = m_pool[i].second;
+            for (unsigned int f=0; f < m_poolSz; f++)
+                if (boolPtr[f]) objectCount++;
+        }
+        return objectCount;
+    }
+    
+    void Fill(unsigned int count) {
+        while (m_pool.size() * m_poolSz < count)
+            allocate();
+        for (unsigned int i=0; i < count; i++) {
+            std::pair<PoolBenchmarkType*, std::vector<bool>>& poolPair = m_pool[i / m_poolSz];
+            new (&poolPair.first[i % m_poolSz]) PoolBenchmarkType();
+            poolPair.second[i % m_poolSz] = true;
+            m_activeList.push_back(&poolPair.first[i % m_poolSz]);
+        }
+    }
+    
+    PoolBenchmarkType* operator[] (unsigned int const i) {return m_activeList[i];}
+
+private:
+    
+    void allocate(void) {
+        PoolBenchmarkType* poolPtr = (PoolBenchmarkType*)malloc(m_poolSz * sizeof(PoolBenchmarkType));
+        m_pool.push_back( std::make_pair(poolPtr, std::vector<bool>(m_poolSz, false)) );
+    }
+    
+    unsigned int m_poolSz;
+    
+    std::vector< std::pair<PoolBenchmarkType*, std::vector<bool>> > m_pool;
+    std::vector< PoolBenchmarkType* > m_activeList;
+    
+};
+
+
+// Churn objects near the end of the active list as chunk streaming does, then
+// query the counters. Returns milliseconds for each phase.
+template<typename Allocator> void BenchmarkPoolChurn(Allocator& pool, unsigned int occupancy, unsigned int numberOfOperations,
+                                                     double& createMs, double& destroyMs, double& countMs) {
+    
+    Timer timer;
+    std::vector<PoolBenchmarkType*> churn(numberOfOperations);
+    
+    // Release a block of objects to open holes in the pool
+    for (unsigned int i=0; i < numberOfOperations; i++)
+        churn[i] = pool[occupancy - 1 - i];
+    
+    timer.Update();
+    for (unsigned int i=0; i < numberOfOperations; i++)
+        pool.Destroy(churn[i]);
+    destroyMs = timer.GetCurrentDelta();
+    
+    timer.Update();
+    for (unsigned int i=0; i < numberOfOperations; i++)
+        churn[i] = pool.Create();
+    createMs = timer.GetCurrentDelta();
+    
+    unsigned int total = 0;
+    timer.Update();
+    for (unsigned int i=0; i < 100; i++)
+        total += pool.GetObjectCount();
+    countMs = timer.GetCurrentDelta() / 100.0;
+    
+    if (total == 0)
+        std::cout << "";
+    
+    return;
+}
+
+
+void TestFramework::BenchmarkPoolAllocator(void) {
+    
+    std::cout << "Pool allocator\n";
+    std::cout << "  objects   allocator   create (ns/op)   destroy (ns/op)   count (ms)\n";
+    
+    const unsigned int occupancy[] = {1000, 64 * 1024, 1000 * 1000};
+    
+    for (unsigned int i=0; i < 3; i++) {
+        
+        unsigned int numberOfObjects = occupancy[i];
+        unsigned int numberOfOperations = (numberOfObjects < 1000) ? numberOfObjects : 1000;
+        
+        double createMs  = 0;
+        double destroyMs = 0;
+        double countMs   = 0;
+        
+        // Free list allocator
+        PoolAllocator<PoolBenchmarkType> pool(1024, 1);
+        for (unsigned int n=0; n < numberOfObjects; n++)
+            pool.Create();
+        
+        BenchmarkPoolChurn(pool, numberOfObjects, numberOfOperations, createMs, destroyMs, countMs);
+        
+        std::cout << "  " << numberOfObjects << "   free list   "
+                  << (createMs  * 1000000.0) / numberOfOperations << "   "
+                  << (destroyMs * 1000000.0) / numberOfOperations << "   "
+                  << countMs << "\n";
+        
+        // Previous scanning allocator
+        LegacyPoolAllocator legacy(1024);
+        legacy.Fill(numberOfObjects);
+        
+        BenchmarkPoolChurn(legacy, numberOfObjects, numberOfOperations, createMs, destroyMs, countMs);
+        
+        std::cout << "  " << numberOfObjects << "   scanning    "
+                  << (createMs  * 1000000.0) / numberOfOperations << "   "
+                  << (destroyMs * 1000000.0) / numberOfOperations << "   "
+                  << countMs << "\n";
+        
+        continue;
+    }
+    
+    return;
+}
+
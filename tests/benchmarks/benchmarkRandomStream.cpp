@@ -0,0 +1,52 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "../framework.h"
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkRandomStream(void) {
+    
+    std::cout << "Random stream throughput\n";
+    
+    const unsigned int numberOfValues = 10000000;
+    
+    std::vector<uint32_t> buffer(numberOfValues);
+    
+    // Sum the values so the loops are not removed
+    unsigned long long checksum = 0;
+    
+    srand(100);
+    
+    Timer timer;
+    timer.Update();
+    for (unsigned int i=0; i < numberOfValues; i++)
+        checksum += rand() % 100;
+    double randMs = timer.GetCurrentDelta();
+    
+    RandomStream stream(100);
+    
+    timer.Update();
+    for (unsigned int i=0; i < numberOfValues; i++)
+        checksum += stream.Range(0, 100);
+    double rangeMs = timer.GetCurrentDelta();
+    
+    timer.Update();
+    for (unsigned int i=0; i < numberOfValues; i++)
+        checksum += stream.Next();
+    double nextMs = timer.GetCurrentDelta();
+    
+    timer.Update();
+    stream.Fill(buffer.data(), numberOfValues);
+    double fillMs = timer.GetCurrentDelta();
+    checksum += buffer[numberOfValues / 2];
+    
+    std::cout << "  rand() % 100     " << randMs  << " ms  " << numberOfValues / (randMs  * 1000.0) << " M/s\n";
+    std::cout << "  stream Range     " << rangeMs << " ms  " << numberOfValues / (rangeMs * 1000.0) << " M/s\n";
+    std::cout << "  stream Next      " << nextMs  << " ms  " << numberOfValues / (nextMs  * 1000.0) << " M/s\n";
+    std::cout << "  stream Fill      " << fillMs  << " ms  " << numberOfValues / (fillMs  * 1000.0) << " M/s\n";
+    std::cout << "  checksum " << checksum << "\n\n";
+}
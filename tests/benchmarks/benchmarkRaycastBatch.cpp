@@ -0,0 +1,114 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern PhysicsSystem Physics;
+
+// Rays per second from the milliseconds taken
+static double RayRate(unsigned int numberOfRays, double milliseconds) {
+    
+    if (milliseconds <= 0.0)
+        return 0.0;
+    
+    return numberOfRays / (milliseconds / 1000.0);
+}
+
+
+void TestFramework::BenchmarkRaycastBatch(void) {
+    
+    std::cout << "Ray casts\n";
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    const unsigned int fieldSize = 33;
+    const int tilesPerSide = 8;
+    const float tileSize = (float)(fieldSize - 1);
+    
+    RandomStream random(47);
+    
+    std::vector<float> heightField(fieldSize * fieldSize);
+    std::vector<MeshCollider*> meshColliders;
+    
+    // Generate a field of chunks with rolling terrain
+    for (int x=0; x < tilesPerSide; x++) {
+        
+        for (int z=0; z < tilesPerSide; z++) {
+            
+            for (unsigned int i=0; i < fieldSize; i++)
+                for (unsigned int j=0; j < fieldSize; j++)
+                    heightField[j * fieldSize + i] = random.Perlin((x * tileSize + i) * 0.05f, 0, (z * tileSize + j) * 0.05f) * 20.0f;
+            
+            MeshCollider* meshCollider = Physics.CreateHeightFieldMap(heightField.data(), fieldSize, fieldSize, 1, 1, 1);
+            
+            rp3d::Transform bodyTransform = rp3d::Transform::identity();
+            bodyTransform.setPosition( rp3d::Vector3(x * tileSize, 0, z * tileSize) );
+            
+            rp3d::RigidBody* rigidBody = Physics.world->createRigidBody( bodyTransform );
+            rigidBody->setType(rp3d::BodyType::STATIC);
+            
+            rp3d::Collider* bodyCollider = rigidBody->addCollider( meshCollider->heightFieldShape, rp3d::Transform::identity() );
+            bodyCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+            
+            meshColliders.push_back(meshCollider);
+        }
+    }
+    
+    const unsigned int rayCounts[] = {1000, 10000, 100000};
+    const float minimum = -tileSize * 0.5f;
+    const float maximum = tileSize * (tilesPerSide - 0.5f);
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfRays = rayCounts[c];
+        
+        std::vector<RaycastQuery> queries(numberOfRays);
+        std::vector<Hit> hits(numberOfRays);
+        std::vector<uint8_t> isHit(numberOfRays);
+        
+        for (unsigned int i=0; i < numberOfRays; i++) {
+            queries[i].from     = glm::vec3(random.Range(minimum, maximum), 100.0f, random.Range(minimum, maximum));
+            queries[i].distance = 200.0f;
+            queries[i].layer    = LayerMask::Ground;
+        }
+        
+        unsigned int singleHits = 0;
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfRays; i++)
+            singleHits += Physics.Raycast(queries[i].from, queries[i].direction, queries[i].distance, hits[i], queries[i].layer);
+        
+        double singleMs = timer.GetCurrentDelta();
+        
+        timer.Update();
+        
+        unsigned int batchHits = Physics.RaycastBatch(queries.data(), numberOfRays, hits.data(), isHit.data());
+        
+        double batchMs = timer.GetCurrentDelta();
+        
+        std::cout << "  rays " << numberOfRays << "   single " << RayRate(numberOfRays, singleMs)
+                  << " /s   batch " << RayRate(numberOfRays, batchMs) << " /s";
+        
+        if (singleHits != batchHits)
+            std::cout << "   MISMATCH";
+        
+        std::cout << "\n";
+    }
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    for (unsigned int i=0; i < meshColliders.size(); i++)
+        Physics.DestroyHeightFieldMap( meshColliders[i] );
+    
+    return;
+}
@@ -0,0 +1,210 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/RegionFile.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Static element layout used by the per chunk static files
+struct LegacyStaticElement {
+    glm::vec3 position;
+    glm::vec3 color;
+    uint8_t type;
+};
+
+static const std::string benchmarkRegionPath = "benchmark_regions";
+
+static ChunkRecord CreateBenchmarkChunkRecord(RandomStream& random, unsigned int numberOfActors, unsigned int numberOfStatics) {
+    ChunkRecord record;
+    
+    // Genomes are comma separated weight lists
+    for (unsigned int a=0; a < numberOfActors; a++) {
+        ChunkActorRecord actor;
+        actor.position = glm::vec3(random.Range(-25.0f, 25.0f), random.Range(-20.0f, 40.0f), random.Range(-25.0f, 25.0f));
+        actor.age = random.Range(0, 100000);
+        for (unsigned int g=0; g < 96; g++)
+            actor.genome += Float.ToString(random.Range(-1.0f, 1.0f)) + ",";
+        record.actors.push_back(actor);
+    }
+    
+    for (unsigned int s=0; s < numberOfStatics; s++) {
+        ChunkStaticRecord staticRecord;
+        staticRecord.position = glm::vec3(random.Range(-25, 25), random.Range(-20.0f, 40.0f), random.Range(-25, 25));
+        staticRecord.color = glm::vec3(0.1f, 0.3f + random.Range(0, 4) * 0.05f, 0.1f);
+        staticRecord.type = random.Range(0, 5);
+        record.statics.push_back(staticRecord);
+    }
+    
+    return record;
+}
+
+static std::string GetCellName(int cellX, int cellZ) {
+    return Int.ToString(cellX) + "_" + Int.ToString(cellZ);
+}
+
+
+void TestFramework::BenchmarkRegionFile(void) {
+    
+    std::cout << "Chunk save / load\n";
+    
+    const int gridSize = 24;
+    const unsigned int numberOfChunks = gridSize * gridSize;
+    
+    RandomStream random(77);
+    std::vector<ChunkRecord> records;
+    for (unsigned int c=0; c < numberOfChunks; c++)
+        records.push_back( CreateBenchmarkChunkRecord(random, 4, 300) );
+    
+    fs.DirectoryDelete(benchmarkRegionPath + "/chunks");
+    fs.DirectoryDelete(benchmarkRegionPath + "/static");
+    fs.DirectoryDelete(benchmarkRegionPath + "/regions");
+    fs.DirectoryCreate(benchmarkRegionPath);
+    fs.DirectoryCreate(benchmarkRegionPath + "/chunks");
+    fs.DirectoryCreate(benchmarkRegionPath + "/static");
+    fs.DirectoryCreate(benchmarkRegionPath + "/regions");
+    
+    // One text file for actors and one array file for statics per chunk
+    
+    unsigned int legacyFiles = 0;
+    unsigned long long int legacyBytes = 0;
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int c=0; c < numberOfChunks; c++) {
+        ChunkRecord& record = records[c];
+        std::string name = GetCellName((c % gridSize) - gridSize / 2, (c / gridSize) - gridSize / 2);
+        
+        std::string buffer;
+        for (unsigned int a=0; a < record.actors.size(); a++) {
+            ChunkActorRecord& actor = record.actors[a];
+            buffer += Float.ToString(actor.position.x) + "~" + Float.ToString(actor.position.y) + "~" +
+                      Float.ToString(actor.position.z) + "~" + IntLong.ToString((long int)actor.age) + "~" + actor.genome + '\n';
+        }
+        
+        std::vector<LegacyStaticElement> staticElements(record.statics.size());
+        for (unsigned int s=0; s < record.statics.size(); s++) {
+            staticElements[s].position = record.statics[s].position;
+            staticElements[s].color = record.statics[s].color;
+            staticElements[s].type = record.statics[s].type;
+        }
+        
+        Serializer.Serialize(benchmarkRegionPath + "/chunks/" + name, (void*)buffer.data(), buffer.size());
+        Serializer.Serialize(benchmarkRegionPath + "/static/" + name, (void*)staticElements.data(), staticElements.size() * sizeof(LegacyStaticElement));
+        
+        legacyFiles += 2;
+        legacyBytes += buffer.size() + staticElements.size() * sizeof(LegacyStaticElement);
+    }
+    
+    double legacySaveMs = timer.GetCurrentDelta();
+    
+    timer.Update();
+    
+    unsigned int numberOfActorsLoaded = 0;
+    for (unsigned int c=0; c < numberOfChunks; c++) {
+        std::string name = GetCellName((c % gridSize) - gridSize / 2, (c / gridSize) - gridSize / 2);
+        std::string chunkName = benchmarkRegionPath + "/chunks/" + name;
+        std::string staticName = benchmarkRegionPath + "/static/" + name;
+        
+        unsigned int fileSize = Serializer.GetFileSize(chunkName);
+        std::string dataBuffer;
+        dataBuffer.resize(fileSize);
+        Serializer.Deserialize(chunkName, (void*)dataBuffer.data(), fileSize);
+        
+        std::vector<std::string> lines = String.Explode(dataBuffer, '\n');
+        for (unsigned int l=0; l < lines.size(); l++) {
+            std::vector<std::string> line = String.Explode(lines[l], '~');
+            if (line.size() < 5) continue;
+            glm::vec3 position(String.ToFloat(line[0]), String.ToFloat(line[1]), String.ToFloat(line[2]));
+            unsigned long long int age = String.ToLongUint(line[3]);
+            numberOfActorsLoaded += (position.x != 0.0f) | (age != 0) | (line[4].size() != 0);
+        }
+        
+        fileSize = Serializer.GetFileSize(staticName);
+        std::vector<LegacyStaticElement> staticElements(fileSize / sizeof(LegacyStaticElement));
+        Serializer.Deserialize(staticName, (void*)staticElements.data(), fileSize);
+    }
+    
+    double legacyLoadMs = timer.GetCurrentDelta();
+    
+    std::cout << "  per chunk files   " << legacyFiles << " files   " << legacyBytes << " bytes   save "
+              << legacySaveMs / numberOfChunks << " ms   load " << legacyLoadMs / numberOfChunks << " ms per chunk\n";
+    
+    // Region files with and without record compression
+    
+    for (unsigned int pass=0; pass < 2; pass++) {
+        bool doCompress = (pass == 1);
+        
+        std::map<std::pair<int, int>, RegionFile*> regions;
+        std::vector<uint8_t> buffer;
+        
+        for (unsigned int c=0; c < numberOfChunks; c++) {
+            int regionX, regionZ;
+            int cellX = (c % gridSize) - gridSize / 2;
+            int cellZ = (c / gridSize) - gridSize / 2;
+            RegionFile::GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+            
+            RegionFile*& region = regions[std::make_pair(regionX, regionZ)];
+            if (region != nullptr) continue;
+            
+            std::string regionName = benchmarkRegionPath + "/regions/" + GetCellName(regionX, regionZ);
+            fs.FileDelete(regionName);
+            
+            region = new RegionFile();
+            region->Open(regionName);
+        }
+        
+        timer.Update();
+        
+        for (unsigned int c=0; c < numberOfChunks; c++) {
+            int regionX, regionZ;
+            int cellX = (c % gridSize) - gridSize / 2;
+            int cellZ = (c / gridSize) - gridSize / 2;
+            RegionFile::GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+            
+            records[c].Encode(buffer);
+            regions[std::make_pair(regionX, regionZ)]->Write(cellX, cellZ, buffer, doCompress);
+        }
+        
+        double regionSaveMs = timer.GetCurrentDelta();
+        
+        unsigned long long int regionBytes = 0;
+        for (std::map<std::pair<int, int>, RegionFile*>::iterator it = regions.begin(); it != regions.end(); ++it)
+            regionBytes += it->second->GetBytesWritten();
+        
+        timer.Update();
+        
+        ChunkRecord record;
+        for (unsigned int c=0; c < numberOfChunks; c++) {
+            int regionX, regionZ;
+            int cellX = (c % gridSize) - gridSize / 2;
+            int cellZ = (c / gridSize) - gridSize / 2;
+            RegionFile::GetRegionCoordinates(cellX, cellZ, regionX, regionZ);
+            
+            regions[std::make_pair(regionX, regionZ)]->Read(cellX, cellZ, buffer);
+            record.Decode(buffer.data(), buffer.size());
+            numberOfActorsLoaded += record.actors.size();
+        }
+        
+        double regionLoadMs = timer.GetCurrentDelta();
+        
+        std::cout << (doCompress ? "  region compressed " : "  region raw        ") << regions.size() << " files   "
+                  << regionBytes << " bytes   save " << regionSaveMs / numberOfChunks << " ms   load "
+                  << regionLoadMs / numberOfChunks << " ms per chunk\n";
+        
+        for (std::map<std::pair<int, int>, RegionFile*>::iterator it = regions.begin(); it != regions.end(); ++it)
+            delete it->second;
+    }
+    
+    fs.DirectoryDelete(benchmarkRegionPath + "/chunks");
+    fs.DirectoryDelete(benchmarkRegionPath + "/static");
+    fs.DirectoryDelete(benchmarkRegionPath + "/regions");
+    fs.DirectoryDelete(benchmarkRegionPath);
+    
+    if (numberOfActorsLoaded == 0)
+        std::cout << "  no actors loaded\n";
+    
+    return;
+}
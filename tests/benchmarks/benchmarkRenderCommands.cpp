@@ -0,0 +1,96 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern RenderSystem Renderer;
+
+
+void TestFramework::BenchmarkRenderCommands(void) {
+    
+    // Recording only, the render system is never initiated. The meshes and
+    // shaders are still taken from the initiated renderer.
+    RenderSystem* headless = new RenderSystem();
+    
+    headless->SetNumberOfRecordingWorkers(RENDER_NUMBER_OF_RECORDING_WORKERS);
+    
+    std::cout << "Render command recording (" << headless->GetNumberOfRecordingWorkers() << " workers)\n";
+    
+    const unsigned int rendererCounts[] = {1000, 10000, 100000};
+    const unsigned int numberOfFrames = 10;
+    
+    const int queueGroups[] = {RENDER_QUEUE_BACKGROUND, RENDER_QUEUE_GEOMETRY, RENDER_QUEUE_POSTGEOMETRY, RENDER_QUEUE_FOREGROUND};
+    
+    Camera* cameraPtr = headless->CreateCamera();
+    
+    Mesh* meshList[2] = {Renderer.meshes.cube, Renderer.meshes.sphere};
+    
+    std::vector<Material*> materials;
+    
+    for (unsigned int m=0; m < 16; m++) {
+        
+        Material* materialPtr = headless->CreateMaterial();
+        materialPtr->isShared = true;
+        materialPtr->shader = (m & 1) ? Renderer.shaders.color : Renderer.shaders.colorUnlit;
+        
+        materials.push_back(materialPtr);
+    }
+    
+    RenderCommandList commandList;
+    
+    for (unsigned int c=0; c < 3; c++) {
+        
+        unsigned int numberOfRenderers = rendererCounts[c];
+        
+        Scene* scenePtr = headless->CreateScene();
+        scenePtr->camera = cameraPtr;
+        
+        headless->AddSceneToRenderQueue(scenePtr);
+        
+        std::vector<MeshRenderer*> renderers;
+        
+        for (unsigned int i=0; i < numberOfRenderers; i++) {
+            
+            MeshRenderer* renderer = headless->CreateMeshRenderer();
+            renderer->mesh     = meshList[i % 2];
+            renderer->material = materials[i % materials.size()];
+            
+            renderer->transform.position = glm::vec3((i % 100) * 3.0f, (i / 10000) * 3.0f, ((i / 100) % 100) * 3.0f);
+            renderer->transform.UpdateMatrix();
+            
+            scenePtr->AddMeshRendererToSceneRoot(renderer, queueGroups[i % 4]);
+            renderers.push_back(renderer);
+        }
+        
+        headless->RecordFrame(commandList);
+        
+        Timer timer;
+        timer.Update();
+        
+        for (unsigned int f=0; f < numberOfFrames; f++)
+            headless->RecordFrame(commandList);
+        
+        double recordMs = timer.GetCurrentDelta() / numberOfFrames;
+        
+        std::cout << "  " << numberOfRenderers << " renderers   " << commandList.GetNumberOfCommands() << " commands   "
+                  << commandList.GetNumberOfSegments() << " segments   " << recordMs << " ms per frame\n";
+        
+        headless->RemoveSceneFromRenderQueue(scenePtr);
+        headless->DestroyScene(scenePtr);
+        
+        for (unsigned int i=0; i < numberOfRenderers; i++) 
+            headless->DestroyMeshRenderer(renderers[i]);
+    }
+    
+    for (unsigned int m=0; m < materials.size(); m++)
+        headless->DestroyMaterial(materials[m]);
+    
+    headless->DestroyCamera(cameraPtr);
+    
+    delete headless;
+    
+    return;
+}
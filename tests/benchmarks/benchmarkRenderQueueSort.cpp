@@ -0,0 +1,141 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern RenderSystem Renderer;
+
+
+void TestFramework::BenchmarkRenderQueueSort(void) {
+    
+    std::cout << "Render queue sort keys\n";
+    
+    const unsigned int numberOfRenderers = 10000;
+    const unsigned int numberOfMaterials = 64;
+    const unsigned int numberOfFrames    = 10;
+    
+    RandomStream random(57);
+    
+    Shader* shaderList[4] = {Renderer.shaders.color, Renderer.shaders.colorUnlit, Renderer.shaders.texture, Renderer.shaders.textureUnlit};
+    Mesh*   meshList[4]   = {Renderer.meshes.cube, Renderer.meshes.sphere, Renderer.meshes.plain, Renderer.meshes.wallHorizontal};
+    
+    std::vector<Material*> materials;
+    for (unsigned int m=0; m < numberOfMaterials; m++) {
+        Material* materialPtr = Renderer.CreateMaterial();
+        materialPtr->shader = shaderList[m % 4];
+        materials.push_back(materialPtr);
+    }
+    
+    // Renderers scattered in front of the camera with mixed state
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    
+    std::vector<MeshRenderer*> renderers;
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        meshRenderer->material = materials[random.Next() % numberOfMaterials];
+        meshRenderer->mesh = meshList[random.Next() % 4];
+        meshRenderer->DisableFrustumCulling();
+        
+        meshRenderer->transform.position = glm::vec3(random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f), random.Range(10.0f, 500.0f));
+        meshRenderer->transform.UpdateMatrix();
+        
+        scenePtr->AddMeshRendererToSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        renderers.push_back(meshRenderer);
+    }
+    
+    // Binds the previous distance ordering would have issued
+    std::vector<std::pair<float, MeshRenderer*>> distanceOrder;
+    for (unsigned int i=0; i < numberOfRenderers; i++)
+        distanceOrder.push_back( std::make_pair(glm::length(renderers[i]->transform.position), renderers[i]) );
+    
+    std::sort(distanceOrder.begin(), distanceOrder.end(), [](const std::pair<float, MeshRenderer*>& a, const std::pair<float, MeshRenderer*>& b) {
+        return a.first < b.first;
+    });
+    
+    unsigned int distanceShaderBinds   = 0;
+    unsigned int distanceMaterialBinds = 0;
+    unsigned int distanceMeshBinds     = 0;
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        MeshRenderer* current  = distanceOrder[i].second;
+        MeshRenderer* previous = (i > 0) ? distanceOrder[i - 1].second : nullptr;
+        
+        if ((previous == nullptr) || (previous->material->shader != current->material->shader)) distanceShaderBinds++;
+        if ((previous == nullptr) || (previous->material != current->material)) distanceMaterialBinds++;
+        if ((previous == nullptr) || (previous->mesh != current->mesh)) distanceMeshBinds++;
+    }
+    
+    // Submit the scene on its own
+    IsolateScene(scenePtr);
+    
+    Renderer.RenderFrame();
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++)
+        Renderer.RenderFrame();
+    
+    double frameMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    RestoreScenes();
+    
+    // Key sorting on its own
+    std::vector<RenderQueueItem> items(numberOfRenderers);
+    std::vector<RenderQueueItem> sorted;
+    std::vector<RenderQueueItem> buffer;
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        items[i].key = ((uint64_t)random.Next() << 32) | random.Next();
+        items[i].renderer = renderers[i];
+    }
+    
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        sorted = items;
+        std::sort(sorted.begin(), sorted.end(), [](const RenderQueueItem& a, const RenderQueueItem& b) {
+            return a.key < b.key;
+        });
+    }
+    
+    double stdSortMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        sorted = items;
+        RenderQueueSort(sorted, buffer);
+    }
+    
+    double radixSortMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    std::cout << "  " << numberOfRenderers << " renderers, " << numberOfMaterials << " materials\n";
+    std::cout << "  Distance order    shader " << distanceShaderBinds << "  material " << distanceMaterialBinds << "  mesh " << distanceMeshBinds << " binds\n";
+    std::cout << "  Sort key order    shader " << Renderer.GetNumberOfShaderBinds() << "  material " << Renderer.GetNumberOfMaterialBinds() << "  mesh " << Renderer.GetNumberOfMeshBinds() << " binds\n";
+    std::cout << "  Submission        " << frameMs << " ms per frame  (" << Renderer.GetNumberOfDrawCalls() << " draw calls)\n";
+    std::cout << "  std::sort         " << stdSortMs << " ms\n";
+    std::cout << "  Radix sort        " << radixSortMs << " ms\n";
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        renderers[i]->mesh = nullptr;
+        renderers[i]->material = nullptr;
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    for (unsigned int m=0; m < materials.size(); m++)
+        Renderer.DestroyMaterial(materials[m]);
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}
+
@@ -0,0 +1,177 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+struct ActorQueryResult {
+    double updateMs;
+    double gridMs;
+    double linearMs;
+    unsigned int gridChecksum;
+    unsigned int linearChecksum;
+};
+
+// Breeding pairing scanned every actor before the grid
+static unsigned int LinearQueryRadius(std::vector<Actor*>& actors, const glm::vec3& center, float radius, std::vector<Actor*>& results) {
+    unsigned int count = 0;
+    for (unsigned int i=0; i < actors.size(); i++) {
+        if (!actors[i]->GetActive()) continue;
+        glm::vec3 offset = actors[i]->GetPosition() - center;
+        if (glm::dot(offset, offset) > radius * radius) continue;
+        results.push_back(actors[i]);
+        count++;
+    }
+    return count;
+}
+
+// Chunk saves scanned every actor before the grid
+static unsigned int LinearQueryBounds(std::vector<Actor*>& actors, const glm::vec3& min, const glm::vec3& max, std::vector<Actor*>& results) {
+    unsigned int count = 0;
+    for (unsigned int i=0; i < actors.size(); i++) {
+        if (!actors[i]->GetActive()) continue;
+        glm::vec3 position = actors[i]->GetPosition();
+        if ((position.x < min.x) | (position.x > max.x) | (position.z < min.z) | (position.z > max.z)) continue;
+        results.push_back(actors[i]);
+        count++;
+    }
+    return count;
+}
+
+// Real actor update passes. Each pass the main thread moves the actors, the
+// actor system runs its update and exchange, then the chunk manager queries
+// run through the grid and through the old scan over the same actors.
+static ActorQueryResult ActorQueryBenchmark(unsigned int numberOfActors, unsigned int numberOfPasses) {
+    
+    const float worldSize = std::sqrt((float)numberOfActors) * 10.0f;
+    const float chunkSize = 64.0f;
+    
+    RandomStream random(31);
+    
+    ActorSystem actorSystem;
+    actorSystem.SetNumberOfThreads(ACTOR_SYSTEM_NUMBER_OF_THREADS);
+    actorSystem.SetSeed(31);
+    actorSystem.SetActorUpdateDistance(worldSize * 2.0f);
+    actorSystem.SetPlayerWorldPosition(glm::vec3(worldSize * 0.5f, 0, worldSize * 0.5f));
+    
+    std::vector<Actor*> actors(numberOfActors);
+    std::vector<glm::vec3> positions(numberOfActors);
+    
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        positions[i] = glm::vec3(random.Range(0.0f, worldSize), 0, random.Range(0.0f, worldSize));
+        
+        actors[i] = actorSystem.CreateActor();
+        actors[i]->SetPosition(positions[i]);
+        actors[i]->SetTargetPoint(positions[i]);
+    }
+    
+    actorSystem.UpdateSendSignal();
+    
+    std::vector<Actor*> results;
+    
+    ActorQueryResult result;
+    result.updateMs = 0;
+    result.gridMs   = 0;
+    result.linearMs = 0;
+    result.gridChecksum   = 0;
+    result.linearChecksum = 0;
+    
+    Timer timer;
+    
+    for (unsigned int p=0; p < numberOfPasses; p++) {
+        
+        timer.Update();
+        
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            positions[i].x += random.Range(0.0f, 2.0f) - 1.0f;
+            positions[i].z += random.Range(0.0f, 2.0f) - 1.0f;
+            actors[i]->SetPosition(positions[i]);
+        }
+        
+        actorSystem.Update();
+        actorSystem.UpdateSendSignal();
+        
+        result.updateMs += timer.GetCurrentDelta();
+        
+        // Same query points for both paths
+        glm::vec3 breedPoints[8];
+        glm::vec3 chunkPoints[4];
+        
+        for (unsigned int b=0; b < 8; b++)
+            breedPoints[b] = positions[random.Range(0, numberOfActors)];
+        
+        for (unsigned int c=0; c < 4; c++)
+            chunkPoints[c] = glm::vec3(random.Range(0.0f, worldSize), 0, random.Range(0.0f, worldSize));
+        
+        glm::vec3 chunkExtent(chunkSize * 1.5f, 1.0f, chunkSize * 1.5f);
+        
+        // Grid path as shipped in the chunk manager
+        timer.Update();
+        
+        for (unsigned int b=0; b < 8; b++) {
+            results.clear();
+            result.gridChecksum += actorSystem.GetActorsInRadius(breedPoints[b], 50.0f, results);
+        }
+        
+        for (unsigned int c=0; c < 4; c++) {
+            results.clear();
+            result.gridChecksum += actorSystem.GetActorsInBounds(chunkPoints[c] - chunkExtent, chunkPoints[c] + chunkExtent, results);
+        }
+        
+        result.gridMs += timer.GetCurrentDelta();
+        
+        // Scan over every actor as before the grid
+        timer.Update();
+        
+        for (unsigned int b=0; b < 8; b++) {
+            results.clear();
+            result.linearChecksum += LinearQueryRadius(actors, breedPoints[b], 50.0f, results);
+        }
+        
+        for (unsigned int c=0; c < 4; c++) {
+            results.clear();
+            result.linearChecksum += LinearQueryBounds(actors, chunkPoints[c] - chunkExtent, chunkPoints[c] + chunkExtent, results);
+        }
+        
+        result.linearMs += timer.GetCurrentDelta();
+    }
+    
+    result.updateMs /= numberOfPasses;
+    result.gridMs   /= numberOfPasses;
+    result.linearMs /= numberOfPasses;
+    
+    actorSystem.Shutdown();
+    
+    for (unsigned int i=0; i < numberOfActors; i++)
+        actorSystem.DestroyActor(actors[i]);
+    
+    return result;
+}
+
+
+void TestFramework::BenchmarkSpatialGrid(void) {
+    
+    std::cout << "Actor proximity queries\n";
+    
+    const unsigned int actorCounts[] = {1000, 10000, 50000};
+    const unsigned int numberOfPasses = 10;
+    
+    for (unsigned int i=0; i < 3; i++) {
+        
+        ActorQueryResult pass = ActorQueryBenchmark(actorCounts[i], numberOfPasses);
+        
+        std::cout << "  actors " << actorCounts[i] << "   update " << pass.updateMs << " ms   queries linear " << pass.linearMs
+                  << " ms   grid " << pass.gridMs << " ms";
+        
+        if (pass.linearChecksum != pass.gridChecksum)
+            std::cout << "   MISMATCH";
+        
+        std::cout << "\n";
+    }
+    
+    return;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkGenerator.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+// Per quad sub mesh construction as used before the grid builder
+static void LegacyHeightFieldToMesh(Mesh* mesh, float* heightField, glm::vec3* colorField, unsigned int width, unsigned int height) {
+    
+    for (unsigned int x = 0; x < width - 1; x++) {
+        
+        for (unsigned int z = 0; z < height - 1; z++) {
+            
+            float yyA = heightField[z * width + x];
+            float yyB = heightField[z * width + (x + 1)];
+            float yyC = heightField[(z + 1) * width + (x + 1)];
+            float yyD = heightField[(z + 1) * width + x];
+            
+            glm::vec3 cA = colorField[z * width + x];
+            
+            float xx = (((float)x - (float)width / 2) / 2) + 0.25;
+            float zz = (((float)z - (float)height / 2) / 2) + 0.25;
+            
+            Vertex vertex[4] = {
+                Vertex(xx, yyA, zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0),
+                Vertex(xx + 1, yyB, zz, cA.x, cA.y, cA.z, 0, 1, 0, 1, 0),
+                Vertex(xx + 1, yyC, zz + 1, cA.x, cA.y, cA.z, 0, 1, 0, 1, 1),
+                Vertex(xx, yyD, zz + 1, cA.x, cA.y, cA.z, 0, 1, 0, 0, 1)
+            };
+            
+            glm::vec3 U = glm::vec3(vertex[2].x, vertex[2].y, vertex[2].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+            glm::vec3 V = glm::vec3(vertex[1].x, vertex[1].y, vertex[1].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+            glm::vec3 normal = glm::cross(U, V);
+            
+            for (int i = 0; i < 4; i++) {
+                vertex[i].nx = normal.x;
+                vertex[i].ny = normal.y;
+                vertex[i].nz = normal.z;
+            }
+            
+            SubMesh subBuffer;
+            subBuffer.vertexBuffer.assign(vertex, vertex + 4);
+            subBuffer.indexBuffer = {0, 2, 1, 0, 3, 2};
+            
+            mesh->AddSubMesh(xx, 0, zz, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+        }
+    }
+}
+
+
+void TestFramework::BenchmarkTerrainMesh(void) {
+    
+    std::cout << "Terrain mesh build (chunk size 50)\n";
+    
+    ChunkGenerator generator;
+    generator.chunkSize = 50;
+    
+    Perlin layer;
+    layer.heightMultuplier = 60.0f;
+    layer.noiseWidth  = 0.02f;
+    layer.noiseHeight = 0.02f;
+    generator.perlin.push_back(layer);
+    
+    ChunkBuildData data;
+    generator.Build(data, 0, 0);
+    
+    float* heightField    = &data.heightField[0];
+    glm::vec3* colorField = &data.colorField[0];
+    unsigned int fieldSize = data.fieldSize;
+    
+    const unsigned int numberOfBuilds = 200;
+    
+    // Per quad sub meshes
+    Timer timer;
+    timer.Update();
+    
+    unsigned int legacyBytes = 0;
+    
+    for (unsigned int i=0; i < numberOfBuilds; i++) {
+        Mesh* mesh = Engine.Create<Mesh>();
+        LegacyHeightFieldToMesh(mesh, heightField, colorField, fieldSize, fieldSize);
+        legacyBytes = mesh->GetNumberOfVertices() * sizeof(Vertex) + mesh->GetNumberOfIndices() * sizeof(Index);
+        Engine.Destroy<Mesh>(mesh);
+    }
+    
+    double legacyMs = timer.GetCurrentDelta() / numberOfBuilds;
+    
+    // Pre-sized quad grid
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfBuilds; i++) {
+        std::vector<Vertex>().swap(vertexBuffer);
+        std::vector<Index>().swap(indexBuffer);
+        Engine.AddHeightFieldToBuffer(vertexBuffer, indexBuffer, heightField, colorField, fieldSize, fieldSize, 0, 0);
+    }
+    
+    double quadMs = timer.GetCurrentDelta() / numberOfBuilds;
+    unsigned int quadBytes = vertexBuffer.size() * sizeof(Vertex) + indexBuffer.size() * sizeof(Index);
+    
+    // Shared vertex grid
+    timer.Update();
+    
+    for (unsigned int i=0; i < numberOfBuilds; i++) {
+        std::vector<Vertex>().swap(vertexBuffer);
+        std::vector<Index>().swap(indexBuffer);
+        Engine.AddHeightFieldToBufferShared(vertexBuffer, indexBuffer, heightField, colorField, fieldSize, fieldSize, 0, 0);
+    }
+    
+    double sharedMs = timer.GetCurrentDelta() / numberOfBuilds;
+    unsigned int sharedBytes = vertexBuffer.size() * sizeof(Vertex) + indexBuffer.size() * sizeof(Index);
+    
+    std::cout << "  per quad sub mesh  " << legacyMs << " ms  " << legacyBytes << " bytes\n";
+    std::cout << "  quad grid          " << quadMs   << " ms  " << quadBytes   << " bytes\n";
+    std::cout << "  shared grid        " << sharedMs << " ms  " << sharedBytes << " bytes\n\n";
+}
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Transform/Transform.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+
+void TestFramework::BenchmarkTransformCache(void) {
+    
+    std::cout << "Transform cache update\n";
+    
+    const unsigned int numberOfChunks       = 4096;
+    const unsigned int numberOfStaticProps  = 8;
+    const unsigned int numberOfMovingActors = 300;
+    const unsigned int numberOfUpdates      = 60;
+    
+    // Static world chunks each carrying a few parented props,
+    // plus a few hundred actors moving every update
+    std::vector<Transform> chunks(numberOfChunks);
+    std::vector<Transform> props(numberOfChunks * numberOfStaticProps);
+    std::vector<Transform> actors(numberOfMovingActors);
+    
+    std::vector<Transform*> stream;
+    
+    for (unsigned int i=0; i < numberOfChunks; i++) {
+        chunks[i].SetPosition((i % 64) * 32.0f, 0.0f, (i / 64) * 32.0f);
+        stream.push_back( &chunks[i] );
+        
+        for (unsigned int p=0; p < numberOfStaticProps; p++) {
+            Transform& prop = props[i * numberOfStaticProps + p];
+            prop.parent = &chunks[i];
+            prop.SetPosition(p * 2.0f, 1.0f, p * 3.0f);
+            stream.push_back( &prop );
+        }
+    }
+    
+    for (unsigned int i=0; i < numberOfMovingActors; i++) {
+        actors[i].SetPosition(i * 1.5f, 0.0f, i * 0.5f);
+        stream.push_back( &actors[i] );
+    }
+    
+    // Full recompute of every transform each update
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int u=0; u < numberOfUpdates; u++) {
+        
+        for (unsigned int i=0; i < numberOfMovingActors; i++)
+            actors[i].position.x += 0.1f;
+        
+        for (unsigned int i=0; i < stream.size(); i++) {
+            Transform* current = stream[i];
+            
+            glm::vec3 currentPosition = current->position;
+            glm::quat currentRotation = current->rotation;
+            glm::vec3 currentScale    = current->scale;
+            
+            for (Transform* parent = current->parent; parent != nullptr; parent = parent->parent) {
+                currentPosition = parent->position + currentPosition * parent->rotation;
+                if (parent->inheritParentRotation) currentRotation = parent->rotation * currentRotation;
+                if (parent->inheritParentScale)    currentScale *= parent->scale;
+            }
+            
+            current->matrix = glm::translate(glm::mat4(1), currentPosition) *
+                              glm::toMat4(currentRotation) *
+                              glm::scale(glm::mat4(1), currentScale);
+        }
+        
+    }
+    
+    double fullMs = timer.GetCurrentDelta() / numberOfUpdates;
+    
+    // Cached update only rebuilds what moved
+    unsigned int pass = 1;
+    for (unsigned int i=0; i < stream.size(); i++)
+        stream[i]->UpdateCachedMatrix(pass);
+    
+    unsigned int rebuilt = 0;
+    
+    timer.Update();
+    
+    for (unsigned int u=0; u < numberOfUpdates; u++) {
+        
+        for (unsigned int i=0; i < numberOfMovingActors; i++)
+            actors[i].position.x += 0.1f;
+        
+        pass++;
+        for (unsigned int i=0; i < stream.size(); i++)
+            rebuilt += stream[i]->UpdateCachedMatrix(pass) ? 1 : 0;
+            
+    }
+    
+    double cachedMs = timer.GetCurrentDelta() / numberOfUpdates;
+    
+    std::cout << "  " << stream.size() << " transforms, " << numberOfMovingActors << " moving\n";
+    std::cout << "  Full recompute    " << fullMs   << " ms per update\n";
+    std::cout << "  Dirty cache       " << cachedMs << " ms per update  (" << rebuilt / numberOfUpdates << " rebuilt)\n";
+    
+    return;
+}
@@ -0,0 +1,432 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Timer/timer.h>
+
+extern RenderSystem Renderer;
+
+// The color shader as it was before the uniform blocks, taking every value
+// as a plain uniform. The old path is measured against this program.
+static const char* legacyColorVertex = R"(#version 330 core
+
+layout(location = 0) in vec3 l_position;
+layout(location = 1) in vec3 l_color;
+layout(location = 2) in vec3 l_normal;
+layout(location = 3) in vec2 l_uv;
+
+uniform mat4 u_proj;
+uniform mat4 u_model;
+uniform mat4 u_shadow;
+uniform mat3 u_inv_model;
+
+uniform vec3 u_eye;
+uniform vec3 u_angle;
+
+varying vec2 v_coord;
+varying vec3 v_color;
+
+uniform vec3 m_ambient;
+uniform vec3 m_diffuse;
+uniform vec3 m_specular;
+
+uniform int u_light_count;
+uniform vec3 u_light_position[50];
+uniform vec3 u_light_direction[50];
+uniform vec4 u_light_attenuation[50];
+uniform vec3 u_light_color[50];
+
+uniform int u_fog_count;
+uniform vec3 u_fogStartColor[8];
+uniform vec3 u_fogEndColor[8];
+uniform float u_fogStart[8];
+uniform float u_fogEnd[8];
+uniform float u_fogDensity[8];
+uniform float u_fogCutoffHeight[8];
+varying float v_fogFactor[8];
+
+void main() {
+    vec4 vertPos = u_model * vec4(l_position, 1.0);
+    vec3 norm = normalize(u_inv_model * l_normal);
+    vec3 lightColor = m_ambient;
+    
+    for (int i = 0; i < u_light_count; i++) {
+        float intensity = u_light_attenuation[i].r;
+        float range = u_light_attenuation[i].g;
+        float attenuation = u_light_attenuation[i].b;
+        float type = u_light_attenuation[i].a;
+        
+        if (type < 1.0) {
+            float dist = length(u_light_position[i] - vec3(vertPos));
+            if (dist > range) continue;
+            
+            vec3 lightDir = normalize(u_light_position[i] - vec3(vertPos));
+            float diff = max(dot(norm, lightDir), 0.0);
+            vec3 viewDir = normalize(u_eye - vec3(vertPos));
+            vec3 reflectDir = reflect(-lightDir, norm);
+            float spec = pow(max(dot(viewDir, reflectDir), 0.0), 1.0);
+            vec3 specular = u_light_color[i] * (spec * m_specular);
+            
+            lightColor += ((diff * u_light_color[i]) * intensity) / (1.0 + (dist * attenuation)) + specular;
+        } else if (type < 2.0) {
+            vec3 lightDir = normalize(-u_light_direction[i]);
+            float diff = max(dot(norm, lightDir), 0.0);
+            lightColor += (diff * u_light_color[i]) * intensity;
+        }
+    }
+    
+    v_color = m_diffuse * l_color * lightColor;
+    v_coord = l_uv;
+    
+    for (int i = 0; i < u_fog_count; i++) {
+        float fogDistance = length(vertPos.xyz - u_eye);
+        float fogRange = u_fogEnd[i] - u_fogStart[i];
+        float fogFactor = clamp((fogDistance - u_fogStart[i]) / fogRange, 0.0, 1.0);
+        v_fogFactor[i] = vertPos.y < u_fogCutoffHeight[i] ? exp(-u_fogDensity[i] * fogFactor) : -1.0;
+    }
+    
+    gl_Position = u_proj * vertPos;
+}
+)";
+
+static const char* legacyColorFragment = R"(#version 330 core
+
+varying vec3 v_color;
+varying vec2 v_coord;
+varying float v_fogFactor[8];
+
+uniform sampler2D u_sampler;
+uniform int u_fog_count;
+uniform vec3 u_fogStartColor[8];
+uniform vec3 u_fogEndColor[8];
+
+out vec4 color;
+
+void main() {
+    float Gamma = 2.2;
+    
+    vec3 finalColor = pow(v_color.rgb, vec3(1.0 / Gamma));
+    
+    for (int i = 0; i < u_fog_count; i++) {
+        vec3 fogColor = mix(u_fogStartColor[i], u_fogEndColor[i], v_fogFactor[i]);
+        finalColor = (v_fogFactor[i] >= 0.0) ? mix(fogColor, finalColor, v_fogFactor[i]) : finalColor;
+    }
+    
+    color = vec4(finalColor, 1.0);
+}
+)";
+
+
+void TestFramework::BenchmarkUniformBuffers(void) {
+    
+    std::cout << "Uniform buffer submission\n";
+    
+    const unsigned int numberOfRenderers = 5000;
+    const unsigned int numberOfMaterials = 64;
+    const unsigned int numberOfLights    = RENDER_NUMBER_OF_LIGHTS;
+    const unsigned int numberOfFrames    = 10;
+    
+    // Shadow distance of the render system and the volume settings of the
+    // shadow casting materials, replayed by the per draw path
+    const float shadowDistance    = 300.0f;
+    const float shadowLength      = 5.0f;
+    const float shadowIntensity   = 0.8f;
+    const Color shadowColor       = Color(0.1f, 0.1f, 0.1f, 1.0f);
+    
+    RandomStream random(83);
+    
+    Mesh* meshList[2] = {Renderer.meshes.cube, Renderer.meshes.sphere};
+    
+    // Both paths draw through the lit color shader, which reads the
+    // camera, light, fog and object values. Every other material casts
+    // shadow volumes.
+    std::vector<Material*> materials;
+    for (unsigned int m=0; m < numberOfMaterials; m++) {
+        Material* materialPtr = Renderer.CreateMaterial();
+        materialPtr->shader = Renderer.shaders.color;
+        
+        if ((m % 2) == 0) {
+            materialPtr->EnableShadowVolumePass();
+            materialPtr->SetShadowVolumeLength(shadowLength);
+            materialPtr->SetShadowVolumeIntensityHigh(shadowIntensity);
+            materialPtr->SetShadowVolumeColor(shadowColor);
+        }
+        
+        materials.push_back(materialPtr);
+    }
+    
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    
+    // Full light list and fog stack with the first lights
+    // filling the shadow list as directional lights
+    std::vector<Light*> lights;
+    for (unsigned int l=0; l < numberOfLights; l++) {
+        
+        Light* lightPtr = Renderer.CreateLight();
+        lightPtr->position = glm::vec3(random.Range(-100.0f, 100.0f), random.Range(0.0f, 50.0f), random.Range(10.0f, 300.0f));
+        lightPtr->renderDistance = 10000.0f;
+        lightPtr->doCastShadow = false;
+        
+        if (l < RENDER_NUMBER_OF_SHADOWS) {
+            lightPtr->type = LIGHT_TYPE_DIRECTIONAL;
+            lightPtr->direction = glm::normalize( glm::vec3(random.Range(-1.0f, 1.0f), -1.0f, random.Range(-1.0f, 1.0f)) );
+            lightPtr->doCastShadow = true;
+        }
+        
+        scenePtr->AddLightToSceneRoot(lightPtr);
+        lights.push_back(lightPtr);
+    }
+    
+    std::vector<Fog*> fogLayers;
+    for (unsigned int f=0; f < RENDER_NUMBER_OF_FOG_LAYERS; f++) {
+        Fog* fogPtr = Renderer.CreateFog();
+        scenePtr->AddFogLayerToScene(fogPtr);
+        fogLayers.push_back(fogPtr);
+    }
+    
+    std::vector<MeshRenderer*> renderers;
+    std::vector<uint8_t> isShadowCaster;
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        unsigned int materialIndex = random.Next() % numberOfMaterials;
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        meshRenderer->material = materials[materialIndex];
+        meshRenderer->mesh = meshList[random.Next() % 2];
+        meshRenderer->DisableFrustumCulling();
+        
+        meshRenderer->transform.position = glm::vec3(random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f), random.Range(10.0f, 500.0f));
+        meshRenderer->transform.UpdateMatrix();
+        
+        scenePtr->AddMeshRendererToSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        renderers.push_back(meshRenderer);
+        isShadowCaster.push_back( (materialIndex % 2) == 0 );
+    }
+    
+    // Uniform block path
+    IsolateScene(scenePtr);
+    
+    Renderer.RenderFrame();
+    glFinish();
+    
+    Timer timer;
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        Renderer.RenderFrame();
+        glFinish();
+    }
+    
+    double blockMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    unsigned int blockUpdates = Renderer.GetNumberOfUniformUpdates();
+    unsigned int drawCalls    = Renderer.GetNumberOfDrawCalls();
+    unsigned int shaderBinds  = Renderer.GetNumberOfShaderBinds();
+    
+    RestoreScenes();
+    
+    // Per draw uniform path as the geometry pass submitted it before the
+    // blocks, drawing the same renderers through the old color shader
+    Shader* legacyShader = Renderer.CreateShader();
+    legacyShader->CreateShaderProgram(legacyColorVertex, legacyColorFragment);
+    
+    glm::vec3 lightPosition    [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec3 lightDirection   [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec4 lightAttenuation [RENDER_NUMBER_OF_LIGHTS];
+    glm::vec3 lightColor       [RENDER_NUMBER_OF_LIGHTS];
+    
+    for (unsigned int l=0; l < numberOfLights; l++) {
+        lightPosition[l]    = lights[l]->position;
+        lightDirection[l]   = lights[l]->direction;
+        lightAttenuation[l] = glm::vec4(lights[l]->intensity, lights[l]->range, lights[l]->attenuation, lights[l]->type);
+        lightColor[l]       = glm::vec3(lights[l]->color.r, lights[l]->color.g, lights[l]->color.b);
+    }
+    
+    float     fogDensity [RENDER_NUMBER_OF_FOG_LAYERS];
+    float     fogCutoff  [RENDER_NUMBER_OF_FOG_LAYERS];
+    float     fogBegin   [RENDER_NUMBER_OF_FOG_LAYERS];
+    float     fogEnd     [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec3 fogColorsA [RENDER_NUMBER_OF_FOG_LAYERS];
+    glm::vec3 fogColorsB [RENDER_NUMBER_OF_FOG_LAYERS];
+    
+    for (unsigned int f=0; f < RENDER_NUMBER_OF_FOG_LAYERS; f++) {
+        fogDensity[f] = fogLayers[f]->fogDensity;
+        fogCutoff[f]  = fogLayers[f]->fogHeightCutoff;
+        fogBegin[f]   = fogLayers[f]->fogBegin;
+        fogEnd[f]     = fogLayers[f]->fogEnd;
+        fogColorsA[f] = glm::vec3(fogLayers[f]->fogColorBegin.r, fogLayers[f]->fogColorBegin.g, fogLayers[f]->fogColorBegin.b);
+        fogColorsB[f] = glm::vec3(fogLayers[f]->fogColorEnd.r, fogLayers[f]->fogColorEnd.g, fogLayers[f]->fogColorEnd.b);
+    }
+    
+    // Same view as the scene camera
+    Camera* cameraPtr = scenePtr->camera;
+    glm::vec3 eye = cameraPtr->transform.position;
+    glm::vec3 angle = cameraPtr->forward;
+    glm::mat4 view = glm::lookAt(eye, eye + cameraPtr->forward, cameraPtr->up);
+    glm::mat4 projection = glm::perspective(glm::radians(cameraPtr->fov), cameraPtr->aspect, cameraPtr->clipNear, cameraPtr->clipFar);
+    glm::mat4 viewProjection = projection * view;
+    
+    unsigned int legacyUpdates = 0;
+    unsigned int legacyDrawCalls = 0;
+    
+    Shader* shadowShader = Renderer.shaders.shadowCaster;
+    Transform shadowTransform;
+    
+    glm::vec3 shadowPosition(0);
+    glm::vec3 shadowVolumeColor(shadowColor.r, shadowColor.g, shadowColor.b);
+    glm::vec4 shadowAttenuation(0, 0, shadowIntensity * 0.1f, 0);
+    
+    timer.Update();
+    
+    for (unsigned int f=0; f < numberOfFrames; f++) {
+        
+        legacyUpdates = 0;
+        legacyDrawCalls = 0;
+        Shader* currentShader = nullptr;
+        Mesh*   currentMesh   = nullptr;
+        
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        
+        for (unsigned int i=0; i < numberOfRenderers; i++) {
+            
+            MeshRenderer* meshRenderer = renderers[i];
+            Material* materialPtr = meshRenderer->material;
+            
+            if (meshRenderer->mesh != currentMesh) {
+                currentMesh = meshRenderer->mesh;
+                currentMesh->Bind();
+            }
+            
+            // Light and fog lists on every shader switch
+            if (legacyShader != currentShader) {
+                currentShader = legacyShader;
+                
+                legacyShader->Bind();
+                legacyShader->SetTextureSampler(0);
+                legacyShader->SetLightCount(numberOfLights);
+                legacyShader->SetLightPositions(numberOfLights, lightPosition);
+                legacyShader->SetLightDirections(numberOfLights, lightDirection);
+                legacyShader->SetLightAttenuation(numberOfLights, lightAttenuation);
+                legacyShader->SetLightColors(numberOfLights, lightColor);
+                legacyShader->SetFogCount(RENDER_NUMBER_OF_FOG_LAYERS);
+                legacyShader->SetFogDensity(RENDER_NUMBER_OF_FOG_LAYERS, fogDensity);
+                legacyShader->SetFogHeightCutoff(RENDER_NUMBER_OF_FOG_LAYERS, fogCutoff);
+                legacyShader->SetFogBegin(RENDER_NUMBER_OF_FOG_LAYERS, fogBegin);
+                legacyShader->SetFogEnd(RENDER_NUMBER_OF_FOG_LAYERS, fogEnd);
+                legacyShader->SetFogColorBegin(RENDER_NUMBER_OF_FOG_LAYERS, fogColorsA);
+                legacyShader->SetFogColorEnd(RENDER_NUMBER_OF_FOG_LAYERS, fogColorsB);
+                legacyUpdates += 13;
+            }
+            
+            // Transforms, camera and colors on every draw
+            glm::mat3 invTransposeMatrix = glm::transpose( glm::inverse( meshRenderer->transform.matrix ) );
+            
+            legacyShader->SetProjectionMatrix(viewProjection);
+            legacyShader->SetModelMatrix(meshRenderer->transform.matrix);
+            legacyShader->SetInverseModelMatrix(invTransposeMatrix);
+            legacyShader->SetCameraPosition(eye);
+            legacyShader->SetCameraAngle(angle);
+            legacyShader->SetMaterialAmbient(materialPtr->ambient);
+            legacyShader->SetMaterialDiffuse(materialPtr->diffuse);
+            legacyShader->SetMaterialSpecular(materialPtr->specular);
+            legacyUpdates += 8;
+            
+            meshRenderer->mesh->DrawIndexArray();
+            legacyDrawCalls++;
+        }
+        
+        // Shadow volumes follow the geometry as in the render queue
+        shadowShader->Bind();
+        
+        glEnable( GL_BLEND );
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glEnable( GL_CULL_FACE );
+        
+        for (unsigned int i=0; i < numberOfRenderers; i++) {
+            
+            MeshRenderer* meshRenderer = renderers[i];
+            
+            if (!isShadowCaster[i]) 
+                continue;
+            
+            if (glm::distance(eye, meshRenderer->transform.position) > shadowDistance) 
+                continue;
+            
+            if (meshRenderer->mesh != currentMesh) {
+                currentMesh = meshRenderer->mesh;
+                currentMesh->Bind();
+            }
+            
+            glm::mat4 modelMatrix = glm::identity<glm::mat4>();
+            modelMatrix = glm::translate(modelMatrix, meshRenderer->transform.position);
+            modelMatrix = glm::scale(modelMatrix, meshRenderer->transform.scale);
+            
+            shadowShader->SetProjectionMatrix(viewProjection);
+            shadowShader->SetModelMatrix(modelMatrix);
+            shadowShader->SetCameraPosition(eye);
+            shadowShader->SetCameraAngle(angle);
+            legacyUpdates += 4;
+            
+            for (unsigned int s=0; s < RENDER_NUMBER_OF_SHADOWS; s++) {
+                
+                shadowTransform.SetIdentity();
+                shadowTransform.RotateWorldAxis( 180, lightDirection[s], glm::vec3(0, 0, 0) );
+                shadowTransform.Translate( glm::vec3(0, -1, 0) * shadowLength );
+                shadowTransform.Scale( glm::vec3(1, shadowLength * 2, 1) );
+                
+                shadowShader->SetLightCount(1);
+                shadowShader->SetLightPositions(1, &shadowPosition);
+                shadowShader->SetLightDirections(1, &lightDirection[s]);
+                shadowShader->SetLightAttenuation(1, &shadowAttenuation);
+                shadowShader->SetLightColors(1, &shadowVolumeColor);
+                shadowShader->SetShadowMatrix(shadowTransform.matrix);
+                legacyUpdates += 6;
+                
+                meshRenderer->mesh->DrawIndexArray();
+                legacyDrawCalls++;
+            }
+        }
+        
+        glDisable( GL_BLEND );
+        
+        glFinish();
+    }
+    
+    double legacyMs = timer.GetCurrentDelta() / numberOfFrames;
+    
+    Renderer.DestroyShader(legacyShader);
+    
+    std::cout << "  " << numberOfRenderers << " renderers, " << numberOfMaterials << " materials, " << numberOfLights << " lights, "
+              << RENDER_NUMBER_OF_SHADOWS << " shadow casting\n";
+    std::cout << "  Per draw uniforms    " << legacyMs << " ms frame  (" << legacyUpdates << " uniform updates, " << legacyDrawCalls << " draw calls)\n";
+    std::cout << "  Uniform blocks       " << blockMs << " ms frame  (" << blockUpdates << " uniform updates, "
+              << shaderBinds << " shader binds, " << drawCalls << " draw calls)\n";
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        renderers[i]->mesh = nullptr;
+        renderers[i]->material = nullptr;
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    for (unsigned int m=0; m < materials.size(); m++)
+        Renderer.DestroyMaterial(materials[m]);
+    
+    for (unsigned int l=0; l < lights.size(); l++) {
+        scenePtr->RemoveLightFromSceneRoot(lights[l]);
+        Renderer.DestroyLight(lights[l]);
+    }
+    
+    for (unsigned int f=0; f < fogLayers.size(); f++) {
+        scenePtr->RemoveFogLayer(fogLayers[f]);
+        Renderer.DestroyFog(fogLayers[f]);
+    }
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}
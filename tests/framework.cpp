@@ -4,10 +4,14 @@
 extern StringType String;
 extern IntType    Int;
 
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+extern RenderSystem Renderer;
+
 
 TestFramework::TestFramework() : 
     hasTestFailed(false),
-    mLogString("")
+    mLogString(""),
+    mIsolatedScene(nullptr)
 {}
 
 void TestFramework::Initiate(void) {
@@ -35,6 +39,33 @@ void TestFramework::Throw(std::string message, std::string sourceFile, int line)
     mLogString += sourceFileName + "\nLine " + Int.ToString((int)line) + " - " + message + "\n\n";
 }
 
+void TestFramework::IsolateScene(Scene* scenePtr) {
+    
+    for (unsigned int i=0; i < Renderer.GetRenderQueueSize(); i++) {
+        if (!Renderer[i]->isActive) 
+            continue;
+        
+        mSuspendedScenes.push_back( Renderer[i] );
+        Renderer[i]->isActive = false;
+    }
+    
+    Renderer.AddSceneToRenderQueue(scenePtr);
+    
+    mIsolatedScene = scenePtr;
+}
+
+void TestFramework::RestoreScenes(void) {
+    
+    Renderer.RemoveSceneFromRenderQueue(mIsolatedScene);
+    
+    mIsolatedScene = nullptr;
+    
+    for (unsigned int i=0; i < mSuspendedScenes.size(); i++)
+        mSuspendedScenes[i]->isActive = true;
+    
+    mSuspendedScenes.clear();
+}
+
 void TestFramework::AddTest(void(TestFramework::*testFunction)()) {
     mTestList.push_back(testFunction);
 }
@@ -46,3 +77,16 @@ void TestFramework::RunTestSuite(void) {
     }
 }
 
+void TestFramework::AddBenchmark(void(TestFramework::*benchmarkFunction)()) {
+    mBenchmarkList.push_back(benchmarkFunction);
+}
+
+void TestFramework::RunBenchmarkSuite(void) {
+    std::cout << "Running benchmarks\n\n";
+    for (unsigned int i=0; i < mBenchmarkList.size(); i++) {
+        void(TestFramework::*functionPtr)() = (void(TestFramework::*)())mBenchmarkList[i];
+        (*this.*functionPtr)();
+        std::cout << "\n";
+    }
+}
+
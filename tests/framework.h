@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+class Scene;
 
 class __declspec(dllexport) TestFramework {
     
@@ -31,6 +32,11 @@ public:
     /// Log a message string to the output console.
     void Throw(std::string message, std::string sourceFile, int line);
     
+    /// Switch off the active scenes and render only the given scene.
+    void IsolateScene(Scene* scenePtr);
+    /// Remove the isolated scene and switch the other scenes back on.
+    void RestoreScenes(void);
+    
     
     //
     // Test suite
@@ -38,6 +44,12 @@ public:
     
     void AddTest(void(TestFramework::*testFunction)());
     
+    /// Add a benchmark to the benchmark suite.
+    void AddBenchmark(void(TestFramework::*benchmarkFunction)());
+    
+    /// Run the suite of benchmarks. Results are printed to the output console.
+    void RunBenchmarkSuite(void);
+    
     void TestEngineFunctionality(void);
     void TestGameObject(void);
     void TestComponentObject(void);
@@ -46,6 +58,58 @@ public:
     void TestScriptSystem(void);
     void TestPhysicsSystem(void);
     void TestTransform(void);
+    void TestTransformHierarchy(void);
+    void TestPoolAllocator(void);
+    void TestJobSystem(void);
+    void TestChunkGeneration(void);
+    void TestRandomStream(void);
+    void TestPerlinBatch(void);
+    void TestRegionFile(void);
+    void TestNeuralNetwork(void);
+    void TestNeuralTraining(void);
+    void TestGenomeFormat(void);
+    void TestActorSystem(void);
+    void TestActorSimulation(void);
+    void TestSpatialGrid(void);
+    void TestHeightFieldQuery(void);
+    void TestRaycastBatch(void);
+    void TestActorInstancing(void);
+    void TestRenderQueueSort(void);
+    void TestUniformBuffers(void);
+    void TestMeshStreaming(void);
+    void TestParticleInstancing(void);
+    void TestRenderCommands(void);
+    
+    
+    //
+    // Benchmarks
+    //
+    
+    void BenchmarkPoolAllocator(void);
+    void BenchmarkComponentStream(void);
+    void BenchmarkTransformCache(void);
+    void BenchmarkJobSystem(void);
+    void BenchmarkChunkIndex(void);
+    void BenchmarkChunkGeneration(void);
+    void BenchmarkRandomStream(void);
+    void BenchmarkTerrainMesh(void);
+    void BenchmarkPerlinBatch(void);
+    void BenchmarkRegionFile(void);
+    void BenchmarkNeuralNetwork(void);
+    void BenchmarkNeuralBatch(void);
+    void BenchmarkNeuralTraining(void);
+    void BenchmarkGenomeFormat(void);
+    void BenchmarkActorSystem(void);
+    void BenchmarkActorSimulation(void);
+    void BenchmarkSpatialGrid(void);
+    void BenchmarkHeightFieldQuery(void);
+    void BenchmarkRaycastBatch(void);
+    void BenchmarkActorInstancing(void);
+    void BenchmarkRenderQueueSort(void);
+    void BenchmarkUniformBuffers(void);
+    void BenchmarkMeshStreaming(void);
+    void BenchmarkParticleInstancing(void);
+    void BenchmarkRenderCommands(void);
     
 private:
     
@@ -63,10 +127,34 @@ private:
     const std::string msgFailedSetGet              = "set/get not returning correct value";
     const std::string msgFailedOperator            = "operator failed to operate";
     const std::string msgFailedSerialization       = "serialization failed";
+    const std::string msgFailedJob                 = "job did not run exactly once";
+    const std::string msgFailedChunkBuild          = "chunk data differs between builds";
+    const std::string msgFailedRandomStream        = "random stream sequence mismatch";
+    const std::string msgFailedPerlinBatch         = "batched noise differs from scalar noise";
+    const std::string msgFailedRegionFile          = "region record does not match what was saved";
+    const std::string msgFailedNeuralNetwork       = "network output differs from the reference";
+    const std::string msgFailedNeuralTraining      = "training did not converge or allocated memory";
+    const std::string msgFailedGenomeFormat        = "genome did not survive a round trip";
+    const std::string msgFailedActorSystem         = "actor state was lost between threads";
+    const std::string msgFailedActorSimulation     = "simulation differs between thread counts";
+    const std::string msgFailedSpatialGrid         = "grid query differs from a linear scan";
+    const std::string msgFailedHeightFieldQuery    = "ground query differs from a ray cast";
+    const std::string msgFailedRaycastBatch        = "batched ray cast differs from a single cast";
+    const std::string msgFailedActorInstancing     = "instance batch lost or duplicated a renderer";
+    const std::string msgFailedRenderQueueSort     = "render queue order or bind count is wrong";
+    const std::string msgFailedUniformBuffers      = "uniform block layout or update count is wrong";
+    const std::string msgFailedMeshStreaming       = "dynamic mesh uploaded the wrong byte ranges";
+    const std::string msgFailedParticleInstancing  = "particle batch did not draw in a single call";
+    const std::string msgFailedRenderCommands      = "recorded command list does not match the scene";
     
     std::string mLogString;
     
+    Scene* mIsolatedScene;
+    
+    std::vector<Scene*> mSuspendedScenes;
+    
     std::vector<void(TestFramework::*)()> mTestList;
+    std::vector<void(TestFramework::*)()> mBenchmarkList;
     
 };
 
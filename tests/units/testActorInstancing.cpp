@@ -0,0 +1,94 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+extern RenderSystem Renderer;
+
+
+void TestFramework::TestActorInstancing(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Actor instancing........ ";
+    
+    const unsigned int numberOfParts = 16;
+    
+    InstanceBatch* batch = Renderer.CreateInstanceBatch();
+    if (batch == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    Material* batchMaterial = Renderer.CreateMaterial();
+    batchMaterial->shader = Renderer.shaders.colorInstanced;
+    
+    batch->mesh     = Renderer.meshes.cube;
+    batch->material = batchMaterial;
+    
+    std::vector<MeshRenderer*> parts;
+    
+    for (unsigned int i=0; i < numberOfParts; i++) {
+        
+        MeshRenderer* part = Renderer.CreateMeshRenderer();
+        part->mesh = Renderer.meshes.cube;
+        part->material = Renderer.CreateMaterial();
+        part->DisableFrustumCulling();
+        
+        part->transform.position = glm::vec3(i * 2.0f, 0.0f, 10.0f);
+        part->transform.UpdateMatrix();
+        
+        batch->AddMeshRenderer(part);
+        parts.push_back(part);
+    }
+    
+    // Adding a renderer twice keeps a single instance
+    batch->AddMeshRenderer(parts[0]);
+    
+    if (batch->GetNumberOfMeshRenderers() != numberOfParts) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    // Remove from the middle, the end and a renderer that is not in the batch
+    if (!batch->RemoveMeshRenderer(parts[3]))                 Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    if (!batch->RemoveMeshRenderer(parts[numberOfParts - 1])) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    if (batch->RemoveMeshRenderer(parts[3]))                  Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    // A removed renderer can be added back
+    batch->AddMeshRenderer(parts[3]);
+    
+    unsigned int numberOfRemaining = numberOfParts - 1;
+    
+    if (batch->GetNumberOfMeshRenderers() != numberOfRemaining) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    // Draw the batch in a scene of its own
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    scenePtr->AddInstanceBatchToScene(batch);
+    
+    IsolateScene(scenePtr);
+    
+    // One part is hidden and is not drawn
+    parts[5]->isActive = false;
+    
+    Renderer.RenderFrame();
+    
+    if (batch->GetNumberOfInstances() != numberOfRemaining - 1) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfDrawCalls() != 1)                   Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    RestoreScenes();
+    
+    // Each remaining renderer is still found after the swaps
+    for (unsigned int i=0; i < numberOfRemaining; i++)
+        if (!batch->RemoveMeshRenderer(parts[i])) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    // Destroying a renderer also destroys its material
+    for (unsigned int i=0; i < numberOfParts; i++)
+        Renderer.DestroyMeshRenderer(parts[i]);
+    
+    if (batch->GetNumberOfMeshRenderers() != 0) Throw(msgFailedActorInstancing, __FILE__, __LINE__);
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    Renderer.DestroyMaterial(batchMaterial);
+    
+    if (!Renderer.DestroyInstanceBatch(batch)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    return;
+}
+
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+
+
+void TestFramework::TestActorSimulation(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Actor simulation........ ";
+    
+    // Two networks so the actors split into separate batches
+    NeuralNetwork sourceA;
+    sourceA.AddNeuralLayer(8, 1);
+    sourceA.AddNeuralLayer(1, 8);
+    
+    NeuralNetwork sourceB;
+    sourceB.AddNeuralLayer(4, 1);
+    sourceB.AddNeuralLayer(4, 4);
+    sourceB.AddNeuralLayer(1, 4);
+    
+    std::vector<std::string> stateA = sourceA.SaveState();
+    std::vector<std::string> stateB = sourceB.SaveState();
+    
+    const unsigned int numberOfActors = 1000;
+    const unsigned int numberOfCycles = 60;
+    
+    const unsigned int threadCounts[] = {1, 2, 4, 7};
+    
+    std::vector<unsigned long int> referenceAges;
+    std::vector<glm::vec3> referenceTargets;
+    std::vector<bool> referenceActive;
+    
+    for (unsigned int t=0; t < 4; t++) {
+        
+        // The test thread stands in for the AI thread
+        ActorSystem actorSystem;
+        actorSystem.SetNumberOfThreads(threadCounts[t]);
+        actorSystem.SetSeed(1234);
+        
+        if (actorSystem.GetNumberOfThreads() != threadCounts[t]) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        std::vector<Actor*> actors(numberOfActors);
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            actors[i] = actorSystem.CreateActor();
+            actors[i]->SetPosition( glm::vec3((float)(i % 40) * 2.0f, 0, (float)(i / 40) * 2.0f) );
+            actors[i]->LoadNeuralStates( ((i % 3) == 0) ? stateB : stateA );
+        }
+        
+        for (unsigned int c=0; c < numberOfCycles; c++) {
+            
+            actorSystem.UpdateSendSignal();
+            actorSystem.Update();
+            
+            // Walk the actors toward their targets on the main thread side
+            for (unsigned int i=0; i < numberOfActors; i++) {
+                glm::vec3 position = actors[i]->GetPosition();
+                actors[i]->SetPosition( position + (actors[i]->GetTargetPoint() - position) * 0.1f );
+            }
+        }
+        
+        actorSystem.UpdateSendSignal();
+        
+        std::vector<unsigned long int> ages(numberOfActors);
+        std::vector<glm::vec3> targets(numberOfActors);
+        std::vector<bool> active(numberOfActors);
+        
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            ages[i]    = actors[i]->GetAge();
+            targets[i] = actors[i]->GetTargetPoint();
+            active[i]  = actors[i]->GetActive();
+        }
+        
+        actorSystem.Shutdown();
+        
+        for (unsigned int i=0; i < numberOfActors; i++)
+            actorSystem.DestroyActor(actors[i]);
+        
+        if (t == 0) {
+            
+            // Every actor is in range and ticks at most once per cycle
+            unsigned long int totalAge = 0;
+            for (unsigned int i=0; i < numberOfActors; i++) {
+                if (ages[i] > numberOfCycles) Throw(msgFailedActorSimulation, __FILE__, __LINE__);
+                totalAge += ages[i];
+            }
+            if (totalAge == 0) Throw(msgFailedActorSimulation, __FILE__, __LINE__);
+            
+            referenceAges    = ages;
+            referenceTargets = targets;
+            referenceActive  = active;
+            
+            continue;
+        }
+        
+        // Equal seeds must give equal simulations on any number of threads
+        for (unsigned int i=0; i < numberOfActors; i++) {
+            if (ages[i] != referenceAges[i])       {Throw(msgFailedActorSimulation, __FILE__, __LINE__); break;}
+            if (targets[i] != referenceTargets[i]) {Throw(msgFailedActorSimulation, __FILE__, __LINE__); break;}
+            if (active[i] != referenceActive[i])   {Throw(msgFailedActorSimulation, __FILE__, __LINE__); break;}
+        }
+    }
+    
+    return;
+}
@@ -0,0 +1,165 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+
+
+void TestFramework::TestActorSystem(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Actor system............ ";
+    
+    ActorSystem actorSystem;
+    actorSystem.Initiate();
+    
+    const unsigned int numberOfActors = 500;
+    
+    std::vector<Actor*> actors;
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        Actor* actor = actorSystem.CreateActor();
+        if (actor == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        
+        actor->SetPosition( glm::vec3((float)(i % 20), 0, (float)(i / 20)) );
+        actors.push_back(actor);
+    }
+    
+    unsigned int churn = 0;
+    
+    // Run update cycles while hammering the actors from the main thread
+    auto runCycles = [&](unsigned int numberOfCycles) {
+        unsigned int cycles = 0;
+        while (cycles < numberOfCycles) {
+            
+            if (!actorSystem.IsUpdatePending()) {
+                actorSystem.UpdateSendSignal();
+                cycles++;
+                
+                // Churn the pool while the AI thread is running
+                if ((cycles % 10) == 0) {
+                    unsigned int index = churn++ % actors.size();
+                    if (!actorSystem.DestroyActor(actors[index])) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+                    actors[index] = actorSystem.CreateActor();
+                    actors[index]->SetPosition( glm::vec3(1, 0, 1) );
+                }
+            }
+            
+            for (unsigned int i=0; i < actors.size(); i++) {
+                glm::vec3 position = actors[i]->GetPosition();
+                actors[i]->SetPosition( position + glm::vec3(0.0001f, 0, 0) );
+                actors[i]->GetTargetPoint();
+                actors[i]->GetAge();
+            }
+            
+            actorSystem.SetPlayerWorldPosition( glm::vec3(10, 0, 10) );
+            
+            std::this_thread::yield();
+        }
+        
+        // Collect the last cycle
+        while (actorSystem.IsUpdatePending())
+            std::this_thread::yield();
+        actorSystem.UpdateSendSignal();
+    };
+    
+    runCycles(500);
+    
+    // Ages must advance on the AI thread and arrive on the main thread
+    unsigned long int totalAge = 0;
+    for (unsigned int i=0; i < actors.size(); i++)
+        totalAge += actors[i]->GetAge();
+    
+    if (totalAge == 0) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+    
+    // Every actor stops walking and picks a new target around its own
+    // position on each cycle
+    for (unsigned int i=0; i < actors.size(); i++) {
+        actors[i]->SetChanceToWalk(0);
+        actors[i]->SetChanceToStopWalking(10000);
+        actors[i]->SetChanceToFocusOnActor(0);
+        actors[i]->SetChanceToChangeDirection(1000);
+        actors[i]->SetDistanceToWalk(1.0f);
+    }
+    
+    actorSystem.SetActorUpdateDistance(1000000.0f);
+    actorSystem.SetPlayerWorldPosition( glm::vec3(0) );
+    
+    // Let the settings reach the AI thread and settle the walking states
+    for (unsigned int i=0; i < 3; i++) {
+        while (actorSystem.IsUpdatePending())
+            std::this_thread::yield();
+        actorSystem.UpdateSendSignal();
+    }
+    
+    // Each actor gets its own position and age on the main thread. After one
+    // exchange the AI must see them and after the next its results must
+    // come back - the cycle in flight adds one more year.
+    for (unsigned int round=0; round < 10; round++) {
+        
+        while (actorSystem.IsUpdatePending())
+            std::this_thread::yield();
+        
+        for (unsigned int i=0; i < actors.size(); i++) {
+            actors[i]->SetPosition( glm::vec3((float)i * 100.0f, 0, (float)round * 100.0f) );
+            actors[i]->SetAge(round * 100000 + i * 10);
+        }
+        
+        actorSystem.UpdateSendSignal();
+        while (actorSystem.IsUpdatePending())
+            std::this_thread::yield();
+        actorSystem.UpdateSendSignal();
+        
+        for (unsigned int i=0; i < actors.size(); i++) {
+            glm::vec3 position    = actors[i]->GetPosition();
+            glm::vec3 targetPoint = actors[i]->GetTargetPoint();
+            
+            if (position != glm::vec3((float)i * 100.0f, 0, (float)round * 100.0f)) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+            if (actors[i]->GetAge() != round * 100000 + i * 10 + 2) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+            
+            if (glm::abs(targetPoint.x - position.x) > 1.001f) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+            if (glm::abs(targetPoint.z - position.z) > 1.001f) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+        }
+        
+    }
+    
+    // Main thread changes must reach the AI thread - no actor is in range
+    actorSystem.SetActorUpdateDistance(1.0f);
+    actorSystem.SetPlayerWorldPosition( glm::vec3(10000, 0, 10000) );
+    
+    while (actorSystem.IsUpdatePending())
+        std::this_thread::yield();
+    actorSystem.UpdateSendSignal();
+    while (actorSystem.IsUpdatePending())
+        std::this_thread::yield();
+    actorSystem.UpdateSendSignal();
+    
+    std::vector<unsigned long int> ages(actors.size());
+    for (unsigned int i=0; i < actors.size(); i++)
+        ages[i] = actors[i]->GetAge();
+    
+    unsigned int cycles = 0;
+    while (cycles < 100) {
+        if (actorSystem.IsUpdatePending()) {
+            std::this_thread::yield();
+            continue;
+        }
+        actorSystem.UpdateSendSignal();
+        cycles++;
+    }
+    
+    actorSystem.Shutdown();
+    actorSystem.UpdateSendSignal();
+    
+    for (unsigned int i=0; i < actors.size(); i++)
+        if (actors[i]->GetAge() != ages[i]) Throw(msgFailedActorSystem, __FILE__, __LINE__);
+    
+    // Queued destroys are released on shutdown
+    for (unsigned int i=0; i < actors.size(); i++)
+        actorSystem.DestroyActor(actors[i]);
+    
+    if (actorSystem.GetNumberOfActors() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,316 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkGenerator.h>
+
+extern EngineSystemManager  Engine;
+extern NumberGeneration  Random;
+extern ColorPreset       Colors;
+extern MathCore          Math;
+
+
+// Quad copied into a mesh the way the old Mesh::AddSubMesh did it
+static void AddReferenceQuad(std::vector<Vertex>& vertexBuffer, std::vector<Index>& indexBuffer, Vertex* vertex, float x, float z) {
+    
+    glm::vec3 U = glm::vec3(vertex[2].x, vertex[2].y, vertex[2].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+    glm::vec3 V = glm::vec3(vertex[1].x, vertex[1].y, vertex[1].z) - glm::vec3(vertex[0].x, vertex[0].y, vertex[0].z);
+    glm::vec3 normal = glm::cross(U, V);
+    
+    unsigned int startVertex = vertexBuffer.size();
+    
+    for (int i = 0; i < 4; i++) {
+        vertex[i].nx = normal.x;
+        vertex[i].ny = normal.y;
+        vertex[i].nz = normal.z;
+        
+        vertex[i].x += x;
+        vertex[i].z += z;
+        
+        vertexBuffer.push_back(vertex[i]);
+    }
+    
+    const unsigned int quadIndices[6] = {0, 2, 1, 0, 3, 2};
+    for (int i = 0; i < 6; i++) 
+        indexBuffer.push_back( Index(quadIndices[i] + startVertex) );
+    
+    return;
+}
+
+// Copy of the synchronous chunk path from ChunkManager::CreateChunk before
+// generation moved to the job workers. The color noise is drawn from the
+// chunk stream because the old shared rand() sequence cannot be reproduced.
+static void BuildChunkReference(ChunkGenerator& generator, ChunkBuildData& data, float x, float y) {
+    
+    data.x = x;
+    data.y = y;
+    data.seed = generator.worldSeed + ((x * 2) + (y * 4) / 2);
+    
+    int chunkSZ = generator.chunkSize + 1;
+    unsigned int size = chunkSZ * chunkSZ;
+    
+    data.fieldSize = chunkSZ;
+    data.heightField.assign(size, 0.0f);
+    data.colorField.assign(size, glm::vec3(1.0f, 1.0f, 1.0f));
+    
+    float* heightField    = &data.heightField[0];
+    glm::vec3* colorField = &data.colorField[0];
+    
+    // Perlin layers
+    for (unsigned int l=0; l < generator.perlin.size(); l++) {
+        
+        Perlin* perlinLayer = &generator.perlin[l];
+        
+        for (unsigned int i = 0; i < size; i++) {
+            unsigned int xx = i % chunkSZ;
+            unsigned int zz = i / chunkSZ;
+            
+            float xCoord = ((float)xx + (int)x) * perlinLayer->noiseWidth;
+            float zCoord = ((float)zz + (int)y) * perlinLayer->noiseHeight;
+            
+            float noise = Random.Perlin(xCoord, 0, zCoord, generator.worldSeed) * perlinLayer->heightMultuplier;
+            
+            heightField[i] += Math.Round((noise * 10.0)) * 0.1;
+        }
+    }
+    
+    // Terrain color
+    RandomStream random(data.seed);
+    
+    Color low(generator.colorLow.x, generator.colorLow.y, generator.colorLow.z);
+    Color high(generator.colorHigh.x, generator.colorHigh.y, generator.colorHigh.z);
+    Color capColor(generator.snowCapColor.x, generator.snowCapColor.y, generator.snowCapColor.z);
+    
+    for (unsigned int i = 0; i < size; i++) {
+        float heightBias = heightField[i] * 0.024f;
+        heightBias = glm::clamp(heightBias, 0.0f, 1.0f);
+        
+        Color color = Colors.Lerp(low, high, heightBias);
+        
+        float uniformVariant = (random.Range(0, 100) * 0.00001f) - (random.Range(0, 10) * 0.00001f);
+        
+        color.r += uniformVariant;
+        color.g += uniformVariant;
+        color.b += uniformVariant;
+        
+        colorField[i] = glm::vec3(color.r, color.g, color.b);
+    }
+    
+    // Snow cap
+    float beginHeight = generator.snowCapHeight;
+    
+    for (unsigned int i = 0; i < size; i++) {
+        Color color(colorField[i].x, colorField[i].y, colorField[i].z);
+        int diff = ((beginHeight - (beginHeight - 20)) - (heightField[i] - beginHeight)) * 2.0f;
+        
+        if (random.Range(0, 100) > diff) 
+            color = Colors.Lerp(color, capColor, heightField[i] * 0.07);
+        
+        colorField[i] = glm::vec3(color.r, color.g, color.b);
+    }
+    
+    // Water table
+    for (unsigned int i = 0; i < size; i++) 
+        if (heightField[i] < 0) heightField[i] *= 0.3;
+    
+    // Full size mesh
+    data.meshVertices.clear();
+    data.meshIndices.clear();
+    data.lodVertices.clear();
+    data.lodIndices.clear();
+    
+    unsigned int fieldWidth = chunkSZ - 1;
+    
+    for (unsigned int xq = 0; xq < fieldWidth; xq++) {
+        for (unsigned int zq = 0; zq < fieldWidth; zq++) {
+            
+            float yyA = heightField[zq * chunkSZ + xq];
+            float yyB = heightField[zq * chunkSZ + (xq + 1)];
+            float yyC = heightField[(zq + 1) * chunkSZ + (xq + 1)];
+            float yyD = heightField[(zq + 1) * chunkSZ + xq];
+            
+            glm::vec3 cA = colorField[zq * chunkSZ + xq];
+            
+            float xx = (((float)xq - (float)chunkSZ / 2) / 2) + 0.25;
+            float zz = (((float)zq - (float)chunkSZ / 2) / 2) + 0.25;
+            
+            Vertex vertex[4] = {
+                Vertex(xx, yyA, zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0),
+                Vertex(xx + 1.0f, yyB, zz, cA.x, cA.y, cA.z, 0, 1, 0, 1, 0),
+                Vertex(xx + 1.0f, yyC, zz + 1.0f, cA.x, cA.y, cA.z, 0, 1, 0, 1, 1),
+                Vertex(xx, yyD, zz + 1.0f, cA.x, cA.y, cA.z, 0, 1, 0, 0, 1)
+            };
+            
+            AddReferenceQuad(data.meshVertices, data.meshIndices, vertex, xx, zz);
+        }
+    }
+    
+    // Half size mesh
+    unsigned int halfWidth = chunkSZ / 2.0f;
+    
+    for (unsigned int xq = 0; xq < halfWidth; xq++) {
+        for (unsigned int zq = 0; zq < halfWidth; zq++) {
+            unsigned int xa = xq * 2;
+            unsigned int za = zq * 2;
+            
+            float yyA = heightField[za * chunkSZ + xa] - 0.25f;
+            float yyB = heightField[za * chunkSZ + (xa + 2)] - 0.25f;
+            float yyC = heightField[(za + 2) * chunkSZ + (xa + 2)] - 0.25f;
+            float yyD = heightField[(za + 2) * chunkSZ + xa] - 0.25f;
+            
+            glm::vec3 cA = colorField[za * chunkSZ + xa];
+            glm::vec3 cB = colorField[za * chunkSZ + (xa + 2)];
+            glm::vec3 cC = colorField[(za + 2) * chunkSZ + (xa + 2)];
+            glm::vec3 cD = colorField[(za + 2) * chunkSZ + xa];
+            
+            float xx = (((float)xq * 2.5f - (float)halfWidth) / 2.5f) - 2.5f;
+            float zz = (((float)zq * 2.5f - (float)halfWidth) / 2.5f) - 2.5f;
+            
+            Vertex vertex[4] = {
+                Vertex(xx, yyA, zz, cA.x, cA.y, cA.z, 0, 1, 0, 0, 0),
+                Vertex(xx + 2.0f, yyB, zz, cB.x, cB.y, cB.z, 0, 1, 0, 1, 0),
+                Vertex(xx + 2.0f, yyC, zz + 2.0f, cC.x, cC.y, cC.z, 0, 1, 0, 1, 1),
+                Vertex(xx, yyD, zz + 2.0f, cD.x, cD.y, cD.z, 0, 1, 0, 0, 1)
+            };
+            
+            AddReferenceQuad(data.lodVertices, data.lodIndices, vertex, xx, zz);
+        }
+    }
+    
+    return;
+}
+
+
+static bool CompareChunkBuildData(ChunkBuildData& a, ChunkBuildData& b) {
+    
+    if (a.seed != b.seed || a.fieldSize != b.fieldSize)
+        return false;
+    
+    if (a.heightField.size()  != b.heightField.size()  ||
+        a.colorField.size()   != b.colorField.size()   ||
+        a.meshVertices.size() != b.meshVertices.size() ||
+        a.meshIndices.size()  != b.meshIndices.size()  ||
+        a.lodVertices.size()  != b.lodVertices.size()  ||
+        a.lodIndices.size()   != b.lodIndices.size())
+        return false;
+    
+    if (memcmp(a.heightField.data(),  b.heightField.data(),  a.heightField.size()  * sizeof(float))     != 0) return false;
+    if (memcmp(a.colorField.data(),   b.colorField.data(),   a.colorField.size()   * sizeof(glm::vec3)) != 0) return false;
+    if (memcmp(a.meshVertices.data(), b.meshVertices.data(), a.meshVertices.size() * sizeof(Vertex))    != 0) return false;
+    if (memcmp(a.meshIndices.data(),  b.meshIndices.data(),  a.meshIndices.size()  * sizeof(Index))     != 0) return false;
+    if (memcmp(a.lodVertices.data(),  b.lodVertices.data(),  a.lodVertices.size()  * sizeof(Vertex))    != 0) return false;
+    if (memcmp(a.lodIndices.data(),   b.lodIndices.data(),   a.lodIndices.size()   * sizeof(Index))     != 0) return false;
+    
+    return true;
+}
+
+
+void TestFramework::TestChunkGeneration(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Chunk generation........ ";
+    
+    ChunkGenerator generator;
+    generator.chunkSize = 32;
+    generator.worldSeed = 1234;
+    generator.colorLow  = glm::vec3(0.1f, 0.2f, 0.05f);
+    generator.colorHigh = glm::vec3(0.3f, 0.25f, 0.2f);
+    
+    Perlin layerLow;
+    layerLow.heightMultuplier = 20.0f;
+    layerLow.noiseWidth  = 0.02f;
+    layerLow.noiseHeight = 0.02f;
+    
+    Perlin layerHigh;
+    layerHigh.heightMultuplier = 80.0f;
+    layerHigh.noiseWidth  = 0.005f;
+    layerHigh.noiseHeight = 0.005f;
+    
+    generator.perlin.push_back(layerLow);
+    generator.perlin.push_back(layerHigh);
+    
+    // Build every chunk in an area with the old synchronous path
+    const int areaSize = 8;
+    const unsigned int numberOfChunks = areaSize * areaSize;
+    
+    std::vector<ChunkBuildData> syncData(numberOfChunks);
+    std::vector<ChunkBuildData> asyncData(numberOfChunks);
+    
+    for (unsigned int i=0; i < numberOfChunks; i++) {
+        float x = (float)(((int)i % areaSize) - areaSize / 2) * generator.chunkSize;
+        float z = (float)(((int)i / areaSize) - areaSize / 2) * generator.chunkSize;
+        BuildChunkReference(generator, syncData[i], x, z);
+    }
+    
+    if (syncData[0].meshVertices.size() == 0) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (syncData[0].lodVertices.size()  == 0) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Build the same chunks in reverse order across the job workers
+    JobSystem jobs;
+    jobs.Initiate(4);
+    
+    JobCounter counter;
+    
+    for (int i=numberOfChunks - 1; i >= 0; i--) {
+        
+        ChunkBuildData* data = &asyncData[i];
+        float x = syncData[i].x;
+        float z = syncData[i].y;
+        
+        jobs.Submit([generator, data, x, z]() mutable {
+            generator.Build(*data, x, z);
+        }, &counter);
+    }
+    
+    jobs.Wait(&counter);
+    jobs.Shutdown();
+    
+    for (unsigned int i=0; i < numberOfChunks; i++)
+        if (!CompareChunkBuildData(syncData[i], asyncData[i])) Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+    
+    // Rebuilding into used data must not leave anything behind
+    generator.Build(asyncData[0], syncData[1].x, syncData[1].y);
+    if (!CompareChunkBuildData(syncData[1], asyncData[0])) Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+    
+    // Shared vertex grid corners must land on the quad corners
+    ChunkBuildData sharedData;
+    generator.doSharedVertices = true;
+    generator.Build(sharedData, syncData[0].x, syncData[0].y);
+    
+    unsigned int fieldSize = sharedData.fieldSize;
+    unsigned int quadsPerSide = fieldSize - 1;
+    
+    if (sharedData.meshVertices.size() != fieldSize * fieldSize) Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+    if (sharedData.meshIndices.size() != syncData[0].meshIndices.size()) Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+    
+    for (unsigned int x=0; x < quadsPerSide; x++) {
+        for (unsigned int z=0; z < quadsPerSide; z++) {
+            Vertex& quadCorner   = syncData[0].meshVertices[(x * quadsPerSide + z) * 4];
+            Vertex& sharedCorner = sharedData.meshVertices[z * fieldSize + x];
+            
+            if (glm::distance(glm::vec3(quadCorner.x, quadCorner.y, quadCorner.z), 
+                              glm::vec3(sharedCorner.x, sharedCorner.y, sharedCorner.z)) > 0.0001f) 
+                Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+        }
+    }
+    
+    // Fields without a single quad add nothing
+    const unsigned int smallSizes[3][2] = {{1, 1}, {1, 5}, {5, 1}};
+    
+    float smallHeights[5] = {0};
+    glm::vec3 smallColors[5];
+    
+    for (unsigned int i=0; i < 3; i++) {
+        
+        std::vector<Vertex> smallVertices;
+        std::vector<Index>  smallIndices;
+        
+        Engine.AddHeightFieldToBufferShared(smallVertices, smallIndices, smallHeights, smallColors, smallSizes[i][0], smallSizes[i][1], 0, 0);
+        
+        if ((smallVertices.size() != 0) | (smallIndices.size() != 0)) Throw(msgFailedChunkBuild, __FILE__, __LINE__);
+    }
+    
+    return;
+}
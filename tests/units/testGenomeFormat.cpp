@@ -0,0 +1,144 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/EngineSystems.h>
+
+
+static bool CompareBaseGene(const BaseGene& a, const BaseGene& b) {
+    return (a.x == b.x) & (a.y == b.y) & (a.z == b.z);
+}
+
+static bool CompareActorGenome(Actor& a, Actor& b) {
+    
+    if (a.GetName() != b.GetName()) return false;
+    
+    if (a.GetSpeed()           != b.GetSpeed())           return false;
+    if (a.GetSpeedMultiplier() != b.GetSpeedMultiplier()) return false;
+    if (a.GetSpeedYouth()      != b.GetSpeedYouth())      return false;
+    if (a.GetYouthScale()      != b.GetYouthScale())      return false;
+    if (a.GetAdultScale()      != b.GetAdultScale())      return false;
+    
+    if (a.GetChanceToChangeDirection() != b.GetChanceToChangeDirection()) return false;
+    if (a.GetChanceToFocusOnActor()    != b.GetChanceToFocusOnActor())    return false;
+    if (a.GetChanceToStopWalking()     != b.GetChanceToStopWalking())     return false;
+    if (a.GetChanceToWalk()            != b.GetChanceToWalk())            return false;
+    
+    if (a.GetDistanceToWalk()      != b.GetDistanceToWalk())      return false;
+    if (a.GetDistanceToAttack()    != b.GetDistanceToAttack())    return false;
+    if (a.GetDistanceToFlee()      != b.GetDistanceToFlee())      return false;
+    if (a.GetHeightPreferenceMin() != b.GetHeightPreferenceMin()) return false;
+    if (a.GetHeightPreferenceMax() != b.GetHeightPreferenceMax()) return false;
+    
+    if (a.GetNumberOfGenes() != b.GetNumberOfGenes()) return false;
+    
+    for (unsigned int i=0; i < a.GetNumberOfGenes(); i++) {
+        Gene geneA = a.GetGeneFromGenome(i);
+        Gene geneB = b.GetGeneFromGenome(i);
+        
+        if (!CompareBaseGene(geneA.offset, geneB.offset))               return false;
+        if (!CompareBaseGene(geneA.position, geneB.position))           return false;
+        if (!CompareBaseGene(geneA.rotation, geneB.rotation))           return false;
+        if (!CompareBaseGene(geneA.scale, geneB.scale))                 return false;
+        if (!CompareBaseGene(geneA.color, geneB.color))                 return false;
+        if (!CompareBaseGene(geneA.animationAxis, geneB.animationAxis)) return false;
+        
+        if (geneA.animationRange     != geneB.animationRange)     return false;
+        if (geneA.attachmentIndex    != geneB.attachmentIndex)    return false;
+        if (geneA.doExpress          != geneB.doExpress)          return false;
+        if (geneA.doAnimationCycle   != geneB.doAnimationCycle)   return false;
+        if (geneA.doInverseAnimation != geneB.doInverseAnimation) return false;
+    }
+    
+    return true;
+}
+
+
+void TestFramework::TestGenomeFormat(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Genome format........... ";
+    
+    // Test each preset survives a binary round trip
+    for (unsigned int p=0; p < 3; p++) {
+        
+        Actor source;
+        if (p == 0) AI.genomes.presets.Sheep(&source);
+        if (p == 1) AI.genomes.presets.Bear(&source);
+        if (p == 2) AI.genomes.presets.Dog(&source);
+        
+        std::string genome;
+        AI.genomes.EncodeGenome(&source, genome);
+        
+        if (!AI.genomes.IsBinaryGenome(genome)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        Actor target;
+        if (!AI.genomes.InjectGenome(&target, genome)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        if (!CompareActorGenome(source, target)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        std::string reencoded;
+        AI.genomes.EncodeGenome(&target, reencoded);
+        if (reencoded != genome) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        // Test the text format still imports
+        Actor imported;
+        if (!AI.genomes.InjectGenome(&imported, AI.genomes.ExtractGenome(&source))) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        if (imported.GetName() != source.GetName()) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        if (imported.GetNumberOfGenes() != source.GetNumberOfGenes()) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        for (unsigned int i=0; i < source.GetNumberOfGenes(); i++)
+            if (std::fabs(imported.GetGeneFromGenome(i).scale.x - source.GetGeneFromGenome(i).scale.x) > 0.001f) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        // Test damaged genomes are rejected without touching the actor
+        Actor rejected;
+        
+        std::string corrupted = genome;
+        corrupted[corrupted.size() / 2] ^= 0x5a;
+        if (AI.genomes.DecodeGenome(&rejected, corrupted)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        std::string truncated = genome.substr(0, genome.size() - 1);
+        if (AI.genomes.DecodeGenome(&rejected, truncated)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        std::string version = genome;
+        version[4] = 99;
+        if (AI.genomes.DecodeGenome(&rejected, version)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+        
+        if (rejected.GetNumberOfGenes() != 0) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    }
+    
+    // Test a network survives a binary round trip
+    NeuralNetwork network;
+    network.AddNeuralLayer(16, 1);
+    network.AddNeuralLayer(16, 16);
+    network.AddNeuralLayer(16, 16);
+    network.AddNeuralLayer(1, 16);
+    
+    std::vector<float> input = {0.87f};
+    network.FeedForward(input);
+    
+    std::string state;
+    network.SaveStateBinary(state);
+    
+    NeuralNetwork restored;
+    if (!restored.LoadStateBinary(state)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    if (restored.GetFingerprint() != network.GetFingerprint()) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    
+    restored.FeedForward(input);
+    if (restored.GetResults() != network.GetResults()) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    
+    std::string corruptedState = state;
+    corruptedState[corruptedState.size() - 3] ^= 0x01;
+    if (restored.LoadStateBinary(corruptedState)) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    
+    // Test text states import into the same weights
+    std::vector<std::string> textState = network.SaveState();
+    
+    NeuralNetwork imported;
+    imported.LoadState(textState);
+    imported.FeedForward(input);
+    if (std::fabs(imported.GetResults()[0] - network.GetResults()[0]) > 0.001f) Throw(msgFailedGenomeFormat, __FILE__, __LINE__);
+    
+    return;
+}
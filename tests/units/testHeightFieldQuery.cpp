@@ -0,0 +1,189 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+
+extern PhysicsSystem Physics;
+
+// Ground hits agree when they land on the same point of the same surface
+static bool CompareHit(const Hit& terrainHit, const Hit& rayHit) {
+    
+    if (std::fabs(terrainHit.point.y - rayHit.point.y) > 0.01f) return false;
+    if (glm::dot(terrainHit.normal, rayHit.normal) < 0.999f) return false;
+    
+    return terrainHit.gameObject == rayHit.gameObject;
+}
+
+
+void TestFramework::TestHeightFieldQuery(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Height field query...... ";
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    const unsigned int fieldSize = 33;
+    const int tilesPerSide = 3;
+    const float tileSize = (float)(fieldSize - 1);
+    
+    RandomStream random(55);
+    
+    std::vector<float> heightField(fieldSize * fieldSize);
+    std::vector<MeshCollider*> meshColliders;
+    std::vector<rp3d::RigidBody*> rigidBodies;
+    
+    // Lay out a grid of height fields as the chunk manager does
+    for (int x=0; x < tilesPerSide; x++) {
+        
+        for (int z=0; z < tilesPerSide; z++) {
+            
+            random.Fill(heightField.data(), heightField.size(), -20.0f, 20.0f);
+            
+            MeshCollider* meshCollider = Physics.CreateHeightFieldMap(heightField.data(), fieldSize, fieldSize, 1, 1, 1);
+            
+            rp3d::Transform bodyTransform = rp3d::Transform::identity();
+            bodyTransform.setPosition( rp3d::Vector3(x * tileSize, 0, z * tileSize) );
+            
+            rp3d::RigidBody* rigidBody = Physics.world->createRigidBody( bodyTransform );
+            rigidBody->setType(rp3d::BodyType::STATIC);
+            
+            void* userData = (void*)(size_t)(meshColliders.size() + 1);
+            
+            rp3d::Collider* bodyCollider = rigidBody->addCollider( meshCollider->heightFieldShape, rp3d::Transform::identity() );
+            bodyCollider->setUserData( userData );
+            bodyCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+            
+            if (!Physics.AddTerrainHeightField(meshCollider, glm::vec3(x * tileSize, 0, z * tileSize), userData))
+                Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+            
+            meshColliders.push_back(meshCollider);
+            rigidBodies.push_back(rigidBody);
+        }
+    }
+    
+    // The same tile cannot be added twice
+    if (Physics.AddTerrainHeightField(meshColliders[0], glm::vec3(0), nullptr)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    // Test single queries against a ray cast
+    const unsigned int numberOfPoints = 2000;
+    const float minimum = -tileSize * 0.5f + 0.01f;
+    const float maximum = tileSize * (tilesPerSide - 0.5f) - 0.01f;
+    
+    std::vector<glm::vec3> points(numberOfPoints);
+    
+    for (unsigned int i=0; i < numberOfPoints; i++) {
+        
+        points[i] = glm::vec3(random.Range(minimum, maximum), 100.0f, random.Range(minimum, maximum));
+        
+        Hit terrainHit;
+        Hit rayHit;
+        
+        bool isTerrainHit = Physics.QueryGround(points[i], 200.0f, terrainHit);
+        bool isRayHit     = Physics.Raycast(points[i], glm::vec3(0, -1, 0), 200.0f, rayHit, LayerMask::Ground);
+        
+        if (isTerrainHit != isRayHit) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+        if (!isTerrainHit) continue;
+        
+        if (!CompareHit(terrainHit, rayHit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    }
+    
+    // Test the batch against the single queries
+    std::vector<Hit> hits(numberOfPoints);
+    std::vector<uint8_t> isHit(numberOfPoints);
+    
+    unsigned int numberOfHits = Physics.QueryGroundBatch(points.data(), numberOfPoints, 200.0f, hits.data(), isHit.data());
+    
+    if (numberOfHits != numberOfPoints) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < numberOfPoints; i++) {
+        
+        Hit terrainHit;
+        Physics.QueryGround(points[i], 200.0f, terrainHit);
+        
+        if (hits[i].point != terrainHit.point) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    }
+    
+    // Test points out of reach of the ground
+    Hit hit;
+    if (Physics.QueryGround(glm::vec3(0, -100.0f, 0), 200.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (Physics.QueryGround(glm::vec3(0, 100.0f, 0), 50.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    // Test the ray cast fallback for geometry off the terrain
+    rp3d::BoxShape* boxShape = Physics.CreateColliderBox(5.0f, 5.0f, 5.0f);
+    
+    rp3d::Transform boxTransform = rp3d::Transform::identity();
+    boxTransform.setPosition( rp3d::Vector3(-200.0f, 0, -200.0f) );
+    
+    rp3d::RigidBody* boxBody = Physics.world->createRigidBody( boxTransform );
+    boxBody->setType(rp3d::BodyType::STATIC);
+    
+    rp3d::Collider* boxCollider = boxBody->addCollider( boxShape, rp3d::Transform::identity() );
+    boxCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+    
+    if (!Physics.QueryGround(glm::vec3(-200.0f, 100.0f, -200.0f), 200.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (std::fabs(hit.point.y - 5.0f) > 0.01f) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (hit.collider != boxCollider) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    // Test a ground collider standing on the terrain
+    rp3d::Transform rockTransform = rp3d::Transform::identity();
+    rockTransform.setPosition( rp3d::Vector3(tileSize, 30.0f, tileSize) );
+    
+    rp3d::RigidBody* rockBody = Physics.world->createRigidBody( rockTransform );
+    rockBody->setType(rp3d::BodyType::STATIC);
+    
+    rp3d::Collider* rockCollider = rockBody->addCollider( boxShape, rp3d::Transform::identity() );
+    rockCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+    
+    glm::vec3 rockPoints[2] = {glm::vec3(tileSize + 1.0f, 100.0f, tileSize - 1.0f), 
+                               glm::vec3(tileSize + 10.0f, 100.0f, tileSize)};
+    
+    if (!Physics.QueryGround(rockPoints[0], 200.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (std::fabs(hit.point.y - 35.0f) > 0.01f) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (hit.collider != rockCollider) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    Hit rockHits[2];
+    uint8_t isRockHit[2];
+    
+    if (Physics.QueryGroundBatch(rockPoints, 2, 200.0f, rockHits, isRockHit) != 2) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (rockHits[0].collider != rockCollider) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    // Points beside the collider still sample the terrain
+    Hit rayHit;
+    Physics.Raycast(rockPoints[1], glm::vec3(0, -1, 0), 200.0f, rayHit, LayerMask::Ground);
+    
+    if (rockHits[1].collider != nullptr) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (!CompareHit(rockHits[1], rayHit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    Physics.world->destroyRigidBody( rockBody );
+    
+    // Removed tiles fall back to the ray cast
+    Physics.RemoveTerrainHeightField(meshColliders[4]);
+    
+    glm::vec3 center(tileSize, 100.0f, tileSize);
+    
+    if (!Physics.QueryGround(center, 200.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    if (hit.collider == nullptr) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    Physics.AddTerrainHeightField(meshColliders[4], glm::vec3(tileSize, 0, tileSize), (void*)(size_t)5);
+    
+    // Destroying the height field also removes the tile
+    for (unsigned int i=0; i < rigidBodies.size(); i++)
+        Physics.world->destroyRigidBody( rigidBodies[i] );
+    
+    for (unsigned int i=0; i < meshColliders.size(); i++)
+        Physics.DestroyHeightFieldMap( meshColliders[i] );
+    
+    if (Physics.QueryGround(center, 200.0f, hit)) Throw(msgFailedHeightFieldQuery, __FILE__, __LINE__);
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    return;
+}
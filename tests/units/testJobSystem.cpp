@@ -0,0 +1,134 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/Jobs/JobSystem.h>
+
+
+void TestFramework::TestJobSystem(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Job system.............. ";
+    
+    JobSystem jobs;
+    jobs.Initiate(4);
+    
+    if (jobs.GetNumberOfWorkers() != 4) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Test parallel for visits every index exactly once
+    const unsigned int rangeSize = 100000;
+    std::vector<unsigned char> visits(rangeSize, 0);
+    
+    jobs.ParallelFor(rangeSize, 64, [&visits](unsigned int begin, unsigned int end) {
+        for (unsigned int i=begin; i < end; i++)
+            visits[i]++;
+    });
+    
+    for (unsigned int i=0; i < rangeSize; i++)
+        if (visits[i] != 1) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    // Test many threads submitting against their own counters
+    const unsigned int numberOfProducers = 8;
+    const unsigned int jobsPerProducer   = 5000;
+    std::atomic<unsigned int> total(0);
+    
+    std::vector<std::thread*> producers;
+    for (unsigned int p=0; p < numberOfProducers; p++) {
+        producers.push_back( new std::thread([&jobs, &total, jobsPerProducer]() {
+            JobCounter counter;
+            for (unsigned int i=0; i < jobsPerProducer; i++)
+                jobs.Submit([&total]() {total.fetch_add(1);}, &counter);
+            jobs.Wait(&counter);
+        }) );
+    }
+    
+    for (unsigned int p=0; p < numberOfProducers; p++) {
+        producers[p]->join();
+        delete producers[p];
+    }
+    
+    if (total.load() != numberOfProducers * jobsPerProducer) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    // Test jobs submitting jobs from the workers
+    std::atomic<unsigned int> nestedTotal(0);
+    JobCounter nestedCounter;
+    
+    for (unsigned int i=0; i < 64; i++) {
+        jobs.Submit([&jobs, &nestedTotal, &nestedCounter]() {
+            for (unsigned int n=0; n < 16; n++)
+                jobs.Submit([&nestedTotal]() {nestedTotal.fetch_add(1);}, &nestedCounter);
+        }, &nestedCounter);
+    }
+    
+    jobs.Wait(&nestedCounter);
+    if (nestedTotal.load() != 64 * 16) Throw(msgFailedJob, __FILE__, __LINE__);
+    if (!nestedCounter.IsComplete())  Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    // Test dependent jobs only start after their dependency completes
+    std::atomic<unsigned int> firstStage(0);
+    std::atomic<unsigned int> orderErrors(0);
+    JobCounter firstCounter;
+    JobCounter secondCounter;
+    
+    for (unsigned int i=0; i < 32; i++) {
+        jobs.Submit([&firstStage]() {
+            std::this_thread::yield();
+            firstStage.fetch_add(1);
+        }, &firstCounter);
+    }
+    
+    for (unsigned int i=0; i < 32; i++) {
+        jobs.Submit([&firstStage, &orderErrors]() {
+            if (firstStage.load() != 32)
+                orderErrors.fetch_add(1);
+        }, &secondCounter, &firstCounter);
+    }
+    
+    jobs.Wait(&secondCounter);
+    if (orderErrors.load() != 0) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    // Test dependent jobs submitted after their dependency has already completed
+    JobCounter lateCounter;
+    jobs.Submit([&firstStage, &orderErrors]() {
+        if (firstStage.load() != 32)
+            orderErrors.fetch_add(1);
+    }, &lateCounter, &firstCounter);
+    
+    jobs.Wait(&lateCounter);
+    if (orderErrors.load() != 0) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    // Test workers of one pool submitting into a smaller pool
+    JobSystem otherJobs;
+    otherJobs.Initiate(1);
+    
+    std::atomic<unsigned int> crossTotal(0);
+    JobCounter crossCounter;
+    
+    for (unsigned int i=0; i < 64; i++) {
+        jobs.Submit([&otherJobs, &crossTotal]() {
+            JobCounter innerCounter;
+            otherJobs.Submit([&crossTotal]() {crossTotal.fetch_add(1);}, &innerCounter);
+            otherJobs.Wait(&innerCounter);
+        }, &crossCounter);
+    }
+    
+    jobs.Wait(&crossCounter);
+    otherJobs.Shutdown();
+    if (crossTotal.load() != 64) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    jobs.Shutdown();
+    if (jobs.GetNumberOfWorkers() != 0) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Test jobs still run on the calling thread without a worker pool
+    unsigned int serialTotal = 0;
+    JobCounter serialCounter;
+    for (unsigned int i=0; i < 10; i++)
+        jobs.Submit([&serialTotal]() {serialTotal++;}, &serialCounter);
+    jobs.Wait(&serialCounter);
+    if (serialTotal != 10) Throw(msgFailedJob, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,156 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+
+extern RenderSystem Renderer;
+extern ColorPreset  Colors;
+
+
+void TestFramework::TestMeshStreaming(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Mesh streaming.......... ";
+    
+    const unsigned int numberOfCubes = 100;
+    
+    MeshUploadTrace trace;
+    Mesh::SetUploadTrace(&trace);
+    
+    SubMesh cube;
+    Renderer.meshes.cube->GetSubMesh(0, cube);
+    
+    unsigned int cubeBytes = cube.vertexBuffer.size() * sizeof(Vertex);
+    unsigned int fullBytes = numberOfCubes * (cube.vertexBuffer.size() * sizeof(Vertex) + cube.indexBuffer.size() * sizeof(Index));
+    
+    // Static meshes upload everything on every load
+    Mesh* staticMesh = Renderer.CreateMesh();
+    
+    for (unsigned int i=0; i < numberOfCubes; i++)
+        staticMesh->AddSubMesh(i, 0, 0, cube, false);
+    
+    staticMesh->Load();
+    staticMesh->ChangeSubMeshColor(5, Colors.red);
+    
+    trace.Clear();
+    staticMesh->Load();
+    
+    if (trace.numberOfBytes != fullBytes) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // Dynamic meshes fill the ring once then upload only the changes
+    Mesh* dynamicMesh = Renderer.CreateMesh();
+    dynamicMesh->SetDynamic(true);
+    
+    for (unsigned int i=0; i < numberOfCubes; i++)
+        dynamicMesh->AddSubMesh(i, 0, 0, cube, false);
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfAllocations != 1)            Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if (trace.numberOfBytes < fullBytes)           Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if ((trace.numberOfBytes % fullBytes) != 0)    Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // Writes go through the mapping when buffer storage is available, otherwise through sub data
+    bool isMapped = (GLEW_ARB_buffer_storage != 0);
+    
+    if (isMapped) {
+        if (trace.numberOfMappedWrites  != trace.numberOfUploads) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+        if (trace.numberOfSubDataWrites != 0)                     Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    } else {
+        if (trace.numberOfSubDataWrites != trace.numberOfUploads) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+        if (trace.numberOfMappedWrites  != 0)                     Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    }
+    
+    // A single sub mesh change
+    dynamicMesh->ChangeSubMeshColor(5, Colors.red);
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfAllocations != 0)  Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if (trace.numberOfUploads != 1)      Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if (trace.uploadSizes[0] != cubeBytes) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // The change reaches the remaining copies then nothing is left to upload
+    for (unsigned int i=0; i < RENDER_NUMBER_OF_STREAM_BUFFERS; i++)
+        dynamicMesh->Load();
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfUploads != 0) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // Changes on two sub meshes upload the span between them
+    dynamicMesh->ChangeSubMeshPosition(10, 0, 1, 0);
+    dynamicMesh->ChangeSubMeshPosition(12, 0, 1, 0);
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfBytes != cubeBytes * 3) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < RENDER_NUMBER_OF_STREAM_BUFFERS; i++)
+        dynamicMesh->Load();
+    
+    // Normal changes stream the whole vertex range
+    dynamicMesh->SetNormals( glm::vec3(0, 1, 0) );
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfBytes != dynamicMesh->GetNumberOfVertices() * sizeof(Vertex)) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < RENDER_NUMBER_OF_STREAM_BUFFERS; i++)
+        dynamicMesh->Load();
+    
+    // Range and buffer loads go through the ring rather than the immutable storage
+    trace.Clear();
+    
+    if (!dynamicMesh->LoadRange(0, 3)) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    if (trace.numberOfAllocations != 0)                              Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if (trace.numberOfBytes != 3 * sizeof(Vertex) + 3 * sizeof(Index)) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < RENDER_NUMBER_OF_STREAM_BUFFERS; i++)
+        dynamicMesh->Load();
+    
+    std::vector<Vertex> vertexCopy(dynamicMesh->GetNumberOfVertices());
+    for (unsigned int i=0; i < vertexCopy.size(); i++)
+        vertexCopy[i] = dynamicMesh->GetVertex(i);
+    
+    trace.Clear();
+    dynamicMesh->LoadVertexBuffer(vertexCopy.data(), vertexCopy.size());
+    
+    if (trace.numberOfAllocations != 0)                               Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    if (trace.numberOfBytes != vertexCopy.size() * sizeof(Vertex))    Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // A drawn copy is fenced and waited on before the ring comes back around to it
+    Renderer.shaders.color->Bind();
+    dynamicMesh->Bind();
+    dynamicMesh->DrawIndexArray();
+    
+    trace.Clear();
+    for (unsigned int i=0; i < RENDER_NUMBER_OF_STREAM_BUFFERS; i++)
+        dynamicMesh->Load();
+    
+    if (trace.numberOfFenceWaits != (isMapped ? 1u : 0u)) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    // Growing past the capacity reallocates
+    for (unsigned int i=0; i < numberOfCubes; i++)
+        dynamicMesh->AddSubMesh(i, 1, 0, cube, false);
+    
+    trace.Clear();
+    dynamicMesh->Load();
+    
+    if (trace.numberOfAllocations != 1) Throw(msgFailedMeshStreaming, __FILE__, __LINE__);
+    
+    Mesh::SetUploadTrace(nullptr);
+    
+    Renderer.DestroyMesh(staticMesh);
+    Renderer.DestroyMesh(dynamicMesh);
+    
+    return;
+}
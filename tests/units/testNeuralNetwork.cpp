@@ -0,0 +1,173 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/NeuralNetwork.h>
+#include <GameEngineFramework/Math/Random.h>
+
+
+// Nested vector network matching the original scalar feed forward
+struct ReferenceNetwork {
+    
+    std::vector<std::vector<float>> neurons;
+    std::vector<std::vector<std::vector<float>>> weights;
+    std::vector<std::vector<float>> biases;
+    
+    void FeedForward(const std::vector<float>& input) {
+        neurons[0] = input;
+        for (size_t i = 1; i < neurons.size(); ++i) {
+            for (size_t j = 0; j < neurons[i].size(); ++j) {
+                float sum = biases[i][j];
+                for (size_t k = 0; k < neurons[i - 1].size(); ++k)
+                    sum += neurons[i - 1][k] * weights[i][j][k];
+                neurons[i][j] = tanh(sum);
+            }
+        }
+    }
+};
+
+// Build matching state strings and a reference network for a topology
+static std::vector<std::string> CreateNeuralState(const std::vector<unsigned int>& topology, RandomStream& random, ReferenceNetwork& reference) {
+    std::vector<std::string> state;
+    
+    unsigned int numberOfLayers = topology.size();
+    reference.neurons.resize(numberOfLayers);
+    reference.weights.resize(numberOfLayers);
+    reference.biases.resize(numberOfLayers);
+    
+    for (unsigned int i=0; i < numberOfLayers; i++) {
+        unsigned int numberOfNeurons = topology[i];
+        unsigned int numberOfInputs  = (i == 0) ? 1 : topology[i - 1];
+        
+        reference.neurons[i].resize(numberOfNeurons);
+        reference.biases[i].resize(numberOfNeurons);
+        reference.weights[i].resize(numberOfNeurons, std::vector<float>(numberOfInputs));
+        
+        std::string layerString = std::to_string(numberOfInputs) + " " + std::to_string(numberOfNeurons) + " " +
+                                  std::to_string(numberOfNeurons) + " " + std::to_string(numberOfNeurons) + " " +
+                                  std::to_string(numberOfNeurons) + " ";
+        
+        // Sixty fourths print exactly so both networks hold the same values
+        for (unsigned int b=0; b < numberOfNeurons; b++) {
+            reference.biases[i][b] = random.Range(-32, 32) / 64.0f;
+            layerString += std::to_string(reference.biases[i][b]) + " ";
+        }
+        
+        for (unsigned int n=0; n < numberOfNeurons; n++) {
+            for (unsigned int w=0; w < numberOfInputs; w++) {
+                reference.weights[i][n][w] = random.Range(-64, 64) / 64.0f;
+                layerString += std::to_string(reference.weights[i][n][w]) + " ";
+            }
+        }
+        
+        state.push_back(layerString);
+    }
+    
+    return state;
+}
+
+
+void TestFramework::TestNeuralNetwork(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Neural network.......... ";
+    
+    const float tolerance = 0.00001f;
+    
+    std::vector<std::vector<unsigned int>> topologies;
+    topologies.push_back({1, 16, 16, 1});
+    topologies.push_back({8, 32, 32, 4});
+    topologies.push_back({5, 7, 3});
+    topologies.push_back({13, 9, 11, 6, 2});
+    
+    RandomStream random(2024);
+    
+    uint64_t previousFingerprint = 0;
+    
+    for (unsigned int t=0; t < topologies.size(); t++) {
+        
+        ReferenceNetwork reference;
+        std::vector<std::string> state = CreateNeuralState(topologies[t], random, reference);
+        
+        NeuralNetwork network;
+        network.LoadState(state);
+        
+        if (network.GetNumberOfLayers() != topologies[t].size()) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+        
+        std::vector<float> output(topologies[t].back());
+        
+        for (unsigned int i=0; i < 32; i++) {
+            
+            // Actor networks are fed fewer values than the input layer holds
+            unsigned int numberOfInputs = (i % 2 == 0) ? topologies[t][0] : 1;
+            
+            std::vector<float> input(numberOfInputs);
+            for (unsigned int n=0; n < numberOfInputs; n++)
+                input[n] = random.Range(-1.0f, 1.0f);
+            
+            reference.FeedForward(input);
+            network.FeedForward(input.data(), input.size(), output.data());
+            
+            std::vector<float> results = network.GetResults();
+            if (results.size() != output.size()) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+            
+            for (unsigned int n=0; n < output.size(); n++) {
+                if (std::fabs(output[n] - reference.neurons.back()[n]) > tolerance) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+                if (output[n] != results[n]) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+            }
+        }
+        
+        // Test the saved state reproduces the network
+        std::vector<std::string> savedState = network.SaveState();
+        
+        NeuralNetwork restored;
+        restored.LoadState(savedState);
+        
+        std::vector<float> input(topologies[t][0], 0.5f);
+        network.FeedForward(input);
+        restored.FeedForward(input);
+        
+        if (network.GetResults() != restored.GetResults()) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+        if (network.GetFingerprint() != restored.GetFingerprint()) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+        
+        // Test a batch gives the same results as feeding each dataset alone
+        unsigned int numberOfInputs  = topologies[t][0];
+        unsigned int numberOfOutputs = network.GetNumberOfOutputs();
+        unsigned int batchSize = 75;
+        
+        std::vector<float> batchInputs(batchSize * numberOfInputs);
+        std::vector<float> batchOutputs(batchSize * numberOfOutputs);
+        for (unsigned int i=0; i < batchInputs.size(); i++) 
+            batchInputs[i] = random.Range(-1.0f, 1.0f);
+        
+        network.FeedForwardBatch(batchInputs.data(), numberOfInputs, batchOutputs.data(), batchSize);
+        
+        for (unsigned int b=0; b < batchSize; b++) {
+            network.FeedForward(&batchInputs[b * numberOfInputs], numberOfInputs, output.data());
+            for (unsigned int n=0; n < numberOfOutputs; n++) 
+                if (std::fabs(output[n] - batchOutputs[b * numberOfOutputs + n]) > tolerance) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+        }
+        
+        // Test different networks give different fingerprints
+        if (network.GetFingerprint() == previousFingerprint) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+        previousFingerprint = network.GetFingerprint();
+    }
+    
+    // Test the activation across its range including the clamped tails
+    std::vector<std::string> identityState;
+    identityState.push_back("1 1 1 1 1 0 1 ");
+    identityState.push_back("1 1 1 1 1 0 1 ");
+    
+    NeuralNetwork identity;
+    identity.LoadState(identityState);
+    
+    for (float x = -12.0f; x <= 12.0f; x += 0.01f) {
+        std::vector<float> input(1, x);
+        identity.FeedForward(input);
+        if (std::fabs(identity.GetResults()[0] - tanh(x)) > tolerance) Throw(msgFailedNeuralNetwork, __FILE__, __LINE__);
+    }
+    
+    return;
+}
@@ -0,0 +1,275 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <sstream>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/NeuralNetwork.h>
+#include <GameEngineFramework/Math/Random.h>
+
+
+// Build a network state with small positive weights as AddNeuralLayer does
+static std::vector<std::string> CreateTrainingState(const std::vector<unsigned int>& topology, RandomStream& random) {
+    std::vector<std::string> state;
+    
+    for (unsigned int i=0; i < topology.size(); i++) {
+        unsigned int numberOfNeurons = topology[i];
+        unsigned int numberOfInputs  = (i == 0) ? 1 : topology[i - 1];
+        
+        std::string layerString = std::to_string(numberOfInputs) + " " + std::to_string(numberOfNeurons) + " " +
+                                  std::to_string(numberOfNeurons) + " " + std::to_string(numberOfNeurons) + " " +
+                                  std::to_string(numberOfNeurons) + " ";
+        
+        for (unsigned int b=0; b < numberOfNeurons; b++)
+            layerString += "0 ";
+        
+        for (unsigned int w=0; w < numberOfNeurons * numberOfInputs; w++)
+            layerString += std::to_string(random.Range(0, 100) * 0.0025f) + " ";
+        
+        state.push_back(layerString);
+    }
+    
+    return state;
+}
+
+// Per-sample reference copied from the nested vector network that
+// trained one set at a time before the scratch buffers
+struct ReferenceLayer {
+    
+    std::vector<float> neurons;
+    std::vector<float> biases;
+    std::vector<std::vector<float>> weights;
+    
+};
+
+static std::vector<ReferenceLayer> LoadReferenceState(const std::vector<std::string>& state) {
+    std::vector<ReferenceLayer> layers;
+    
+    for (unsigned int i=0; i < state.size(); i++) {
+        std::istringstream stream(state[i]);
+        
+        unsigned int numberOfInputs, numberOfNeurons, numberOfValues, numberOfBiases, numberOfWeightLists;
+        stream >> numberOfInputs >> numberOfNeurons >> numberOfValues >> numberOfBiases >> numberOfWeightLists;
+        
+        ReferenceLayer layer;
+        layer.neurons.resize(numberOfValues);
+        layer.biases.resize(numberOfBiases);
+        layer.weights.resize(numberOfWeightLists, std::vector<float>(numberOfInputs));
+        
+        for (unsigned int b=0; b < numberOfBiases; b++)
+            stream >> layer.biases[b];
+        
+        for (unsigned int ws=0; ws < numberOfWeightLists; ws++)
+            for (unsigned int w=0; w < numberOfInputs; w++)
+                stream >> layer.weights[ws][w];
+        
+        layers.push_back(layer);
+    }
+    
+    return layers;
+}
+
+static void ReferenceFeedForward(std::vector<ReferenceLayer>& layers, const std::vector<float>& input) {
+    layers[0].neurons = input;
+    
+    for (size_t i = 1; i < layers.size(); ++i) {
+        ReferenceLayer& previousLayer = layers[i - 1];
+        ReferenceLayer& currentLayer = layers[i];
+        
+        for (size_t j = 0; j < currentLayer.neurons.size(); ++j) {
+            float sum = currentLayer.biases[j];
+            
+            for (size_t k = 0; k < previousLayer.neurons.size(); ++k)
+                sum += previousLayer.neurons[k] * currentLayer.weights[j][k];
+            
+            currentLayer.neurons[j] = tanh(sum);
+        }
+    }
+    
+    return;
+}
+
+// Average the per-sample gradients over the sets then apply them once
+static void ReferenceTrainBatch(std::vector<ReferenceLayer>& layers, const TrainingSet* trainingSets, unsigned int numberOfSets, float learningRate) {
+    std::vector<std::vector<float>> biasGradients(layers.size());
+    std::vector<std::vector<std::vector<float>>> weightGradients(layers.size());
+    
+    for (size_t i = 0; i < layers.size(); ++i) {
+        biasGradients[i].assign(layers[i].biases.size(), 0.0f);
+        weightGradients[i].assign(layers[i].weights.size(), std::vector<float>(layers[i].weights[0].size(), 0.0f));
+    }
+    
+    for (unsigned int s=0; s < numberOfSets; s++) {
+        ReferenceFeedForward(layers, trainingSets[s].input);
+        
+        // Output and hidden layer deltas
+        std::vector<std::vector<float>> deltas(layers.size());
+        ReferenceLayer& outputLayer = layers.back();
+        deltas.back().resize(outputLayer.neurons.size());
+        
+        for (size_t i = 0; i < outputLayer.neurons.size(); ++i) {
+            float error = trainingSets[s].target[i] - outputLayer.neurons[i];
+            deltas.back()[i] = error * (outputLayer.neurons[i] > 0 ? 1.0f : 0.0f);
+        }
+        
+        for (int i = layers.size() - 2; i >= 0; --i) {
+            deltas[i].resize(layers[i].neurons.size());
+            
+            for (size_t j = 0; j < layers[i].neurons.size(); ++j) {
+                float error = 0.0f;
+                
+                for (size_t k = 0; k < layers[i + 1].neurons.size(); ++k)
+                    error += layers[i + 1].weights[k][j] * deltas[i + 1][k];
+                
+                deltas[i][j] = error * (layers[i].neurons[j] > 0 ? 1.0f : 0.0f);
+            }
+        }
+        
+        // Gradients
+        std::vector<float> previousLayerOutputs = trainingSets[s].input;
+        
+        for (size_t i = 0; i < layers.size(); ++i) {
+            for (size_t j = 0; j < layers[i].neurons.size(); ++j) {
+                biasGradients[i][j] += deltas[i][j];
+                
+                for (size_t k = 0; k < previousLayerOutputs.size(); ++k)
+                    weightGradients[i][j][k] += deltas[i][j] * previousLayerOutputs[k];
+            }
+            
+            previousLayerOutputs = layers[i].neurons;
+        }
+    }
+    
+    float rate = learningRate / numberOfSets;
+    
+    for (size_t i = 0; i < layers.size(); ++i) {
+        for (size_t j = 0; j < layers[i].biases.size(); ++j) {
+            layers[i].biases[j] += rate * biasGradients[i][j];
+            
+            for (size_t k = 0; k < layers[i].weights[j].size(); ++k)
+                layers[i].weights[j][k] += rate * weightGradients[i][j][k];
+        }
+    }
+    
+    return;
+}
+
+// Check the network gives the reference results for every training input
+static bool CompareWithReference(NeuralNetwork& network, std::vector<ReferenceLayer>& layers, std::vector<TrainingSet>& trainingBook) {
+    
+    for (unsigned int i=0; i < trainingBook.size(); i++) {
+        network.FeedForward(trainingBook[i].input);
+        ReferenceFeedForward(layers, trainingBook[i].input);
+        
+        if (std::fabs(network.GetResults()[0] - layers.back().neurons[0]) > 0.0001f) 
+            return false;
+    }
+    
+    return true;
+}
+
+static float CalculateTrainingError(NeuralNetwork& network, std::vector<TrainingSet>& trainingBook) {
+    float error = 0.0f;
+    
+    for (unsigned int i=0; i < trainingBook.size(); i++) {
+        network.FeedForward(trainingBook[i].input);
+        
+        float difference = network.GetResults()[0] - trainingBook[i].target[0];
+        error += difference * difference;
+    }
+    
+    return error / trainingBook.size();
+}
+
+
+void TestFramework::TestNeuralTraining(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Neural training......... ";
+    
+    // Fixed dataset from the run script
+    std::vector<TrainingSet> trainingBook(3);
+    
+    trainingBook[0].input  = {0.87f};
+    trainingBook[0].target = {0.25f};
+    trainingBook[1].input  = {0.4f};
+    trainingBook[1].target = {0.2f};
+    trainingBook[2].input  = {0.3f};
+    trainingBook[2].target = {0.3f};
+    
+    RandomStream random(1337);
+    std::vector<std::string> state = CreateTrainingState({16, 16, 16, 1}, random);
+    
+    // Test single set training converges
+    NeuralNetwork network;
+    network.LoadState(state);
+    
+    float initialError = CalculateTrainingError(network, trainingBook);
+    
+    for (unsigned int epoch=0; epoch < 2000; epoch++)
+        for (unsigned int i=0; i < trainingBook.size(); i++)
+            network.Train(trainingBook[i], 0.07f);
+    
+    float trainedError = CalculateTrainingError(network, trainingBook);
+    
+    if (trainedError > 0.0025f) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    if (trainedError > initialError * 0.1f) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    // Test mini-batch training converges
+    NeuralNetwork batchNetwork;
+    batchNetwork.LoadState(state);
+    
+    for (unsigned int epoch=0; epoch < 2000; epoch++)
+        batchNetwork.TrainBatch(trainingBook.data(), trainingBook.size(), 0.2f);
+    
+    if (CalculateTrainingError(batchNetwork, trainingBook) > 0.0025f) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    // Test single set training against the per-sample reference
+    NeuralNetwork single;
+    single.LoadState(state);
+    
+    std::vector<ReferenceLayer> singleReference = LoadReferenceState(state);
+    
+    for (unsigned int step=0; step < 20; step++) {
+        single.Train(trainingBook[step % trainingBook.size()], 0.07f);
+        ReferenceTrainBatch(singleReference, &trainingBook[step % trainingBook.size()], 1, 0.07f);
+    }
+    
+    if (!CompareWithReference(single, singleReference, trainingBook)) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    // Test mini-batch training against the reference averaged over the batch
+    NeuralNetwork batchCheck;
+    batchCheck.LoadState(state);
+    
+    std::vector<ReferenceLayer> batchReference = LoadReferenceState(state);
+    
+    for (unsigned int step=0; step < 20; step++) {
+        batchCheck.TrainBatch(trainingBook.data(), trainingBook.size(), 0.2f);
+        ReferenceTrainBatch(batchReference, trainingBook.data(), trainingBook.size(), 0.2f);
+    }
+    
+    if (!CompareWithReference(batchCheck, batchReference, trainingBook)) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    // Test training changes the fingerprint
+    if (single.GetFingerprint() == network.GetFingerprint()) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    // Test training steps do not allocate once the scratch buffers exist
+    unsigned long long int numberOfAllocations = NeuralGetAllocationCount();
+    std::size_t networkCapacity = network.GetBufferCapacity();
+    std::size_t batchCapacity   = batchNetwork.GetBufferCapacity();
+    
+    for (unsigned int epoch=0; epoch < 100; epoch++) {
+        
+        for (unsigned int i=0; i < trainingBook.size(); i++)
+            network.Train(trainingBook[i], 0.07f);
+        
+        batchNetwork.TrainBatch(trainingBook.data(), trainingBook.size(), 0.2f);
+    }
+    
+    if (NeuralGetAllocationCount() != numberOfAllocations) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    if (network.GetBufferCapacity() != networkCapacity)    Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    if (batchNetwork.GetBufferCapacity() != batchCapacity) Throw(msgFailedNeuralTraining, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/plugins.h>
+
+
+void TestFramework::TestParticleInstancing(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Particle instancing..... ";
+    
+    // Emitters keep their particles in separate arrays and spawn one per update
+    unsigned int numberOfBatches = Renderer.GetNumberOfParticleBatches();
+    
+    Emitter* emitter = Particle.CreateEmitter();
+    if (emitter == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    if (Renderer.GetNumberOfParticleBatches() != numberOfBatches + 1) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    emitter->type = EmitterType::Point;
+    emitter->position = glm::vec3(0.0f, 5000.0f, 0.0f);
+    emitter->direction = glm::vec3(0.0f, 1.0f, 0.0f);
+    emitter->spawnRate = 0;
+    emitter->maxParticles = 8;
+    emitter->lifetime = 4;
+    
+    // The first particle moves away from the emitter as it ages
+    Particle.Update();
+    
+    glm::vec3 firstPosition = emitter->GetParticlePosition(0);
+    
+    if (emitter->GetParticleLife(0) != 1.0f) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    if (firstPosition.y <= emitter->position.y) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    // Particles past their lifetime are reset back to the emitter
+    for (unsigned int i=0; i < emitter->lifetime; i++)
+        Particle.Update();
+    
+    if (emitter->GetNumberOfParticles() != 5) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    if (emitter->GetParticleLife(0) != 0.0f) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    if (emitter->GetParticlePosition(0) != emitter->position) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    // Respawned rather than added
+    for (unsigned int i=0; i < 20; i++)
+        Particle.Update();
+    
+    if (emitter->GetNumberOfParticles() != emitter->maxParticles) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    Particle.DestroyEmitter(emitter);
+    
+    if (Renderer.GetNumberOfParticleBatches() != numberOfBatches) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    // A batch draws every particle in one call, also after its buffer grows
+    ParticleBatch* batch = Renderer.CreateParticleBatch();
+    if (batch == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    Material* batchMaterial = Renderer.CreateMaterial();
+    batchMaterial->shader = Renderer.shaders.particle;
+    
+    batch->mesh     = Renderer.meshes.cube;
+    batch->material = batchMaterial;
+    
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> scales;
+    std::vector<glm::vec3> colors;
+    
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    scenePtr->AddParticleBatchToScene(batch);
+    
+    IsolateScene(scenePtr);
+    
+    const unsigned int particleCounts[] = {16, 500};
+    
+    for (unsigned int c=0; c < 2; c++) {
+        
+        positions.resize(particleCounts[c], glm::vec3(0.0f, 0.0f, 10.0f));
+        scales.resize(particleCounts[c], glm::vec3(1.0f));
+        colors.resize(particleCounts[c], glm::vec3(1.0f));
+        
+        batch->SetParticles(positions.data(), scales.data(), colors.data(), particleCounts[c]);
+        
+        if (batch->GetNumberOfParticles() != particleCounts[c]) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+        
+        Renderer.RenderFrame();
+        
+        if (Renderer.GetNumberOfDrawCalls() != 1) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    }
+    
+    // An inactive batch is not drawn
+    batch->isActive = false;
+    
+    Renderer.RenderFrame();
+    
+    if (Renderer.GetNumberOfDrawCalls() != 0) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    RestoreScenes();
+    
+    if (!scenePtr->RemoveParticleBatchFromScene(batch)) Throw(msgFailedParticleInstancing, __FILE__, __LINE__);
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    Renderer.DestroyMaterial(batchMaterial);
+    
+    if (!Renderer.DestroyParticleBatch(batch)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+
+
+void TestFramework::TestPerlinBatch(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Perlin batch............ ";
+    
+    // Odd count so the scalar tail is covered
+    const unsigned int numberOfSamples = 10007;
+    
+    std::vector<float> xCoord(numberOfSamples);
+    std::vector<float> yCoord(numberOfSamples);
+    std::vector<float> zCoord(numberOfSamples);
+    std::vector<float> batch(numberOfSamples);
+    std::vector<float> reference(numberOfSamples);
+    
+    RandomStream stream(321);
+    stream.Fill(xCoord.data(), numberOfSamples, -500.0f, 500.0f);
+    stream.Fill(yCoord.data(), numberOfSamples, -4.0f, 4.0f);
+    stream.Fill(zCoord.data(), numberOfSamples, -500.0f, 500.0f);
+    
+    // Whole numbers and cell edges
+    for (unsigned int i=0; i < 512; i++) {
+        xCoord[i] = (float)i - 256.0f;
+        yCoord[i] = 0.0f;
+        zCoord[i] = (float)i * 0.25f;
+    }
+    
+    int seeds[] = {0, 1, 100, 255, 256, -7, 12345};
+    
+    for (unsigned int s=0; s < sizeof(seeds) / sizeof(int); s++) {
+        
+        Random.PerlinBatch(xCoord.data(), yCoord.data(), zCoord.data(), batch.data(), numberOfSamples, seeds[s]);
+        
+        for (unsigned int i=0; i < numberOfSamples; i++)
+            reference[i] = Random.Perlin(xCoord[i], yCoord[i], zCoord[i], seeds[s]);
+        
+        if (memcmp(batch.data(), reference.data(), numberOfSamples * sizeof(float)) != 0)
+            Throw(msgFailedPerlinBatch, __FILE__, __LINE__);
+    }
+    
+    // Test the height field matches per sample evaluation
+    const unsigned int fieldSize = 51;
+    const float noiseWidth  = 0.07f;
+    const float noiseHeight = 0.05f;
+    const float noiseMul    = 40.0f;
+    
+    std::vector<float> heightField(fieldSize * fieldSize, 0.0f);
+    std::vector<float> heightReference(fieldSize * fieldSize, 0.0f);
+    
+    Engine.AddHeightFieldFromPerlinNoise(heightField.data(), fieldSize, fieldSize, noiseWidth, noiseHeight, noiseMul, -150, 200, 100);
+    
+    for (unsigned int i=0; i < fieldSize * fieldSize; i++) {
+        float x = ((float)(i % fieldSize) + -150) * noiseWidth;
+        float z = ((float)(i / fieldSize) + 200) * noiseHeight;
+        
+        float noise = Random.Perlin(x, 0, z, 100) * noiseMul;
+        
+        heightReference[i] += Math.Round((noise * 10.0)) * 0.1;
+    }
+    
+    if (memcmp(heightField.data(), heightReference.data(), heightField.size() * sizeof(float)) != 0)
+        Throw(msgFailedPerlinBatch, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+
+#include "../framework.h"
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+
+struct PoolTestType {
+    int    valueA;
+    float  valueB;
+    PoolTestType() : valueA(100), valueB(200.0f) {}
+};
+
+
+void TestFramework::TestPoolAllocator(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Pool allocator.......... ";
+    
+    PoolAllocator<PoolTestType> pool(8, 1);
+    
+    // Test create past the initial pool
+    std::vector<PoolTestType*> objects;
+    for (unsigned int i=0; i < 20; i++)
+        objects.push_back( pool.Create() );
+    
+    if (objects[0] == nullptr)         Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (objects[0]->valueA != 100)     Throw(msgFailedConstructor, __FILE__, __LINE__);
+    if (pool.Size() != 20)             Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (pool.GetObjectCount() != 20)   Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (pool.GetFreeCount() != 4)      Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Test handles
+    PoolHandle handle = pool.GetHandle(objects[5]);
+    if (handle.IsNull())                      Throw(msgFailedNullptr, __FILE__, __LINE__);
+    if (pool.Resolve(handle) != objects[5])   Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Test destroy
+    if (!pool.Destroy(objects[5]))     Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.Destroy(objects[5]))      Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.Destroy(nullptr))         Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.Size() != 19)             Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.GetFreeCount() != 5)      Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Foreign pointers should be rejected without touching either pool
+    PoolAllocator<PoolTestType> otherPool(8, 1);
+    PoolTestType* foreign = otherPool.Create();
+    PoolTestType local;
+    PoolTestType* interior = reinterpret_cast<PoolTestType*>( reinterpret_cast<char*>(objects[6]) + 1 );
+    
+    if (pool.Destroy(foreign))                Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.Destroy(&local))                 Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (pool.Destroy(interior))               Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (!pool.GetHandle(foreign).IsNull())    Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (pool.Size() != 19)                    Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (otherPool.Size() != 1)                Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (!otherPool.Destroy(foreign))          Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Stale handles should no longer resolve after the slot is reused
+    PoolTestType* reused = pool.Create();
+    if (reused != objects[5])          Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (pool.IsValid(handle))          Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (pool.Resolve(handle) != nullptr) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Active list should contain every live object exactly once
+    objects[5] = reused;
+    for (unsigned int i=0; i < objects.size(); i++) {
+        unsigned int found = 0;
+        for (unsigned int a=0; a < pool.Size(); a++)
+            if (pool[a] == objects[i]) found++;
+        if (found != 1) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    }
+    
+    // Destroy everything
+    for (unsigned int i=0; i < objects.size(); i++)
+        pool.Destroy(objects[i]);
+    
+    if (pool.Size() != 0)              Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    if (pool.GetFreeCount() != 24)     Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Owner lookup across many pools
+    PoolAllocator<PoolTestType> widePool(4, 1);
+    
+    std::vector<PoolTestType*> wideObjects;
+    for (unsigned int i=0; i < 4 * 512; i++)
+        wideObjects.push_back( widePool.Create() );
+    
+    PoolTestType* firstPtr = wideObjects.front();
+    PoolTestType* lastPtr  = wideObjects.back();
+    
+    PoolHandle lastHandle = widePool.GetHandle(lastPtr);
+    if (lastHandle.IsNull())                          Throw(msgFailedNullptr, __FILE__, __LINE__);
+    if (lastHandle.GetIndex() != 4 * 512 - 1)         Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (widePool.Resolve(lastHandle) != lastPtr)      Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (widePool.GetHandle(firstPtr).GetIndex() != 0) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    if (widePool.Destroy(foreign))                    Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (widePool.Destroy(&local))                     Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    if (!widePool.Destroy(lastPtr))                   Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (widePool.Destroy(lastPtr))                    Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (widePool.IsValid(lastHandle))                 Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!widePool.Destroy(firstPtr))                  Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (widePool.Size() != 4 * 512 - 2)               Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    return;
+}
+
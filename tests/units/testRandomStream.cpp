@@ -0,0 +1,200 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/ChunkManager.h>
+
+extern PhysicsSystem Physics;
+
+
+void TestFramework::TestRandomStream(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Random stream........... ";
+    
+    // Test the same seed gives the same sequence
+    RandomStream streamA(1234);
+    RandomStream streamB(1234);
+    RandomStream streamC(1235);
+    
+    unsigned int numberOfMatches = 0;
+    for (unsigned int i=0; i < 1000; i++) {
+        uint32_t value = streamA.Next();
+        if (value != streamB.Next()) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+        if (value == streamC.Next()) numberOfMatches++;
+    }
+    
+    if (numberOfMatches > 2) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    
+    // Test reseeding restarts the sequence
+    streamA.SetSeed(1234);
+    streamB.SetSeed(1234);
+    if (streamA.GetSeed() != 1234) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Test other streams and the C library generator do not disturb a stream
+    std::vector<int> expected(256);
+    for (unsigned int i=0; i < expected.size(); i++)
+        expected[i] = streamA.Range(0, 100);
+    
+    srand(42);
+    for (unsigned int i=0; i < expected.size(); i++) {
+        rand();
+        streamC.Next();
+        if (streamB.Range(0, 100) != expected[i]) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    }
+    
+    // Test ranges stay within bounds
+    RandomStream stream(99);
+    for (unsigned int i=0; i < 10000; i++) {
+        int valueInt = stream.Range(5, 10);
+        if (valueInt < 5 || valueInt >= 15) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+        
+        float valueFloat = stream.Range(0.0f, 3.0f);
+        if (valueFloat < 0.0f || valueFloat >= 3.0f) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    }
+    
+    // Test batch fills continue the same sequence
+    std::vector<uint32_t> batch(100);
+    streamA.SetSeed(7);
+    streamB.SetSeed(7);
+    streamA.Fill(batch.data(), batch.size());
+    for (unsigned int i=0; i < batch.size(); i++)
+        if (batch[i] != streamB.Next()) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    
+    std::vector<float> batchFloat(1000);
+    streamA.Fill(batchFloat.data(), batchFloat.size(), -2.0f, 2.0f);
+    for (unsigned int i=0; i < batchFloat.size(); i++)
+        if (batchFloat[i] < -2.0f || batchFloat[i] >= 2.0f) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    
+    // Test perlin uses the stream seed
+    if (streamA.Perlin(0.3f, 0.0f, 0.7f) != Random.Perlin(0.3f, 0.0f, 0.7f, 7)) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    
+    // Test chunks come out the same regardless of generation order
+    ChunkGenerator generator;
+    generator.chunkSize = 16;
+    generator.worldSeed = 500;
+    
+    Perlin layer;
+    layer.heightMultuplier = 60.0f;
+    layer.noiseWidth  = 0.01f;
+    layer.noiseHeight = 0.01f;
+    generator.perlin.push_back(layer);
+    
+    const unsigned int numberOfChunks = 16;
+    std::vector<ChunkBuildData> forward(numberOfChunks);
+    std::vector<ChunkBuildData> reverse(numberOfChunks);
+    
+    for (unsigned int i=0; i < numberOfChunks; i++)
+        generator.Build(forward[i], (float)i * 16, (float)(i % 4) * 16);
+    
+    for (int i=numberOfChunks - 1; i >= 0; i--) {
+        Random.Range(0, 100);
+        generator.Build(reverse[i], (float)i * 16, (float)(i % 4) * 16);
+    }
+    
+    for (unsigned int i=0; i < numberOfChunks; i++) {
+        if (forward[i].colorField.size() != reverse[i].colorField.size())
+            Throw(msgFailedRandomStream, __FILE__, __LINE__);
+        if (memcmp(forward[i].colorField.data(), reverse[i].colorField.data(), forward[i].colorField.size() * sizeof(glm::vec3)) != 0)
+            Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    }
+    
+    // Test decoration placements do not depend on the decoration order
+    ChunkManager managerForward;
+    ChunkManager managerReverse;
+    
+    ChunkManager* managers[2] = {&managerForward, &managerReverse};
+    
+    for (unsigned int m=0; m < 2; m++) {
+        
+        managers[m]->chunkSize = 16;
+        managers[m]->worldSeed = 500;
+        managers[m]->perlin.push_back(layer);
+        
+        DecorationSpecifier decorGrass;
+        decorGrass.type = DECORATION_GRASS;
+        decorGrass.density = 80;
+        decorGrass.spawnHeightMinimum = -100;
+        decorGrass.threshold = -1.0f;
+        
+        DecorationSpecifier decorTrees;
+        decorTrees.type = DECORATION_TREE;
+        decorTrees.density = 10;
+        decorTrees.spawnHeightMinimum = -100;
+        decorTrees.threshold = 0.0f;
+        decorTrees.noise = 0.3f;
+        
+        managers[m]->world.staticHeightCutoff = 1000.0f;
+        managers[m]->world.mDecorations.push_back(decorGrass);
+        managers[m]->world.mDecorations.push_back(decorTrees);
+    }
+    
+    const unsigned int numberOfDecorChunks = 4;
+    std::vector<Chunk> decorForward(numberOfDecorChunks);
+    std::vector<Chunk> decorReverse(numberOfDecorChunks);
+    
+    std::vector<Chunk>* decorChunks[2] = {&decorForward, &decorReverse};
+    
+    for (unsigned int m=0; m < 2; m++) {
+        
+        ChunkManager* manager = managers[m];
+        std::vector<Chunk>& chunkList = *decorChunks[m];
+        
+        for (unsigned int i=0; i < numberOfDecorChunks; i++) {
+            
+            float x = (float)(i % 2) * manager->chunkSize;
+            float z = (float)(i / 2) * manager->chunkSize;
+            
+            chunkList[i] = manager->CreateChunk(x, z);
+            chunkList[i].seed = manager->worldSeed + ((x * 2) + (z * 4) / 2);
+        }
+        
+        // Decorate forward on the first manager and in reverse on the second
+        for (unsigned int i=0; i < numberOfDecorChunks; i++) {
+            
+            unsigned int index = (m == 0) ? i : (numberOfDecorChunks - 1 - i);
+            
+            Random.Range(0, 100);
+            
+            manager->Decorate(chunkList[index]);
+        }
+        
+        for (unsigned int i=0; i < numberOfDecorChunks; i++) 
+            manager->DestroyChunk(chunkList[i]);
+    }
+    
+    unsigned int numberOfStatics = 0;
+    
+    for (unsigned int i=0; i < numberOfDecorChunks; i++) {
+        
+        std::vector<StaticObject>& staticsA = decorForward[i].statics;
+        std::vector<StaticObject>& staticsB = decorReverse[i].statics;
+        
+        if (staticsA.size() != staticsB.size()) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+        
+        for (unsigned int s=0; s < staticsA.size(); s++) {
+            
+            if (staticsA[s].type != staticsB[s].type) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+            
+            if ((staticsA[s].x != staticsB[s].x) | 
+                (staticsA[s].y != staticsB[s].y) | 
+                (staticsA[s].z != staticsB[s].z)) 
+                Throw(msgFailedRandomStream, __FILE__, __LINE__);
+            
+            if ((staticsA[s].r != staticsB[s].r) | 
+                (staticsA[s].g != staticsB[s].g) | 
+                (staticsA[s].b != staticsB[s].b)) 
+                Throw(msgFailedRandomStream, __FILE__, __LINE__);
+        }
+        
+        numberOfStatics += staticsA.size();
+    }
+    
+    // The chunks must have been decorated for the comparison to mean anything
+    if (numberOfStatics == 0) Throw(msgFailedRandomStream, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+
+extern PhysicsSystem Physics;
+
+// Hits agree when they are the same point on the same collider
+static bool CompareHit(const Hit& hit, const Hit& expected) {
+    
+    if (hit.point != expected.point) return false;
+    if (hit.normal != expected.normal) return false;
+    
+    return hit.collider == expected.collider;
+}
+
+
+void TestFramework::TestRaycastBatch(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Raycast batch........... ";
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    const unsigned int fieldSize = 33;
+    const int tilesPerSide = 3;
+    const float tileSize = (float)(fieldSize - 1);
+    
+    RandomStream random(23);
+    
+    std::vector<float> heightField(fieldSize * fieldSize);
+    std::vector<MeshCollider*> meshColliders;
+    
+    // Ground tiles laid out as chunks
+    for (int x=0; x < tilesPerSide; x++) {
+        
+        for (int z=0; z < tilesPerSide; z++) {
+            
+            random.Fill(heightField.data(), heightField.size(), -10.0f, 10.0f);
+            
+            MeshCollider* meshCollider = Physics.CreateHeightFieldMap(heightField.data(), fieldSize, fieldSize, 1, 1, 1);
+            
+            rp3d::Transform bodyTransform = rp3d::Transform::identity();
+            bodyTransform.setPosition( rp3d::Vector3(x * tileSize, 0, z * tileSize) );
+            
+            rp3d::RigidBody* rigidBody = Physics.world->createRigidBody( bodyTransform );
+            rigidBody->setType(rp3d::BodyType::STATIC);
+            
+            rp3d::Collider* bodyCollider = rigidBody->addCollider( meshCollider->heightFieldShape, rp3d::Transform::identity() );
+            bodyCollider->setCollisionCategoryBits((unsigned short)LayerMask::Ground);
+            
+            meshColliders.push_back(meshCollider);
+        }
+    }
+    
+    // Boxes standing in for actors
+    rp3d::BoxShape* boxShape = Physics.CreateColliderBox(1.0f, 2.0f, 1.0f);
+    
+    for (unsigned int i=0; i < 64; i++) {
+        
+        rp3d::Transform bodyTransform = rp3d::Transform::identity();
+        bodyTransform.setPosition( rp3d::Vector3(random.Range(0.0f, tileSize * 2), 15.0f, random.Range(0.0f, tileSize * 2)) );
+        
+        rp3d::RigidBody* rigidBody = Physics.world->createRigidBody( bodyTransform );
+        rigidBody->setType(rp3d::BodyType::STATIC);
+        
+        rp3d::Collider* bodyCollider = rigidBody->addCollider( boxShape, rp3d::Transform::identity() );
+        bodyCollider->setCollisionCategoryBits((unsigned short)LayerMask::Actor);
+    }
+    
+    // Mixed rays across both layers
+    const unsigned int numberOfRays = 4000;
+    
+    std::vector<RaycastQuery> queries(numberOfRays);
+    
+    for (unsigned int i=0; i < numberOfRays; i++) {
+        
+        queries[i].from      = glm::vec3(random.Range(0.0f, tileSize * 2), 30.0f, random.Range(0.0f, tileSize * 2));
+        queries[i].direction = glm::vec3(random.Range(-1.0f, 1.0f), -1.0f, random.Range(-1.0f, 1.0f));
+        queries[i].distance  = 100.0f;
+        queries[i].layer     = (i % 2 == 0) ? LayerMask::Ground : LayerMask::Actor;
+    }
+    
+    // Expected results cast one at a time
+    std::vector<Hit> expected(numberOfRays);
+    std::vector<uint8_t> isExpected(numberOfRays);
+    unsigned int numberOfExpected = 0;
+    
+    for (unsigned int i=0; i < numberOfRays; i++) {
+        isExpected[i] = Physics.Raycast(queries[i].from, queries[i].direction, queries[i].distance, expected[i], queries[i].layer);
+        numberOfExpected += isExpected[i];
+    }
+    
+    if (numberOfExpected == 0) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+    
+    // Test the batch against the single casts
+    std::vector<Hit> hits(numberOfRays);
+    std::vector<uint8_t> isHit(numberOfRays);
+    
+    if (Physics.RaycastBatch(queries.data(), numberOfRays, hits.data(), isHit.data()) != numberOfExpected) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < numberOfRays; i++) {
+        
+        if (isHit[i] != isExpected[i]) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+        
+        if ((isHit[i]) && (!CompareHit(hits[i], expected[i]))) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+    }
+    
+    if (Physics.RaycastBatch(queries.data(), 0, hits.data(), isHit.data()) != 0) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+    
+    // Test many threads casting single rays and batches at once
+    const unsigned int numberOfCallers = 8;
+    std::atomic<unsigned int> mismatches(0);
+    
+    std::vector<std::thread*> callers;
+    for (unsigned int c=0; c < numberOfCallers; c++) {
+        callers.push_back( new std::thread([&, c]() {
+            
+            std::vector<Hit> callerHits(numberOfRays);
+            std::vector<uint8_t> callerIsHit(numberOfRays);
+            
+            // Half the callers cast one ray at a time
+            if (c % 2 == 0) {
+                for (unsigned int i=0; i < numberOfRays; i++)
+                    callerIsHit[i] = Physics.Raycast(queries[i].from, queries[i].direction, queries[i].distance, callerHits[i], queries[i].layer);
+            } else {
+                Physics.RaycastBatch(queries.data(), numberOfRays, callerHits.data(), callerIsHit.data());
+            }
+            
+            for (unsigned int i=0; i < numberOfRays; i++) {
+                if (callerIsHit[i] != isExpected[i]) {mismatches++; continue;}
+                if ((callerIsHit[i]) && (!CompareHit(callerHits[i], expected[i]))) mismatches++;
+            }
+        }) );
+    }
+    
+    for (unsigned int c=0; c < numberOfCallers; c++) {
+        callers[c]->join();
+        delete callers[c];
+    }
+    
+    if (mismatches.load() != 0) Throw(msgFailedRaycastBatch, __FILE__, __LINE__);
+    
+    // Clear the physics world
+    Physics.common.destroyPhysicsWorld(Physics.world);
+    Physics.world = Physics.common.createPhysicsWorld();
+    
+    for (unsigned int i=0; i < meshColliders.size(); i++)
+        Physics.DestroyHeightFieldMap( meshColliders[i] );
+    
+    return;
+}
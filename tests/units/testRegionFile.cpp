@@ -0,0 +1,164 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+#include "../framework.h"
+#include <GameEngineFramework/Plugins/ChunkSpawner/RegionFile.h>
+
+
+static ChunkRecord CreateTestChunkRecord(unsigned int numberOfActors, unsigned int numberOfStatics) {
+    ChunkRecord record;
+    
+    for (unsigned int a=0; a < numberOfActors; a++) {
+        ChunkActorRecord actor;
+        actor.position = glm::vec3(a * 1.5f, -20.25f, a * -3.0f);
+        actor.age = 1099511627776ULL + a;
+        actor.genome = "0.25,0.5,0.75|1.0,0.125#" + std::to_string(a);
+        record.actors.push_back(actor);
+    }
+    
+    for (unsigned int s=0; s < numberOfStatics; s++) {
+        ChunkStaticRecord staticRecord;
+        staticRecord.position = glm::vec3(s % 50, s * 0.01f, s / 50);
+        staticRecord.color = glm::vec3(0.1f, 0.4f + (s % 3) * 0.1f, 0.2f);
+        staticRecord.type = s % 5;
+        record.statics.push_back(staticRecord);
+    }
+    
+    return record;
+}
+
+static bool CompareChunkRecords(ChunkRecord& recordA, ChunkRecord& recordB) {
+    if (recordA.actors.size() != recordB.actors.size()) return false;
+    if (recordA.statics.size() != recordB.statics.size()) return false;
+    
+    for (unsigned int a=0; a < recordA.actors.size(); a++) {
+        if (recordA.actors[a].position != recordB.actors[a].position) return false;
+        if (recordA.actors[a].age != recordB.actors[a].age) return false;
+        if (recordA.actors[a].genome != recordB.actors[a].genome) return false;
+    }
+    
+    for (unsigned int s=0; s < recordA.statics.size(); s++) {
+        if (recordA.statics[s].position != recordB.statics[s].position) return false;
+        if (recordA.statics[s].color != recordB.statics[s].color) return false;
+        if (recordA.statics[s].type != recordB.statics[s].type) return false;
+    }
+    
+    return true;
+}
+
+
+void TestFramework::TestRegionFile(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Region file............. ";
+    
+    // Test record encoding round trip
+    ChunkRecord record = CreateTestChunkRecord(5, 400);
+    
+    std::vector<uint8_t> buffer;
+    record.Encode(buffer);
+    
+    ChunkRecord decoded;
+    if (!decoded.Decode(buffer.data(), buffer.size())) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    if (!CompareChunkRecords(record, decoded)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    // Test truncated records are rejected
+    if (decoded.Decode(buffer.data(), buffer.size() - 1)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    // Test compression round trip on record data and on data that does not compress
+    std::vector<uint8_t> noise(4096);
+    uint32_t state = 12345;
+    for (unsigned int i=0; i < noise.size(); i++) {
+        state = state * 1664525u + 1013904223u;
+        noise[i] = state >> 24;
+    }
+    
+    std::vector<uint8_t>* sources[] = {&buffer, &noise};
+    for (unsigned int i=0; i < 2; i++) {
+        std::vector<uint8_t>& source = *sources[i];
+        std::vector<uint8_t> compressed;
+        std::vector<uint8_t> restored(source.size());
+        
+        RegionCompress(source.data(), source.size(), compressed);
+        
+        if (!RegionDecompress(compressed.data(), compressed.size(), restored.data(), restored.size()))
+            Throw(msgFailedRegionFile, __FILE__, __LINE__);
+        if (restored != source) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+        
+        // Record data should shrink
+        if ((i == 0) & (compressed.size() >= source.size())) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    }
+    
+    // Test region coordinates round toward negative infinity
+    int regionX, regionZ;
+    RegionFile::GetRegionCoordinates(-1, REGION_GRID_SIZE, regionX, regionZ);
+    if ((regionX != -1) | (regionZ != 1)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    // Test writing a region and reading it back after reopening
+    const std::string regionName = "region_test.dat";
+    std::remove(regionName.c_str());
+    
+    RegionFile region;
+    if (!region.Open(regionName)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    for (int x=-REGION_GRID_SIZE; x < 0; x++) {
+        for (int z=-REGION_GRID_SIZE; z < 0; z++) {
+            ChunkRecord chunkRecord = CreateTestChunkRecord((-x) % 4, -z * 10);
+            chunkRecord.Encode(buffer);
+            if (!region.Write(x, z, buffer, (x & 1) != 0)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+        }
+    }
+    
+    // Grow one record so it moves past the end of the file
+    ChunkRecord grown = CreateTestChunkRecord(40, 1000);
+    grown.Encode(buffer);
+    if (!region.Write(-3, -7, buffer, false)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    region.Close();
+    
+    if (!region.Open(regionName)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    if (region.Contains(0, 0)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    for (int x=-REGION_GRID_SIZE; x < 0; x++) {
+        for (int z=-REGION_GRID_SIZE; z < 0; z++) {
+            ChunkRecord expected = ((x == -3) & (z == -7)) ? grown : CreateTestChunkRecord((-x) % 4, -z * 10);
+            
+            if (!region.Read(x, z, buffer)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+            if (!decoded.Decode(buffer.data(), buffer.size())) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+            if (!CompareChunkRecords(expected, decoded)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+        }
+    }
+    
+    region.Close();
+    std::remove(regionName.c_str());
+    
+    // Test records appended after reopening do not land in the spare
+    // capacity of the last record, which may still grow in place
+    std::vector<uint8_t> recordA(300, 0xaa);
+    std::vector<uint8_t> recordB(300, 0xbb);
+    
+    if (!region.Open(regionName)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    if (!region.Write(0, 0, recordA, false)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    region.Close();
+    
+    if (!region.Open(regionName)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    if (!region.Write(1, 0, recordB, false)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    recordA.resize(500, 0xcc);
+    if (!region.Write(0, 0, recordA, false)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    if (!region.Read(1, 0, buffer)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    if (buffer != recordB) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    if (!region.Read(0, 0, buffer)) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    if (buffer != recordA) Throw(msgFailedRegionFile, __FILE__, __LINE__);
+    
+    region.Close();
+    std::remove(regionName.c_str());
+    
+    return;
+}
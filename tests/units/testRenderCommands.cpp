@@ -0,0 +1,128 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+extern RenderSystem Renderer;
+
+
+void TestFramework::TestRenderCommands(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Render commands......... ";
+    
+    // A render system that was never initiated has no GL state of its own,
+    // recording through it must not need a context. Its segments are recorded
+    // on the calling thread as it has no recording workers.
+    RenderSystem* headless = new RenderSystem();
+    
+    Scene* scenePtr = headless->CreateScene();
+    scenePtr->camera = headless->CreateCamera();
+    
+    headless->AddSceneToRenderQueue(scenePtr);
+    
+    Material* sharedMaterial = headless->CreateMaterial();
+    sharedMaterial->isShared = true;
+    
+    const unsigned int numberOfRenderers = 8;
+    
+    std::vector<MeshRenderer*> renderers;
+    
+    // Added from the farthest to the nearest
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        MeshRenderer* renderer = headless->CreateMeshRenderer();
+        renderer->mesh     = Renderer.meshes.cube;
+        renderer->material = sharedMaterial;
+        renderer->DisableFrustumCulling();
+        
+        renderer->transform.position = glm::vec3(0.0f, 0.0f, 100.0f - i * 10.0f);
+        renderer->transform.UpdateMatrix();
+        
+        scenePtr->AddMeshRendererToSceneRoot(renderer, RENDER_QUEUE_GEOMETRY);
+        renderers.push_back(renderer);
+    }
+    
+    // Hidden renderers and renderers without a material are not recorded
+    renderers[2]->isActive = false;
+    renderers[4]->material = nullptr;
+    
+    // The farthest renderer switches to its lower detail mesh
+    renderers[0]->lods.push_back(Renderer.meshes.sphere);
+    renderers[0]->distance = 50.0f;
+    
+    MeshRenderer* overlay = headless->CreateMeshRenderer();
+    overlay->mesh     = Renderer.meshes.plain;
+    overlay->material = sharedMaterial;
+    overlay->DisableFrustumCulling();
+    
+    scenePtr->AddMeshRendererToSceneRoot(overlay, RENDER_QUEUE_OVERLAY);
+    
+    RenderCommandList commandList;
+    
+    // Recording twice reuses the segments of the last frame
+    for (unsigned int frame=0; frame < 2; frame++) {
+        
+        headless->RecordFrame(commandList);
+        
+        if (commandList.GetNumberOfScenes() != 1)                     Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+        if (commandList.GetNumberOfSegments() != 2)                   Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+        if (commandList.GetNumberOfCommands() != numberOfRenderers - 1) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    }
+    
+    // Segments follow the render queue order
+    RenderCommandSegment* geometry = commandList.GetSegment(0);
+    RenderCommandSegment* overlays = commandList.GetSegment(1);
+    
+    if ((geometry->queueGroup != 3) | (overlays->queueGroup != 6)) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    
+    if (geometry->commands.size() != numberOfRenderers - 2) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    if (overlays->commands.size() != 1)                     Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    
+    // Opaque draws with the same state are sorted from the nearest out
+    float lastDistance = 0.0f;
+    
+    for (unsigned int i=0; i < geometry->commands.size(); i++) {
+        
+        RenderCommand& command = geometry->commands[i];
+        
+        if (command.type != RenderCommandType::DrawMesh) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+        if (command.objectIndex != i)                    Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+        
+        float distance = command.renderer->transform.position.z;
+        
+        if (distance < lastDistance) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+        
+        lastDistance = distance;
+        
+        Mesh* expectedMesh = (command.renderer == renderers[0]) ? Renderer.meshes.sphere : Renderer.meshes.cube;
+        
+        if (command.mesh != expectedMesh) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    }
+    
+    // Each draw carries its own object block
+    if (geometry->objectBlocks.size() != geometry->commands.size() * sizeof(UniformBlockObject)) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    
+    UniformBlockObject* blocks = (UniformBlockObject*)geometry->objectBlocks.data();
+    
+    for (unsigned int i=0; i < geometry->commands.size(); i++)
+        if (blocks[i].model != geometry->commands[i].renderer->transform.matrix) Throw(msgFailedRenderCommands, __FILE__, __LINE__);
+    
+    // Undo the changes so the renderers are destroyed with what they were given
+    renderers[0]->lods.clear();
+    renderers[4]->material = sharedMaterial;
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++)
+        headless->DestroyMeshRenderer(renderers[i]);
+    
+    headless->DestroyMeshRenderer(overlay);
+    headless->DestroyMaterial(sharedMaterial);
+    
+    headless->DestroyCamera(scenePtr->camera);
+    headless->DestroyScene(scenePtr);
+    
+    delete headless;
+    
+    return;
+}
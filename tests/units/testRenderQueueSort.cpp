@@ -0,0 +1,98 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+
+extern RenderSystem Renderer;
+
+
+void TestFramework::TestRenderQueueSort(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Render queue sort....... ";
+    
+    // Radix sort against a stable sort on keys with few distinct values
+    RandomStream random(31);
+    
+    std::vector<RenderQueueItem> items(5000);
+    std::vector<RenderQueueItem> buffer;
+    
+    for (unsigned int i=0; i < items.size(); i++) {
+        uint64_t key = ((uint64_t)(random.Next() % 7) << 61) | ((uint64_t)(random.Next() % 50) << 20) | (random.Next() % 1000);
+        items[i].key = key;
+        items[i].renderer = (MeshRenderer*)(uintptr_t)(i + 1);
+    }
+    
+    std::vector<RenderQueueItem> expected = items;
+    std::stable_sort(expected.begin(), expected.end(), [](const RenderQueueItem& a, const RenderQueueItem& b) {
+        return a.key < b.key;
+    });
+    
+    RenderQueueSort(items, buffer);
+    
+    for (unsigned int i=0; i < items.size(); i++) {
+        if (items[i].key != expected[i].key)           Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+        if (items[i].renderer != expected[i].renderer) Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+    }
+    
+    // Draws sharing state are submitted together
+    const unsigned int numberOfRenderers = 64;
+    
+    Shader* shaderList[2] = {Renderer.shaders.color, Renderer.shaders.colorUnlit};
+    Mesh*   meshList[2]   = {Renderer.meshes.cube, Renderer.meshes.sphere};
+    
+    std::vector<Material*> materials;
+    for (unsigned int m=0; m < 4; m++) {
+        Material* materialPtr = Renderer.CreateMaterial();
+        materialPtr->shader = shaderList[m % 2];
+        materials.push_back(materialPtr);
+    }
+    
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    
+    std::vector<MeshRenderer*> renderers;
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        meshRenderer->material = materials[i % 4];
+        meshRenderer->mesh = meshList[(i / 4) % 2];
+        meshRenderer->DisableFrustumCulling();
+        
+        meshRenderer->transform.position = glm::vec3(0.0f, 0.0f, 5.0f + i);
+        meshRenderer->transform.UpdateMatrix();
+        
+        scenePtr->AddMeshRendererToSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        renderers.push_back(meshRenderer);
+    }
+    
+    IsolateScene(scenePtr);
+    
+    Renderer.RenderFrame();
+    
+    if (Renderer.GetNumberOfDrawCalls() != numberOfRenderers) Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfShaderBinds() != 2)               Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfMaterialBinds() != 4)             Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfMeshBinds() > 8)                  Throw(msgFailedRenderQueueSort, __FILE__, __LINE__);
+    
+    RestoreScenes();
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        renderers[i]->mesh = nullptr;
+        renderers[i]->material = nullptr;
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    for (unsigned int m=0; m < materials.size(); m++)
+        Renderer.DestroyMaterial(materials[m]);
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}
+
@@ -0,0 +1,224 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/ActorAI/SpatialGrid.h>
+#include <GameEngineFramework/Math/Random.h>
+
+// Compare a grid query against a scan over every position
+static bool CompareQuery(std::vector<Actor*> found, std::vector<Actor*> expected) {
+    
+    std::sort(found.begin(), found.end());
+    std::sort(expected.begin(), expected.end());
+    
+    return found == expected;
+}
+
+
+void TestFramework::TestSpatialGrid(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Spatial grid............ ";
+    
+    const unsigned int numberOfActors = 2000;
+    
+    // The grid only stores the pointers
+    std::vector<Actor> actors(numberOfActors);
+    std::vector<glm::vec3> positions(numberOfActors);
+    std::vector<unsigned int> handles(numberOfActors);
+    std::vector<bool> isInGrid(numberOfActors, true);
+    
+    RandomStream random(77);
+    
+    SpatialGrid grid;
+    grid.SetCellSize(10.0f);
+    
+    if (grid.GetCellSize() != 10.0f) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < numberOfActors; i++) {
+        positions[i] = glm::vec3(random.Range(0.0f, 400.0f) - 200.0f, random.Range(0.0f, 20.0f), random.Range(0.0f, 400.0f) - 200.0f);
+        handles[i] = grid.Insert(&actors[i], positions[i]);
+    }
+    
+    for (unsigned int pass=0; pass < 2; pass++) {
+        
+        if (pass == 1) {
+            
+            // Move actors within and across cells, then remove some
+            for (unsigned int i=0; i < numberOfActors; i += 2) {
+                positions[i] += glm::vec3(random.Range(0.0f, 30.0f) - 15.0f, 0, random.Range(0.0f, 30.0f) - 15.0f);
+                grid.Update(handles[i], positions[i]);
+            }
+            
+            for (unsigned int i=0; i < numberOfActors; i += 4) {
+                grid.Remove(handles[i]);
+                isInGrid[i] = false;
+            }
+            
+            // Removed handles are reused
+            for (unsigned int i=0; i < numberOfActors; i += 8) {
+                handles[i] = grid.Insert(&actors[i], positions[i]);
+                isInGrid[i] = true;
+            }
+        }
+        
+        unsigned int numberInGrid = 0;
+        for (unsigned int i=0; i < numberOfActors; i++)
+            if (isInGrid[i]) numberInGrid++;
+        
+        if (grid.GetNumberOfActors() != numberInGrid) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+        
+        for (unsigned int q=0; q < 50; q++) {
+            
+            glm::vec3 center(random.Range(0.0f, 400.0f) - 200.0f, 10.0f, random.Range(0.0f, 400.0f) - 200.0f);
+            float radius = random.Range(0.0f, 40.0f);
+            
+            glm::vec3 min = center - glm::vec3(radius, 5.0f, radius * 0.5f);
+            glm::vec3 max = center + glm::vec3(radius * 0.5f, 5.0f, radius);
+            
+            std::vector<Actor*> expectedRadius;
+            std::vector<Actor*> expectedBounds;
+            
+            for (unsigned int i=0; i < numberOfActors; i++) {
+                if (!isInGrid[i]) continue;
+                
+                glm::vec3 offset = positions[i] - center;
+                if (glm::dot(offset, offset) <= radius * radius)
+                    expectedRadius.push_back(&actors[i]);
+                
+                glm::vec3 position = positions[i];
+                if ((position.x >= min.x) & (position.x <= max.x) &
+                    (position.y >= min.y) & (position.y <= max.y) &
+                    (position.z >= min.z) & (position.z <= max.z))
+                    expectedBounds.push_back(&actors[i]);
+            }
+            
+            std::vector<Actor*> foundRadius;
+            std::vector<Actor*> foundBounds;
+            
+            if (grid.QueryRadius(center, radius, foundRadius) != foundRadius.size()) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+            if (grid.QueryBounds(min, max, foundBounds) != foundBounds.size()) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+            
+            if (!CompareQuery(foundRadius, expectedRadius)) {Throw(msgFailedSpatialGrid, __FILE__, __LINE__); break;}
+            if (!CompareQuery(foundBounds, expectedBounds)) {Throw(msgFailedSpatialGrid, __FILE__, __LINE__); break;}
+        }
+    }
+    
+    grid.Clear();
+    
+    std::vector<Actor*> results;
+    grid.QueryRadius(glm::vec3(0), 1000.0f, results);
+    
+    if ((grid.GetNumberOfActors() != 0) | (results.size() != 0)) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    
+    // The actor system keeps the grid in step at the state exchange
+    ActorSystem actorSystem;
+    actorSystem.SetNumberOfThreads(1);
+    actorSystem.SetSeed(5);
+    
+    Actor* prey = actorSystem.CreateActor();
+    Actor* wolf = actorSystem.CreateActor();
+    Actor* stray = actorSystem.CreateActor();
+    Actor* owl   = actorSystem.CreateActor();
+    
+    prey->SetName("deer");
+    wolf->SetName("wolf");
+    stray->SetName("wolf");
+    owl->SetName("owl");
+    
+    prey->SetPosition(glm::vec3(0, 0, 0));
+    wolf->SetPosition(glm::vec3(5, 0, 0));
+    stray->SetPosition(glm::vec3(100, 0, 100));
+    owl->SetPosition(glm::vec3(100, 0, 105));
+    
+    Actor* list[] = {prey, wolf, stray, owl};
+    for (unsigned int i=0; i < 4; i++) {
+        list[i]->SetActive(true);
+        list[i]->SetTargetPoint(list[i]->GetPosition());
+        list[i]->SetChanceToWalk(0);
+        list[i]->SetChanceToStopWalking(0);
+        list[i]->SetChanceToFocusOnActor(0);
+        list[i]->SetChanceToChangeDirection(0);
+    }
+    
+    prey->SetDistanceToFlee(20);
+    prey->AddFleeFromActor("wolf");
+    
+    wolf->SetDistanceToAttack(20);
+    wolf->AddAttackActor("deer");
+    
+    // The player is out of focus range so the owl watches the closest actor
+    owl->SetChanceToFocusOnActor(10000);
+    
+    actorSystem.UpdateSendSignal();
+    
+    results.clear();
+    actorSystem.GetActorsInRadius(glm::vec3(0), 10.0f, results);
+    if (!CompareQuery(results, std::vector<Actor*>{prey, wolf})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    results.clear();
+    actorSystem.GetActorsInBounds(glm::vec3(90, -1, 90), glm::vec3(110, 1, 110), results);
+    if (!CompareQuery(results, std::vector<Actor*>{stray, owl})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // The prey should run directly away from the wolf
+    actorSystem.Update();
+    actorSystem.UpdateSendSignal();
+    
+    glm::vec3 target = prey->GetTargetPoint();
+    if ((target.x > -19.0f) | (glm::abs(target.z) > 0.01f)) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // The wolf should run down the prey
+    if (wolf->GetTargetPoint() != glm::vec3(0, 0, 0)) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // The owl should watch the stray
+    if (owl->GetTargetPoint() != glm::vec3(100, 0, 100)) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // Inactive and destroyed actors leave the grid
+    wolf->SetActive(false);
+    actorSystem.DestroyActor(stray);
+    actorSystem.UpdateSendSignal();
+    
+    results.clear();
+    actorSystem.GetActorsInRadius(glm::vec3(0), 1000.0f, results);
+    if (!CompareQuery(results, std::vector<Actor*>{prey, owl})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // Main thread changes show up before the next exchange. New and moved
+    // actors are found where they are now and deactivated actors are skipped.
+    Actor* fox = actorSystem.CreateActor();
+    fox->SetPosition(glm::vec3(3, 0, 0));
+    
+    owl->SetActive(false);
+    prey->SetPosition(glm::vec3(500, 0, 500));
+    
+    results.clear();
+    actorSystem.GetActorsInRadius(glm::vec3(0), 10.0f, results);
+    if (!CompareQuery(results, std::vector<Actor*>{fox})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    results.clear();
+    actorSystem.GetActorsInBounds(glm::vec3(490, -1, 490), glm::vec3(510, 1, 510), results);
+    if (!CompareQuery(results, std::vector<Actor*>{prey})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    results.clear();
+    actorSystem.GetActorsInRadius(glm::vec3(0), 1000.0f, results);
+    if (!CompareQuery(results, std::vector<Actor*>{prey, fox})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    // The exchange brings the grid up to date
+    actorSystem.UpdateSendSignal();
+    
+    results.clear();
+    actorSystem.GetActorsInRadius(glm::vec3(0), 1000.0f, results);
+    if (!CompareQuery(results, std::vector<Actor*>{prey, fox})) Throw(msgFailedSpatialGrid, __FILE__, __LINE__);
+    
+    actorSystem.Shutdown();
+    
+    actorSystem.DestroyActor(prey);
+    actorSystem.DestroyActor(wolf);
+    actorSystem.DestroyActor(owl);
+    actorSystem.DestroyActor(fox);
+    
+    return;
+}
@@ -95,3 +95,104 @@ void TestFramework::TestTransform(void) {
 }
 
 
+
+
+// Full chain recompute matching the uncached transform update
+static glm::mat4 RecomputeWorldMatrix(Transform* transform) {
+    glm::vec3 currentPosition = transform->position;
+    glm::quat currentRotation = transform->rotation;
+    glm::vec3 currentScale    = transform->scale;
+    
+    for (Transform* parent = transform->parent; parent != nullptr; parent = parent->parent) {
+        currentPosition = parent->position + currentPosition * parent->rotation;
+        if (parent->inheritParentRotation) currentRotation = parent->rotation * currentRotation;
+        if (parent->inheritParentScale)    currentScale *= parent->scale;
+    }
+    
+    return glm::translate(glm::mat4(1), currentPosition) *
+           glm::toMat4(currentRotation) *
+           glm::scale(glm::mat4(1), currentScale);
+}
+
+void TestFramework::TestTransformHierarchy(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Transform hierarchy..... ";
+    
+    // Three deep chain plus an unrelated root
+    Transform root;
+    Transform child;
+    Transform leaf;
+    Transform other;
+    
+    child.parent = &root;
+    leaf.parent  = &child;
+    
+    root.SetPosition(10.0, 0.0, 5.0);
+    root.RotateAxis(45.0, glm::vec3(0, 1, 0));
+    child.SetPosition(0.0, 2.0, 0.0);
+    child.SetScale(2.0, 2.0, 2.0);
+    leaf.SetPosition(1.0, 0.0, 0.0);
+    other.SetPosition(-4.0, 0.0, 0.0);
+    
+    Transform* transforms[] = {&leaf, &child, &root, &other};
+    unsigned int pass = 0;
+    
+    // First pass builds every matrix
+    pass++;
+    for (unsigned int i=0; i < 4; i++)
+        if (!transforms[i]->UpdateCachedMatrix(pass)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < 4; i++)
+        if (transforms[i]->matrix != RecomputeWorldMatrix(transforms[i])) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Nothing changed so nothing is rebuilt
+    pass++;
+    for (unsigned int i=0; i < 4; i++)
+        if (transforms[i]->UpdateCachedMatrix(pass)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Direct field writes on a parent propagate to the children only
+    root.position = glm::vec3(3.0, 1.0, 3.0);
+    pass++;
+    if (!leaf.UpdateCachedMatrix(pass))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!child.UpdateCachedMatrix(pass)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!root.UpdateCachedMatrix(pass))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (other.UpdateCachedMatrix(pass))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < 4; i++)
+        if (transforms[i]->matrix != RecomputeWorldMatrix(transforms[i])) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // A leaf change leaves its parents untouched
+    leaf.Translate(0.0, 1.0, 0.0);
+    pass++;
+    if (!leaf.UpdateCachedMatrix(pass))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (child.UpdateCachedMatrix(pass))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (leaf.matrix != RecomputeWorldMatrix(&leaf)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Changing the inherit flags or the parent pointer forces a rebuild
+    child.inheritParentRotation = false;
+    other.parent = &leaf;
+    pass++;
+    for (unsigned int i=0; i < 4; i++)
+        if (!transforms[i]->UpdateCachedMatrix(pass) && transforms[i] != &root) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < 4; i++)
+        if (transforms[i]->matrix != RecomputeWorldMatrix(transforms[i])) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Randomized edits against a full recompute every pass
+    for (unsigned int step=0; step < 100; step++) {
+        Transform* target = transforms[step % 4];
+        target->position += glm::vec3(0.25f * (step % 3), -0.5f, 0.125f * step);
+        if ((step % 5) == 0) target->RotateAxis(7.0, glm::vec3(0, 1, 0));
+        if ((step % 7) == 0) target->Scale(1.5, 1.0, 1.0);
+        
+        pass++;
+        for (unsigned int i=0; i < 4; i++)
+            transforms[i]->UpdateCachedMatrix(pass);
+        
+        for (unsigned int i=0; i < 4; i++)
+            if (transforms[i]->matrix != RecomputeWorldMatrix(transforms[i])) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    }
+    
+    return;
+}
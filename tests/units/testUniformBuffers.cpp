@@ -0,0 +1,87 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+
+extern RenderSystem Renderer;
+
+
+void TestFramework::TestUniformBuffers(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Uniform buffers......... ";
+    
+    // Host structures must match the std140 block layouts
+    if (sizeof(UniformBlockCamera) != 96)                                      Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    if (sizeof(UniformBlockObject) != 160)                                     Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    if (sizeof(UniformBlockLights) != 16 + 4 * 16 * RENDER_NUMBER_OF_LIGHTS)   Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    if (sizeof(UniformBlockFog) != 16 + 6 * 16 * RENDER_NUMBER_OF_FOG_LAYERS)  Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    
+    // Draws with lights and fog issue no individual uniform updates
+    const unsigned int numberOfRenderers = 32;
+    
+    Shader* shaderList[4] = {Renderer.shaders.color, Renderer.shaders.colorUnlit, Renderer.shaders.texture, Renderer.shaders.textureUnlit};
+    
+    std::vector<Material*> materials;
+    for (unsigned int m=0; m < 4; m++) {
+        Material* materialPtr = Renderer.CreateMaterial();
+        materialPtr->shader = shaderList[m];
+        materials.push_back(materialPtr);
+    }
+    
+    Scene* scenePtr = Renderer.CreateScene();
+    scenePtr->camera = Renderer.CreateCamera();
+    
+    Light* lightPtr = Renderer.CreateLight();
+    lightPtr->position = glm::vec3(0.0f, 10.0f, 10.0f);
+    scenePtr->AddLightToSceneRoot(lightPtr);
+    
+    Fog* fogPtr = Renderer.CreateFog();
+    scenePtr->AddFogLayerToScene(fogPtr);
+    
+    std::vector<MeshRenderer*> renderers;
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        meshRenderer->material = materials[i % 4];
+        meshRenderer->mesh = Renderer.meshes.cube;
+        meshRenderer->DisableFrustumCulling();
+        
+        meshRenderer->transform.position = glm::vec3(0.0f, 0.0f, 5.0f + i);
+        meshRenderer->transform.UpdateMatrix();
+        
+        scenePtr->AddMeshRendererToSceneRoot(meshRenderer, RENDER_QUEUE_GEOMETRY);
+        renderers.push_back(meshRenderer);
+    }
+    
+    IsolateScene(scenePtr);
+    
+    Renderer.RenderFrame();
+    
+    if (Renderer.GetNumberOfDrawCalls() != numberOfRenderers) Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfShaderBinds() != 4)               Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfUniformUpdates() != 0)            Throw(msgFailedUniformBuffers, __FILE__, __LINE__);
+    
+    RestoreScenes();
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        renderers[i]->mesh = nullptr;
+        renderers[i]->material = nullptr;
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    for (unsigned int m=0; m < materials.size(); m++)
+        Renderer.DestroyMaterial(materials[m]);
+    
+    scenePtr->RemoveLightFromSceneRoot(lightPtr);
+    scenePtr->RemoveFogLayer(fogPtr);
+    Renderer.DestroyLight(lightPtr);
+    Renderer.DestroyFog(fogPtr);
+    
+    Renderer.DestroyCamera(scenePtr->camera);
+    Renderer.DestroyScene(scenePtr);
+    
+    return;
+}